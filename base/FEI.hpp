@@ -518,7 +518,38 @@ class FEI {
                             GlobalID elemID,  
                             const GlobalID* elemConn,
                             const double* elemLoad) = 0;
-     
+
+    /** Element-stiffness/load data loading for a batch of elements from the
+       same element-block. The result is the same as calling 'sumInElem' once
+       per element, but block-level lookups are performed once per batch and
+       contributions to each equation are handed on once per batch rather than
+       once per element.
+       @param elemBlockID Which element-block the elements belong to.
+       @param numElems Number of elements in the batch.
+       @param elemIDs List of length numElems.
+       @param elemConn Packed connectivity lists, numElems * nodes-per-element.
+       @param elemStiffness Packed element-stiffness data, numElems dense
+             tables each of size n X n, where n is the number of equations per
+             element. May be NULL if only loads are being supplied.
+       @param elemLoads Packed element-load vectors, numElems * n. May be NULL
+             if only stiffnesses are being supplied.
+       @param elemFormat Layout of each element-stiffness table.
+              FEI_DENSE_ROW and FEI_DENSE_COL are always valid. When the
+              underlying solver is a FiniteElementData, the symmetric formats
+              are also accepted, each table then holding n*(n+1)/2 entries
+              stored row after row (or column after column).
+       @return error-code 0 if successful, -1 if not supported by this
+       implementation.
+   */
+   virtual int sumInElemBlockMatrix(GlobalID /*elemBlockID*/,
+                                    int /*numElems*/,
+                                    const GlobalID* /*elemIDs*/,
+                                    const GlobalID* /*elemConn*/,
+                                    const double* /*elemStiffness*/,
+                                    const double* /*elemLoads*/,
+                                    int /*elemFormat*/)
+    { return -1; }
+
     /** Load weight/value data for a Lagrange Multiplier constraint relation.
        @param CRMultID Identifier returned from an earlier call to 'initCRMult'.
        @param numCRNodes Length of CRNodeIDs and CRFieldIDs lists.
@@ -661,6 +661,29 @@ int FEI_Implementation::sumInElemRHS(GlobalID elemBlockID,
    return(0);
 }
 
+//------------------------------------------------------------------------------
+int FEI_Implementation::sumInElemBlockMatrix(GlobalID elemBlockID,
+                        int numElems,
+                        const GlobalID* elemIDs,
+                        const GlobalID* elemConn,
+                        const double* elemStiffness,
+                        const double* elemLoads,
+                        int elemFormat)
+{
+  if (!internalFEIsAllocated_) {
+    notAllocatedAbort("FEI_Implementation::sumInElemBlockMatrix");
+  }
+
+  CHK_ERR( filter_[index_current_filter_]->sumInElemBlockMatrix(elemBlockID,
+                                          numElems, elemIDs, elemConn,
+                                          elemStiffness, elemLoads,
+                                          elemFormat) );
+
+  newMatrixDataLoaded_ = 1;
+
+  return(0);
+}
+
 //------------------------------------------------------------------------------
 int FEI_Implementation::loadCRMult(int CRID,
                                    int numCRNodes,
@@ -1328,13 +1351,13 @@ int FEI_Implementation::getLocalNodeIDList(int& numNodes,
                                            GlobalID* nodeIDs,
                                            int lenNodeIDs)
 {
-  std::map<GlobalID,int>& nodes =
+  const std::vector<GlobalID>& nodes =
     problemStructure_->getNodeDatabase().getNodeIDs();
   numNodes = nodes.size();
   int len = numNodes;
   if (lenNodeIDs < len) len = lenNodeIDs;
 
-  fei::copyKeysToArray(nodes, len, nodeIDs);
+  std::copy(nodes.begin(), nodes.begin()+len, nodeIDs);
 
   return( 0 );
 }
@@ -395,6 +395,17 @@ class FEI_Implementation : public FEI {
                     const GlobalID* elemConn,
                     const double* elemLoad);
 
+    /** Element-stiffness/load data loading for a batch of elements from the
+       same element-block. See FEI::sumInElemBlockMatrix.
+   */
+   int sumInElemBlockMatrix(GlobalID elemBlockID,
+                            int numElems,
+                            const GlobalID* elemIDs,
+                            const GlobalID* elemConn,
+                            const double* elemStiffness,
+                            const double* elemLoads,
+                            int elemFormat);
+
     /** Load weight/value data for a Lagrange Multiplier constraint relation.
        @param CRID Identifier returned from an earlier call to 'initCRMult'.
        @param numCRNodes Length of CRNodeIDs and CRFieldIDs lists.
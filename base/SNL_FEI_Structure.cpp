@@ -11,11 +11,13 @@
 
 #include <limits>
 #include <cmath>
+#include <algorithm>
 #include <assert.h>
 
 #include "fei_defs.h"
 
 #include "fei_TemplateUtils.hpp"
+#include <fei_impl_utils.hpp>
 #include <fei_CommUtils.hpp>
 #include "snl_fei_Constraint.hpp"
 typedef snl_fei::Constraint<GlobalID> ConstraintType;
@@ -96,9 +98,12 @@ SNL_FEI_Structure::SNL_FEI_Structure(MPI_Comm comm)
    rSlave_(),
    cSlave_(),
    work_nodePtrs_(),
+   cacheScatterIndices_(false),
    structureFinalized_(false),
    generateGraph_(true),
    sysMatIndices_(NULL),
+   sysMatRowOffsets_(),
+   sysMatColIndices_(),
    blockMatrix_(false),
    numGlobalEqnBlks_(0),
    numLocalEqnBlks_(0),
@@ -170,6 +175,11 @@ int SNL_FEI_Structure::parameters(int numParams, const char*const* paramStrings)
     checkSharedNodes_ = true;
   }
 
+  param = snl_fei::getParam("FEI_CACHE_SCATTER_INDICES", numParams,paramStrings);
+  if (param != NULL){
+    cacheScatterIndices_ = true;
+  }
+
   param = snl_fei::getParamValue("sharedNodeOwnership",
 					numParams,paramStrings);
   if (param != NULL){
@@ -267,6 +277,9 @@ void SNL_FEI_Structure::destroyMatIndices()
   delete [] sysMatIndices_;
   sysMatIndices_ = NULL;
 
+  std::vector<int>().swap(sysMatRowOffsets_);
+  std::vector<int>().swap(sysMatColIndices_);
+
   delete [] sysBlkMatIndices_;
   sysBlkMatIndices_ = NULL;
 
@@ -899,7 +912,7 @@ int SNL_FEI_Structure::initComplete(bool generateGraph)
   //  space, where they are called reducedStartRow_ and reducedEndRow_, after
   //  which we know how many local equations there are not including any
   //  slave equations. At this point we can allocate the sysMatIndices_ array
-  //  of arrays, which will hold the point-entry matrix structure.
+  //  of sets, which will accumulate the point-entry matrix structure.
   //
   //10. formMatrixStructure()
   //  - initElemBlockStructure() for each element in each element-block,
@@ -914,6 +927,9 @@ int SNL_FEI_Structure::initComplete(bool generateGraph)
   //    contributions to the processors that own the corresponding equations,
   //    after which the receiving processors insert those contributions into
   //    the local matrix structure.
+  //  - packMatrixStructure() copies the sets into one packed CSR array
+  //    (sysMatRowOffsets_/sysMatColIndices_), releasing each set as it goes.
+  //    getMatrixStructure serves pointers into that array.
   //
   //11. initializeBlkEqnMapper() run all nodes, elem-dof, multiplier constraints
   //  and pass global point-equation-numbers with corresponding block-equation
@@ -1139,6 +1155,8 @@ int SNL_FEI_Structure::formMatrixStructure()
     }
   }
 
+  if (generateGraph_) packMatrixStructure();
+
   if (debugOutput_) {
     os << "#  leaving formMatrixStructure" << FEI_ENDL;
   }
@@ -1146,6 +1164,32 @@ int SNL_FEI_Structure::formMatrixStructure()
   return(0);
 }
 
+//------------------------------------------------------------------------------
+void SNL_FEI_Structure::packMatrixStructure()
+{
+  //Count-then-fill: the row lengths give the CSR row-offsets, then each
+  //row's set is copied into its slot and released, so the sets and the
+  //packed copy of any one row don't coexist for long.
+
+  sysMatRowOffsets_.assign(numLocalReducedRows_+1, 0);
+  for(int i=0; i<numLocalReducedRows_; ++i) {
+    sysMatRowOffsets_[i+1] = sysMatRowOffsets_[i] + sysMatIndices_[i].size();
+  }
+
+  sysMatColIndices_.resize(sysMatRowOffsets_[numLocalReducedRows_]);
+  for(int i=0; i<numLocalReducedRows_; ++i) {
+    int rowLength = sysMatRowOffsets_[i+1] - sysMatRowOffsets_[i];
+    if (rowLength > 0) {
+      sysMatIndices_[i].copy_to_array(rowLength,
+                                      &sysMatColIndices_[sysMatRowOffsets_[i]]);
+    }
+    sysMatIndices_[i].clear();
+  }
+
+  delete [] sysMatIndices_;
+  sysMatIndices_ = NULL;
+}
+
 //------------------------------------------------------------------------------
 int SNL_FEI_Structure::initElemBlockStructure()
 {
@@ -1172,6 +1216,17 @@ int SNL_FEI_Structure::initElemBlockStructure()
     block->setNumElements(elemIDList.size());
     int numBlockElems = block->getNumElements();
 
+    //if caching is enabled for this block, the scatter-indices are computed
+    //once here and the loop below is then served from the cache.
+    connTable.scatterInterleave = -1;
+    if (cacheScatterIndices_ || connTable.cacheScatterIndices) {
+      CHK_ERR( initScatterIndexCache(bIndex) );
+      if (debugOutput_) {
+        os << "#        block " << bIndex << ", scatter-index cache bytes: "
+           << getScatterIndexCacheMemory(elemBlockID) << FEI_ENDL;
+      }
+    }
+
     //loop over all the elements, determining the elemental (both from nodes 
     //and from element DOF) contributions to the sparse matrix structure
     if (debugOutput_) {
@@ -1196,15 +1251,75 @@ int SNL_FEI_Structure::initElemBlockStructure()
   return(FEI_SUCCESS);
 }
 
+//------------------------------------------------------------------------------
+int SNL_FEI_Structure::initScatterIndexCache(int blockIndex)
+{
+  BlockDescriptor& block = *(blocks_[blockIndex]);
+  ConnectivityTable& connTable = *(connTables_[blockIndex]);
+
+  int interleave = block.getInterleaveStrategy();
+  int numEqns = block.getNumEqnsPerElement();
+  int numBlkEqns = block.getNumBlkEqnsPerElement();
+  int numElems = connTable.elemIDs.size();
+
+  connTable.scatterInterleave = -1;
+  if (numEqns <= 0 || numBlkEqns <= 0) return(FEI_SUCCESS);
+
+  connTable.numScatterIndicesPerElem = numEqns;
+  connTable.numBlkScatterIndicesPerElem = numBlkEqns;
+  connTable.scatterIndices.assign(numElems*numEqns, -1);
+  connTable.blkScatterIndices.assign(numElems*numBlkEqns, -1);
+  connTable.blkScatterSizes.assign(numElems*numBlkEqns, 0);
+
+  for(int elemIndex=0; elemIndex<numElems; ++elemIndex) {
+    int* indices = &connTable.scatterIndices[elemIndex*numEqns];
+    int* blkIndices = &connTable.blkScatterIndices[elemIndex*numBlkEqns];
+    int* blkSizes = &connTable.blkScatterSizes[elemIndex*numBlkEqns];
+
+    getScatterIndices_index(blockIndex, elemIndex, interleave,
+                            indices, blkIndices, blkSizes);
+  }
+
+  connTable.scatterInterleave = interleave;
+
+  return(FEI_SUCCESS);
+}
+
+//------------------------------------------------------------------------------
+int SNL_FEI_Structure::setScatterIndexCaching(GlobalID blockID,
+                                              bool cacheScatterIndices)
+{
+  int index = fei::binarySearch(blockID, blockIDs_);
+  if (index < 0) ERReturn(-1);
+
+  connTables_[index]->cacheScatterIndices = cacheScatterIndices;
+  return(FEI_SUCCESS);
+}
+
+//------------------------------------------------------------------------------
+size_t SNL_FEI_Structure::getScatterIndexCacheMemory(GlobalID blockID) const
+{
+  int index = fei::binarySearch(blockID, blockIDs_);
+  if (index < 0) return(0);
+
+  const ConnectivityTable& connTable = *(connTables_[index]);
+  if (connTable.scatterInterleave < 0) return(0);
+
+  return( (connTable.scatterIndices.capacity()
+          + connTable.blkScatterIndices.capacity()
+          + connTable.blkScatterSizes.capacity())*sizeof(int) );
+}
+
 //------------------------------------------------------------------------------
 int SNL_FEI_Structure::getMatrixRowLengths(std::vector<int>& rowLengths)
 {
   if (!structureFinalized_) return(-1);
 
-  rowLengths.resize(numLocalReducedRows_);
+  rowLengths.assign(numLocalReducedRows_, 0);
+  if (sysMatRowOffsets_.empty()) return(0);
 
   for(int i=0; i<numLocalReducedRows_; i++) {
-    rowLengths[i] = sysMatIndices_[i].size();
+    rowLengths[i] = sysMatRowOffsets_[i+1] - sysMatRowOffsets_[i];
   }
   return(0);
 }
@@ -1213,20 +1328,37 @@ int SNL_FEI_Structure::getMatrixRowLengths(std::vector<int>& rowLengths)
 int SNL_FEI_Structure::getMatrixStructure(int** indices,
 					 std::vector<int>& rowLengths)
 {
-  if (!structureFinalized_) return(-1);
+  if (getMatrixRowLengths(rowLengths) != 0) return(-1);
+
+  for(int i=0; i<numLocalReducedRows_; i++) {
+    if (rowLengths[i] > 0) {
+      const int* cols = &sysMatColIndices_[sysMatRowOffsets_[i]];
+      std::copy(cols, cols+rowLengths[i], indices[i]);
+    }
+  }
+
+  return(0);
+}
+
+//------------------------------------------------------------------------------
+int SNL_FEI_Structure::getMatrixStructure(std::vector<int*>& colIndices,
+					 std::vector<int>& rowLengths)
+{
+  if (getMatrixRowLengths(rowLengths) != 0) return(-1);
 
-  rowLengths.resize(numLocalReducedRows_);
+  colIndices.assign(numLocalReducedRows_, (int*)NULL);
+  if (sysMatColIndices_.empty()) return(0);
 
+  int* cols = &sysMatColIndices_[0];
   for(int i=0; i<numLocalReducedRows_; i++) {
-    rowLengths[i] = sysMatIndices_[i].size();
-    fei::copySetToArray(sysMatIndices_[i], rowLengths[i], indices[i]);
+    colIndices[i] = cols + sysMatRowOffsets_[i];
   }
 
   return(0);
 }
 
 //------------------------------------------------------------------------------
-int SNL_FEI_Structure::getMatrixStructure(int** ptColIndices,
+int SNL_FEI_Structure::getMatrixStructure(std::vector<int*>& ptColIndices,
 					 std::vector<int>& ptRowLengths,
 					 int** blkColIndices,
 					  int* blkIndices_1D,
@@ -1256,20 +1388,21 @@ int SNL_FEI_Structure::getMatrixStructure(int** ptColIndices,
     //There are block-equations with more than 1 point-equation, so let's
     //calculate the actual block-structure.
 
-    std::map<int,int>* ptEqns = blkEqnMapper_->getPtEqns();
+    std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>* ptEqns =
+      blkEqnMapper_->getPtEqns();
     int numPtEqns = ptEqns->size();
 
-    std::map<int,int>::const_iterator
+    std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>::const_iterator
       pteq = ptEqns->begin();
 
     int lastBlkRow = -1;
 
     for(int jj=0; jj<numPtEqns; ++jj, ++pteq) {
-      int ptEqn = (*pteq).first;
+      int ptEqn = fei::impl_utils::int_index((*pteq).first);
       int localPtEqn = ptEqn - reducedStartRow_;
       if (localPtEqn < 0 || localPtEqn >= numLocalReducedRows_) continue;
 
-      int rowLength = sysMatIndices_[localPtEqn].size();
+      int rowLength = ptRowLengths[localPtEqn];
 
       int blkRow = blkEqnMapper_->eqnToBlkEqn(ptEqn);
       if (blkRow < 0) {
@@ -2115,10 +2248,11 @@ int SNL_FEI_Structure::translateToReducedEqns(EqnBuffer& eqnBuf)
     translateToReducedEqn(eqnNumbers[i], reducedEqn);
     eqnNumbers[i] = reducedEqn;
 
-    int* indicesPtr = &(eqnArray[i]->indices()[0]);
+    fei::GlobalOrdinal* indicesPtr = &(eqnArray[i]->indices()[0]);
     int numIndices = eqnArray[i]->size();
     for(int j=0; j<numIndices; ++j) {
-      translateToReducedEqn(indicesPtr[j], reducedEqn);
+      translateToReducedEqn(fei::impl_utils::int_index(indicesPtr[j]),
+                            reducedEqn);
       indicesPtr[j] = reducedEqn;
     }
   }
@@ -2157,16 +2291,20 @@ int SNL_FEI_Structure::translateMatToReducedEqns(fei::CSRMat& mat)
 
   fei::SparseRowGraph& srg = mat.getGraph();
 
-  std::vector<int>& rowNumbers = srg.rowNumbers;
+  std::vector<fei::GlobalOrdinal>& rowNumbers = srg.rowNumbers;
   for(size_t i=0; i<rowNumbers.size(); ++i) {
-    bool isSlave = translateToReducedEqn(rowNumbers[i], reducedEqn);
+    bool isSlave =
+      translateToReducedEqn(fei::impl_utils::int_index(rowNumbers[i]),
+                            reducedEqn);
     if (isSlave) foundSlave = 1;
     else rowNumbers[i] = reducedEqn;
   }
 
-  std::vector<int>& colIndices = srg.packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& colIndices = srg.packedColumnIndices;
   for(size_t i=0; i<colIndices.size(); ++i) {
-    bool isSlave = translateToReducedEqn(colIndices[i], reducedEqn);
+    bool isSlave =
+      translateToReducedEqn(fei::impl_utils::int_index(colIndices[i]),
+                            reducedEqn);
     if (isSlave) foundSlave = 1;
     else colIndices[i] = reducedEqn;
   }
@@ -2188,18 +2326,20 @@ int SNL_FEI_Structure::createMatrixPositions(fei::CSRMat& mat)
   //call 'createMatrixPosition' to make an entry in the global matrix structure
   //if it doesn't already exist.
   //
-  const std::vector<int>& rowNumbers = mat.getGraph().rowNumbers;
+  const std::vector<fei::GlobalOrdinal>& rowNumbers = mat.getGraph().rowNumbers;
   const std::vector<int>& rowOffsets = mat.getGraph().rowOffsets;
-  const std::vector<int>& pckColInds = mat.getGraph().packedColumnIndices;
+  const std::vector<fei::GlobalOrdinal>& pckColInds =
+    mat.getGraph().packedColumnIndices;
 
   for(size_t i=0; i<rowNumbers.size(); ++i) {
-    int row = rowNumbers[i];
+    int row = fei::impl_utils::int_index(rowNumbers[i]);
     int offset = rowOffsets[i];
     int rowlen = rowOffsets[i+1]-offset;
-    const int* indices = &pckColInds[offset];
+    const fei::GlobalOrdinal* indices = &pckColInds[offset];
 
     for(int j=0; j<rowlen; j++) {
-      CHK_ERR( createMatrixPosition(row, indices[j], "crtMatPos(CSRMat)") );
+      CHK_ERR( createMatrixPosition(row, fei::impl_utils::int_index(indices[j]),
+                                    "crtMatPos(CSRMat)") );
     }
   }
 
@@ -2326,13 +2466,11 @@ int SNL_FEI_Structure::initializeBlkEqnMapper()
 
   int eqnNumber, blkEqnNumber;
 
-  std::map<GlobalID,int>& nodeIDmap = nodeDatabase_->getNodeIDs();
-  std::map<GlobalID,int>::iterator
-    iter = nodeIDmap.begin(), iter_end = nodeIDmap.end();
+  int numNodes = nodeDatabase_->getNumNodeDescriptors();
 
-  for(; iter!=iter_end; ++iter) {
+  for(int i=0; i<numNodes; ++i) {
     NodeDescriptor* node = NULL;
-    nodeDatabase_->getNodeAtIndex(iter->second, node);
+    nodeDatabase_->getNodeAtIndex(i, node);
 
     // If the node doesn't exist, skip.
     if (node==NULL) continue;
@@ -2512,13 +2650,11 @@ int SNL_FEI_Structure::writeEqn2NodeMap()
     ++cr_iter;
   }
 
-  std::map<GlobalID,int>& nodeIDmap = nodeDatabase_->getNodeIDs();
-  std::map<GlobalID,int>::iterator
-    iter = nodeIDmap.begin(), iter_end = nodeIDmap.end();
+  int numNodes = nodeDatabase_->getNumNodeDescriptors();
 
-  for(; iter!=iter_end; ++iter) {
+  for(int i=0; i<numNodes; ++i) {
     NodeDescriptor* node = NULL;
-    nodeDatabase_->getNodeAtIndex(iter->second, node);
+    nodeDatabase_->getNodeAtIndex(i, node);
 
     if (node==NULL || node->getOwnerProc() != localProc_) {
       continue;
@@ -2732,13 +2868,11 @@ int SNL_FEI_Structure::setNodalEqnInfo()
   //localBlkOffset_ is 0-based, and so is blkEqnNumber.
   int blkEqnNumber = localBlkOffset_;
 
-  std::map<GlobalID,int>& nodeIDmap = nodeDatabase_->getNodeIDs();
-  std::map<GlobalID,int>::iterator
-    iter = nodeIDmap.begin(), iter_end = nodeIDmap.end();
+  int numNodes = nodeDatabase_->getNumNodeDescriptors();
 
-  for(; iter!=iter_end; ++iter) {
+  for(int i=0; i<numNodes; ++i) {
     NodeDescriptor* node = NULL;
-    nodeDatabase_->getNodeAtIndex(iter->second, node);
+    nodeDatabase_->getNodeAtIndex(i, node);
 
     if (node==NULL) continue;
 
@@ -3056,7 +3190,8 @@ int SNL_FEI_Structure::finalizeNodeCommMgr()
 
   if (safetyCheck && localProc_==0 && numProcs_>1 && outputLevel_>0) {
     FEI_COUT << "FEI Info: A consistency-check of shared-node data will be "
-	 << "performed, which involves all-to-all communication. This check is "
+	 << "performed, which involves global reductions and communication "
+	 << "with each neighboring processor. This check is "
 	 << "done only if explicitly requested by parameter "
          << "'FEI_CHECK_SHARED_IDS'."<<FEI_ENDL;
   }
@@ -3554,7 +3689,7 @@ int SNL_FEI_Structure::removeCouplings(EqnBuffer& eqnbuf, int& levelsOfCoupling)
 	CHK_ERR( eqnbuf.getCoefAndRemoveIndex( eqnNumbers[rowIndex],
 					       eqnNumbers[i], coef) );
 
-	std::vector<int>& indicesRef = eqns[i]->indices();
+	std::vector<fei::GlobalOrdinal>& indicesRef = eqns[i]->indices();
 	std::vector<double>& coefsRef = eqns[i]->coefs();
 
 	int len = indicesRef.size();
@@ -3564,10 +3699,10 @@ int SNL_FEI_Structure::removeCouplings(EqnBuffer& eqnbuf, int& levelsOfCoupling)
 	double* tempCoefsPtr = &tempCoefs[0];
 	int* tempIndicesPtr = &tempIndices[0];
 	double* coefsPtr = &coefsRef[0];
-	int* indicesPtr = &indicesRef[0];
+	fei::GlobalOrdinal* indicesPtr = &indicesRef[0];
 
 	for(int j=0; j<len; ++j) {
-	  tempIndicesPtr[j] = indicesPtr[j];
+	  tempIndicesPtr[j] = fei::impl_utils::int_index(indicesPtr[j]);
 	  tempCoefsPtr[j] = coef*coefsPtr[j];
 	}
 
@@ -3698,7 +3833,7 @@ int SNL_FEI_Structure::translateFromReducedEqn(int reducedEqn)
 
 //------------------------------------------------------------------------------
 int SNL_FEI_Structure::getMasterEqnNumbers(int slaveEqn,
-					  std::vector<int>*& masterEqns)
+                               std::vector<fei::GlobalOrdinal>*& masterEqns)
 {
   if (slaveEqns_->getNumEqns() == 0) {
     masterEqns = NULL;
@@ -3855,6 +3990,14 @@ void SNL_FEI_Structure::getScatterIndices_index(int blockIndex, int elemIndex,
 //On input, scatterIndices, is assumed to be allocated by the calling code,
 // and be of length the number of equations per element.
 //
+   const ConnectivityTable& connTable = *(connTables_[blockIndex]);
+   if (connTable.scatterInterleave == interleaveStrategy) {
+     int numEqns = connTable.numScatterIndicesPerElem;
+     const int* cached = &connTable.scatterIndices[elemIndex*numEqns];
+     std::copy(cached, cached+numEqns, scatterIndices);
+     return;
+   }
+
    BlockDescriptor& block = *(blocks_[blockIndex]);
    int numNodes = block.getNumNodesPerElement();
    int* fieldsPerNode = block.fieldsPerNodePtr();
@@ -3915,6 +4058,20 @@ void SNL_FEI_Structure::getScatterIndices_index(int blockIndex, int elemIndex,
 //On input, scatterIndices, is assumed to be allocated by the calling code,
 // and be of length the number of equations per element.
 //
+   const ConnectivityTable& connTable = *(connTables_[blockIndex]);
+   if (connTable.scatterInterleave == interleaveStrategy) {
+     int numEqns = connTable.numScatterIndicesPerElem;
+     const int* cached = &connTable.scatterIndices[elemIndex*numEqns];
+     std::copy(cached, cached+numEqns, scatterIndices);
+
+     int numBlkEqns = connTable.numBlkScatterIndicesPerElem;
+     const int* cachedBlk = &connTable.blkScatterIndices[elemIndex*numBlkEqns];
+     const int* cachedSizes = &connTable.blkScatterSizes[elemIndex*numBlkEqns];
+     std::copy(cachedBlk, cachedBlk+numBlkEqns, blkScatterIndices);
+     std::copy(cachedSizes, cachedSizes+numBlkEqns, blkSizes);
+     return;
+   }
+
    BlockDescriptor& block = *(blocks_[blockIndex]);
    int numNodes = block.getNumNodesPerElement();
    int* fieldsPerNode = block.fieldsPerNodePtr();
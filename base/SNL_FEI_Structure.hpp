@@ -239,6 +239,21 @@ class SNL_FEI_Structure : public Lookup {
 			     int* blkScatterIndices,
 				int* blkSizes);
 
+   /** Specify whether the scatter-indices for every element in the given
+       block should be computed once (during initComplete) and held in a flat
+       table, from which later getScatterIndices_* requests are served. This
+       may also be enabled for all blocks with the parameter
+       "FEI_CACHE_SCATTER_INDICES". Must be called before initComplete.
+       @return 0 if successful, -1 if blockID not found.
+   */
+   int setScatterIndexCaching(GlobalID blockID, bool cacheScatterIndices);
+
+   /** Return the number of bytes held by the cached scatter-index table for
+       the given block (0 if caching isn't enabled for that block, or
+       initComplete hasn't been called yet).
+   */
+   size_t getScatterIndexCacheMemory(GlobalID blockID) const;
+
 
    /////////////////////////////////////////////////////////////////////////////
    //now the shared-node lookup functions from the Lookup interface.
@@ -327,7 +342,7 @@ class SNL_FEI_Structure : public Lookup {
 
    NodeDatabase& getNodeDatabase() { return( *nodeDatabase_ ); }
 
-   std::map<GlobalID,int>& getActiveNodeIDList()
+   const std::vector<GlobalID>& getActiveNodeIDList()
      { return( nodeDatabase_->getNodeIDs() ); }
 
    std::vector<int>& getGlobalNodeOffsets() {return(globalNodeOffsets_);}
@@ -454,7 +469,8 @@ class SNL_FEI_Structure : public Lookup {
        @param masterEqns Output. NULL if slaveEqn is not a slave equation.
        @return error-code
    */
-   int getMasterEqnNumbers(int slaveEqn, std::vector<int>*& masterEqns);
+   int getMasterEqnNumbers(int slaveEqn,
+                           std::vector<fei::GlobalOrdinal>*& masterEqns);
 
    /** Given a slave equation, fill a std::vector with the
        coefficients of the equations upon which the slave depends.
@@ -491,7 +507,18 @@ class SNL_FEI_Structure : public Lookup {
    int getMatrixRowLengths(std::vector<int>& rowLengths);
    int getMatrixStructure(int** colIndices, std::vector<int>& rowLengths);
 
-   int getMatrixStructure(int** ptColIndices, std::vector<int>& ptRowLengths,
+   /** Obtain the local point-entry matrix structure without copying it.
+       On return, colIndices[i] points at the sorted column-indices for local
+       reduced row i, which are stored in one packed (CSR) array owned by this
+       object. The pointers remain valid until destroyMatIndices() is called.
+       @return error-code 0 if successful, -1 if initComplete hasn't been
+       called.
+   */
+   int getMatrixStructure(std::vector<int*>& colIndices,
+                          std::vector<int>& rowLengths);
+
+   int getMatrixStructure(std::vector<int*>& ptColIndices,
+                          std::vector<int>& ptRowLengths,
 			  int** blkColIndices, int* blkIndices_1D,
 			  std::vector<int>& blkRowLengths,
 			  std::vector<int>& numPtRowsPerBlkRow);
@@ -575,8 +602,10 @@ class SNL_FEI_Structure : public Lookup {
    bool activeNodesInitialized();
 
    int formMatrixStructure();
+   void packMatrixStructure();
 
    int initElemBlockStructure();
+   int initScatterIndexCache(int blockIndex);
    int initMultCRStructure();
    int initPenCRStructure();
    int createMatrixPosition(int row, int col, const char* callingFunction);
@@ -676,12 +705,20 @@ class SNL_FEI_Structure : public Lookup {
    int reducedEqnCounter_, reducedRHSCounter_;
    std::vector<int> rSlave_, cSlave_;
    std::vector<NodeDescriptor*> work_nodePtrs_;
+   bool cacheScatterIndices_;
 
    bool structureFinalized_;
    bool generateGraph_;
 
    fei::ctg_set<int>* sysMatIndices_;
 
+   //sysMatIndices_ is only used while the structure is being formed. After
+   //that it is packed into CSR form: the column-indices for local reduced
+   //row i are sysMatColIndices_[sysMatRowOffsets_[i] ...
+   //sysMatRowOffsets_[i+1]-1].
+   std::vector<int> sysMatRowOffsets_;
+   std::vector<int> sysMatColIndices_;
+
    bool blockMatrix_;
    int numGlobalEqnBlks_;
    int numLocalEqnBlks_;
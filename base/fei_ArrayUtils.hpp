@@ -78,10 +78,12 @@ namespace fei {
   /** sort the specified array, and move the contents
     of the specified companions array to match the new order.
     This is an implementation of the insertion sort algorithm. */
-  template<typename T>
-  inline void insertion_sort_with_companions(int len, int* array, T* companions)
+  template<typename T, typename Index>
+  inline void insertion_sort_with_companions(int len, Index* array,
+                                             T* companions)
     {
-      int i, j, index;
+      int i, j;
+      Index index;
       T companion;
 
       for (i=1; i < len; i++) {
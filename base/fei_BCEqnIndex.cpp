@@ -0,0 +1,342 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_BCEqnIndex.hpp>
+
+#include <utility>
+
+namespace {
+
+//number of set bits in a 32-bit word.
+inline unsigned count_bits(unsigned word)
+{
+  word = word - ((word >> 1) & 0x55555555u);
+  word = (word & 0x33333333u) + ((word >> 2) & 0x33333333u);
+  return( (((word + (word >> 4)) & 0x0F0F0F0Fu) * 0x01010101u) >> 24 );
+}
+
+}//namespace <anonymous>
+
+namespace fei {
+
+//----------------------------------------------------------------------------
+BCEqnIndex::BCEqnIndex()
+ : firstLocalEqn_(0),
+   lastLocalEqn_(-1),
+   localBits_(),
+   localValues_(),
+   localRanks_(),
+   ranksValid_(false),
+   lastInsertedLocal_(-1),
+   remoteEqns_(),
+   remoteValues_(),
+   pendingEqns_(),
+   pendingValues_(),
+   valuesSorted_(true)
+{
+}
+
+//----------------------------------------------------------------------------
+BCEqnIndex::~BCEqnIndex()
+{
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::setLocalRange(GlobalOrdinal firstLocalEqn,
+                               GlobalOrdinal lastLocalEqn)
+{
+  firstLocalEqn_ = firstLocalEqn;
+  lastLocalEqn_ = lastLocalEqn;
+
+  size_t numWords = 0;
+  if (lastLocalEqn_ >= firstLocalEqn_) {
+    unsigned numLocal = lastLocalEqn_ - firstLocalEqn_ + 1;
+    numWords = (numLocal+BITS_PER_WORD-1)/BITS_PER_WORD;
+  }
+
+  //the bitset is reused if the range has the same length, clear() zeros it.
+  if (numWords != localBits_.size()) {
+    std::vector<unsigned>(numWords, 0u).swap(localBits_);
+  }
+
+  clear();
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::insert(GlobalOrdinal eqn, double value)
+{
+  //bc eqns usually arrive in increasing order, in which case the value is
+  //appended and nothing needs to be merged.
+  if (eqn >= firstLocalEqn_ && eqn <= lastLocalEqn_) {
+    if (eqn > lastInsertedLocal_) {
+      unsigned offset = eqn - firstLocalEqn_;
+      localBits_[offset/BITS_PER_WORD] |= 1u << (offset%BITS_PER_WORD);
+      localValues_.push_back(value);
+      lastInsertedLocal_ = eqn;
+      ranksValid_ = false;
+      return;
+    }
+
+    if (eqn == lastInsertedLocal_) {
+      localValues_.back() = value;
+      return;
+    }
+  }
+  else {
+    if (remoteEqns_.empty() || eqn > remoteEqns_.back()) {
+      remoteEqns_.push_back(eqn);
+      remoteValues_.push_back(value);
+      return;
+    }
+
+    if (eqn == remoteEqns_.back()) {
+      remoteValues_.back() = value;
+      return;
+    }
+  }
+
+  //out-of-order, sortValues() will merge it in when next queried.
+  pendingEqns_.push_back(eqn);
+  pendingValues_.push_back(value);
+  valuesSorted_ = false;
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::assign(GlobalOrdinal firstLocalEqn,
+                        GlobalOrdinal lastLocalEqn,
+                        int numEqns, const GlobalOrdinal* eqns,
+                        const double* values)
+{
+  setLocalRange(firstLocalEqn, lastLocalEqn);
+
+  for(int i=0; i<numEqns; ++i) {
+    GlobalOrdinal eqn = eqns[i];
+    if (eqn < firstLocalEqn_ || eqn > lastLocalEqn_) {
+      remoteEqns_.push_back(eqn);
+      remoteValues_.push_back(values[i]);
+      continue;
+    }
+
+    unsigned offset = eqn - firstLocalEqn_;
+    localBits_[offset/BITS_PER_WORD] |= 1u << (offset%BITS_PER_WORD);
+    localValues_.push_back(values[i]);
+    lastInsertedLocal_ = eqn;
+  }
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::sortValues() const
+{
+  if (valuesSorted_) return;
+
+  //sort on (eqn, insertion-position) so that for duplicate eqns the most
+  //recently inserted value is the last one in its run.
+  size_t len = pendingEqns_.size();
+  std::vector<std::pair<GlobalOrdinal,size_t> > order(len);
+  for(size_t i=0; i<len; ++i) {
+    order[i] = std::make_pair(pendingEqns_[i], i);
+  }
+  std::sort(order.begin(), order.end());
+
+  std::vector<GlobalOrdinal> localEqns, remoteEqns;
+  std::vector<double> localValues, remoteValues;
+
+  for(size_t i=0; i<len; ++i) {
+    if (i+1 < len && order[i+1].first == order[i].first) continue;
+    GlobalOrdinal eqn = order[i].first;
+    double value = pendingValues_[order[i].second];
+    if (eqn >= firstLocalEqn_ && eqn <= lastLocalEqn_) {
+      localEqns.push_back(eqn);
+      localValues.push_back(value);
+    }
+    else {
+      remoteEqns.push_back(eqn);
+      remoteValues.push_back(value);
+    }
+  }
+
+  pendingEqns_.clear();
+  pendingValues_.clear();
+
+  if (!localEqns.empty()) mergeLocal(localEqns, localValues);
+  if (!remoteEqns.empty()) mergeRemote(remoteEqns, remoteValues);
+
+  valuesSorted_ = true;
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::mergeLocal(const std::vector<GlobalOrdinal>& eqns,
+                            const std::vector<double>& values) const
+{
+  //eqns is sorted and unique. Walk the words of the bitset, and in each word
+  //that gains eqns, interleave the new values with the existing ones in bit
+  //order. New values replace existing ones.
+  std::vector<double> merged;
+  merged.reserve(localValues_.size() + eqns.size());
+
+  size_t next = 0, oldRank = 0;
+  for(size_t w=0; w<localBits_.size(); ++w) {
+    unsigned oldWord = localBits_[w];
+    unsigned newWord = 0;
+    for(size_t j=next; j<eqns.size(); ++j) {
+      unsigned offset = eqns[j] - firstLocalEqn_;
+      if (offset/BITS_PER_WORD != w) break;
+      newWord |= 1u << (offset%BITS_PER_WORD);
+    }
+
+    if (newWord == 0) {
+      unsigned n = count_bits(oldWord);
+      merged.insert(merged.end(), localValues_.begin()+oldRank,
+                    localValues_.begin()+oldRank+n);
+      oldRank += n;
+      continue;
+    }
+
+    unsigned word = oldWord | newWord;
+    for(unsigned b=0; b<BITS_PER_WORD; ++b) {
+      unsigned bit = 1u << b;
+      if ((word & bit) == 0) continue;
+
+      if ((newWord & bit) != 0) {
+        merged.push_back(values[next++]);
+        if ((oldWord & bit) != 0) ++oldRank;
+      }
+      else {
+        merged.push_back(localValues_[oldRank++]);
+      }
+    }
+    localBits_[w] = word;
+  }
+
+  localValues_.swap(merged);
+  if (eqns.back() > lastInsertedLocal_) lastInsertedLocal_ = eqns.back();
+  ranksValid_ = false;
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::mergeRemote(const std::vector<GlobalOrdinal>& eqns,
+                             const std::vector<double>& values) const
+{
+  //both lists are sorted and unique. New values replace existing ones.
+  std::vector<GlobalOrdinal> mergedEqns;
+  std::vector<double> mergedValues;
+  mergedEqns.reserve(remoteEqns_.size() + eqns.size());
+  mergedValues.reserve(remoteEqns_.size() + eqns.size());
+
+  size_t i = 0, j = 0;
+  while(i < remoteEqns_.size() || j < eqns.size()) {
+    if (j == eqns.size() ||
+        (i < remoteEqns_.size() && remoteEqns_[i] < eqns[j])) {
+      mergedEqns.push_back(remoteEqns_[i]);
+      mergedValues.push_back(remoteValues_[i++]);
+      continue;
+    }
+
+    if (i < remoteEqns_.size() && remoteEqns_[i] == eqns[j]) ++i;
+    mergedEqns.push_back(eqns[j]);
+    mergedValues.push_back(values[j++]);
+  }
+
+  remoteEqns_.swap(mergedEqns);
+  remoteValues_.swap(mergedValues);
+}
+
+//----------------------------------------------------------------------------
+size_t BCEqnIndex::getLocalRank(unsigned offset) const
+{
+  if (!ranksValid_) {
+    localRanks_.resize(localBits_.size());
+    unsigned rank = 0;
+    for(size_t w=0; w<localBits_.size(); ++w) {
+      localRanks_[w] = rank;
+      rank += count_bits(localBits_[w]);
+    }
+    ranksValid_ = true;
+  }
+
+  unsigned w = offset/BITS_PER_WORD;
+  unsigned below = localBits_[w] & ((1u << (offset%BITS_PER_WORD)) - 1u);
+  return( localRanks_[w] + count_bits(below) );
+}
+
+//----------------------------------------------------------------------------
+int BCEqnIndex::getValue(GlobalOrdinal eqn, double& value) const
+{
+  if (!contains(eqn)) return(-1);
+
+  if (eqn >= firstLocalEqn_ && eqn <= lastLocalEqn_) {
+    value = localValues_[getLocalRank(eqn - firstLocalEqn_)];
+    return(0);
+  }
+
+  std::vector<GlobalOrdinal>::const_iterator
+    iter = std::lower_bound(remoteEqns_.begin(), remoteEqns_.end(), eqn);
+  value = remoteValues_[iter - remoteEqns_.begin()];
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::getBCEqns(std::vector<GlobalOrdinal>& eqns,
+                           std::vector<double>& values) const
+{
+  sortValues();
+
+  //the remote eqns below the local range, then the local eqns, then the
+  //remote eqns above the local range.
+  std::vector<GlobalOrdinal>::iterator
+    split = std::lower_bound(remoteEqns_.begin(), remoteEqns_.end(),
+                             firstLocalEqn_);
+  size_t numBelow = split - remoteEqns_.begin();
+
+  eqns.assign(remoteEqns_.begin(), split);
+  values.assign(remoteValues_.begin(), remoteValues_.begin()+numBelow);
+  eqns.reserve(size());
+  values.reserve(size());
+
+  size_t rank = 0;
+  for(size_t w=0; w<localBits_.size(); ++w) {
+    unsigned word = localBits_[w];
+    for(unsigned b=0; word != 0; ++b, word >>= 1) {
+      if ((word & 1u) == 0) continue;
+      eqns.push_back(firstLocalEqn_ + (GlobalOrdinal)(w*BITS_PER_WORD + b));
+      values.push_back(localValues_[rank++]);
+    }
+  }
+
+  eqns.insert(eqns.end(), split, remoteEqns_.end());
+  values.insert(values.end(), remoteValues_.begin()+numBelow,
+                remoteValues_.end());
+}
+
+//----------------------------------------------------------------------------
+void BCEqnIndex::clear()
+{
+  std::fill(localBits_.begin(), localBits_.end(), 0u);
+  localValues_.clear();
+  ranksValid_ = false;
+  lastInsertedLocal_ = firstLocalEqn_ - 1;
+  remoteEqns_.clear();
+  remoteValues_.clear();
+  pendingEqns_.clear();
+  pendingValues_.clear();
+  valuesSorted_ = true;
+}
+
+//----------------------------------------------------------------------------
+size_t BCEqnIndex::getMemoryUsage() const
+{
+  return( (localBits_.capacity() + localRanks_.capacity())*sizeof(unsigned)
+        + localValues_.capacity()*sizeof(double)
+        + (remoteEqns_.capacity() + pendingEqns_.capacity())
+          *sizeof(GlobalOrdinal)
+        + (remoteValues_.capacity() + pendingValues_.capacity())
+          *sizeof(double) );
+}
+
+}//namespace fei
+
@@ -0,0 +1,139 @@
+#ifndef _fei_BCEqnIndex_hpp_
+#define _fei_BCEqnIndex_hpp_
+
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_macros.hpp>
+
+#include <vector>
+#include <algorithm>
+
+namespace fei {
+
+/** Membership index and prescribed values for essential (dirichlet)
+  boundary-condition equations.
+
+  Membership of equations in the range [firstLocalEqn, lastLocalEqn]
+  (normally the locally-owned equations) is held in a dense bitset, so that
+  contains() is a single bit-test for those equations. Their prescribed
+  values are stored without the equations, in equation order, and are found
+  by the rank of the equation's bit (the number of set bits before it).
+  Other equations are held in a sorted list with their values.
+
+  Bc equations inserted in increasing order are appended directly. Others
+  are buffered and merged in when the index is next queried, so that
+  inserting bc equations in arbitrary order costs O(n log n) overall. If the
+  same equation is inserted more than once, the most recently inserted value
+  is kept.
+*/
+class BCEqnIndex {
+ public:
+  /** constructor. The local range is empty, i.e., all equations are
+    treated as remotely-owned until setLocalRange is called. */
+  BCEqnIndex();
+
+  /** destructor */
+  ~BCEqnIndex();
+
+  /** Specify the range of equations to be held in the dense bitset.
+    Any existing contents are cleared. */
+  void setLocalRange(GlobalOrdinal firstLocalEqn, GlobalOrdinal lastLocalEqn);
+
+  /** Query whether setLocalRange has been called with a non-empty range. */
+  bool haveLocalRange() const
+  { return( lastLocalEqn_ >= firstLocalEqn_ ); }
+
+  /** Insert a bc equation and its prescribed value. If eqn is already
+    present, its value is replaced. */
+  void insert(GlobalOrdinal eqn, double value);
+
+  /** Replace the contents with numEqns bc equations and their prescribed
+    values. eqns must be sorted and contain no duplicates (e.g., the indices
+    of a fei::CSVec). The local range is set as in setLocalRange.
+  */
+  void assign(GlobalOrdinal firstLocalEqn, GlobalOrdinal lastLocalEqn,
+              int numEqns, const GlobalOrdinal* eqns, const double* values);
+
+  /** Query whether eqn is a bc equation. */
+  bool contains(GlobalOrdinal eqn) const
+  {
+    sortValues();
+    if (eqn >= firstLocalEqn_ && eqn <= lastLocalEqn_) {
+      unsigned offset = eqn - firstLocalEqn_;
+      return( (localBits_[offset/BITS_PER_WORD] &
+               (1u << (offset%BITS_PER_WORD))) != 0 );
+    }
+    return( std::binary_search(remoteEqns_.begin(), remoteEqns_.end(), eqn) );
+  }
+
+  /** Obtain the prescribed value for eqn.
+    @return 0 if successful, -1 if eqn is not a bc equation.
+  */
+  int getValue(GlobalOrdinal eqn, double& value) const;
+
+  /** Return the number of distinct bc equations. */
+  size_t size() const
+  {
+    sortValues();
+    return( localValues_.size() + remoteEqns_.size() );
+  }
+
+  /** Copy out all bc equations, sorted, and their prescribed values. */
+  void getBCEqns(std::vector<GlobalOrdinal>& eqns,
+                 std::vector<double>& values) const;
+
+  /** Remove all bc equations. The local range is retained. */
+  void clear();
+
+  /** Return the number of bytes of storage currently allocated. */
+  size_t getMemoryUsage() const;
+
+ private:
+  BCEqnIndex(const BCEqnIndex& src);
+  BCEqnIndex& operator=(const BCEqnIndex& src);
+
+  void sortValues() const;
+
+  void mergeLocal(const std::vector<GlobalOrdinal>& eqns,
+                  const std::vector<double>& values) const;
+
+  void mergeRemote(const std::vector<GlobalOrdinal>& eqns,
+                   const std::vector<double>& values) const;
+
+  size_t getLocalRank(unsigned offset) const;
+
+  enum { BITS_PER_WORD = 32 };
+
+  GlobalOrdinal firstLocalEqn_;
+  GlobalOrdinal lastLocalEqn_;
+
+  //localValues_[r] is the value of the local eqn with the r-th set bit.
+  //localRanks_[w] is the number of bits set in the words before word w, and
+  //is rebuilt on demand.
+  mutable std::vector<unsigned> localBits_;
+  mutable std::vector<double> localValues_;
+  mutable std::vector<unsigned> localRanks_;
+  mutable bool ranksValid_;
+
+  //largest local eqn present, firstLocalEqn_-1 if none.
+  mutable GlobalOrdinal lastInsertedLocal_;
+
+  mutable std::vector<GlobalOrdinal> remoteEqns_;
+  mutable std::vector<double> remoteValues_;
+
+  //out-of-order insertions, merged in by sortValues().
+  mutable std::vector<GlobalOrdinal> pendingEqns_;
+  mutable std::vector<double> pendingValues_;
+  mutable bool valuesSorted_;
+};//class BCEqnIndex
+
+}//namespace fei
+
+#endif // _fei_BCEqnIndex_hpp_
+
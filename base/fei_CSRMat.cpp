@@ -55,7 +55,7 @@ CSRMat::operator=(const fei::FillableMat& src)
   srg_.packedColumnIndices.resize(nnz);
   packedcoefs_.resize(nnz);
 
-  int* colind_ptr = (srg_.packedColumnIndices.size()
+  GlobalOrdinal* colind_ptr = (srg_.packedColumnIndices.size()
     ? &(srg_.packedColumnIndices[0]) : 0);
   double* coef_ptr = (packedcoefs_.size()
     ? &(packedcoefs_[0]) : 0);
@@ -65,7 +65,7 @@ CSRMat::operator=(const fei::FillableMat& src)
   unsigned offset = 0;
   for(; iter != iter_end; ++iter) {
     const CSVec* v = iter->second;
-    const std::vector<int>& v_ind = v->indices();
+    const std::vector<GlobalOrdinal>& v_ind = v->indices();
     const std::vector<double>& v_coef = v->coefs();
     for(size_t i=0; i<v_ind.size(); ++i) {
       colind_ptr[offset] = v_ind[i];
@@ -103,19 +103,19 @@ void multiply_CSRMat_CSVec(const CSRMat& A, const CSVec& x, CSVec& y)
 {
   //This function is unit-tested in fei/utest_cases/fei_unit_CSRMat_CSVec.cpp
 
-  const std::vector<int>& rows = A.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& rows = A.getGraph().rowNumbers;
   const int* rowoffs = &(A.getGraph().rowOffsets[0]);
-  const std::vector<int>& colinds = A.getGraph().packedColumnIndices;
+  const std::vector<GlobalOrdinal>& colinds = A.getGraph().packedColumnIndices;
   const double* Acoef = A.getPackedCoefs().size() > 0 ? &(A.getPackedCoefs()[0]): NULL;
 
-  const std::vector<int>& xind = x.indices();
+  const std::vector<GlobalOrdinal>& xind = x.indices();
   const std::vector<double>& xcoef = x.coefs();
 
   const double* xcoef_ptr = xcoef.empty() ? NULL : &xcoef[0];
-  const int* xind_ptr = xind.empty() ? NULL : &xind[0];
+  const GlobalOrdinal* xind_ptr = xind.empty() ? NULL : &xind[0];
   int xlen = xcoef.size();
 
-  std::vector<int>& yind = y.indices();
+  std::vector<GlobalOrdinal>& yind = y.indices();
   std::vector<double>& ycoef = y.coefs();
 
   unsigned nrows = A.getNumRows();
@@ -123,7 +123,7 @@ void multiply_CSRMat_CSVec(const CSRMat& A, const CSVec& x, CSVec& y)
   yind.resize(nrows);
   ycoef.resize(nrows);
 
-  int* yind_ptr = yind.size() > 0 ? &yind[0] : NULL;
+  GlobalOrdinal* yind_ptr = yind.size() > 0 ? &yind[0] : NULL;
   double* ycoef_ptr = ycoef.size() > 0 ? &ycoef[0] : NULL;
 
   int jbeg = *rowoffs++;
@@ -147,12 +147,12 @@ void multiply_CSRMat_CSVec(const CSRMat& A, const CSVec& x, CSVec& y)
 
 void multiply_trans_CSRMat_CSVec(const CSRMat& A, const CSVec& x, CSVec& y)
 {
-  const std::vector<int>& rows = A.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& rows = A.getGraph().rowNumbers;
   const int* rowoffs = &(A.getGraph().rowOffsets[0]);
-  const int* colinds = A.getGraph().packedColumnIndices.empty() ? NULL : &(A.getGraph().packedColumnIndices[0]);
+  const GlobalOrdinal* colinds = A.getGraph().packedColumnIndices.empty() ? NULL : &(A.getGraph().packedColumnIndices[0]);
   const double* Acoef = A.getPackedCoefs().empty() ? NULL : &(A.getPackedCoefs()[0]);
 
-  const std::vector<int>& xind = x.indices();
+  const std::vector<GlobalOrdinal>& xind = x.indices();
   const std::vector<double>& xcoef = x.coefs();
 
   const double* xcoef_ptr = xcoef.empty() ? NULL : &xcoef[0];
@@ -193,25 +193,25 @@ void multiply_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
 
   fei::FillableMat fc;
 
-  const std::vector<int>& Arows = A.getGraph().rowNumbers;
-  const std::vector<int>& Brows = B.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& Arows = A.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& Brows = B.getGraph().rowNumbers;
   if (Arows.size() < 1 || Brows.size() < 1) {
     C = fc;
     return;
   }
   const int* Arowoffs = &(A.getGraph().rowOffsets[0]);
-  const int* Acols = &(A.getGraph().packedColumnIndices[0]);
+  const GlobalOrdinal* Acols = &(A.getGraph().packedColumnIndices[0]);
   const double* Acoefs = &(A.getPackedCoefs()[0]);
 
   const int* Browoffs = &(B.getGraph().rowOffsets[0]);
-  const std::vector<int>& Bcols = B.getGraph().packedColumnIndices;
+  const std::vector<GlobalOrdinal>& Bcols = B.getGraph().packedColumnIndices;
   const double* Bcoefs = B.getPackedCoefs().empty() ? NULL : &(B.getPackedCoefs()[0]);
 
   static double fei_min = std::numeric_limits<double>::min();
 
   int jbeg = *Arowoffs++;
   for(size_t i=0; i<Arows.size(); ++i) {
-    int row = Arows[i];
+    GlobalOrdinal row = Arows[i];
     int jend = *Arowoffs++;
 
     fei::CSVec* fc_row = NULL;
@@ -224,7 +224,7 @@ void multiply_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
 
     while(jbeg<jend) {
       ++jbeg;
-      int Acol = *Acols++;
+      GlobalOrdinal Acol = *Acols++;
       double Acoef = *Acoefs++;
 
       int Brow_offset = fei::binarySearch(Acol, &Brows[0], Brows.size());
@@ -239,13 +239,13 @@ void multiply_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
         }
       }
 
-      const int* Brow_cols = Bcols.empty() ? NULL : &(Bcols[Browoffs[Brow_offset]]);
+      const GlobalOrdinal* Brow_cols = Bcols.empty() ? NULL : &(Bcols[Browoffs[Brow_offset]]);
       const double* Brow_coefs = Bcoefs==NULL ? NULL : &(Bcoefs[Browoffs[Brow_offset]]);
       int Brow_len = Browoffs[Brow_offset+1]-Browoffs[Brow_offset];
 
       for(int k=0; k<Brow_len; ++k) {
         double resultCoef = Acoef*Brow_coefs[k];
-        int resultCol = Brow_cols[k];
+        GlobalOrdinal resultCol = Brow_cols[k];
 
         if (!storeResultZeros) {
           if (std::abs(resultCoef) < fei_min) {
@@ -272,8 +272,8 @@ void multiply_trans_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
 
   fei::FillableMat fc;
 
-  const std::vector<int>& Arows = A.getGraph().rowNumbers;
-  const std::vector<int>& Brows = B.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& Arows = A.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& Brows = B.getGraph().rowNumbers;
   if (Arows.size() < 1 || Brows.size() < 1) {
     C = fc;
     return;
@@ -281,11 +281,11 @@ void multiply_trans_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
 
   const size_t numArows = Arows.size();
   const int* Arowoffs = &(A.getGraph().rowOffsets[0]);
-  const int* Acols = A.getGraph().packedColumnIndices.empty() ? NULL : &(A.getGraph().packedColumnIndices[0]);
+  const GlobalOrdinal* Acols = A.getGraph().packedColumnIndices.empty() ? NULL : &(A.getGraph().packedColumnIndices[0]);
   const double* Acoefs = A.getPackedCoefs().empty() ? NULL : &(A.getPackedCoefs()[0]);
 
   const int* Browoffs = &(B.getGraph().rowOffsets[0]);
-  const std::vector<int>& Bcols = B.getGraph().packedColumnIndices;
+  const std::vector<GlobalOrdinal>& Bcols = B.getGraph().packedColumnIndices;
   const double* Bcoefs = B.getPackedCoefs().empty() ? NULL : &(B.getPackedCoefs()[0]);
 
   std::vector<double> row_coefs;
@@ -305,7 +305,7 @@ void multiply_trans_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
       continue;
     }
 
-    const int* Brow_cols = Bcols.empty() ? NULL : &(Bcols[Browoffs[Brow_offset]]);
+    const GlobalOrdinal* Brow_cols = Bcols.empty() ? NULL : &(Bcols[Browoffs[Brow_offset]]);
     const double* Brow_coefs = Bcoefs==NULL ? NULL : &(Bcoefs[Browoffs[Brow_offset]]);
     int Brow_len = Browoffs[Brow_offset+1]-Browoffs[Brow_offset];
 
@@ -313,7 +313,7 @@ void multiply_trans_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
     double* row_coefs_ptr = &row_coefs[0];
 
     while(jbeg<jend) {
-      int Acol = Acols[jbeg];
+      GlobalOrdinal Acol = Acols[jbeg];
       double Acoef = Acoefs[jbeg++];
 
       if (std::abs(Acoef) < fei_min && !storeResultZeros) {
@@ -333,13 +333,13 @@ void multiply_trans_CSRMat_CSRMat(const CSRMat& A, const CSRMat& B, CSRMat& C,
 
 void add_CSRMat_to_FillableMat(const CSRMat& csrm, FillableMat& fm)
 {
-  const std::vector<int>& rows = csrm.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& rows = csrm.getGraph().rowNumbers;
   const int* rowoffs = &(csrm.getGraph().rowOffsets[0]);
-  const std::vector<int>& cols = csrm.getGraph().packedColumnIndices;
+  const std::vector<GlobalOrdinal>& cols = csrm.getGraph().packedColumnIndices;
   const double* coefs = &(csrm.getPackedCoefs()[0]);
 
   for(size_t i=0; i<rows.size(); ++i) {
-    int row = rows[i];
+    GlobalOrdinal row = rows[i];
 
     for(int j=rowoffs[i]; j<rowoffs[i+1]; ++j) {
       fm.sumInCoef(row, cols[j], coefs[j]);
@@ -31,17 +31,18 @@ CSVec::operator=(const CSVec& invec)
   return *this;
 }
 
-void add_entries(CSVec& vec, int num, const int* eqns, const double* coefs)
+void add_entries(CSVec& vec, int num, const GlobalOrdinal* eqns,
+                 const double* coefs)
 {
   for(int i=0; i<num; ++i) add_entry(vec, eqns[i], coefs[i]);
 }
 
-void put_entry(CSVec& vec, int eqn, double coef)
+void put_entry(CSVec& vec, GlobalOrdinal eqn, double coef)
 {
-  std::vector<int>& v_ind = vec.indices();
+  std::vector<GlobalOrdinal>& v_ind = vec.indices();
   std::vector<double>& v_coef = vec.coefs();
 
-  std::vector<int>::iterator
+  std::vector<GlobalOrdinal>::iterator
     iter = std::lower_bound(v_ind.begin(), v_ind.end(), eqn);
 
   size_t offset = iter - v_ind.begin();
@@ -55,16 +56,16 @@ void put_entry(CSVec& vec, int eqn, double coef)
   }
 }
 
-double get_entry(const CSVec& vec, int eqn)
+double get_entry(const CSVec& vec, GlobalOrdinal eqn)
 {
-  const std::vector<int>& v_ind = vec.indices();
+  const std::vector<GlobalOrdinal>& v_ind = vec.indices();
   const std::vector<double>& v_coef = vec.coefs();
 
   if (vec.size() == 0) {
     throw std::runtime_error("get_entry error, CSVec is empty");
   }
 
-  std::vector<int>::const_iterator
+  std::vector<GlobalOrdinal>::const_iterator
     iter = std::lower_bound(v_ind.begin(), v_ind.end(), eqn);
 
   if (iter == v_ind.end()) {
@@ -74,12 +75,12 @@ double get_entry(const CSVec& vec, int eqn)
   return v_coef[iter - v_ind.begin()];
 }
 
-void remove_entry(CSVec& vec, int eqn)
+void remove_entry(CSVec& vec, GlobalOrdinal eqn)
 {
-  std::vector<int>& v_ind = vec.indices();
+  std::vector<GlobalOrdinal>& v_ind = vec.indices();
   std::vector<double>& v_coef = vec.coefs();
 
-  std::vector<int>::iterator
+  std::vector<GlobalOrdinal>::iterator
     iter = std::lower_bound(v_ind.begin(), v_ind.end(), eqn);
 
   if (iter != v_ind.end() && *iter == eqn) {
@@ -105,7 +106,7 @@ void set_values(CSVec& vec, double scalar)
 
 void add_CSVec_CSVec(const CSVec& u, CSVec& v)
 {
-  const std::vector<int>& indices = u.indices();
+  const std::vector<GlobalOrdinal>& indices = u.indices();
   const std::vector<double>& coefs = u.coefs();
 
   for(size_t i=0; i<indices.size(); ++i) {
@@ -15,8 +15,9 @@
 
 namespace fei {
 
-/** 'Compressed Sparse Vector' stored as two std::vectors: a vector of ints for the
-    indices and a vector of doubles for the coefficients.
+/** 'Compressed Sparse Vector' stored as two std::vectors: a vector of
+    GlobalOrdinals for the indices and a vector of doubles for the
+    coefficients.
 
    Non-member functions add_entry and put_entry maintain sortedness of the
    vector when inserting new entries.
@@ -28,8 +29,8 @@ class CSVec {
 
   CSVec& operator=(const CSVec& invec);
 
-  std::vector<int>& indices() {return indices_;}
-  const std::vector<int>& indices() const {return indices_;}
+  std::vector<GlobalOrdinal>& indices() {return indices_;}
+  const std::vector<GlobalOrdinal>& indices() const {return indices_;}
   std::vector<double>& coefs() {return coefs_;}
   const std::vector<double>& coefs() const {return coefs_;}
 
@@ -48,17 +49,17 @@ class CSVec {
   void subtract(const CSVec& rhs);
 
  private:
-  std::vector<int> indices_;
+  std::vector<GlobalOrdinal> indices_;
   std::vector<double> coefs_;
 };//class CSVec
 
 inline
-void add_entry(CSVec& vec, int eqn, double coef)
+void add_entry(CSVec& vec, GlobalOrdinal eqn, double coef)
 {
-  std::vector<int>& v_ind = vec.indices();
+  std::vector<GlobalOrdinal>& v_ind = vec.indices();
   std::vector<double>& v_coef = vec.coefs();
 
-  std::vector<int>::iterator
+  std::vector<GlobalOrdinal>::iterator
     iter = std::lower_bound(v_ind.begin(), v_ind.end(), eqn);
 
   size_t offset = iter - v_ind.begin();
@@ -73,13 +74,14 @@ void add_entry(CSVec& vec, int eqn, double coef)
 }
 
 
-void add_entries(CSVec& vec, int num, const int* eqns, const double* coefs);
+void add_entries(CSVec& vec, int num, const GlobalOrdinal* eqns,
+                 const double* coefs);
 
-void put_entry(CSVec& vec, int eqn, double coef);
+void put_entry(CSVec& vec, GlobalOrdinal eqn, double coef);
 
-double get_entry(const CSVec& vec, int eqn);
+double get_entry(const CSVec& vec, GlobalOrdinal eqn);
 
-void remove_entry(CSVec& vec, int eqn);
+void remove_entry(CSVec& vec, GlobalOrdinal eqn);
 
 void set_values(CSVec& vec, double scalar);
 
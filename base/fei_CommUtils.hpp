@@ -541,6 +541,78 @@ int exchangeData(MPI_Comm comm,
   return(0);
 }
 
+//------------------------------------------------------------------------
+/** Sparse exchange of variable-length messages, one message per processor.
+    Unlike exchangeData with recvDataLengthsKnownOnEntry==false, no separate
+    round of length messages is sent: each incoming message is sized with
+    MPI_Probe before it is received.
+
+    @param tag Input. Message tag, should be unique to the calling phase.
+    @param sendProcs Input. Processors to send to (not including the local
+    processor).
+    @param sendData Input. One message per entry in sendProcs. May be empty.
+    @param recvProcs Input. Processors to receive from. Each of them must
+    send exactly one message to the local processor with this tag.
+    @param recvData Output. On exit, one message per entry in recvProcs.
+    @return error-code 0 if successful
+*/
+template<class T>
+int exchangeDataProbe(MPI_Comm comm, int tag,
+                      std::vector<int>& sendProcs,
+                      std::vector<std::vector<T> >& sendData,
+                      std::vector<int>& recvProcs,
+                      std::vector<std::vector<T> >& recvData)
+{
+  if (sendProcs.size() != sendData.size()) return(-1);
+  recvData.resize(recvProcs.size());
+#ifndef FEI_SER
+  MPI_Datatype mpi_dtype = fei::mpiTraits<T>::mpi_type();
+  std::vector<MPI_Request> sendReqs(sendProcs.size(), MPI_REQUEST_NULL);
+  int err = MPI_SUCCESS;
+
+  for(size_t i=0; i<sendProcs.size() && err == MPI_SUCCESS; ++i) {
+    std::vector<T>& send_vec = sendData[i];
+    T* send_buf = send_vec.empty() ? NULL : &send_vec[0];
+    err = MPI_Isend(send_buf, (int)send_vec.size(), mpi_dtype,
+                    sendProcs[i], tag, comm, &sendReqs[i]);
+  }
+
+  for(size_t i=0; i<recvProcs.size() && err == MPI_SUCCESS; ++i) {
+    MPI_Status status;
+    err = MPI_Probe(recvProcs[i], tag, comm, &status);
+    int len = 0;
+    if (err == MPI_SUCCESS) err = MPI_Get_count(&status, mpi_dtype, &len);
+    if (err != MPI_SUCCESS) break;
+
+    std::vector<T>& recv_vec = recvData[i];
+    recv_vec.resize(len);
+    T* recv_buf = len > 0 ? &recv_vec[0] : NULL;
+    err = MPI_Recv(recv_buf, len, mpi_dtype, recvProcs[i], tag,
+                   comm, &status);
+  }
+
+  //the send requests must not be left outstanding, even on error. If a
+  //receive failed, the matching receives may never be posted, so the sends
+  //are cancelled rather than waited on.
+  if (!sendReqs.empty()) {
+    if (err != MPI_SUCCESS) {
+      for(size_t i=0; i<sendReqs.size(); ++i) {
+        if (sendReqs[i] != MPI_REQUEST_NULL) MPI_Cancel(&sendReqs[i]);
+      }
+    }
+    std::vector<MPI_Status> statuses(sendReqs.size());
+    int waitErr = MPI_Waitall((int)sendReqs.size(), &sendReqs[0],
+                              &statuses[0]);
+    if (err == MPI_SUCCESS) err = waitErr;
+  }
+  CHK_MPI( err );
+#else
+  (void)comm;
+  (void)tag;
+#endif
+  return(0);
+}
+
 
 //------------------------------------------------------------------------
 /** MessageHandler is an interface representing a general sparse data
@@ -23,7 +23,12 @@ class ConnectivityTable {
  public:
    ConnectivityTable() : numRows(0), elemIDs(), elemNumbers(),
                          elem_conn_ids(NULL), elem_conn_ptrs(NULL),
-                         connectivities(NULL), numNodesPerElem(0) {}
+                         connectivities(NULL), numNodesPerElem(0),
+                         cacheScatterIndices(false), scatterInterleave(-1),
+                         numScatterIndicesPerElem(0),
+                         numBlkScatterIndicesPerElem(0),
+                         scatterIndices(), blkScatterIndices(),
+                         blkScatterSizes() {}
 
    virtual ~ConnectivityTable() {
       for(int i=0; i<numRows; i++) delete connectivities[i];
@@ -43,6 +48,19 @@ class ConnectivityTable {
    std::vector<GlobalID>** connectivities;
    int numNodesPerElem;
 
+   /** Whether SNL_FEI_Structure should hold the scatter-indices for every
+     element of this block in the flat tables below, rather than computing
+     them from the node descriptors each time they're requested. */
+   bool cacheScatterIndices;
+   /** interleave-strategy the cached tables were computed with, or -1 if
+     the tables are not currently valid. */
+   int scatterInterleave;
+   int numScatterIndicesPerElem;
+   int numBlkScatterIndicesPerElem;
+   std::vector<int> scatterIndices;
+   std::vector<int> blkScatterIndices;
+   std::vector<int> blkScatterSizes;
+
  private:
    ConnectivityTable(const ConnectivityTable& /*src*/);
 
@@ -15,6 +15,8 @@
 #include <fei_SharedPtr.hpp>
 #include <fei_VectorSpace.hpp>
 #include <fei_Matrix.hpp>
+#include <fei_CommUtils.hpp>
+#include <fei_impl_utils.hpp>
 
 #include <algorithm>
 #include <vector>
@@ -27,10 +29,10 @@ typedef std::vector<fei::DirichletBCRecord> DBCvec;
 
 namespace fei {
 
-int
+GlobalOrdinal
 DirichletBCManager::getEqnNumber(int IDType, int ID, int fieldID, int offsetIntoField)
 {
-  int eqn = -1;
+  GlobalOrdinal eqn = -1;
   try {
     if (vecSpace_.get() != NULL) {
       vecSpace_->getGlobalIndex(IDType, ID, fieldID, eqn);
@@ -45,7 +47,9 @@ DirichletBCManager::getEqnNumber(int IDType, int ID, int fieldID, int offsetInto
       if (node == NULL) {
         throw std::runtime_error("fei::DirichletBCManager::getEqnNumber failed to get node.");
       }
-      node->getFieldEqnNumber(fieldID, eqn);
+      int nodeEqn = -1;
+      node->getFieldEqnNumber(fieldID, nodeEqn);
+      eqn = nodeEqn;
     }
   }
   catch(std::runtime_error& exc) {
@@ -60,6 +64,29 @@ DirichletBCManager::getEqnNumber(int IDType, int ID, int fieldID, int offsetInto
   return eqn + offsetIntoField;
 }
 
+void
+DirichletBCManager::initLocalRange()
+{
+  //setLocalRange clears the index, so it must not be repeated once bcs have
+  //been added (the local range may legitimately be empty).
+  if (bcs_.haveLocalRange() || bcs_.size() > 0) return;
+
+  //eqns in the locally-owned range are indexed by a dense bitset, anything
+  //else (shared eqns owned elsewhere) goes into a small sorted list.
+  if (vecSpace_.get() != NULL) {
+    std::vector<GlobalOrdinal> offsets;
+    vecSpace_->getGlobalIndexOffsets(offsets);
+    int localProc = fei::localProc(vecSpace_->getCommunicator());
+    if ((int)offsets.size() > localProc+1) {
+      bcs_.setLocalRange(offsets[localProc], offsets[localProc+1]-1);
+    }
+  }
+  else if (structure_ != NULL) {
+    bcs_.setLocalRange(structure_->getFirstLocalEqn(),
+                       structure_->getLastLocalEqn());
+  }
+}
+
 void
 DirichletBCManager::addBCRecords(int numBCs,
                                  int IDType,
@@ -68,16 +95,12 @@ DirichletBCManager::addBCRecords(int numBCs,
                                  const int* IDs,
                                  const double* prescribedValues)
 {
-  for(int i=0; i<numBCs; ++i) {
-    int eqn = getEqnNumber(IDType, IDs[i], fieldID, offsetIntoField);
+  initLocalRange();
 
-    bc_map::iterator iter = bcs_.lower_bound(eqn);
+  for(int i=0; i<numBCs; ++i) {
+    GlobalOrdinal eqn = getEqnNumber(IDType, IDs[i], fieldID, offsetIntoField);
 
-    if (iter == bcs_.end() || iter->first != eqn) {
-      bcs_.insert(iter, std::make_pair(eqn, prescribedValues[i]));
-      continue;
-    }
-    else iter->second = prescribedValues[i];
+    bcs_.insert(eqn, prescribedValues[i]);
   }
 }
 
@@ -89,16 +112,13 @@ DirichletBCManager::addBCRecords(int numBCs,
                                  const int* offsetsIntoField,
                                  const double* prescribedValues)
 {
-  for(int i=0; i<numBCs; ++i) {
-    int eqn = getEqnNumber(IDType, IDs[i], fieldID, offsetsIntoField[i]);
+  initLocalRange();
 
-    bc_map::iterator iter = bcs_.lower_bound(eqn);
+  for(int i=0; i<numBCs; ++i) {
+    GlobalOrdinal eqn = getEqnNumber(IDType, IDs[i], fieldID,
+                                     offsetsIntoField[i]);
 
-    if (iter == bcs_.end() || iter->first != eqn) {
-      bcs_.insert(iter, std::make_pair(eqn, prescribedValues[i]));
-      continue;
-    }
-    else iter->second = prescribedValues[i];
+    bcs_.insert(eqn, prescribedValues[i]);
   }
 }
 
@@ -115,11 +135,13 @@ DirichletBCManager::finalizeBCEqns(fei::Matrix& matrix,
   //bc values will go on the diagonal of the matrix, i.e., column-index
   //will be the same equation-number.
 
-  bc_map::iterator iter = bcs_.begin(), iter_end = bcs_.end();
+  std::vector<GlobalOrdinal> eqns;
+  std::vector<double> values;
+  bcs_.getBCEqns(eqns, values);
 
-  for(; iter!=iter_end; ++iter) {
+  for(size_t i=0; i<eqns.size(); ++i) {
 
-    int eqn = iter->first;
+    GlobalOrdinal eqn = eqns[i];
 
     if (haveSlaves) {
       if (reducer->isSlaveEqn(eqn)) {
@@ -133,7 +155,7 @@ DirichletBCManager::finalizeBCEqns(fei::Matrix& matrix,
       }
     }
 
-    double* ptr = &iter->second;
+    double* ptr = &values[i];
 
     CHK_ERR( matrix.copyIn(1, &eqn, 1, &eqn, &ptr) );
   }
@@ -147,11 +169,13 @@ DirichletBCManager::finalizeBCEqns(EqnBuffer& bcEqns)
 {
   //copy the boundary-condition prescribed values into bcEqns.
 
-  bc_map::iterator iter = bcs_.begin(), iter_end = bcs_.end();
+  std::vector<GlobalOrdinal> eqns;
+  std::vector<double> values;
+  bcs_.getBCEqns(eqns, values);
 
-  for(; iter!=iter_end; ++iter) {
-    int eqn = iter->first;
-    double coef = iter->second;
+  for(size_t i=0; i<eqns.size(); ++i) {
+    int eqn = fei::impl_utils::int_index(eqns[i]);
+    double coef = values[i];
 
     CHK_ERR( bcEqns.addEqn(eqn, &coef, &eqn, 1, false) );
   }
@@ -12,9 +12,7 @@
 #include <fei_DirichletBCRecord.hpp>
 #include <SNL_FEI_Structure.hpp>
 #include <fei_VectorSpace.hpp>
-
-#include <fei_Pool_alloc.hpp>
-#include <map>
+#include <fei_BCEqnIndex.hpp>
 
 class NodeDatabase;
 class EqnBuffer;
@@ -56,14 +54,15 @@ class DirichletBCManager {
   void clearAllBCs();
 
  private:
-  int getEqnNumber(int IDType, int ID, int fieldID, int offsetIntoField);
+  GlobalOrdinal getEqnNumber(int IDType, int ID, int fieldID,
+                             int offsetIntoField);
+
+  void initLocalRange();
 
   SNL_FEI_Structure* structure_;
   fei::SharedPtr<fei::VectorSpace> vecSpace_;
 
-  typedef std::map<int,double,std::less<int>,
-            fei_Pool_alloc<std::pair<const int, double> > > bc_map;
-  bc_map bcs_;
+  fei::BCEqnIndex bcs_;
 };//class DirichletBCManager
 }//namespace fei
 #endif
@@ -0,0 +1,324 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include "fei_DistCSRMat.hpp"
+#include "fei_CommUtils.hpp"
+#include "fei_chk_mpi.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#undef fei_file
+#define fei_file "fei_DistCSRMat.cpp"
+#include "fei_ErrMacros.hpp"
+
+namespace fei {
+
+//----------------------------------------------------------------------------
+DistCSRMat_core::DistCSRMat_core(MPI_Comm comm,
+                                 GlobalOrdinal firstLocalRow,
+                                 int numLocalRows,
+                                 const SparseRowGraph& localGraph)
+ : comm_(comm),
+   localProc_(fei::localProc(comm)),
+   numProcs_(fei::numProcs(comm)),
+   firstLocalRow_(firstLocalRow),
+   numLocalRows_(numLocalRows),
+   globalRowOffsets_(),
+   rowOffsets_(numLocalRows+1, 0),
+   ghostBegin_(numLocalRows, 0),
+   colIndices_(),
+   colMap_(),
+   recvProcs_(),
+   recvOffsets_(),
+   sendProcs_(),
+   sendOffsets_(),
+   sendLocalRows_(),
+   sendBuffer_(),
+   ghostValues_(),
+   ghostRecvBuffer_()
+#ifndef FEI_SER
+   , requests_()
+#endif
+{
+  createRowOffsets();
+
+  //row lengths, and the list of columns that aren't locally owned.
+  const GlobalOrdinal lastLocalRow = firstLocalRow_ + numLocalRows_ - 1;
+  const int numGraphRows = localGraph.rowNumbers.size();
+  std::vector<GlobalOrdinal> ghosts;
+  int badRow = 0;
+  for(int i=0; i<numGraphRows; ++i) {
+    GlobalOrdinal row = localGraph.rowNumbers[i];
+    if (row < firstLocalRow_ || row > lastLocalRow) {
+      badRow = 1;
+      continue;
+    }
+
+    int rowBegin = localGraph.rowOffsets[i];
+    int rowEnd = localGraph.rowOffsets[i+1];
+    rowOffsets_[row-firstLocalRow_+1] = rowEnd - rowBegin;
+
+    for(int j=rowBegin; j<rowEnd; ++j) {
+      GlobalOrdinal col = localGraph.packedColumnIndices[j];
+      if (col < firstLocalRow_ || col > lastLocalRow) ghosts.push_back(col);
+    }
+  }
+
+  int globalBadRow = 0;
+  fei::GlobalMax(comm_, badRow, globalBadRow);
+  if (globalBadRow != 0) {
+    throw std::runtime_error("fei::DistCSRMat ERROR, graph contains rows that aren't locally owned.");
+  }
+
+  std::sort(ghosts.begin(), ghosts.end());
+  ghosts.erase(std::unique(ghosts.begin(), ghosts.end()), ghosts.end());
+
+  colMap_.resize(numLocalRows_ + ghosts.size());
+  for(int i=0; i<numLocalRows_; ++i) colMap_[i] = firstLocalRow_ + i;
+  std::copy(ghosts.begin(), ghosts.end(), colMap_.begin()+numLocalRows_);
+
+  for(int i=0; i<numLocalRows_; ++i) rowOffsets_[i+1] += rowOffsets_[i];
+
+  colIndices_.resize(rowOffsets_[numLocalRows_]);
+
+  for(int i=0; i<numGraphRows; ++i) {
+    int localRow = static_cast<int>(localGraph.rowNumbers[i] - firstLocalRow_);
+    int offset = rowOffsets_[localRow];
+    for(int j=localGraph.rowOffsets[i]; j<localGraph.rowOffsets[i+1]; ++j) {
+      colIndices_[offset++] = getLocalCol(localGraph.packedColumnIndices[j]);
+    }
+  }
+
+  for(int i=0; i<numLocalRows_; ++i) {
+    int* rowBegin = colIndices_.empty() ? NULL : &colIndices_[0]+rowOffsets_[i];
+    int* rowEnd = colIndices_.empty() ? NULL : &colIndices_[0]+rowOffsets_[i+1];
+    std::sort(rowBegin, rowEnd);
+    ghostBegin_[i] = std::lower_bound(rowBegin, rowEnd, numLocalRows_) - rowBegin
+                   + rowOffsets_[i];
+  }
+
+  createHaloPlan();
+}
+
+//----------------------------------------------------------------------------
+DistCSRMat_core::~DistCSRMat_core()
+{
+}
+
+//----------------------------------------------------------------------------
+void DistCSRMat_core::createRowOffsets()
+{
+  std::vector<GlobalOrdinal> localRange(2);
+  localRange[0] = firstLocalRow_;
+  localRange[1] = numLocalRows_;
+
+  std::vector<int> recvLengths;
+  std::vector<GlobalOrdinal> ranges;
+  if (fei::Allgatherv(comm_, localRange, recvLengths, ranges) != 0) {
+    throw std::runtime_error("fei::DistCSRMat ERROR in fei::Allgatherv");
+  }
+
+  globalRowOffsets_.assign(numProcs_+1, 0);
+  bool consistent = true;
+  for(int p=0; p<numProcs_; ++p) {
+    GlobalOrdinal first = ranges[2*p], num = ranges[2*p+1];
+    if (num > 0 && first != globalRowOffsets_[p]) consistent = false;
+    globalRowOffsets_[p+1] = globalRowOffsets_[p] + num;
+  }
+
+  if (!consistent) {
+    throw std::runtime_error("fei::DistCSRMat ERROR, locally-owned row ranges are not in processor order.");
+  }
+}
+
+//----------------------------------------------------------------------------
+void DistCSRMat_core::createHaloPlan()
+{
+  const int numGhosts = colMap_.size() - numLocalRows_;
+  ghostValues_.assign(numGhosts, 0.0);
+  recvOffsets_.assign(1, 0);
+
+  //the ghost columns are sorted, so each owning processor's columns are
+  //together.
+  std::vector<std::vector<GlobalOrdinal> > requestedRows;
+  int badCol = 0;
+  for(int i=0; i<numGhosts; ++i) {
+    GlobalOrdinal col = colMap_[numLocalRows_+i];
+    int owner = std::upper_bound(globalRowOffsets_.begin(),
+                                 globalRowOffsets_.end(), col)
+              - globalRowOffsets_.begin() - 1;
+    if (owner < 0 || owner >= numProcs_) {
+      badCol = 1;
+      break;
+    }
+
+    if (recvProcs_.empty() || recvProcs_.back() != owner) {
+      recvProcs_.push_back(owner);
+      recvOffsets_.push_back(recvOffsets_.back());
+      requestedRows.push_back(std::vector<GlobalOrdinal>());
+    }
+    requestedRows.back().push_back(col);
+    ++recvOffsets_.back();
+  }
+
+  int globalBadCol = 0;
+  fei::GlobalMax(comm_, badCol, globalBadCol);
+  if (globalBadCol != 0) {
+    throw std::runtime_error("fei::DistCSRMat ERROR, graph contains columns that aren't owned by any processor.");
+  }
+
+  sendOffsets_.assign(1, 0);
+
+#ifndef FEI_SER
+  if (fei::mirrorProcs(comm_, recvProcs_, sendProcs_) != 0) {
+    throw std::runtime_error("fei::DistCSRMat ERROR in fei::mirrorProcs");
+  }
+
+  std::vector<std::vector<GlobalOrdinal> > rowsToSend;
+  if (fei::exchangeDataProbe(comm_, 19920, recvProcs_, requestedRows,
+                             sendProcs_, rowsToSend) != 0) {
+    throw std::runtime_error("fei::DistCSRMat ERROR in fei::exchangeDataProbe");
+  }
+
+  for(size_t i=0; i<sendProcs_.size(); ++i) {
+    const std::vector<GlobalOrdinal>& rows = rowsToSend[i];
+    for(size_t j=0; j<rows.size(); ++j) {
+      sendLocalRows_.push_back(static_cast<int>(rows[j] - firstLocalRow_));
+    }
+    sendOffsets_.push_back(sendLocalRows_.size());
+  }
+
+  sendBuffer_.resize(sendLocalRows_.size());
+  requests_.resize(recvProcs_.size() + sendProcs_.size());
+#endif
+}
+
+//----------------------------------------------------------------------------
+int DistCSRMat_core::getLocalCol(GlobalOrdinal globalCol) const
+{
+  GlobalOrdinal localCol = globalCol - firstLocalRow_;
+  if (localCol >= 0 && localCol < numLocalRows_) {
+    return(static_cast<int>(localCol));
+  }
+
+  std::vector<GlobalOrdinal>::const_iterator
+    ghosts_begin = colMap_.begin()+numLocalRows_,
+    iter = std::lower_bound(ghosts_begin, colMap_.end(), globalCol);
+  if (iter == colMap_.end() || *iter != globalCol) return(-1);
+
+  return(iter - colMap_.begin());
+}
+
+//----------------------------------------------------------------------------
+int DistCSRMat_core::getOffset(GlobalOrdinal globalRow,
+                               GlobalOrdinal globalCol) const
+{
+  GlobalOrdinal localRowG = globalRow - firstLocalRow_;
+  if (localRowG < 0 || localRowG >= numLocalRows_) return(-1);
+  int localRow = static_cast<int>(localRowG);
+
+  int localCol = getLocalCol(globalCol);
+  if (localCol < 0 || colIndices_.empty()) return(-1);
+
+  const int* rowBegin = &colIndices_[0]+rowOffsets_[localRow];
+  const int* rowEnd = &colIndices_[0]+rowOffsets_[localRow+1];
+  const int* ptr = std::lower_bound(rowBegin, rowEnd, localCol);
+  if (ptr == rowEnd || *ptr != localCol) return(-1);
+
+  return(ptr - &colIndices_[0]);
+}
+
+//----------------------------------------------------------------------------
+int DistCSRMat_core::getRowLength(GlobalOrdinal globalRow) const
+{
+  GlobalOrdinal localRowG = globalRow - firstLocalRow_;
+  if (localRowG < 0 || localRowG >= numLocalRows_) return(-1);
+  int localRow = static_cast<int>(localRowG);
+
+  return(rowOffsets_[localRow+1] - rowOffsets_[localRow]);
+}
+
+//----------------------------------------------------------------------------
+int DistCSRMat_core::postGhostExchange(const DistVec& x)
+{
+  const int numVectors = x.numVectors();
+  const int numGhosts = numGhostCols();
+  if ((int)ghostValues_.size() != numGhosts*numVectors) {
+    ghostValues_.assign(numGhosts*numVectors, 0.0);
+  }
+
+#ifndef FEI_SER
+  if (requests_.empty()) return(0);
+
+  //each message holds the entries for the first vector, then those for the
+  //second, etc. With one vector they are received directly into
+  //ghostValues_.
+  double* recvBuf = ghostValues_.empty() ? NULL : &ghostValues_[0];
+  if (numVectors > 1) {
+    ghostRecvBuffer_.resize(numGhosts*numVectors);
+    recvBuf = &ghostRecvBuffer_[0];
+  }
+  sendBuffer_.resize(sendLocalRows_.size()*numVectors);
+
+  const int tag = 19921;
+  int req = 0;
+  for(size_t i=0; i<recvProcs_.size(); ++i) {
+    int len = recvOffsets_[i+1] - recvOffsets_[i];
+    CHK_MPI( MPI_Irecv(recvBuf+recvOffsets_[i]*numVectors, len*numVectors,
+                       MPI_DOUBLE, recvProcs_[i], tag, comm_,
+                       &requests_[req++]) );
+  }
+
+  for(size_t i=0; i<sendProcs_.size(); ++i) {
+    const int begin = sendOffsets_[i];
+    const int len = sendOffsets_[i+1] - begin;
+    double* buf = len > 0 ? &sendBuffer_[begin*numVectors] : NULL;
+    for(int v=0; v<numVectors; ++v) {
+      const double* xcoefs = x.getLocalCoefs(v);
+      for(int k=0; k<len; ++k) {
+        buf[v*len+k] = xcoefs[sendLocalRows_[begin+k]];
+      }
+    }
+    CHK_MPI( MPI_Isend(buf, len*numVectors, MPI_DOUBLE,
+                       sendProcs_[i], tag, comm_, &requests_[req++]) );
+  }
+#endif
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int DistCSRMat_core::completeGhostExchange(int numVectors)
+{
+#ifndef FEI_SER
+  if (requests_.empty()) return(0);
+
+  CHK_MPI( MPI_Waitall((int)requests_.size(), &requests_[0],
+                       MPI_STATUSES_IGNORE) );
+
+  if (numVectors < 2) return(0);
+
+  //reorder from per-message to per-vector layout.
+  const int numGhosts = numGhostCols();
+  for(size_t i=0; i<recvProcs_.size(); ++i) {
+    const int begin = recvOffsets_[i];
+    const int len = recvOffsets_[i+1] - begin;
+    const double* buf = &ghostRecvBuffer_[begin*numVectors];
+    for(int v=0; v<numVectors; ++v) {
+      std::copy(buf+v*len, buf+(v+1)*len,
+                ghostValues_.begin()+v*numGhosts+begin);
+    }
+  }
+#else
+  (void)numVectors;
+#endif
+  return(0);
+}
+
+}//namespace fei
+
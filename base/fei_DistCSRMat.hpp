@@ -0,0 +1,405 @@
+#ifndef _fei_DistCSRMat_hpp_
+#define _fei_DistCSRMat_hpp_
+
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include "fei_macros.hpp"
+#include "fei_mpi.h"
+#include "fei_SparseRowGraph.hpp"
+#include "fei_DistVec.hpp"
+#include "fei_impl_utils.hpp"
+
+#include <algorithm>
+#include <vector>
+
+#undef fei_file
+#define fei_file "fei_DistCSRMat.hpp"
+#include "fei_ErrMacros.hpp"
+
+namespace fei {
+
+/** Structure and halo-exchange of a distributed compressed-sparse-row
+  matrix. The coefficients are held by the fei::DistCSRMatrix template
+  below, which derives from this class.
+
+  Each processor stores the rows it owns, which are a contiguous range of
+  global row numbers. Column indices are stored as local column numbers:
+  columns 0 .. numLocalRows()-1 are the locally-owned rows' global numbers in
+  order, and the remaining (ghost) columns follow, sorted by global number.
+  getColMap() gives the global number of each local column. Within a row,
+  the column entries are sorted by local column number, so the owned
+  columns of a row come before its ghost columns.
+
+  The structure is fixed at construction, from the locally-owned rows of a
+  matrix-graph. The constructor is collective: it works out which
+  processors own the ghost columns, and sets up the halo exchange that
+  brings those entries of a vector over for multiply().
+*/
+class DistCSRMat_core {
+ public:
+  /** Constructor. Collective.
+     @param comm Communicator.
+     @param firstLocalRow First locally-owned global row.
+     @param numLocalRows Number of locally-owned rows.
+     @param localGraph Structure of (some of) the locally-owned rows. Rows
+     that don't appear in localGraph are empty. Throws std::runtime_error
+     if localGraph contains a row that isn't locally owned, or if the
+     processors' row ranges don't follow each other in processor order.
+  */
+  DistCSRMat_core(MPI_Comm comm,
+                  GlobalOrdinal firstLocalRow,
+                  int numLocalRows,
+                  const SparseRowGraph& localGraph);
+
+  /** Destructor */
+  virtual ~DistCSRMat_core();
+
+  MPI_Comm getCommunicator() const { return comm_; }
+
+  GlobalOrdinal firstLocalRow() const { return firstLocalRow_; }
+
+  int numLocalRows() const { return numLocalRows_; }
+
+  GlobalOrdinal numGlobalRows() const { return globalRowOffsets_.back(); }
+
+  /** Number of columns that appear in local rows but aren't locally owned.*/
+  int numGhostCols() const { return colMap_.size() - numLocalRows_; }
+
+  /** Global number of each local column. */
+  const std::vector<GlobalOrdinal>& getColMap() const { return colMap_; }
+
+  /** First global row of each processor, with the total number of rows
+      as the last entry. */
+  const std::vector<GlobalOrdinal>& getGlobalRowOffsets() const
+  { return globalRowOffsets_; }
+
+  const std::vector<int>& getRowOffsets() const { return rowOffsets_; }
+
+  const std::vector<int>& getColIndices() const { return colIndices_; }
+
+  /** For each local row, the position in getColIndices() of its first ghost
+      column (or the end of the row if it has none). The row's entries
+      before that position are its owned columns. */
+  const std::vector<int>& getGhostBegin() const { return ghostBegin_; }
+
+  /** Local column number of global column 'globalCol', or -1 if the column
+      doesn't appear in any local row. */
+  int getLocalCol(GlobalOrdinal globalCol) const;
+
+  /** Position in getColIndices() (and in the coefficients) of the
+      (globalRow,globalCol) entry. Returns -1 if globalRow isn't locally
+      owned or the entry isn't in the structure. */
+  int getOffset(GlobalOrdinal globalRow, GlobalOrdinal globalCol) const;
+
+  /** Length of a locally-owned row, or -1 if not locally owned. */
+  int getRowLength(GlobalOrdinal globalRow) const;
+
+ protected:
+  /** Start sending the entries of x that other processors hold as ghost
+      columns, and receiving this processor's ghost entries, with one
+      message per neighboring processor for all of the vectors. */
+  int postGhostExchange(const DistVec& x);
+
+  /** Wait for the exchange started by postGhostExchange. The ghost entries
+      are then available from getGhostValues(). */
+  int completeGhostExchange(int numVectors);
+
+  /** Ghost entries of vector 'vectorIndex', in ghost-column order. */
+  const double* getGhostValues(int vectorIndex) const
+  { return &ghostValues_[vectorIndex*numGhostCols()]; }
+
+ private:
+  DistCSRMat_core(const DistCSRMat_core& src);
+  DistCSRMat_core& operator=(const DistCSRMat_core& src);
+
+  void createRowOffsets();
+  void createHaloPlan();
+
+  MPI_Comm comm_;
+  int localProc_;
+  int numProcs_;
+
+  GlobalOrdinal firstLocalRow_;
+  int numLocalRows_;
+  std::vector<GlobalOrdinal> globalRowOffsets_;
+
+  std::vector<int> rowOffsets_;
+  std::vector<int> ghostBegin_;
+  std::vector<int> colIndices_;
+  std::vector<GlobalOrdinal> colMap_;
+
+  //halo exchange: ghost columns received from recvProcs_[i] are local
+  //columns numLocalRows_+recvOffsets_[i] .. numLocalRows_+recvOffsets_[i+1]-1.
+  //Entries sendLocalRows_[sendOffsets_[i] .. sendOffsets_[i+1]-1] of x are
+  //sent to sendProcs_[i].
+  std::vector<int> recvProcs_;
+  std::vector<int> recvOffsets_;
+  std::vector<int> sendProcs_;
+  std::vector<int> sendOffsets_;
+  std::vector<int> sendLocalRows_;
+
+  //ghostValues_ holds the ghost entries of each vector in turn.
+  std::vector<double> sendBuffer_;
+  std::vector<double> ghostValues_;
+  std::vector<double> ghostRecvBuffer_;
+#ifndef FEI_SER
+  std::vector<MPI_Request> requests_;
+#endif
+};//class DistCSRMat_core
+
+/** Distributed compressed-sparse-row matrix, with coefficients stored as
+  Scalar (double or float). See fei::DistCSRMat_core for the layout.
+
+  Coefficients are always assembled in double precision. When Scalar is
+  narrower than double, contributions are summed into a double copy of the
+  coefficients (see getAssemblyCoefs()), which completeAssembly() rounds
+  into the Scalar storage and then releases. So a single-precision matrix
+  takes half the memory and bandwidth in multiply() and in preconditioners
+  computed from it, without accumulating rounding errors during assembly.
+*/
+template<typename Scalar>
+class DistCSRMatrix : public DistCSRMat_core {
+ public:
+  /** Constructor. Collective. See fei::DistCSRMat_core. */
+  DistCSRMatrix(MPI_Comm comm,
+                GlobalOrdinal firstLocalRow,
+                int numLocalRows,
+                const SparseRowGraph& localGraph)
+   : DistCSRMat_core(comm, firstLocalRow, numLocalRows, localGraph),
+     coefs_(getColIndices().size(), 0),
+     accum_()
+  {}
+
+  /** Destructor */
+  virtual ~DistCSRMatrix() {}
+
+  static const char* typeName();
+
+  /** Stored coefficients. When Scalar isn't double, these don't include
+      contributions made since the last completeAssembly(). */
+  std::vector<Scalar>& getCoefs() { return coefs_; }
+
+  const std::vector<Scalar>& getCoefs() const { return coefs_; }
+
+  /** Double-precision coefficients to assemble into, laid out like
+      getCoefs(), or NULL if there are no local entries. For double this is
+      the stored coefficients; otherwise it is the accumulation copy, which
+      is created from the stored coefficients if it doesn't exist. */
+  double* getAssemblyCoefs();
+
+  /** Round the accumulation copy (if any) into the stored coefficients and
+      release it. Does nothing when Scalar is double. */
+  void completeAssembly();
+
+  /** Set 'scalar' at every stored entry. */
+  void setValues(double scalar);
+
+  /** Sum (or, if sum_into is false, copy) coefficients into a locally-owned
+      row. Returns -1 if the row isn't locally owned or if any of the
+      columns isn't in the row's structure. Entries that were found before
+      the error was detected have already been updated.
+  */
+  int putRow(GlobalOrdinal globalRow, int numCols,
+             const GlobalOrdinal* globalCols,
+             const double* coefs, bool sum_into);
+
+  /** Same as putRow, with the row given as a local row number
+      (0 .. numLocalRows()-1) and the columns as local column numbers
+      (see getColMap()). */
+  int putRowLocal(int localRow, int numCols, const int* localCols,
+                  const double* coefs, bool sum_into);
+
+  /** Copy out (at most len entries of) a locally-owned row, with global
+      column indices. Returns -1 if the row isn't locally owned. */
+  int copyOutRow(GlobalOrdinal globalRow, int len, double* coefs,
+                 GlobalOrdinal* globalCols) const;
+
+  /** Form y = A*x, after completeAssembly(). x and y must have
+      numLocalRows() entries per vector. The ghost entries of x are
+      exchanged while the owned-column part of the product is being
+      computed, with one message per neighboring processor for all of the
+      vectors. Products are summed in double. Collective.
+  */
+  int multiply(const DistVec& x, DistVec& y);
+
+ private:
+  std::vector<Scalar> coefs_;
+  std::vector<double> accum_;
+};//class DistCSRMatrix
+
+/** The double-precision matrix used by default. */
+typedef DistCSRMatrix<double> DistCSRMat;
+
+template<>
+inline const char* DistCSRMatrix<double>::typeName()
+{ return("fei::DistCSRMat"); }
+
+template<>
+inline const char* DistCSRMatrix<float>::typeName()
+{ return("fei::DistCSRMatrix<float>"); }
+
+template<>
+inline double* DistCSRMatrix<double>::getAssemblyCoefs()
+{
+  return coefs_.empty() ? NULL : &coefs_[0];
+}
+
+template<typename Scalar>
+double* DistCSRMatrix<Scalar>::getAssemblyCoefs()
+{
+  if (coefs_.empty()) return(NULL);
+
+  if (accum_.size() != coefs_.size()) {
+    accum_.assign(coefs_.begin(), coefs_.end());
+  }
+  return &accum_[0];
+}
+
+template<typename Scalar>
+void DistCSRMatrix<Scalar>::completeAssembly()
+{
+  if (accum_.empty()) return;
+
+  const size_t len = coefs_.size();
+  for(size_t i=0; i<len; ++i) coefs_[i] = static_cast<Scalar>(accum_[i]);
+
+  std::vector<double>().swap(accum_);
+}
+
+template<typename Scalar>
+void DistCSRMatrix<Scalar>::setValues(double scalar)
+{
+  //a new assembly starts from the stored values.
+  std::vector<double>().swap(accum_);
+  const size_t len = coefs_.size();
+  for(size_t i=0; i<len; ++i) coefs_[i] = static_cast<Scalar>(scalar);
+}
+
+template<typename Scalar>
+int DistCSRMatrix<Scalar>::putRow(GlobalOrdinal globalRow, int numCols,
+                                  const GlobalOrdinal* globalCols,
+                                  const double* coefs, bool sum_into)
+{
+  GlobalOrdinal localRowG = globalRow - firstLocalRow();
+  if (localRowG < 0 || localRowG >= numLocalRows()) return(-1);
+  int localRow = static_cast<int>(localRowG);
+  if (numCols < 1) return(0);
+  if (getColIndices().empty()) return(-1);
+
+  const std::vector<int>& rowOffsets = getRowOffsets();
+  const int* rowBegin = &getColIndices()[0]+rowOffsets[localRow];
+  const int* rowEnd = &getColIndices()[0]+rowOffsets[localRow+1];
+  double* rowCoefs = getAssemblyCoefs()+rowOffsets[localRow];
+
+  for(int j=0; j<numCols; ++j) {
+    int localCol = getLocalCol(globalCols[j]);
+    const int* ptr = std::lower_bound(rowBegin, rowEnd, localCol);
+    if (localCol < 0 || ptr == rowEnd || *ptr != localCol) return(-1);
+
+    if (sum_into) rowCoefs[ptr-rowBegin] += coefs[j];
+    else rowCoefs[ptr-rowBegin] = coefs[j];
+  }
+
+  return(0);
+}
+
+template<typename Scalar>
+int DistCSRMatrix<Scalar>::putRowLocal(int localRow, int numCols,
+                                       const int* localCols,
+                                       const double* coefs, bool sum_into)
+{
+  if (localRow < 0 || localRow >= numLocalRows()) return(-1);
+  if (numCols < 1) return(0);
+  if (getColIndices().empty()) return(-1);
+
+  const std::vector<int>& rowOffsets = getRowOffsets();
+  const int* rowBegin = &getColIndices()[0]+rowOffsets[localRow];
+  const int* rowEnd = &getColIndices()[0]+rowOffsets[localRow+1];
+  double* rowCoefs = getAssemblyCoefs()+rowOffsets[localRow];
+
+  for(int j=0; j<numCols; ++j) {
+    const int* ptr = std::lower_bound(rowBegin, rowEnd, localCols[j]);
+    if (ptr == rowEnd || *ptr != localCols[j]) return(-1);
+
+    if (sum_into) rowCoefs[ptr-rowBegin] += coefs[j];
+    else rowCoefs[ptr-rowBegin] = coefs[j];
+  }
+
+  return(0);
+}
+
+template<typename Scalar>
+int DistCSRMatrix<Scalar>::copyOutRow(GlobalOrdinal globalRow, int len,
+                                      double* coefs,
+                                      GlobalOrdinal* globalCols) const
+{
+  GlobalOrdinal localRowG = globalRow - firstLocalRow();
+  if (localRowG < 0 || localRowG >= numLocalRows()) return(-1);
+  int localRow = static_cast<int>(localRowG);
+
+  const std::vector<int>& colIndices = getColIndices();
+  const std::vector<GlobalOrdinal>& colMap = getColMap();
+  int rowBegin = getRowOffsets()[localRow];
+  int rowLen = getRowOffsets()[localRow+1] - rowBegin;
+  if (len > rowLen) len = rowLen;
+
+  for(int j=0; j<len; ++j) {
+    coefs[j] = accum_.empty() ? coefs_[rowBegin+j] : accum_[rowBegin+j];
+    globalCols[j] = colMap[colIndices[rowBegin+j]];
+  }
+
+  return(0);
+}
+
+template<typename Scalar>
+int DistCSRMatrix<Scalar>::multiply(const DistVec& x, DistVec& y)
+{
+  const int numRows = numLocalRows();
+  if (x.localSize() != numRows || y.localSize() != numRows ||
+      x.numVectors() != y.numVectors()) {
+    ERReturn(-1);
+  }
+
+  completeAssembly();
+
+  const int* colInd = getColIndices().empty() ? NULL : &getColIndices()[0];
+  const Scalar* coefs = coefs_.empty() ? NULL : &coefs_[0];
+  const int* rowOffs = &getRowOffsets()[0];
+  const int* ghostBegin = getGhostBegin().empty() ? NULL : &getGhostBegin()[0];
+
+  //the ghost entries of all of the vectors are exchanged together, so
+  //there is one message per neighboring processor regardless of the number
+  //of vectors.
+  const int numVectors = x.numVectors();
+  CHK_ERR( postGhostExchange(x) );
+
+  for(int v=0; v<numVectors; ++v) {
+    fei::impl_utils::csr_matvec(numRows, rowOffs, ghostBegin,
+                                colInd, coefs, x.getLocalCoefs(v), false,
+                                y.getLocalCoefs(v));
+  }
+
+  CHK_ERR( completeGhostExchange(numVectors) );
+
+  if (numGhostCols() == 0) return(0);
+
+  for(int v=0; v<numVectors; ++v) {
+    const double* ghostx = getGhostValues(v) - numRows;
+    fei::impl_utils::csr_matvec(numRows, ghostBegin, rowOffs+1,
+                                colInd, coefs, ghostx, true,
+                                y.getLocalCoefs(v));
+  }
+
+  return(0);
+}
+
+}//namespace fei
+
+#endif // _fei_DistCSRMat_hpp_
+
@@ -0,0 +1,109 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include "fei_DistVec.hpp"
+#include "fei_CommUtils.hpp"
+
+#include <cmath>
+
+#undef fei_file
+#define fei_file "fei_DistVec.cpp"
+#include "fei_ErrMacros.hpp"
+
+namespace fei {
+
+//----------------------------------------------------------------------------
+DistVec::DistVec(MPI_Comm comm, GlobalOrdinal firstLocalOffset,
+                 int localSize,
+                 int numVectors)
+ : comm_(comm),
+   firstLocalOffset_(firstLocalOffset),
+   localSize_(localSize),
+   numVectors_(numVectors),
+   coefs_(localSize*numVectors, 0.0)
+{
+}
+
+//----------------------------------------------------------------------------
+DistVec::~DistVec()
+{
+}
+
+//----------------------------------------------------------------------------
+void DistVec::putScalar(double scalar)
+{
+  const size_t len = coefs_.size();
+  for(size_t i=0; i<len; ++i) coefs_[i] = scalar;
+}
+
+//----------------------------------------------------------------------------
+int DistVec::update(double a, const DistVec& x, double b)
+{
+  if (x.localSize_ != localSize_ || x.numVectors_ != numVectors_) return(-1);
+
+  const size_t len = coefs_.size();
+  double* coefs = len > 0 ? &coefs_[0] : NULL;
+  const double* xcoefs = len > 0 ? &x.coefs_[0] : NULL;
+
+  if (b == 1.0) {
+    for(size_t i=0; i<len; ++i) coefs[i] += a*xcoefs[i];
+  }
+  else if (b == 0.0) {
+    for(size_t i=0; i<len; ++i) coefs[i] = a*xcoefs[i];
+  }
+  else {
+    for(size_t i=0; i<len; ++i) coefs[i] = b*coefs[i] + a*xcoefs[i];
+  }
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int DistVec::dot(const DistVec& x, double& result, int vectorIndex) const
+{
+  if (x.localSize_ != localSize_ || vectorIndex >= x.numVectors_) return(-1);
+
+  const double* coefs = getLocalCoefs(vectorIndex);
+  const double* xcoefs = x.getLocalCoefs(vectorIndex);
+
+  double localSum = 0.0;
+  for(int i=0; i<localSize_; ++i) localSum += coefs[i]*xcoefs[i];
+
+  CHK_ERR( fei::GlobalSum(comm_, localSum, result) );
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int DistVec::norm2(double& result, int vectorIndex) const
+{
+  double sumSquares = 0.0;
+  CHK_ERR( dot(*this, sumSquares, vectorIndex) );
+  result = std::sqrt(sumSquares);
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int DistVec::dots(const DistVec& x, std::vector<double>& results) const
+{
+  if (x.localSize_ != localSize_ || x.numVectors_ != numVectors_) return(-1);
+
+  std::vector<double> localSums(numVectors_, 0.0);
+  for(int v=0; v<numVectors_; ++v) {
+    const double* coefs = getLocalCoefs(v);
+    const double* xcoefs = x.getLocalCoefs(v);
+    double localSum = 0.0;
+    for(int i=0; i<localSize_; ++i) localSum += coefs[i]*xcoefs[i];
+    localSums[v] = localSum;
+  }
+
+  CHK_ERR( fei::GlobalSum(comm_, localSums, results) );
+  return(0);
+}
+
+}//namespace fei
+
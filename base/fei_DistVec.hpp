@@ -0,0 +1,85 @@
+#ifndef _fei_DistVec_hpp_
+#define _fei_DistVec_hpp_
+
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include "fei_macros.hpp"
+#include "fei_mpi.h"
+
+#include <vector>
+
+namespace fei {
+
+/** Distributed vector with a contiguous range of locally-owned entries.
+  Each processor stores only its own entries, for global indices
+  firstLocalOffset() .. firstLocalOffset()+localSize()-1. Shared or
+  remotely-owned data is handled by the fei::Vector_Impl layer, which
+  forwards only locally-owned data to this object.
+
+  Several vectors with the same layout may be stored together
+  (numVectors() > 1), each in its own contiguous section of the coefficient
+  array.
+*/
+class DistVec {
+ public:
+  /** Constructor */
+  DistVec(MPI_Comm comm, GlobalOrdinal firstLocalOffset, int localSize,
+          int numVectors=1);
+
+  /** Destructor */
+  virtual ~DistVec();
+
+  MPI_Comm getCommunicator() const { return comm_; }
+
+  GlobalOrdinal firstLocalOffset() const { return firstLocalOffset_; }
+
+  int localSize() const { return localSize_; }
+
+  int numVectors() const { return numVectors_; }
+
+  /** Pointer to the local coefficients of vector 'vectorIndex'. */
+  double* getLocalCoefs(int vectorIndex=0)
+  { return localSize_ > 0 ? &coefs_[vectorIndex*localSize_] : NULL; }
+
+  const double* getLocalCoefs(int vectorIndex=0) const
+  { return localSize_ > 0 ? &coefs_[vectorIndex*localSize_] : NULL; }
+
+  /** Set 'scalar' throughout all of the vectors. */
+  void putScalar(double scalar);
+
+  /** this = b*this + a*x. Returns -1 if x doesn't have the same layout. */
+  int update(double a, const DistVec& x, double b);
+
+  /** Global dot-product of vector 'vectorIndex' of this and of x.
+      Collective. Returns -1 if x doesn't have the same layout. */
+  int dot(const DistVec& x, double& result, int vectorIndex=0) const;
+
+  /** Global 2-norm of vector 'vectorIndex'. Collective. */
+  int norm2(double& result, int vectorIndex=0) const;
+
+  /** Global dot-products of each vector of this with the corresponding
+      vector of x, with a single reduction for all of them. Collective.
+      Returns -1 if x doesn't have the same layout. */
+  int dots(const DistVec& x, std::vector<double>& results) const;
+
+ private:
+  DistVec(const DistVec& src);
+  DistVec& operator=(const DistVec& src);
+
+  MPI_Comm comm_;
+  GlobalOrdinal firstLocalOffset_;
+  int localSize_;
+  int numVectors_;
+  std::vector<double> coefs_;
+};//class DistVec
+
+}//namespace fei
+
+#endif // _fei_DistVec_hpp_
+
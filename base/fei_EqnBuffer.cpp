@@ -12,6 +12,7 @@
 #include <fei_CSVec.hpp>
 
 #include <fei_TemplateUtils.hpp>
+#include <fei_impl_utils.hpp>
 
 //==============================================================================
 EqnBuffer::EqnBuffer()
@@ -160,8 +161,9 @@ int EqnBuffer::isInIndices(int eqn)
   int numEqns = getNumEqns(), index;
   fei::CSVec** eqnsPtr = &eqns_[0];
   for(int i=0; i<numEqns; i++) {
-    std::vector<int>& indices = eqnsPtr[i]->indices();
-    index = fei::binarySearch(eqn, &indices[0], indices.size());
+    std::vector<fei::GlobalOrdinal>& indices = eqnsPtr[i]->indices();
+    index = fei::binarySearch(fei::GlobalOrdinal(eqn), &indices[0],
+                              indices.size());
     if (index > -1) return(i);
   }
 
@@ -203,7 +205,8 @@ int EqnBuffer::getCoef(int eqnNumber, int colIndex, double& coef)
   int eqnLoc = fei::binarySearch(eqnNumber, eqnNumbers_);
   if (eqnLoc < 0) return(-1);
 
-  int colLoc = fei::binarySearch(colIndex, eqns_[eqnLoc]->indices());
+  int colLoc = fei::binarySearch(fei::GlobalOrdinal(colIndex),
+                                 eqns_[eqnLoc]->indices());
   if (colLoc < 0) return(-1);
 
   coef = eqns_[eqnLoc]->coefs()[colLoc];
@@ -216,15 +219,16 @@ int EqnBuffer::removeIndex(int eqnNumber, int colIndex)
   int eqnLoc = fei::binarySearch(eqnNumber, eqnNumbers_);
   if (eqnLoc < 0) return(-1);
 
-  int colLoc = fei::binarySearch(colIndex, eqns_[eqnLoc]->indices());
+  int colLoc = fei::binarySearch(fei::GlobalOrdinal(colIndex),
+                                 eqns_[eqnLoc]->indices());
   if (colLoc < 0) return(0);
 
-  std::vector<int>& indices = eqns_[eqnLoc]->indices();
+  std::vector<fei::GlobalOrdinal>& indices = eqns_[eqnLoc]->indices();
   std::vector<double>& coefs= eqns_[eqnLoc]->coefs();
 
   int len = indices.size();
 
-  int* indPtr = &indices[0];
+  fei::GlobalOrdinal* indPtr = &indices[0];
   double* coefPtr = &coefs[0];
 
   for(int i=len-1; i>colLoc; --i) {
@@ -244,16 +248,17 @@ int EqnBuffer::getCoefAndRemoveIndex(int eqnNumber, int colIndex, double& coef)
   int eqnLoc = fei::binarySearch(eqnNumber, eqnNumbers_);
   if (eqnLoc < 0) return(-1);
 
-  int colLoc = fei::binarySearch(colIndex, eqns_[eqnLoc]->indices());
+  int colLoc = fei::binarySearch(fei::GlobalOrdinal(colIndex),
+                                 eqns_[eqnLoc]->indices());
   if (colLoc < 0) return(-1);
 
-  std::vector<int>& indices = eqns_[eqnLoc]->indices();
+  std::vector<fei::GlobalOrdinal>& indices = eqns_[eqnLoc]->indices();
   std::vector<double>& coefs= eqns_[eqnLoc]->coefs();
 
   coef = coefs[colLoc];
   int len = indices.size();
 
-  int* indPtr = &indices[0];
+  fei::GlobalOrdinal* indPtr = &indices[0];
   double* coefPtr = &coefs[0];
 
   for(int i=len-1; i>colLoc; --i) {
@@ -280,11 +285,15 @@ int EqnBuffer::addEqns(EqnBuffer& inputEqns, bool accumulate)
   int numRHSs = inputEqns.getNumRHSs();
   std::vector<double>** rhsCoefs = &((*(inputEqns.rhsCoefsPtr()))[0]);
 
+  //the old-FEI eqn buffers are limited to int eqn-numbers.
+  std::vector<int> iwork;
   for(int i=0; i<inputEqns.getNumEqns(); i++) {
-    std::vector<int>& indices_i  = eqs[i]->indices();
+    std::vector<fei::GlobalOrdinal>& indices_i  = eqs[i]->indices();
     std::vector<double>& coefs_i = eqs[i]->coefs();
 
-    int err = addEqn(eqnNums[i], &coefs_i[0], &indices_i[0],
+    int err = addEqn(eqnNums[i], &coefs_i[0],
+                     fei::impl_utils::int_indices(eqs[i]->size(),
+                                                  &indices_i[0], iwork),
 		    eqs[i]->size(), accumulate);
     if (err) return(err);
 
@@ -391,7 +400,7 @@ FEI_OSTREAM& operator<<(FEI_OSTREAM& os, EqnBuffer& eq)
   for(size_t i=0; i<eqnNums.size(); i++) {
     os << "#ereb eqn " << eqnNums[i] << ": ";
 
-    std::vector<int>& inds = eq.eqns()[i]->indices();
+    std::vector<fei::GlobalOrdinal>& inds = eq.eqns()[i]->indices();
     std::vector<double>& cfs = eq.eqns()[i]->coefs();
 
     for(size_t j=0; j<inds.size(); j++) {
@@ -9,6 +9,9 @@
 #include "fei_EqnComm.hpp"
 #include "fei_sstream.hpp"
 
+#include <limits>
+#include <stdexcept>
+
 namespace fei {
 
 EqnComm::EqnComm(MPI_Comm comm, int numLocalEqns)
@@ -34,11 +37,14 @@ EqnComm::EqnComm(MPI_Comm comm, int numLocalEqns)
 
   globalOffsets_.resize(numProcs+1);
 
-  int offset = 0;
+  long long offset = 0;
   for(int i=0; i<numProcs; ++i) {
     globalOffsets_[i] = offset;
     offset += global[i];
   }
+  if (offset > std::numeric_limits<GlobalOrdinal>::max()) {
+    throw std::runtime_error("fei::EqnComm ERROR, global number of eqns is more than fei::GlobalOrdinal can hold.");
+  }
   globalOffsets_[numProcs] = offset;
 
 #else
@@ -47,7 +53,8 @@ EqnComm::EqnComm(MPI_Comm comm, int numLocalEqns)
 #endif
 }
   
-EqnComm::EqnComm(MPI_Comm comm, int numLocalEqns, const std::vector<int>& globalOffsets)
+EqnComm::EqnComm(MPI_Comm comm, int numLocalEqns,
+                 const std::vector<GlobalOrdinal>& globalOffsets)
  : comm_(comm),
    globalOffsets_(globalOffsets)
 {
@@ -57,14 +64,14 @@ EqnComm::~EqnComm()
 {
 }
 
-const std::vector<int>&
+const std::vector<GlobalOrdinal>&
 EqnComm::getGlobalOffsets() const
 {
   return(globalOffsets_);
 }
 
 int
-EqnComm::getOwnerProc(int eqn) const
+EqnComm::getOwnerProc(GlobalOrdinal eqn) const
 {
 //  std::vector<int>::const_iterator
 //   iter = std::lower_bound(globalOffsets_.begin(), globalOffsets_.end(),
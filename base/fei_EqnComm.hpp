@@ -18,18 +18,19 @@ class EqnComm {
  public:
   /** constructor */
   EqnComm(MPI_Comm comm, int numLocalEqns);
-  EqnComm(MPI_Comm comm, int numLocalEqns, const std::vector<int>& globalOffsets);
+  EqnComm(MPI_Comm comm, int numLocalEqns,
+          const std::vector<GlobalOrdinal>& globalOffsets);
 
   /** destructor */
   virtual ~EqnComm();
 
-  const std::vector<int>& getGlobalOffsets() const;
+  const std::vector<GlobalOrdinal>& getGlobalOffsets() const;
 
-  int getOwnerProc(int eqn) const;
+  int getOwnerProc(GlobalOrdinal eqn) const;
 
  private:
   MPI_Comm comm_;
-  std::vector<int> globalOffsets_;
+  std::vector<GlobalOrdinal> globalOffsets_;
 };//class EqnComm
 }//namespace fei
 #endif
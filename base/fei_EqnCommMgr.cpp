@@ -17,6 +17,7 @@
 #include <fei_ProcEqns.hpp>
 #include <fei_EqnBuffer.hpp>
 #include <fei_TemplateUtils.hpp>
+#include <fei_impl_utils.hpp>
 
 #include <algorithm>
 
@@ -36,6 +37,25 @@ EqnCommMgr::EqnCommMgr(MPI_Comm comm, bool accumulate)
    sendEqns_(NULL),
    sendEqnSoln_(),
    essBCEqns_(NULL),
+   packedExchange_(false),
+   packedBuffersValid_(false),
+   packedNumRHSs_(0),
+   packedSendEqnNumbers_(),
+   sendEqnProcIndex_(),
+   sendEqnCoefOffset_(),
+   sendEqnRHSOffset_(),
+   sendEqnLength_(),
+   packedSendIndices_(),
+   packedSendCoefs_(),
+   packedRecvIndices_(),
+   packedRecvCoefs_(),
+   freezePattern_(false),
+   patternFrozen_(false),
+   solnLayoutValid_(false),
+   solnSendEqnLocs_(),
+   solnSendValues_(),
+   solnRecvEqnLocs_(),
+   solnRecvValues_(),
    comm_(comm)
 {
   localProc_ = fei::localProc(comm_);
@@ -59,6 +79,25 @@ EqnCommMgr::EqnCommMgr(const EqnCommMgr& src)
    sendEqns_(NULL),
    sendEqnSoln_(),
    essBCEqns_(NULL),
+   packedExchange_(false),
+   packedBuffersValid_(false),
+   packedNumRHSs_(0),
+   packedSendEqnNumbers_(),
+   sendEqnProcIndex_(),
+   sendEqnCoefOffset_(),
+   sendEqnRHSOffset_(),
+   sendEqnLength_(),
+   packedSendIndices_(),
+   packedSendCoefs_(),
+   packedRecvIndices_(),
+   packedRecvCoefs_(),
+   freezePattern_(false),
+   patternFrozen_(false),
+   solnLayoutValid_(false),
+   solnSendEqnLocs_(),
+   solnSendValues_(),
+   solnRecvEqnLocs_(),
+   solnRecvValues_(),
    comm_(src.comm_)
 {
   *this = src;
@@ -111,6 +150,23 @@ EqnCommMgr& EqnCommMgr::operator=(const EqnCommMgr& src)
    delete essBCEqns_;
    essBCEqns_ = src.essBCEqns_->deepCopy();
 
+   packedExchange_ = src.packedExchange_;
+   packedBuffersValid_ = src.packedBuffersValid_;
+   packedNumRHSs_ = src.packedNumRHSs_;
+   packedSendEqnNumbers_ = src.packedSendEqnNumbers_;
+   sendEqnProcIndex_ = src.sendEqnProcIndex_;
+   sendEqnCoefOffset_ = src.sendEqnCoefOffset_;
+   sendEqnRHSOffset_ = src.sendEqnRHSOffset_;
+   sendEqnLength_ = src.sendEqnLength_;
+   packedSendIndices_ = src.packedSendIndices_;
+   packedSendCoefs_ = src.packedSendCoefs_;
+   packedRecvIndices_ = src.packedRecvIndices_;
+   packedRecvCoefs_ = src.packedRecvCoefs_;
+
+   freezePattern_ = src.freezePattern_;
+   patternFrozen_ = src.patternFrozen_;
+   solnLayoutValid_ = false;
+
    return(*this);
 }
 
@@ -295,11 +351,12 @@ int EqnCommMgr::exchangeIndices(FEI_OSTREAM* dbgOut) {
 
     for(j=0; j<eqnsPerSendProc[i]; j++) {
       int eqnLoc = sendEqns_->getEqnIndex((*(sendProcEqnNumbers[i]))[j]);
-      std::vector<int>& sendIndices = sendEqns_->eqns()[eqnLoc]->indices();
-      int* sendIndicesPtr = &sendIndices[0];
+      std::vector<fei::GlobalOrdinal>& sendIndices =
+        sendEqns_->eqns()[eqnLoc]->indices();
+      fei::GlobalOrdinal* sendIndicesPtr = &sendIndices[0];
 
       for(int k=0; k<(*(sendProcLengths[i]))[j]; k++) {
-        indicesPtr[offset++] = sendIndicesPtr[k];
+        indicesPtr[offset++] = fei::impl_utils::int_index(sendIndicesPtr[k]);
       }
     }
 
@@ -345,6 +402,7 @@ int EqnCommMgr::exchangeIndices(FEI_OSTREAM* dbgOut) {
   solnValues_.resize(numRecvEqns);
 
   exchangeIndicesCalled_ = true;
+  solnLayoutValid_ = false;
 
   if (dbgOut != NULL) {
     FEI_OSTREAM& os = *dbgOut;
@@ -444,6 +502,22 @@ int EqnCommMgr::exchangeEqns(FEI_OSTREAM* dbgOut)
 
   recvEqns_->resetCoefs();
 
+  if (freezePattern_ && exchangeIndicesCalled_) {
+    if (dbgOut != NULL) {
+      (*dbgOut) << "#ereb exchangeEqns, frozen pattern"<<FEI_ENDL;
+    }
+    CHK_ERR( exchangeFrozenEqns() );
+    return(0);
+  }
+
+  if (usePackedBuffers()) {
+    if (dbgOut != NULL) {
+      (*dbgOut) << "#ereb exchangeEqns, packed buffers"<<FEI_ENDL;
+    }
+    CHK_ERR( exchangePackedEqns() );
+    return(0);
+  }
+
   if (dbgOut != NULL) {
     FEI_OSTREAM& os = *dbgOut;
     os << "#ereb exchangeEqns begin, sendEqns_:"<<FEI_ENDL;
@@ -462,6 +536,210 @@ int EqnCommMgr::exchangeEqns(FEI_OSTREAM* dbgOut)
   return(0);
 }
 
+//------------------------------------------------------------------------------
+int EqnCommMgr::exchangePackedEqns()
+{
+  //Same messages (tags and layout) as exchangeEqnBuffers, but sent straight
+  //from, and received straight into, the persistent packed buffers.
+#ifndef FEI_SER
+  int indTag = 9113, coefTag = 9114;
+
+  size_t numRecvProcs = recvProcEqns_->getNumProcs();
+  size_t numSendProcs = sendProcEqns_->getNumProcs();
+  if ((numRecvProcs == 0) && (numSendProcs == 0)) return(0);
+
+  std::vector<int>& recvProcs = recvProcEqns_->procsPtr();
+  std::vector<int>& sendProcs = sendProcEqns_->procsPtr();
+
+  std::vector<MPI_Request> requests(2*numRecvProcs);
+
+  for(unsigned i=0; i<numRecvProcs; i++) {
+    std::vector<int>& indices = packedRecvIndices_[i];
+    std::vector<double>& coefs = packedRecvCoefs_[i];
+
+    MPI_Irecv(&indices[0], (int)indices.size(), MPI_INT,
+              recvProcs[i], indTag, comm_, &requests[2*i]);
+
+    MPI_Irecv(&coefs[0], (int)coefs.size()-2, MPI_DOUBLE,
+              recvProcs[i], coefTag, comm_, &requests[2*i+1]);
+  }
+
+  for(unsigned i=0; i<numSendProcs; i++) {
+    std::vector<int>& indices = packedSendIndices_[i];
+    std::vector<double>& coefs = packedSendCoefs_[i];
+
+    //the last two entries of the indices buffer carry the new*Data_ flags.
+    int len = indices.size();
+    indices[len-2] = sendEqns_->newCoefData_;
+    indices[len-1] = sendEqns_->newRHSData_;
+
+    MPI_Send(&indices[0], len, MPI_INT, sendProcs[i], indTag, comm_);
+    MPI_Send(&coefs[0], (int)coefs.size()-2, MPI_DOUBLE,
+             sendProcs[i], coefTag, comm_);
+  }
+
+  if (numRecvProcs > 0) {
+    std::vector<MPI_Status> statuses(requests.size());
+    MPI_Waitall((int)requests.size(), &requests[0], &statuses[0]);
+  }
+
+  for(unsigned i=0; i<numRecvProcs; i++) {
+    std::vector<int>& indices = packedRecvIndices_[i];
+    int len = indices.size();
+    recvEqns_->newCoefData_ += indices[len-2];
+    recvEqns_->newRHSData_  += indices[len-1];
+  }
+#endif //#ifndef FEI_SER
+
+  return(0);
+}
+
+//------------------------------------------------------------------------------
+int EqnCommMgr::exchangePackedValues()
+{
+  //Values-only exchange for a frozen pattern: one message per processor,
+  //holding the coefs and rhs-coefs followed by the new*Data_ flags.
+#ifndef FEI_SER
+  int valTag = 9115;
+
+  size_t numRecvProcs = recvProcEqns_->getNumProcs();
+  size_t numSendProcs = sendProcEqns_->getNumProcs();
+  if ((numRecvProcs == 0) && (numSendProcs == 0)) return(0);
+
+  std::vector<int>& recvProcs = recvProcEqns_->procsPtr();
+  std::vector<int>& sendProcs = sendProcEqns_->procsPtr();
+
+  std::vector<MPI_Request> requests(numRecvProcs);
+
+  for(unsigned i=0; i<numRecvProcs; i++) {
+    std::vector<double>& coefs = packedRecvCoefs_[i];
+    MPI_Irecv(&coefs[0], (int)coefs.size(), MPI_DOUBLE,
+              recvProcs[i], valTag, comm_, &requests[i]);
+  }
+
+  for(unsigned i=0; i<numSendProcs; i++) {
+    std::vector<double>& coefs = packedSendCoefs_[i];
+    int len = coefs.size();
+    coefs[len-2] = sendEqns_->newCoefData_;
+    coefs[len-1] = sendEqns_->newRHSData_;
+
+    MPI_Send(&coefs[0], len, MPI_DOUBLE, sendProcs[i], valTag, comm_);
+  }
+
+  if (numRecvProcs > 0) {
+    std::vector<MPI_Status> statuses(numRecvProcs);
+    MPI_Waitall((int)numRecvProcs, &requests[0], &statuses[0]);
+  }
+
+  for(unsigned i=0; i<numRecvProcs; i++) {
+    std::vector<double>& coefs = packedRecvCoefs_[i];
+    int len = coefs.size();
+    recvEqns_->newCoefData_ += (int)coefs[len-2];
+    recvEqns_->newRHSData_  += (int)coefs[len-1];
+  }
+#endif //#ifndef FEI_SER
+
+  return(0);
+}
+
+//------------------------------------------------------------------------------
+int EqnCommMgr::frozenPatternChanged()
+{
+  //returns 2 if remote equations or column-indices have been added since the
+  //pattern was frozen (exchangeIndices must be repeated), 1 if the pattern
+  //hasn't been frozen yet or the packed layout must be rebuilt, else 0.
+  //(send equations are never removed, so if the number of them is unchanged
+  //they are the same equations, in the same order.)
+  int numSendEqns = sendEqns_->getNumEqns();
+  if (packedBuffersValid_ && numSendEqns != (int)packedSendEqnNumbers_.size()) {
+    return(2);
+  }
+
+  if (packedBuffersValid_) {
+    std::vector<fei::CSVec*>& sendEqns = sendEqns_->eqns();
+    for(int i=0; i<numSendEqns; ++i) {
+      if (sendEqnProcIndex_[i] < 0) continue;
+      if ((int)sendEqns[i]->size() != sendEqnLength_[i]) return(2);
+    }
+  }
+
+  if (!packedBuffersValid_ || !patternFrozen_) return(1);
+
+  return(0);
+}
+
+//------------------------------------------------------------------------------
+int EqnCommMgr::exchangeFrozenEqns()
+{
+  int localChange = frozenPatternChanged();
+  int globalChange = 0;
+  CHK_ERR( fei::GlobalMax(comm_, localChange, globalChange) );
+
+  if (globalChange > 0) {
+    //fall back to a full exchange of indices and coefs, from which the new
+    //pattern is frozen.
+    if (packedBuffersValid_) flushPackedBuffers();
+
+    if (globalChange > 1) {
+      CHK_ERR( exchangeIndices() );
+    }
+
+    CHK_ERR( buildPackedBuffers() );
+    CHK_ERR( exchangePackedEqns() );
+    patternFrozen_ = true;
+  }
+  else {
+    if (!packedExchange_) copyPackedSendCoefs(true);
+    CHK_ERR( exchangePackedValues() );
+  }
+
+  if (!packedExchange_) {
+    CHK_ERR( unpackRecvBuffers() );
+  }
+
+  return(0);
+}
+
+//------------------------------------------------------------------------------
+int EqnCommMgr::unpackRecvBuffers()
+{
+  //put the contents of the packed receive buffers into recvEqns_, the same
+  //way exchangeEqnBuffers does.
+  size_t numRecvProcs = recvProcEqns_->getNumProcs();
+  std::vector<int>& eqnsPerRecvProc = recvProcEqns_->eqnsPerProcPtr();
+  std::vector<std::vector<int>*>& recvProcEqnNumbers =
+    recvProcEqns_->procEqnNumbersPtr();
+  std::vector<std::vector<int>*>& recvProcEqnLengths =
+    recvProcEqns_->procEqnLengthsPtr();
+
+  recvEqns_->setNumRHSs(packedNumRHSs_);
+
+  for(unsigned i=0; i<numRecvProcs; i++) {
+    const int* indices = &(packedRecvIndices_[i][0]);
+    const double* coefs = &(packedRecvCoefs_[i][0]);
+
+    int offset = 0;
+    for(int j=0; j<eqnsPerRecvProc[i]; j++) {
+      int eqn = (*(recvProcEqnNumbers[i]))[j];
+      int len = (*(recvProcEqnLengths[i]))[j];
+
+      CHK_ERR( recvEqns_->addEqn(eqn, coefs+offset, indices+offset, len,
+                                 accumulate_) );
+      offset += len;
+    }
+
+    for(int j=0; j<eqnsPerRecvProc[i]; j++) {
+      int eqn = (*(recvProcEqnNumbers[i]))[j];
+
+      for(int k=0; k<packedNumRHSs_; k++) {
+        CHK_ERR( recvEqns_->addRHS(eqn, k, coefs[offset++], accumulate_) );
+      }
+    }
+  }
+
+  return(0);
+}
+
 //------------------------------------------------------------------------------
 int EqnCommMgr::exchangeEqnBuffers(MPI_Comm comm, ProcEqns* sendProcEqns,
                               EqnBuffer* sendEqns, ProcEqns* recvProcEqns,
@@ -574,11 +852,12 @@ int EqnCommMgr::exchangeEqnBuffers(MPI_Comm comm, ProcEqns* sendProcEqns,
       //first pack up the coefs and indices
       for(j=0; j<eqnsPerSendProc[i]; j++) {
          int eqnLoc = sendEqns->getEqnIndex(sendProcEqnNumbers_i[j]);
-	 int* sendIndices = &(sendEqns->eqns()[eqnLoc]->indices())[0];
+	 fei::GlobalOrdinal* sendIndices =
+           &(sendEqns->eqns()[eqnLoc]->indices())[0];
 	 double* sendCoefs= &(sendEqns->eqns()[eqnLoc]->coefs())[0];
 
          for(int k=0; k<sendProcEqnLengths_i[j]; k++) {
-            indicesPtr[offset] = sendIndices[k];
+            indicesPtr[offset] = fei::impl_utils::int_index(sendIndices[k]);
             coefsPtr[offset++] = sendCoefs[k];
          }
       }
@@ -668,6 +947,51 @@ void EqnCommMgr::exchangeSoln()
 
    int solnTag = 19906;
 
+   if (freezePattern_ && exchangeIndicesCalled_) {
+     //persistent buffers and precomputed equation offsets.
+     if (!solnLayoutValid_ ||
+         (int)sendEqnSoln_.size() != sendEqns_->getNumEqns()) {
+       buildSolnLayout();
+     }
+
+     size_t numSendProcs = sendProcEqns_->getNumProcs();
+     std::vector<int>& sendProcs = sendProcEqns_->procsPtr();
+     std::vector<int>& eqnsPerSendProc = sendProcEqns_->eqnsPerProcPtr();
+     size_t numRecvProcs = recvProcEqns_->getNumProcs();
+     std::vector<int>& recvProcs = recvProcEqns_->procsPtr();
+     std::vector<int>& eqnsPerRecvProc = recvProcEqns_->eqnsPerProcPtr();
+
+     std::vector<MPI_Request> requests(numSendProcs);
+     int offset = 0;
+     for(unsigned i=0; i<numSendProcs; i++) {
+       MPI_Irecv(&solnRecvValues_[offset], eqnsPerSendProc[i], MPI_DOUBLE,
+                 sendProcs[i], solnTag, comm_, &requests[i]);
+       offset += eqnsPerSendProc[i];
+     }
+
+     for(size_t j=0; j<solnSendEqnLocs_.size(); ++j) {
+       solnSendValues_[j] = solnValues_[solnSendEqnLocs_[j]];
+     }
+
+     offset = 0;
+     for(unsigned i=0; i<numRecvProcs; i++) {
+       MPI_Send(&solnSendValues_[offset], eqnsPerRecvProc[i], MPI_DOUBLE,
+                recvProcs[i], solnTag, comm_);
+       offset += eqnsPerRecvProc[i];
+     }
+
+     if (numSendProcs > 0) {
+       std::vector<MPI_Status> statuses(numSendProcs);
+       MPI_Waitall((int)numSendProcs, &requests[0], &statuses[0]);
+     }
+
+     for(size_t j=0; j<solnRecvEqnLocs_.size(); ++j) {
+       sendEqnSoln_[solnRecvEqnLocs_[j]] = solnRecvValues_[j];
+     }
+
+     return;
+   }
+
    MPI_Request* solnRequests = NULL;
    double** solnBuffer = NULL;
 
@@ -740,6 +1064,42 @@ void EqnCommMgr::exchangeSoln()
 #endif //#ifndef FEI_SER
 }
 
+//------------------------------------------------------------------------------
+void EqnCommMgr::buildSolnLayout()
+{
+  //offsets into recvEqns_ of the eqns whose soln values go to each recv-proc,
+  //and into sendEqns_ of the eqns whose soln values come from each send-proc,
+  //in message order.
+  solnSendEqnLocs_.clear();
+  size_t numRecvProcs = recvProcEqns_->getNumProcs();
+  std::vector<int>& eqnsPerRecvProc = recvProcEqns_->eqnsPerProcPtr();
+  std::vector<std::vector<int>*>& recvProcEqnNumbers =
+    recvProcEqns_->procEqnNumbersPtr();
+  for(unsigned i=0; i<numRecvProcs; i++) {
+    for(int j=0; j<eqnsPerRecvProc[i]; j++) {
+      solnSendEqnLocs_.push_back(
+        recvEqns_->getEqnIndex((*(recvProcEqnNumbers[i]))[j]));
+    }
+  }
+  solnSendValues_.resize(solnSendEqnLocs_.size());
+
+  solnRecvEqnLocs_.clear();
+  size_t numSendProcs = sendProcEqns_->getNumProcs();
+  std::vector<int>& eqnsPerSendProc = sendProcEqns_->eqnsPerProcPtr();
+  std::vector<std::vector<int>*>& sendProcEqnNumbers =
+    sendProcEqns_->procEqnNumbersPtr();
+  for(unsigned i=0; i<numSendProcs; i++) {
+    for(int j=0; j<eqnsPerSendProc[i]; j++) {
+      solnRecvEqnLocs_.push_back(
+        sendEqns_->getEqnIndex((*(sendProcEqnNumbers[i]))[j]));
+    }
+  }
+  solnRecvValues_.resize(solnRecvEqnLocs_.size());
+
+  sendEqnSoln_.resize(sendEqns_->getNumEqns());
+  solnLayoutValid_ = true;
+}
+
 //------------------------------------------------------------------------------
 // This works around an issue with the clang and ARMHPC compiler
 // Needs to be revisited with later versions
@@ -887,10 +1247,14 @@ int EqnCommMgr::mirrorProcEqnLengths(ProcEqns& inProcEqns,
 //------------------------------------------------------------------------------
 int EqnCommMgr::addRemoteEqn(int eqnNumber, int destProc,
                             const double* coefs, const int* indices, int num) {
-   (void)destProc;
-   sendEqns_->newCoefData_ = 1;
+   //with a frozen pattern, a new remote equation is recorded so that the
+   //next exchangeEqns can re-run exchangeIndices for it.
+   if (freezePattern_ && exchangeIndicesCalled_ && destProc >= 0 &&
+       sendEqns_->getEqnIndex(eqnNumber) < 0) {
+     sendProcEqns_->addEqn(eqnNumber, destProc);
+   }
 
-   return(sendEqns_->addEqn(eqnNumber, coefs, indices, num, accumulate_));
+   return( addRemoteEqn(eqnNumber, coefs, indices, num) );
 }
 
 //------------------------------------------------------------------------------
@@ -899,11 +1263,59 @@ int EqnCommMgr::addRemoteEqn(int eqnNumber, const double* coefs,
 {
    sendEqns_->newCoefData_ = 1;
 
+   if (usePackedBuffers()) {
+     int eqnLoc = fei::binarySearch(eqnNumber, packedSendEqnNumbers_);
+     if (eqnLoc >= 0 && sendEqnProcIndex_[eqnLoc] >= 0) {
+       return( addPackedRemoteEqn(eqnLoc, coefs, indices, num) );
+     }
+   }
+
    return(sendEqns_->addEqn(eqnNumber, coefs, indices, num, accumulate_));
 }
 
+//------------------------------------------------------------------------------
+int EqnCommMgr::addPackedRemoteEqn(int eqnLoc, const double* coefs,
+                                   const int* indices, int num)
+{
+  int procIndex = sendEqnProcIndex_[eqnLoc];
+  int offset = sendEqnCoefOffset_[eqnLoc];
+  int len = sendEqnLength_[eqnLoc];
+
+  const int* eqnIndices = &(packedSendIndices_[procIndex][offset]);
+  double* eqnCoefs = &(packedSendCoefs_[procIndex][offset]);
+
+  for(int i=0; i<num; ++i) {
+    int pos = fei::binarySearch(indices[i], eqnIndices, len);
+    if (pos < 0) {
+      if (freezePattern_) {
+        //new column: goes into the send EqnBuffer, which changes the
+        //pattern and triggers a full exchange next time.
+        CHK_ERR( sendEqns_->addEqn(packedSendEqnNumbers_[eqnLoc], &coefs[i],
+                                   &indices[i], 1, accumulate_) );
+        continue;
+      }
+
+      fei::console_out() << "EqnCommMgr::addRemoteEqn ERROR, column "
+         << indices[i] << " not in the structure of remote eqn "
+         << packedSendEqnNumbers_[eqnLoc] << FEI_ENDL;
+      ERReturn(-1);
+    }
+
+    if (accumulate_) eqnCoefs[pos] += coefs[i];
+    else eqnCoefs[pos] = coefs[i];
+  }
+
+  return(0);
+}
+
 //------------------------------------------------------------------------------
 void EqnCommMgr::setNumRHSs(int numRHSs) {
+   //the packed layout depends on numRHSs, so its contents go back into the
+   //send EqnBuffer and the layout is rebuilt the next time it's needed.
+   if (packedBuffersValid_ && numRHSs != packedNumRHSs_) {
+     flushPackedBuffers();
+   }
+
    sendEqns_->setNumRHSs(numRHSs);
    recvEqns_->setNumRHSs(numRHSs);
 }
@@ -913,17 +1325,231 @@ int EqnCommMgr::addRemoteRHS(int eqnNumber, int destProc, int rhsIndex,
                             double value)
 {
    (void)destProc;
-   sendEqns_->newRHSData_ = 1;
-   return(sendEqns_->addRHS(eqnNumber, rhsIndex, value));
+   return( addRemoteRHS(eqnNumber, rhsIndex, value) );
 }
 
 //------------------------------------------------------------------------------
 int EqnCommMgr::addRemoteRHS(int eqnNumber, int rhsIndex, double value)
 {
    sendEqns_->newRHSData_ = 1;
+
+   if (usePackedBuffers()) {
+     int eqnLoc = fei::binarySearch(eqnNumber, packedSendEqnNumbers_);
+     if (eqnLoc >= 0 && sendEqnProcIndex_[eqnLoc] >= 0) {
+       if (rhsIndex < 0) ERReturn(-1);
+       if (rhsIndex >= packedNumRHSs_) {
+         setNumRHSs(rhsIndex+1);
+         return( addRemoteRHS(eqnNumber, rhsIndex, value) );
+       }
+       int procIndex = sendEqnProcIndex_[eqnLoc];
+       packedSendCoefs_[procIndex][sendEqnRHSOffset_[eqnLoc]+rhsIndex] += value;
+       return(0);
+     }
+   }
+
    return(sendEqns_->addRHS(eqnNumber, rhsIndex, value));
 }
 
+//------------------------------------------------------------------------------
+void EqnCommMgr::setPackedExchange(bool packed)
+{
+  if (!packed && packedBuffersValid_) flushPackedBuffers();
+  packedExchange_ = packed;
+}
+
+//------------------------------------------------------------------------------
+void EqnCommMgr::setFreezePattern(bool freeze)
+{
+  freezePattern_ = freeze;
+  patternFrozen_ = false;
+}
+
+//------------------------------------------------------------------------------
+void EqnCommMgr::flushPackedBuffers()
+{
+  //In packed mode, copy the packed send coefficients back into the send
+  //EqnBuffer, which is where the unpacked exchange (and a rebuilt packed
+  //layout) takes them from. Otherwise the send EqnBuffer is already current.
+  if (packedExchange_) copyPackedSendCoefs(false);
+
+  packedBuffersValid_ = false;
+  patternFrozen_ = false;
+}
+
+//------------------------------------------------------------------------------
+void EqnCommMgr::copyPackedSendCoefs(bool toPacked)
+{
+  //copy coefs and rhs-coefs between sendEqns_ and the packed send buffers,
+  //in the direction given by 'toPacked'. Equations and columns are matched
+  //by number, since sendEqns_ may have grown since the layout was built.
+  std::vector<fei::CSVec*>& sendEqns = sendEqns_->eqns();
+  std::vector<std::vector<double>*>& sendRHS = *(sendEqns_->rhsCoefsPtr());
+
+  for(size_t i=0; i<packedSendEqnNumbers_.size(); ++i) {
+    int procIndex = sendEqnProcIndex_[i];
+    if (procIndex < 0) continue;
+
+    int eqnLoc = sendEqns_->getEqnIndex(packedSendEqnNumbers_[i]);
+    if (eqnLoc < 0) continue;
+
+    double* coefs = &(packedSendCoefs_[procIndex][0]);
+    const int* indices = &(packedSendIndices_[procIndex][0]);
+    std::vector<fei::GlobalOrdinal>& eqnIndices = sendEqns[eqnLoc]->indices();
+    std::vector<double>& eqnCoefs = sendEqns[eqnLoc]->coefs();
+    int offset = sendEqnCoefOffset_[i];
+    int len = sendEqnLength_[i];
+    bool samePattern = (int)eqnIndices.size() == len;
+
+    for(int k=0; k<len; ++k) {
+      int pos = samePattern ? k :
+        fei::binarySearch(fei::GlobalOrdinal(indices[offset+k]), eqnIndices);
+      if (pos < 0) continue;
+
+      if (toPacked) coefs[offset+k] = eqnCoefs[pos];
+      else eqnCoefs[pos] = coefs[offset+k];
+    }
+
+    std::vector<double>& rhsCoefs = *(sendRHS[eqnLoc]);
+    int rhsOffset = sendEqnRHSOffset_[i];
+    for(int k=0; k<packedNumRHSs_ && k<(int)rhsCoefs.size(); ++k) {
+      if (toPacked) coefs[rhsOffset+k] = rhsCoefs[k];
+      else rhsCoefs[k] = coefs[rhsOffset+k];
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool EqnCommMgr::usePackedBuffers()
+{
+  if (!packedExchange_ || !exchangeIndicesCalled_) return(false);
+
+  if (!packedBuffersValid_) {
+    if (buildPackedBuffers() != 0) {
+      packedExchange_ = false;
+      return(false);
+    }
+  }
+
+  return(true);
+}
+
+//------------------------------------------------------------------------------
+int EqnCommMgr::buildPackedBuffers()
+{
+  //Lay out one message per destination processor, in the order given by
+  //sendProcEqns_: the column-indices of each equation end-to-end followed by
+  //2 slots for the new*Data_ flags, and the coefficients of each equation
+  //end-to-end followed by numRHSs rhs-coefs per equation and 2 more flag
+  //slots (used by the values-only exchange). The current contents of
+  //sendEqns_ are copied in, so nothing added before this point is lost.
+  int numRHSs = sendEqns_->getNumRHSs();
+  int numSendEqns = sendEqns_->getNumEqns();
+
+  packedSendEqnNumbers_ = sendEqns_->eqnNumbers();
+  sendEqnProcIndex_.assign(numSendEqns, -1);
+  sendEqnCoefOffset_.assign(numSendEqns, 0);
+  sendEqnRHSOffset_.assign(numSendEqns, 0);
+  sendEqnLength_.assign(numSendEqns, 0);
+
+  std::vector<fei::CSVec*>& sendEqns = sendEqns_->eqns();
+
+  size_t numSendProcs = sendProcEqns_->getNumProcs();
+  std::vector<int>& eqnsPerSendProc = sendProcEqns_->eqnsPerProcPtr();
+  std::vector<std::vector<int>*>& sendProcEqnNumbers =
+    sendProcEqns_->procEqnNumbersPtr();
+  std::vector<std::vector<int>*>& sendProcEqnLengths =
+    sendProcEqns_->procEqnLengthsPtr();
+
+  packedSendIndices_.resize(numSendProcs);
+  packedSendCoefs_.resize(numSendProcs);
+
+  for(unsigned i=0; i<numSendProcs; ++i) {
+    int numEqns = eqnsPerSendProc[i];
+    int totalLength = 0;
+    for(int j=0; j<numEqns; ++j) {
+      totalLength += (*(sendProcEqnLengths[i]))[j];
+    }
+
+    std::vector<int>& indices = packedSendIndices_[i];
+    indices.assign(totalLength+2, 0);
+    packedSendCoefs_[i].assign(totalLength + numRHSs*numEqns + 2, 0.0);
+
+    int offset = 0;
+    int rhsOffset = totalLength;
+    for(int j=0; j<numEqns; ++j) {
+      int eqnLoc = sendEqns_->getEqnIndex((*(sendProcEqnNumbers[i]))[j]);
+      int len = (*(sendProcEqnLengths[i]))[j];
+      if (eqnLoc < 0 || len > (int)sendEqns[eqnLoc]->size()) ERReturn(-1);
+
+      std::vector<fei::GlobalOrdinal>& eqnIndices = sendEqns[eqnLoc]->indices();
+      for(int k=0; k<len; ++k) {
+        indices[offset+k] = fei::impl_utils::int_index(eqnIndices[k]);
+      }
+
+      sendEqnProcIndex_[eqnLoc] = i;
+      sendEqnCoefOffset_[eqnLoc] = offset;
+      sendEqnRHSOffset_[eqnLoc] = rhsOffset;
+      sendEqnLength_[eqnLoc] = len;
+
+      offset += len;
+      rhsOffset += numRHSs;
+    }
+  }
+
+  size_t numRecvProcs = recvProcEqns_->getNumProcs();
+  std::vector<int>& eqnsPerRecvProc = recvProcEqns_->eqnsPerProcPtr();
+  std::vector<std::vector<int>*>& recvProcEqnLengths =
+    recvProcEqns_->procEqnLengthsPtr();
+
+  packedRecvIndices_.resize(numRecvProcs);
+  packedRecvCoefs_.resize(numRecvProcs);
+
+  for(unsigned i=0; i<numRecvProcs; ++i) {
+    int totalLength = 0;
+    for(int j=0; j<eqnsPerRecvProc[i]; ++j) {
+      totalLength += (*(recvProcEqnLengths[i]))[j];
+    }
+
+    packedRecvIndices_[i].assign(totalLength+2, 0);
+    packedRecvCoefs_[i].assign(totalLength + numRHSs*eqnsPerRecvProc[i] + 2,
+                               0.0);
+  }
+
+  packedNumRHSs_ = numRHSs;
+  packedBuffersValid_ = true;
+  patternFrozen_ = false;
+
+  copyPackedSendCoefs(true);
+
+  return(0);
+}
+
+//------------------------------------------------------------------------------
+int EqnCommMgr::getPackedRecvEqns(size_t i, int& numEqns,
+                                  const int*& eqnNumbers,
+                                  const int*& eqnLengths,
+                                  const int*& indices, const double*& coefs,
+                                  int& numRHSs, const double*& rhsCoefs)
+{
+  if (!packedExchange_ || !packedBuffersValid_) return(-1);
+  if (i >= packedRecvIndices_.size()) return(-1);
+
+  numEqns = recvProcEqns_->eqnsPerProcPtr()[i];
+  std::vector<int>& eqns = *(recvProcEqns_->procEqnNumbersPtr()[i]);
+  std::vector<int>& lengths = *(recvProcEqns_->procEqnLengthsPtr()[i]);
+
+  int totalLength = packedRecvIndices_[i].size() - 2;
+
+  eqnNumbers = numEqns > 0 ? &eqns[0] : NULL;
+  eqnLengths = numEqns > 0 ? &lengths[0] : NULL;
+  indices = &(packedRecvIndices_[i][0]);
+  coefs = &(packedRecvCoefs_[i][0]);
+  numRHSs = packedNumRHSs_;
+  rhsCoefs = coefs + totalLength;
+
+  return(0);
+}
+
 //------------------------------------------------------------------------------
 void EqnCommMgr::addRemoteIndices(int eqnNumber, int destProc,
                                 int* indices, int num)
@@ -944,6 +1570,14 @@ void EqnCommMgr::resetCoefs() {
    sendEqns_->resetCoefs();
    essBCEqns_->resetCoefs();
 
+   //as with the send EqnBuffer, only the matrix coefficients are zeroed,
+   //the rhs section of each packed buffer is left alone.
+   for(size_t i=0; i<packedSendCoefs_.size(); ++i) {
+     int totalLength = packedSendIndices_[i].size() - 2;
+     std::fill(packedSendCoefs_[i].begin(),
+               packedSendCoefs_[i].begin() + totalLength, 0.0);
+   }
+
    sendEqns_->newCoefData_ = 0;
    sendEqns_->newRHSData_ = 0;
    recvEqns_->newCoefData_ = 0;
@@ -991,6 +1625,7 @@ int EqnCommMgr::gatherSharedBCs(EqnBuffer& bcEqns)
     sendProcEqns_->procEqnNumbersPtr();
   size_t numSendProcs = sendProcs.size();
 
+  std::vector<int> iwork;
   for(i=0; i<numBCeqns; i++) {
     int eqn = bcEqnNumbers[i];
 
@@ -998,8 +1633,10 @@ int EqnCommMgr::gatherSharedBCs(EqnBuffer& bcEqns)
     if (index<0) continue;
 
     std::vector<double>& coefs = bcEqns.eqns()[i]->coefs();
-    std::vector<int>& indices = bcEqns.eqns()[i]->indices();
-    CHK_ERR( sendBCs.addEqn(eqn, &coefs[0], &indices[0],
+    std::vector<fei::GlobalOrdinal>& indices = bcEqns.eqns()[i]->indices();
+    CHK_ERR( sendBCs.addEqn(eqn, &coefs[0],
+                            fei::impl_utils::int_indices(indices.size(),
+                                                         &indices[0], iwork),
 			    indices.size(), false) );
 
     for(unsigned p=0; p<numSendProcs; p++) {
@@ -1056,20 +1693,21 @@ int EqnCommMgr::exchangeRemEssBCs(int* essEqns, int numEssEqns,double* essAlpha,
 
   std::vector<int> offsets(numEssEqns);
   int* offsetsPtr = numEssEqns>0 ? &offsets[0] : NULL;
+  std::vector<int> iwork;
 
   for(int j=0; j<_numSendEqns; j++) {
 
-    std::vector<int>& indices = _sendEqns[j]->indices();
+    std::vector<fei::GlobalOrdinal>& indices = _sendEqns[j]->indices();
+    const int* sendEqnsPtr_j =
+      fei::impl_utils::int_indices(indices.size(), &indices[0], iwork);
 
     fei::binarySearch(numEssEqns, essEqns, offsetsPtr,
-			  &indices[0], indices.size());
+			  sendEqnsPtr_j, indices.size());
 
     int sendEqn_j = _sendEqnNumbers[j];
 
     int proc = getSendProcNumber(sendEqn_j);
 
-    const int* sendEqnsPtr_j = &indices[0];
-
     if (dbgOut != NULL) {
       FEI_OSTREAM& os = *dbgOut;
       os << "#ereb sendeqns["<<j<<"].length: "
@@ -1145,34 +1783,35 @@ int EqnCommMgr::exchangeRemEssBCs(int* essEqns, int numEssEqns,double* essAlpha,
 //------------------------------------------------------------------------------
 int EqnCommMgr::exchangePtToBlkInfo(snl_fei::PointBlockMap& blkEqnMapper)
 {
-  std::set<int> sendIndices;
+  std::set<fei::GlobalOrdinal> sendIndices;
   std::vector<fei::CSVec*>& sendeqns = sendEqns_->eqns();
   for(size_t i=0; i<sendeqns.size(); ++i) {
-    std::vector<int>& indices = sendeqns[i]->indices();
+    std::vector<fei::GlobalOrdinal>& indices = sendeqns[i]->indices();
     int len = indices.size();
     if (len < 1) continue;
-    int* indicesPtr = &indices[0];
+    fei::GlobalOrdinal* indicesPtr = &indices[0];
     for(int j=0; j<len; ++j) {
       sendIndices.insert(indicesPtr[j]);
     }
   }
 
-  std::set<int> recvIndices;
+  std::set<fei::GlobalOrdinal> recvIndices;
   std::vector<fei::CSVec*>& recveqns = recvEqns_->eqns();
   for(size_t i=0; i<recveqns.size(); ++i) {
-    std::vector<int>& indices = recveqns[i]->indices();
+    std::vector<fei::GlobalOrdinal>& indices = recveqns[i]->indices();
     int len = indices.size();
     if (len < 1) continue;
-    int* indicesPtr = &indices[0];
+    fei::GlobalOrdinal* indicesPtr = &indices[0];
     for(int j=0; j<len; ++j) {
       recvIndices.insert(indicesPtr[j]);
     }
   }
 
-  std::map<int,int>* ptEqns =  blkEqnMapper.getPtEqns();
+  std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>* ptEqns =
+    blkEqnMapper.getPtEqns();
   size_t numPtEqns = ptEqns->size();
 
-  std::map<int,int>::const_iterator
+  std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>::const_iterator
     pteq = ptEqns->begin(),
     pteq_end = ptEqns->end();
 
@@ -1181,14 +1820,14 @@ int EqnCommMgr::exchangePtToBlkInfo(snl_fei::PointBlockMap& blkEqnMapper)
 
   int offset = 0;
   for(; pteq!=pteq_end; ++pteq) {
-    int ptEqn = (*pteq).first;
+    fei::GlobalOrdinal ptEqn = (*pteq).first;
     if (sendIndices.find(ptEqn) == sendIndices.end()) continue;
 
-    int blkEqn = blkEqnMapper.eqnToBlkEqn(ptEqn);
+    fei::GlobalOrdinal blkEqn = blkEqnMapper.eqnToBlkEqn(ptEqn);
     int blkSize = blkEqnMapper.getBlkEqnSize(blkEqn);
 
-    ptBlkInfoPtr[offset++] = ptEqn;
-    ptBlkInfoPtr[offset++] = blkEqn;
+    ptBlkInfoPtr[offset++] = fei::impl_utils::int_index(ptEqn);
+    ptBlkInfoPtr[offset++] = fei::impl_utils::int_index(blkEqn);
     ptBlkInfoPtr[offset++] = blkSize;
   }
 
@@ -1238,16 +1877,24 @@ int EqnCommMgr::exchangePtToBlkInfo(snl_fei::PointBlockMap& blkEqnMapper)
 //------------------------------------------------------------------------------
 int EqnCommMgr::addRemoteEqns(fei::CSRMat& mat, bool onlyIndices)
 {
-  std::vector<int>& rowNumbers = mat.getGraph().rowNumbers;
+  std::vector<fei::GlobalOrdinal>& rowNumbers = mat.getGraph().rowNumbers;
   std::vector<int>& rowOffsets = mat.getGraph().rowOffsets;
-  std::vector<int>& pckColInds = mat.getGraph().packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& pckColIndices =
+    mat.getGraph().packedColumnIndices;
   std::vector<double>& pckCoefs = mat.getPackedCoefs();
 
+  //the old-FEI eqn buffers are limited to int eqn-numbers.
+  std::vector<int> iwork;
+  int* pckColInds = const_cast<int*>(fei::impl_utils::int_indices(
+                          pckColIndices.size(),
+                          pckColIndices.empty() ? NULL : &pckColIndices[0],
+                          iwork));
+
   for(size_t i=0; i<rowNumbers.size(); ++i) {
-    int row = rowNumbers[i];
+    int row = fei::impl_utils::int_index(rowNumbers[i]);
     int offset = rowOffsets[i];
     int rowlen = rowOffsets[i+1]-offset;
-    int* indices = &pckColInds[offset];
+    int* indices = pckColInds + offset;
     double* coefs = &pckCoefs[offset];
 
     int proc = getSendProcNumber(row);
@@ -1267,15 +1914,16 @@ int EqnCommMgr::addRemoteEqns(fei::CSRMat& mat, bool onlyIndices)
 //------------------------------------------------------------------------------
 int EqnCommMgr::addRemoteRHS(fei::CSVec& vec, int rhsIndex)
 {
-  std::vector<int>& indices = vec.indices();
+  std::vector<fei::GlobalOrdinal>& indices = vec.indices();
   std::vector<double>& coefs = vec.coefs();
 
   for(size_t i=0; i<indices.size(); i++) {
-    int proc = getSendProcNumber(indices[i]);
+    int eqn = fei::impl_utils::int_index(indices[i]);
+    int proc = getSendProcNumber(eqn);
 
     if (proc == localProc_ || proc < 0) continue;
 
-    CHK_ERR( addRemoteRHS(indices[i], proc, rhsIndex, coefs[i]) );
+    CHK_ERR( addRemoteRHS(eqn, proc, rhsIndex, coefs[i]) );
   }
 
   return(0);
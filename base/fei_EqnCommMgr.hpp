@@ -99,6 +99,24 @@ EqnCommMgr function (exchangeEqnBuffers) is provided to first send the
 equation-lengths to the receiving processors, followed by the actual equation
 data. At this point the exchange is complete. The equation data is 
 supplied/returned in EqnBuffer objects.
+
+Packed exchange mode (see setPackedExchange): once exchangeIndices has fixed
+which equations go to which processor, and which column-indices they contain,
+remote contributions can be accumulated directly into one contiguous
+indices/coefs buffer per destination processor, laid out exactly as the
+message that exchangeEqns sends. exchangeEqns then sends those buffers as-is
+and receives into persistent per-source buffers, with no per-equation
+packing or allocation. In this mode the received equations are not unpacked
+into the recv EqnBuffer; callers read them with getPackedRecvEqns instead.
+
+Frozen pattern mode (see setFreezePattern): the first exchangeEqns sends
+column-indices along with the coefficients, as usual, and both sides keep the
+resulting layout. Subsequent exchangeEqns calls send a single values-only
+message per processor into persistent receive buffers, and exchangeSoln
+reuses persistent buffers and equation offsets. If any processor adds remote
+equations or column-indices that aren't in the frozen pattern, all processors
+fall back to exchangeIndices plus a full exchange, then freeze the new
+pattern. Frozen mode may be combined with packed mode.
 */
 
 class EqnCommMgr {
@@ -192,6 +210,45 @@ class EqnCommMgr {
 				 EqnBuffer* sendEqns, ProcEqns* recvProcEqns,
 				 EqnBuffer* recvEqns, bool accumulate);
 
+   /** Select packed exchange mode. Takes effect for remote equations added
+       after exchangeIndices has been called. Any coefficients already held
+       in the send EqnBuffer are copied into the packed buffers when they are
+       first set up.
+   */
+   void setPackedExchange(bool packed);
+
+   /** Query whether packed exchange mode has been selected. */
+   bool packedExchange() const { return( packedExchange_ ); }
+
+   /** Packed exchange mode only: obtain the equations received from the i-th
+       sharing processor (see sharingProcsPtr()) in the last call to
+       exchangeEqns. The pointers reference internal buffers which are
+       overwritten by the next exchangeEqns call.
+       @param i Input. Offset into the list of sharing processors.
+       @param numEqns Output. Number of equations received from that proc.
+       @param eqnNumbers Output. List of length numEqns.
+       @param eqnLengths Output. List of length numEqns.
+       @param indices Output. Column-indices for all equations, packed
+       end-to-end (eqnLengths[0] for the first equation, etc.).
+       @param coefs Output. Coefficients, packed the same way as indices.
+       @param numRHSs Output. Number of rhs-coefficients per equation.
+       @param rhsCoefs Output. numEqns*numRHSs rhs-coefficients, numRHSs
+       consecutive entries for each equation.
+       @return error-code 0 if successful, -1 if packed mode isn't active.
+   */
+   int getPackedRecvEqns(size_t i, int& numEqns,
+                         const int*& eqnNumbers, const int*& eqnLengths,
+                         const int*& indices, const double*& coefs,
+                         int& numRHSs, const double*& rhsCoefs);
+
+   /** Select frozen pattern mode. Must be set identically on all processors.
+       Takes effect from the next call to exchangeEqns.
+   */
+   void setFreezePattern(bool freeze);
+
+   /** Query whether frozen pattern mode has been selected. */
+   bool freezePattern() const { return( freezePattern_ ); }
+
    int getNumLocalEqns() {return(recvEqns_->getNumEqns());};
 
    std::vector<int>& localEqnNumbers() {return(recvEqns_->eqnNumbers());};
@@ -252,6 +309,19 @@ class EqnCommMgr {
    void deleteEssBCs();
    int getSendProcNumber(int eqn);
 
+   bool usePackedBuffers();
+   int buildPackedBuffers();
+   void flushPackedBuffers();
+   int addPackedRemoteEqn(int eqnLoc, const double* coefs,
+                          const int* indices, int num);
+   void copyPackedSendCoefs(bool toPacked);
+   int exchangePackedEqns();
+   int unpackRecvBuffers();
+   int frozenPatternChanged();
+   int exchangeFrozenEqns();
+   int exchangePackedValues();
+   void buildSolnLayout();
+
    int consistencyCheck(const char* caller,
 			std::vector<int>& recvProcs,
 			std::vector<int>& recvProcTotalLengths,
@@ -281,6 +351,35 @@ class EqnCommMgr {
 
    EqnBuffer* essBCEqns_;
 
+   //packed exchange mode data. The per-send-eqn arrays are parallel to
+   //packedSendEqnNumbers_, which holds sendEqns_->eqnNumbers() as it was when
+   //the layout was built. The per-proc arrays are parallel to
+   //sendProcEqns_->procsPtr() and recvProcEqns_->procsPtr() respectively.
+   bool packedExchange_;
+   bool packedBuffersValid_;
+   int packedNumRHSs_;
+   std::vector<int> packedSendEqnNumbers_;
+   std::vector<int> sendEqnProcIndex_;   //-1 if eqn isn't sent anywhere
+   std::vector<int> sendEqnCoefOffset_;
+   std::vector<int> sendEqnRHSOffset_;
+   std::vector<int> sendEqnLength_;
+   std::vector<std::vector<int> > packedSendIndices_;
+   std::vector<std::vector<double> > packedSendCoefs_;
+   std::vector<std::vector<int> > packedRecvIndices_;
+   std::vector<std::vector<double> > packedRecvCoefs_;
+
+   //frozen pattern mode data. patternFrozen_ is true once the packed
+   //layout's column-indices have been exchanged with all peers. The soln
+   //arrays hold, per processor, offsets into recvEqns_ (values to send) and
+   //sendEqns_ (values to receive) for exchangeSoln.
+   bool freezePattern_;
+   bool patternFrozen_;
+   bool solnLayoutValid_;
+   std::vector<int> solnSendEqnLocs_;
+   std::vector<double> solnSendValues_;
+   std::vector<int> solnRecvEqnLocs_;
+   std::vector<double> solnRecvValues_;
+
    MPI_Comm comm_;
 };
 
@@ -16,7 +16,7 @@ namespace fei {
   mesh-object it corresponds to. */
 struct EqnRecord {
   /** Global equation index. */
-  int global_eqn;
+  GlobalOrdinal global_eqn;
 
   /** IDType (usually corresponds to node, edge, element, etc.) */
   int IDType;
@@ -863,33 +863,33 @@ int FEDataFilter::generalElemInput(GlobalID elemBlockID,
 
   int numElemRows = block->getNumEqnsPerElement();
 
-  //an std::vector.resize operation is free if the size is either shrinking or
-  //staying the same.
-
   const double* const* stiff = NULL;
   if (elemStiffness != NULL) stiff = elemStiffness;
 
   const double* load = NULL;
   if (elemLoad != NULL) load = elemLoad;
 
-  //we'll make a local dense copy of the element stiffness array
-  //if the stiffness array was passed in using one of the "weird"
-  //element formats, AND if the stiffness array is non-null.
-  if (elemFormat != FEI_DENSE_ROW && stiff != NULL) {
-    Filter::copyStiffness(stiff, numElemRows, elemFormat, eStiff_);
-    stiff = eStiff_;
-  }
+  //The stiffness array is handed on to the FiniteElementData in whatever
+  //format it was supplied in, without being copied. (The default
+  //FiniteElementData::setElemMatrixInPlace makes a dense copy if the
+  //implementation needs one.)
 
   if (stiff != NULL || load != NULL) newData_ = true;
 
   if (Filter::logStream() != NULL) {
     if (stiff != NULL) {
+      const double* const* logStiff = stiff;
+      if (elemFormat != FEI_DENSE_ROW) {
+        Filter::copyStiffness(stiff, numElemRows, elemFormat, eStiff_);
+        logStiff = eStiff_;
+      }
+
       (*logStream())
         << "#numElemRows"<< FEI_ENDL << numElemRows << FEI_ENDL
         << "#elem-stiff (after being copied into dense-row format)"
         << FEI_ENDL;
       for(int i=0; i<numElemRows; i++) {
-        const double* stiff_i = stiff[i];
+        const double* stiff_i = logStiff[i];
         for(int j=0; j<numElemRows; j++) {
           (*logStream()) << stiff_i[j] << " ";
         }
@@ -920,86 +920,174 @@ int FEDataFilter::generalElemInput(GlobalID elemBlockID,
     ERReturn(-1);
   }
 
-  fei::FieldDofMap<int>& fdmap = problemStructure_->getFieldDofMap();
-
   int elemIndex = iter->second;
 
   int elemNumber = connTable.elemNumbers[elemIndex];
 
   int numNodes = block->getNumNodesPerElement();
-  int* fieldsPerNode = block->fieldsPerNodePtr();
-  int** fieldIDsTable = block->fieldIDsTablePtr();
 
-  int numDistinctFields = block->getNumDistinctFields();
-  int dof_id = 0;
-  int fieldSize = 0;
-  int total_num_dofs = 0;
-  if (numDistinctFields == 1) {
-    fieldSize = problemStructure_->getFieldSize(fieldIDsTable[0][0]);
-    for(int i=0; i<numNodes; ++i) {
-      total_num_dofs += fieldSize*fieldsPerNode[i];
+  CHK_ERR( getBlockDofs(block, elemDofsPerNode_, elemDofIDs_) );
+
+  elemNodeNumbers_.resize(numNodes);
+  int* nodeNumbers = &elemNodeNumbers_[0];
+
+  NodeDescriptor** elemNodes =
+    &((*connTable.elem_conn_ptrs)[elemIndex*numNodes]);
+
+  for(int nn=0; nn<numNodes; nn++) {
+    nodeNumbers[nn] = elemNodes[nn]->getNodeNumber();
+  }
+
+  int* dofsPerNode = &elemDofsPerNode_[0];
+  int* dof_ids = elemDofIDs_.empty() ? NULL : &elemDofIDs_[0];
+
+  if (stiff != NULL) {
+    CHK_ERR( feData_->setElemMatrixInPlace(blockNumber, elemNumber, numNodes,
+                                           nodeNumbers, dofsPerNode, dof_ids,
+                                           elemFormat, stiff) );
+  }
+
+  if (load != NULL) {
+    CHK_ERR( feData_->setElemVector(blockNumber, elemNumber, numNodes,
+                                    nodeNumbers, dofsPerNode, dof_ids, load) );
+  }
+
+  return(FEI_SUCCESS);
+}
+
+//------------------------------------------------------------------------------
+int FEDataFilter::sumInElemBlockMatrix(GlobalID elemBlockID,
+                                       int numElems,
+                                       const GlobalID* elemIDs,
+                                       const GlobalID* elemConn,
+                                       const double* elemStiffness,
+                                       const double* elemLoads,
+                                       int elemFormat)
+{
+  (void)elemConn;
+
+  if (Filter::logStream() != NULL && outputLevel_ > 2) {
+    (*logStream()) << "FEI: sumInElemBlockMatrix" << FEI_ENDL <<"#blkID" << FEI_ENDL
+                      << static_cast<int>(elemBlockID) << FEI_ENDL
+                      << "#n-elems" << FEI_ENDL << numElems << FEI_ENDL;
+  }
+
+  BlockDescriptor* block = NULL;
+  CHK_ERR( problemStructure_->getBlockDescriptor(elemBlockID, block) );
+
+  int numElemRows = block->getNumEqnsPerElement();
+  int elemSize = Filter::packedStiffnessSize(numElemRows, elemFormat);
+
+  if (elemStiffness != NULL && elemSize < 0) {
+    fei::console_out() << "FEDataFilter::sumInElemBlockMatrix ERROR, elemFormat="
+             << elemFormat << " not supported."<<FEI_ENDL;
+    ERReturn(-1);
+  }
+
+  if (numElems <= 0 || numElemRows <= 0) return(FEI_SUCCESS);
+  if (elemStiffness == NULL && elemLoads == NULL) return(FEI_SUCCESS);
+
+  int blockNumber = problemStructure_->getIndexOfBlock(elemBlockID);
+
+  ConnectivityTable& connTable = problemStructure_->
+    getBlockConnectivity(elemBlockID);
+
+  int numNodes = block->getNumNodesPerElement();
+
+  CHK_ERR( getBlockDofs(block, elemDofsPerNode_, elemDofIDs_) );
+  int* dofsPerNode = &elemDofsPerNode_[0];
+  int* dof_ids = elemDofIDs_.empty() ? NULL : &elemDofIDs_[0];
+
+  batchElemNumbers_.resize(numElems);
+  elemNodeNumbers_.resize(numElems*numNodes);
+
+  for(int e=0; e<numElems; ++e) {
+    std::map<GlobalID,int>::iterator
+      iter = connTable.elemIDs.find(elemIDs[e]);
+    if (iter == connTable.elemIDs.end()) {
+      ERReturn(-1);
+    }
+
+    int elemIndex = iter->second;
+    batchElemNumbers_[e] = connTable.elemNumbers[elemIndex];
+
+    NodeDescriptor** elemNodes =
+      &((*connTable.elem_conn_ptrs)[elemIndex*numNodes]);
+    int* nodeNumbers = &elemNodeNumbers_[e*numNodes];
+    for(int nn=0; nn<numNodes; nn++) {
+      nodeNumbers[nn] = elemNodes[nn]->getNodeNumber();
     }
-    dof_id = fdmap.get_dof_id(fieldIDsTable[0][0], 0);
   }
-  else {
-    for(int i=0; i<numNodes; ++i) {
-      for(int nf=0; nf<fieldsPerNode[i]; ++nf) {
-        total_num_dofs += problemStructure_->getFieldSize(fieldIDsTable[i][nf]);
-      }
+
+  //The whole batch of element-stiffnesses goes through in one call, still
+  //in the caller's array.
+  if (elemStiffness != NULL) {
+    CHK_ERR( feData_->setElemMatrices(blockNumber, numElems,
+                                      &batchElemNumbers_[0], numNodes,
+                                      &elemNodeNumbers_[0], dofsPerNode,
+                                      dof_ids, elemFormat, elemStiffness) );
+  }
+
+  if (elemLoads != NULL) {
+    for(int e=0; e<numElems; ++e) {
+      CHK_ERR( feData_->setElemVector(blockNumber, batchElemNumbers_[e],
+                                      numNodes, &elemNodeNumbers_[e*numNodes],
+                                      dofsPerNode, dof_ids,
+                                      elemLoads + e*numElemRows) );
     }
   }
 
-  static std::vector<int> iwork;
-  iwork.resize(2*numNodes+total_num_dofs);
+  newData_ = true;
 
-  int* dofsPerNode = &iwork[0];
-  int* nodeNumbers = dofsPerNode+numNodes;
-  int* dof_ids = nodeNumbers+numNodes;
+  return(FEI_SUCCESS);
+}
 
-  for(int i=0; i<numNodes; ++i) {
-    dofsPerNode[i] = 0;
-  }
+//------------------------------------------------------------------------------
+int FEDataFilter::getBlockDofs(BlockDescriptor* block,
+                               std::vector<int>& dofsPerNode,
+                               std::vector<int>& dof_ids)
+{
+  //Fill the numDofPerNode and dof_ids lists that are passed to the
+  //FiniteElementData interface along with each element of this block. They
+  //are the same for every element of the block.
 
+  fei::FieldDofMap<int>& fdmap = problemStructure_->getFieldDofMap();
 
-  NodeDescriptor** elemNodes =
-    &((*connTable.elem_conn_ptrs)[elemIndex*numNodes]);
+  int numNodes = block->getNumNodesPerElement();
+  int* fieldsPerNode = block->fieldsPerNodePtr();
+  int** fieldIDsTable = block->fieldIDsTablePtr();
 
-  int doffset = 0;
-  for(int nn=0; nn<numNodes; nn++) {
-    NodeDescriptor* node = elemNodes[nn];
-    nodeNumbers[nn] = node->getNodeNumber();
+  dofsPerNode.assign(numNodes, 0);
+  dof_ids.resize(0);
+
+  int numDistinctFields = block->getNumDistinctFields();
+  if (numDistinctFields == 1) {
+    int fieldSize = problemStructure_->getFieldSize(fieldIDsTable[0][0]);
+    int dof_id = fdmap.get_dof_id(fieldIDsTable[0][0], 0);
 
-    if (numDistinctFields == 1) {
+    for(int nn=0; nn<numNodes; nn++) {
       for(int nf=0; nf<fieldsPerNode[nn]; nf++) {
         dofsPerNode[nn] += fieldSize;
         for(int dof_offset=0; dof_offset<fieldSize; ++dof_offset) {
-          dof_ids[doffset++] = dof_id;
+          dof_ids.push_back(dof_id);
         }
       }
     }
-    else {
+  }
+  else {
+    for(int nn=0; nn<numNodes; nn++) {
       for(int nf=0; nf<fieldsPerNode[nn]; nf++) {
         int fieldSize = problemStructure_->getFieldSize(fieldIDsTable[nn][nf]);
         int dof_id = fdmap.get_dof_id(fieldIDsTable[nn][nf], 0);
         dofsPerNode[nn] += fieldSize;
         for(int dof_offset=0; dof_offset<fieldSize; ++dof_offset) {
-          dof_ids[doffset++] = dof_id + dof_offset;
+          dof_ids.push_back(dof_id + dof_offset);
         }
       }
     }
   }
 
-  if (stiff != NULL) {
-    CHK_ERR( feData_->setElemMatrix(blockNumber, elemNumber, numNodes,
-                                    nodeNumbers, dofsPerNode, dof_ids, stiff) );
-  }
-
-  if (load != NULL) {
-    CHK_ERR( feData_->setElemVector(blockNumber, elemNumber, numNodes,
-                                    nodeNumbers, dofsPerNode, dof_ids, load) );
-  }
-
-  return(FEI_SUCCESS);
+  return(0);
 }
 
 //------------------------------------------------------------------------------
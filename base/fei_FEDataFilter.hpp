@@ -75,6 +75,20 @@ class FEDataFilter : public Filter {
                     const GlobalID* elemConn,
                     const double* elemLoad);
 
+   /** Batched element input. The element-stiffnesses of the whole batch are
+       passed on to FiniteElementData::setElemMatrices in the caller's array,
+       without being copied. All of the elemFormat values accepted by
+       sumInElem are valid here, with each symmetric table stored as its
+       rows (or columns) one after another.
+   */
+   int sumInElemBlockMatrix(GlobalID elemBlockID,
+                            int numElems,
+                            const GlobalID* elemIDs,
+                            const GlobalID* elemConn,
+                            const double* elemStiffness,
+                            const double* elemLoads,
+                            int elemFormat);
+
     int loadCRMult(int CRMultID, 
                    int numCRNodes,
                    const GlobalID* CRNodes, 
@@ -261,6 +275,10 @@ class FEDataFilter : public Filter {
 
    void allocElemStuff();
 
+   int getBlockDofs(BlockDescriptor* block,
+                    std::vector<int>& dofsPerNode,
+                    std::vector<int>& dof_ids);
+
    int giveToMatrix(int numPtRows, const int* ptRows,
                     int numPtCols, const int* ptCols,
                     const double* const* values,
@@ -358,6 +376,9 @@ class FEDataFilter : public Filter {
     double* eStiff1D_;
     double* eLoad_;
 
+    std::vector<int> elemDofsPerNode_, elemDofIDs_;
+    std::vector<int> elemNodeNumbers_, batchElemNumbers_;
+
     int numRegularElems_;
     std::vector<int> constraintBlocks_;
     std::vector<int> constraintNodeOffsets_;
@@ -19,6 +19,7 @@
 #include <fei_Pattern.hpp>
 #include <fei_LibraryWrapper.hpp>
 #include <fei_Data.hpp>
+#include <fei_impl_utils.hpp>
 #include <fei_defs.h>
 
 #include <stdexcept>
@@ -74,6 +75,7 @@ fei::FEI_Impl::FEI_Impl(fei::SharedPtr<LibraryWrapper> wrapper,
     solveTime_(0.0),
     solnReturnTime_(0.0),
     iwork_(),
+    eqnwork_(),
     nodeset_(),
     nodeset_filled_(false),
     block_dof_per_elem_(),
@@ -133,6 +135,7 @@ fei::FEI_Impl::FEI_Impl(const fei::Factory* factory,
     solveTime_(0.0),
     solnReturnTime_(0.0),
     iwork_(),
+    eqnwork_(),
     nodeset_(),
     nodeset_filled_(false),
     block_dof_per_elem_(),
@@ -647,7 +650,7 @@ int fei::FEI_Impl::sumInElem(GlobalID elemBlockID,
   CHK_ERR( A_[index_current_]->sumIn(elemBlockID, elemID, elemStiffness, elemFormat) );
 
   int num = matGraph_->getConnectivityNumIndices(elemBlockID);
-  std::vector<int> indices(num);
+  std::vector<GlobalOrdinal> indices(num);
   CHK_ERR( matGraph_->getConnectivityIndices(elemBlockID, elemID, num,
                                              &indices[0], num) );
   CHK_ERR( b_[index_current_rhs_row_]->sumIn(num, &indices[0], elemLoad, 0) );
@@ -676,7 +679,7 @@ int fei::FEI_Impl::sumInElemRHS(GlobalID elemBlockID,
 				 const double* elemLoad)
 {
   int num = matGraph_->getConnectivityNumIndices(elemBlockID);
-  std::vector<int> indices(num);
+  std::vector<GlobalOrdinal> indices(num);
   CHK_ERR( matGraph_->getConnectivityIndices(elemBlockID, elemID, num,
                                              &indices[0], num) );
   CHK_ERR( b_[index_current_rhs_row_]->sumIn(num, &indices[0], elemLoad, 0) );
@@ -686,6 +689,61 @@ int fei::FEI_Impl::sumInElemRHS(GlobalID elemBlockID,
   return(0);
 }
 
+int fei::FEI_Impl::sumInElemBlockMatrix(GlobalID elemBlockID,
+                                        int numElems,
+                                        const GlobalID* elemIDs,
+                                        const GlobalID* elemConn,
+                                        const double* elemStiffness,
+                                        const double* elemLoads,
+                                        int elemFormat)
+{
+  //each table is assumed to hold num*num coefficients, so the packed
+  //symmetric formats can't be accepted here.
+  if (elemStiffness != NULL &&
+      elemFormat != FEI_DENSE_ROW && elemFormat != FEI_DENSE_COL) {
+    fei::console_out() << "fei::FEI_Impl::sumInElemBlockMatrix ERROR, elemFormat="
+                       << elemFormat << " not supported."<<FEI_ENDL;
+    ERReturn(-1);
+  }
+
+  if (numElems <= 0) return(0);
+
+  int num = matGraph_->getConnectivityNumIndices(elemBlockID);
+  if (num <= 0) return(0);
+
+  if (elemStiffness != NULL) {
+    std::vector<const double*> stiffRows(num);
+    for(int e=0; e<numElems; ++e) {
+      const double* stiff = elemStiffness + e*num*num;
+      for(int i=0; i<num; ++i) {
+        stiffRows[i] = stiff + i*num;
+      }
+
+      CHK_ERR( A_[index_current_]->sumIn(elemBlockID, elemIDs[e],
+                                         &stiffRows[0], elemFormat) );
+    }
+  }
+
+  if (elemLoads != NULL) {
+    //gather the indices for the whole batch so that the loads go into the
+    //rhs vector in a single call.
+    eqnwork_.resize(numElems*num);
+    for(int e=0; e<numElems; ++e) {
+      GlobalOrdinal* indices = &eqnwork_[e*num];
+      int checkNum = 0;
+      CHK_ERR( matGraph_->getConnectivityIndices(elemBlockID, elemIDs[e], num,
+                                                 indices, checkNum) );
+    }
+
+    CHK_ERR( b_[index_current_rhs_row_]->sumIn(numElems*num, &eqnwork_[0],
+                                               elemLoads, 0) );
+  }
+
+  newData_ = true;
+
+  return(0);
+}
+
 int fei::FEI_Impl::loadCRMult(int CRMultID,
 			       int numCRNodes,
 			       const GlobalID* CRNodeIDs,
@@ -752,11 +810,11 @@ int fei::FEI_Impl::inputRHS(int IDType,
 
   int offset = 0;
   for(int i=0; i<numIDs; ++i) {
-    int globalIndex = 0;
+    GlobalOrdinal globalIndex = 0;
     CHK_ERR( rowSpace_->getGlobalIndex(IDType, IDs[i], globalIndex) );
 
     for(int j=0; j<fieldSize; ++j) {
-      int eqn = globalIndex+j;
+      GlobalOrdinal eqn = globalIndex+j;
       if (sumInto) {
 	CHK_ERR( b_[index_current_rhs_row_]->sumIn(1, &eqn, &(coefficients[offset++])) );
       }
@@ -931,9 +989,9 @@ int fei::FEI_Impl::residualNorm(int whichNorm,
   std::vector<double> residValues(numLocalEqns);
   double* residValuesPtr = &residValues[0];
 
-  std::vector<int> globalEqnOffsets;
+  std::vector<GlobalOrdinal> globalEqnOffsets;
   rowspace->getGlobalIndexOffsets(globalEqnOffsets);
-  int firstLocalOffset = globalEqnOffsets[localProc_];
+  GlobalOrdinal firstLocalOffset = globalEqnOffsets[localProc_];
 
   if (wrapper_[0].get() == NULL) {
     fei::SharedPtr<fei::Vector> r = factory_[0]->createVector(rowspace);
@@ -946,7 +1004,7 @@ int fei::FEI_Impl::residualNorm(int whichNorm,
 
     //now put the values from r into the residValues array.
     for(int ii=0; ii<numLocalEqns; ++ii) {
-      int index = firstLocalOffset+ii;
+      GlobalOrdinal index = firstLocalOffset+ii;
       CHK_ERR( r->copyOut(1, &index, &(residValuesPtr[ii]) ) );
     }
   }
@@ -975,8 +1033,8 @@ int fei::FEI_Impl::residualNorm(int whichNorm,
   int check;
   CHK_ERR( rowspace->getOwnedIDs(nodeIDType_, numLocalNodes,
 					nodeIDsPtr, check) );
-  std::vector<int> indices(numLocalEqns);
-  int* indicesPtr = &indices[0];
+  std::vector<GlobalOrdinal> indices(numLocalEqns);
+  GlobalOrdinal* indicesPtr = &indices[0];
 
   std::vector<double> tmpNorms(numFields, 0.0);
 
@@ -1230,13 +1288,14 @@ int fei::FEI_Impl::getCRMultipliers(int numCRs,
 				     const int* CRIDs,
 				     double *multipliers)
 {
-  iwork_.resize(numCRs);
+  eqnwork_.resize(numCRs);
 
   for(int i=0; i<numCRs; ++i) {
-    CHK_ERR( rowSpace_->getGlobalIndex(constraintIDType_, CRIDs[i], iwork_[i]));
+    CHK_ERR( rowSpace_->getGlobalIndex(constraintIDType_, CRIDs[i],
+                                       eqnwork_[i]));
   }
 
-  CHK_ERR( x_->copyOut(numCRs, &iwork_[0], multipliers) );
+  CHK_ERR( x_->copyOut(numCRs, &eqnwork_[0], multipliers) );
 
   return(0);
 }
@@ -1423,7 +1482,14 @@ int fei::FEI_Impl::getEqnNumbers(GlobalID ID,
 				  int* eqnNumbers)
 {
   numEqns = rowSpace_->getFieldSize(fieldID);
-  CHK_ERR( rowSpace_->getGlobalIndices(1, &ID, idType, fieldID, eqnNumbers) );
+  if (numEqns < 1) return(0);
+
+  eqnwork_.resize(numEqns);
+  CHK_ERR( rowSpace_->getGlobalIndices(1, &ID, idType, fieldID,
+                                       &eqnwork_[0]) );
+  for(int i=0; i<numEqns; ++i) {
+    eqnNumbers[i] = fei::impl_utils::int_index(eqnwork_[i]);
+  }
   return(0);
 }
 
@@ -154,6 +154,14 @@ namespace fei {
                     const GlobalID* elemConn,
                     const double* elemLoad);
 
+   int sumInElemBlockMatrix(GlobalID elemBlockID,
+                            int numElems,
+                            const GlobalID* elemIDs,
+                            const GlobalID* elemConn,
+                            const double* elemStiffness,
+                            const double* elemLoads,
+                            int elemFormat);
+
    int loadCRMult(int CRMultID,
                   int numCRNodes,
                   const GlobalID* CRNodeIDs,
@@ -505,6 +513,7 @@ namespace fei {
     double initTime_, loadTime_, solveTime_, solnReturnTime_;
 
     std::vector<int> iwork_;
+    std::vector<GlobalOrdinal> eqnwork_;
 
     mutable std::set<int> nodeset_;
     mutable bool nodeset_filled_;
@@ -0,0 +1,226 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_Factory_DistCSR.hpp>
+#include <fei_Solver_DistCSR.hpp>
+
+#include <fei_MatrixTraits_DistCSRMat.hpp>
+#include <fei_VectorTraits_DistVec.hpp>
+#include <fei_Matrix_Impl.hpp>
+#include <fei_Vector_Impl.hpp>
+#include <fei_MatrixGraph_Impl2.hpp>
+#include <fei_MatrixReducer.hpp>
+#include <fei_VectorReducer.hpp>
+#include <fei_ParameterSet.hpp>
+#include <fei_SparseRowGraph.hpp>
+#include <fei_CommUtils.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace fei {
+
+//----------------------------------------------------------------------------
+Factory_DistCSR::Factory_DistCSR(MPI_Comm comm)
+  : fei::Factory(comm),
+    comm_(comm),
+    reducer_(),
+    outputLevel_(0),
+    floatMatrices_(false)
+{
+}
+
+//----------------------------------------------------------------------------
+Factory_DistCSR::~Factory_DistCSR()
+{
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Factory>
+Factory_DistCSR::clone() const
+{
+  fei::SharedPtr<fei::Factory> factory(new Factory_DistCSR(comm_));
+  return(factory);
+}
+
+//----------------------------------------------------------------------------
+void Factory_DistCSR::parameters(const fei::ParameterSet& parameterset)
+{
+  fei::Factory::parameters(parameterset);
+
+  parameterset.getIntParamValue("outputLevel", outputLevel_);
+
+  std::string scalarType;
+  if (parameterset.getStringParamValue("MATRIX_SCALAR_TYPE", scalarType) == 0) {
+    if (scalarType == "float") floatMatrices_ = true;
+    else if (scalarType == "double") floatMatrices_ = false;
+    else {
+      throw std::runtime_error("fei::Factory_DistCSR ERROR, MATRIX_SCALAR_TYPE must be 'double' or 'float'.");
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::MatrixGraph>
+Factory_DistCSR::createMatrixGraph(fei::SharedPtr<fei::VectorSpace> rowSpace,
+                                   fei::SharedPtr<fei::VectorSpace> colSpace,
+                                   const char* name)
+{
+  static fei::MatrixGraph_Impl2::Factory factory2;
+  return(factory2.createMatrixGraph(rowSpace, colSpace, name));
+}
+
+//----------------------------------------------------------------------------
+void Factory_DistCSR::getLocalEqnRange(fei::SharedPtr<fei::VectorSpace> vecSpace,
+                                       GlobalOrdinal& firstLocalEqn,
+                                       int& numLocalEqns)
+{
+  if (reducer_.get() != NULL) {
+    std::vector<GlobalOrdinal>& eqns = reducer_->getLocalReducedEqns();
+    numLocalEqns = eqns.size();
+    firstLocalEqn = numLocalEqns > 0 ? eqns[0] : 0;
+    if (numLocalEqns > 0 && eqns[numLocalEqns-1] - firstLocalEqn + 1 != numLocalEqns) {
+      throw std::runtime_error("fei::Factory_DistCSR ERROR, local reduced eqns aren't contiguous.");
+    }
+    return;
+  }
+
+  std::vector<GlobalOrdinal> globalOffsets;
+  vecSpace->getGlobalIndexOffsets(globalOffsets);
+  int localProc = fei::localProc(comm_);
+  if ((int)globalOffsets.size() < localProc+2) {
+    throw std::runtime_error("fei::Factory_DistCSR ERROR, vector-space has no global offsets (initComplete not called?)");
+  }
+
+  firstLocalEqn = globalOffsets[localProc];
+  numLocalEqns = static_cast<int>(globalOffsets[localProc+1] - firstLocalEqn);
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Vector>
+Factory_DistCSR::createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
+                              bool isSolutionVector,
+                              int numVectors)
+{
+  GlobalOrdinal firstLocalEqn = 0;
+  int localSize = 0;
+  getLocalEqnRange(vecSpace, firstLocalEqn, localSize);
+
+  fei::DistVec* dvec = new fei::DistVec(comm_, firstLocalEqn,
+                                        localSize, numVectors);
+
+  fei::SharedPtr<fei::Vector> feivec, tmpvec;
+  tmpvec.reset(new fei::Vector_Impl<fei::DistVec>(vecSpace, dvec, localSize,
+                                                  isSolutionVector, true,
+                                                  numVectors));
+
+  if (reducer_.get() != NULL) {
+    feivec.reset(new fei::VectorReducer(reducer_, tmpvec, isSolutionVector));
+  }
+  else {
+    feivec = tmpvec;
+  }
+
+  return(feivec);
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Vector>
+Factory_DistCSR::createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
+                              int numVectors)
+{
+  bool isSolnVector = false;
+  return(createVector(vecSpace, isSolnVector, numVectors));
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Vector>
+Factory_DistCSR::createVector(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
+                              int numVectors)
+{
+  bool isSolnVector = false;
+  return(createVector(matrixGraph, isSolnVector, numVectors));
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Vector>
+Factory_DistCSR::createVector(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
+                              bool isSolutionVector,
+                              int numVectors)
+{
+  int globalNumSlaves = matrixGraph->getGlobalNumSlaveConstraints();
+
+  if (globalNumSlaves > 0 && reducer_.get()==NULL) {
+    reducer_ = matrixGraph->getReducer();
+  }
+
+  return(createVector(matrixGraph->getRowSpace(), isSolutionVector,
+                      numVectors));
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Matrix>
+Factory_DistCSR::createMatrix(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
+{
+  int globalNumSlaves = matrixGraph->getGlobalNumSlaveConstraints();
+
+  if (globalNumSlaves > 0 && reducer_.get()==NULL) {
+    reducer_ = matrixGraph->getReducer();
+  }
+
+  fei::SharedPtr<fei::VectorSpace> vecSpace = matrixGraph->getRowSpace();
+
+  GlobalOrdinal firstLocalEqn = 0;
+  int numLocalEqns = 0;
+  getLocalEqnRange(vecSpace, firstLocalEqn, numLocalEqns);
+
+  fei::SharedPtr<fei::SparseRowGraph> srgraph = matrixGraph->createGraph(false);
+  if (srgraph.get() == NULL) {
+    throw std::runtime_error("fei::Factory_DistCSR::createMatrix ERROR in fei::MatrixGraph::createGraph");
+  }
+
+  //as for the other factories, the fei::Matrix_Impl always deals in the
+  //unreduced point-equation space.
+  int localSize = vecSpace->getNumIndices_Owned();
+
+  fei::SharedPtr<fei::Matrix> tmpmat;
+  if (floatMatrices_) {
+    fei::SharedPtr<fei::DistCSRMatrix<float> >
+      fmat(new fei::DistCSRMatrix<float>(comm_, firstLocalEqn,
+                                         numLocalEqns, *srgraph));
+    tmpmat.reset(new fei::Matrix_Impl<fei::DistCSRMatrix<float> >(fmat,
+                                                    matrixGraph, localSize));
+  }
+  else {
+    fei::SharedPtr<fei::DistCSRMat>
+      dmat(new fei::DistCSRMat(comm_, firstLocalEqn, numLocalEqns, *srgraph));
+    tmpmat.reset(new fei::Matrix_Impl<fei::DistCSRMat>(dmat, matrixGraph,
+                                                       localSize));
+  }
+
+  fei::SharedPtr<fei::Matrix> feimat;
+  if (reducer_.get() != NULL) {
+    feimat.reset(new fei::MatrixReducer(reducer_, tmpmat));
+  }
+  else {
+    feimat = tmpmat;
+  }
+
+  return(feimat);
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Solver>
+Factory_DistCSR::createSolver(const char* name)
+{
+  fei::SharedPtr<fei::Solver> solver(new fei::Solver_DistCSR);
+  return(solver);
+}
+
+}//namespace fei
+
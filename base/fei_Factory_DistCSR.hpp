@@ -0,0 +1,101 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#ifndef _fei_Factory_DistCSR_hpp_
+#define _fei_Factory_DistCSR_hpp_
+
+#include <fei_macros.hpp>
+#include <fei_mpi.h>
+#include <fei_Factory.hpp>
+#include <fei_Reducer.hpp>
+
+namespace fei {
+
+/** Implementation of fei::Factory which creates matrices and vectors that
+    use fei's own distributed storage, fei::DistCSRMat and fei::DistVec, as
+    the underlying algebraic objects. No external solver library is
+    required.
+
+    Matrices are point-entry only; the "BLOCK_MATRIX" and "BLOCK_GRAPH"
+    parameters are ignored. Slave constraints are handled with
+    fei::MatrixReducer and fei::VectorReducer, as with the other factories.
+
+    The "MATRIX_SCALAR_TYPE" parameter (string, "double" or "float")
+    selects the coefficient storage of the matrices created after it is
+    set, so that e.g. a single-precision preconditioning matrix can be
+    created alongside a double-precision system matrix. Single-precision
+    matrices are still assembled in double precision (see
+    fei::DistCSRMatrix). Vectors are always double precision. The default
+    is "double".
+*/
+class Factory_DistCSR : public fei::Factory {
+ public:
+  /** Constructor */
+  Factory_DistCSR(MPI_Comm comm);
+
+  /** Destructor */
+  virtual ~Factory_DistCSR();
+
+  /** Implementation of fei::Factory::clone() */
+  fei::SharedPtr<fei::Factory> clone() const;
+
+  /** Implementation of fei::Factory::parameters() */
+  void parameters(const fei::ParameterSet& parameterset);
+
+  /** Implementation of fei::MatrixGraph::Factory::createMatrixGraph() */
+  fei::SharedPtr<fei::MatrixGraph>
+    createMatrixGraph(fei::SharedPtr<fei::VectorSpace> rowSpace,
+                      fei::SharedPtr<fei::VectorSpace> colSpace,
+                      const char* name);
+
+  /** Implementation of fei::Vector::Factory::createVector() */
+  fei::SharedPtr<fei::Vector>
+    createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
+                 int numVectors=1);
+
+  /** Implementation of fei::Vector::Factory::createVector() */
+  fei::SharedPtr<fei::Vector>
+    createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
+                 bool isSolutionVector,
+                 int numVectors=1);
+
+  /** Implementation of fei::Vector::Factory::createVector() */
+  fei::SharedPtr<fei::Vector>
+    createVector(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
+                 int numVectors=1);
+
+  /** Implementation of fei::Vector::Factory::createVector() */
+  fei::SharedPtr<fei::Vector>
+    createVector(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
+                 bool isSolutionVector,
+                 int numVectors=1);
+
+  /** Implementation of fei::Matrix::Factory::createMatrix() */
+  fei::SharedPtr<fei::Matrix>
+    createMatrix(fei::SharedPtr<fei::MatrixGraph> matrixGraph);
+
+  /** Implementation of fei::Solver::Factory::createSolver(). Returns a
+      fei::Solver_DistCSR; the name argument is ignored. */
+  fei::SharedPtr<fei::Solver> createSolver(const char* name=0);
+
+  int getOutputLevel() const { return(outputLevel_); }
+
+ private:
+  void getLocalEqnRange(fei::SharedPtr<fei::VectorSpace> vecSpace,
+                        GlobalOrdinal& firstLocalEqn, int& numLocalEqns);
+
+  MPI_Comm comm_;
+  fei::SharedPtr<fei::Reducer> reducer_;
+  int outputLevel_;
+  bool floatMatrices_;
+};//class Factory_DistCSR
+
+}//namespace fei
+
+#endif // _fei_Factory_DistCSR_hpp_
+
@@ -29,10 +29,10 @@ FillableMat::FillableMat(EqnBuffer& eqnbuf)
   std::vector<fei::CSVec*>& eqns = eqnbuf.eqns();
 
   for(int i=0; i<numEqns; ++i) {
-    int row = eqnNums[i];
+    GlobalOrdinal row = eqnNums[i];
     fei::CSVec* row_vec = eqns[i];
     int rowlen = row_vec->size();
-    int* indices = &(row_vec->indices()[0]);
+    GlobalOrdinal* indices = &(row_vec->indices()[0]);
     double* coefs = &(row_vec->coefs()[0]);
 
     for(int j=0; j<rowlen; ++j) {
@@ -63,13 +63,13 @@ FillableMat::operator=(const FillableMat& src)
     s_end = src.end();
 
   for(; s_iter != s_end; ++s_iter) {
-    int row = s_iter->first;
+    GlobalOrdinal row = s_iter->first;
     const CSVec* srow = s_iter->second;
-    const std::vector<int>& s_ind = srow->indices();
+    const std::vector<GlobalOrdinal>& s_ind = srow->indices();
     const std::vector<double>& s_coef = srow->coefs();
 
     for(size_t i=0; i<s_ind.size(); ++i) {
-      int col = s_ind[i];
+      GlobalOrdinal col = s_ind[i];
       double coef = s_coef[i];
 
       putCoef(row, col, coef);
@@ -93,7 +93,7 @@ FillableMat::setValues(double value)
 
 //-----------------------------------------------------------------
 void
-FillableMat::createPosition(int row, int col)
+FillableMat::createPosition(GlobalOrdinal row, GlobalOrdinal col)
 {
   sumInCoef(row, col, 0.0);
 }
@@ -102,7 +102,7 @@ FillableMat::createPosition(int row, int col)
 FillableMat::feipoolmat::iterator
 insert_row(FillableMat::feipoolmat& matdata,
            FillableMat::feipoolmat::iterator iter,
-           int row,
+           GlobalOrdinal row,
            fei_Pool_alloc<CSVec>& vecpool)
 {
   static CSVec dummy;
@@ -120,7 +120,7 @@ insert_row(FillableMat::feipoolmat& matdata,
 
 //-----------------------------------------------------------------
 void
-FillableMat::sumInCoef(int row, int col, double coef)
+FillableMat::sumInCoef(GlobalOrdinal row, GlobalOrdinal col, double coef)
 {
   CSVec* rowvec = create_or_getRow(row);
 
@@ -129,7 +129,7 @@ FillableMat::sumInCoef(int row, int col, double coef)
 
 //-----------------------------------------------------------------
 void
-FillableMat::putCoef(int row, int col, double coef)
+FillableMat::putCoef(GlobalOrdinal row, GlobalOrdinal col, double coef)
 {
   CSVec* rowvec = create_or_getRow(row);
 
@@ -138,8 +138,8 @@ FillableMat::putCoef(int row, int col, double coef)
 
 //-----------------------------------------------------------------
 void
-FillableMat::sumInRow(int row, const int* cols, const double* coefs,
-                      unsigned len)
+FillableMat::sumInRow(GlobalOrdinal row, const GlobalOrdinal* cols,
+                      const double* coefs, unsigned len)
 {
   CSVec* rowvec = create_or_getRow(row);
 
@@ -150,8 +150,8 @@ FillableMat::sumInRow(int row, const int* cols, const double* coefs,
 
 //-----------------------------------------------------------------
 void
-FillableMat::putRow(int row, const int* cols, const double* coefs,
-                    unsigned len)
+FillableMat::putRow(GlobalOrdinal row, const GlobalOrdinal* cols,
+                    const double* coefs, unsigned len)
 {
   CSVec* rowvec = create_or_getRow(row);
 
@@ -169,7 +169,7 @@ FillableMat::getNumRows() const
 
 //-----------------------------------------------------------------
 bool
-FillableMat::hasRow(int row) const
+FillableMat::hasRow(GlobalOrdinal row) const
 {
   feipoolmat::const_iterator iter = matdata_.find(row);
   return iter != matdata_.end();
@@ -177,7 +177,7 @@ FillableMat::hasRow(int row) const
 
 //-----------------------------------------------------------------
 const CSVec*
-FillableMat::getRow(int row) const
+FillableMat::getRow(GlobalOrdinal row) const
 {
   feipoolmat::const_iterator iter = matdata_.lower_bound(row);
 
@@ -190,7 +190,7 @@ FillableMat::getRow(int row) const
 
 //-----------------------------------------------------------------
 CSVec*
-FillableMat::create_or_getRow(int row)
+FillableMat::create_or_getRow(GlobalOrdinal row)
 {
   feipoolmat::iterator iter = matdata_.lower_bound(row);
 
@@ -228,8 +228,8 @@ FillableMat::operator==(const FillableMat& rhs) const
   FillableMat::const_iterator rhs_it = rhs.begin();
 
   for(; this_it != this_end; ++this_it, ++rhs_it) {
-    int this_row = this_it->first;
-    int rhs_row = rhs_it->first;
+    GlobalOrdinal this_row = this_it->first;
+    GlobalOrdinal rhs_row = rhs_it->first;
     if (this_row != rhs_row) return false;
 
     const CSVec* this_row_vec = this_it->second;
@@ -254,9 +254,9 @@ void print(std::ostream& os, const FillableMat& mat)
   FillableMat::const_iterator
     irow = mat.begin(), irowend = mat.end();
   for(; irow!=irowend; ++irow) {
-    int row = irow->first;
+    GlobalOrdinal row = irow->first;
     const CSVec* vec = irow->second;
-    const std::vector<int>& v_ind = vec->indices();
+    const std::vector<GlobalOrdinal>& v_ind = vec->indices();
     const std::vector<double>& v_coef = vec->coefs();
     os << "row " << row << ": ";
     for(size_t i=0; i<v_ind.size(); ++i) {
@@ -284,7 +284,7 @@ int count_nnz(const FillableMat& mat)
 }
 
 //-----------------------------------------------------------------
-void get_row_numbers(const FillableMat& mat, std::vector<int>& rows)
+void get_row_numbers(const FillableMat& mat, std::vector<GlobalOrdinal>& rows)
 {
   rows.resize(mat.getNumRows());
 
@@ -27,23 +27,26 @@ class FillableMat {
 
   void setValues(double value);
 
-  void createPosition(int row, int col);
+  void createPosition(GlobalOrdinal row, GlobalOrdinal col);
 
-  void sumInCoef(int row, int col, double coef);
-  void putCoef(int row, int col, double coef);
+  void sumInCoef(GlobalOrdinal row, GlobalOrdinal col, double coef);
+  void putCoef(GlobalOrdinal row, GlobalOrdinal col, double coef);
 
-  void sumInRow(int row, const int* cols, const double* coefs, unsigned len);
-  void putRow(int row, const int* cols, const double* coefs, unsigned len);
+  void sumInRow(GlobalOrdinal row, const GlobalOrdinal* cols,
+                const double* coefs, unsigned len);
+  void putRow(GlobalOrdinal row, const GlobalOrdinal* cols,
+              const double* coefs, unsigned len);
 
   unsigned getNumRows() const;
 
-  bool hasRow(int row) const;
+  bool hasRow(GlobalOrdinal row) const;
 
-  const CSVec* getRow(int row) const;
-  CSVec* create_or_getRow(int row);
+  const CSVec* getRow(GlobalOrdinal row) const;
+  CSVec* create_or_getRow(GlobalOrdinal row);
 
-  typedef std::map<int, CSVec*, std::less<int>,
-                fei_Pool_alloc<std::pair<const int,CSVec*> > > feipoolmat;
+  typedef std::map<GlobalOrdinal, CSVec*, std::less<GlobalOrdinal>,
+                fei_Pool_alloc<std::pair<const GlobalOrdinal,CSVec*> > >
+    feipoolmat;
 
   typedef feipoolmat::iterator iterator;
   typedef feipoolmat::const_iterator const_iterator;
@@ -72,7 +75,7 @@ void print(std::ostream& os, const FillableMat& mat);
 int count_nnz(const FillableMat& mat);
 
 /** Fill a std::vector with the row-numbers from the given matrix. */
-void get_row_numbers(const FillableMat& mat, std::vector<int>& rows);
+void get_row_numbers(const FillableMat& mat, std::vector<GlobalOrdinal>& rows);
 
 }//namespace fei
 
@@ -21,6 +21,7 @@
 
 #include <cmath>
 #include <algorithm>
+#include <vector>
 
 #undef fei_file
 #define fei_file "fei_Filter.cpp"
@@ -131,6 +132,104 @@ void Filter::copyStiffness(const double* const* elemStiff,
   }
 }
 
+//------------------------------------------------------------------------------
+int Filter::packedStiffnessSize(int numRows, int elemFormat)
+{
+  switch (elemFormat) {
+  case FEI_DENSE_ROW:
+  case FEI_DENSE_COL:
+    return( numRows*numRows );
+
+  case FEI_UPPER_SYMM_ROW:
+  case FEI_LOWER_SYMM_ROW:
+  case FEI_UPPER_SYMM_COL:
+  case FEI_LOWER_SYMM_COL:
+    return( numRows*(numRows+1)/2 );
+
+  default:
+    return(-1);
+  }
+}
+
+//------------------------------------------------------------------------------
+void Filter::packedStiffnessRows(const double* packed, int numRows,
+                                 int elemFormat, const double** rows)
+{
+  //Row (or column) i of the upper-symmetric-row and lower-symmetric-col
+  //formats holds entries i..numRows-1, while the lower-symmetric-row and
+  //upper-symmetric-col formats hold entries 0..i. (See copyStiffness.)
+  int offset = 0;
+  for(int i=0; i<numRows; i++) {
+    rows[i] = packed + offset;
+
+    switch (elemFormat) {
+    case FEI_UPPER_SYMM_ROW:
+    case FEI_LOWER_SYMM_COL:
+      offset += numRows - i;
+      break;
+    case FEI_LOWER_SYMM_ROW:
+    case FEI_UPPER_SYMM_COL:
+      offset += i + 1;
+      break;
+    default:
+      offset += numRows;
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+int Filter::sumInElemBlockMatrix(GlobalID elemBlockID,
+                                 int numElems,
+                                 const GlobalID* elemIDs,
+                                 const GlobalID* elemConn,
+                                 const double* elemStiffness,
+                                 const double* elemLoads,
+                                 int elemFormat)
+{
+  if (elemStiffness != NULL &&
+      elemFormat != FEI_DENSE_ROW && elemFormat != FEI_DENSE_COL) {
+    fei::console_out() << "Filter::sumInElemBlockMatrix ERROR, elemFormat="
+                       << elemFormat << " not supported."<<FEI_ENDL;
+    ERReturn(-1);
+  }
+
+  BlockDescriptor* block = NULL;
+  CHK_ERR( problemStructure_->getBlockDescriptor(elemBlockID, block) );
+  int numNodes = block->getNumNodesPerElement();
+  int numRows = block->getNumEqnsPerElement();
+  if (numElems <= 0 || numRows <= 0) return(0);
+
+  std::vector<const double*> stiffRows(numRows);
+
+  for(int e=0; e<numElems; ++e) {
+    const GlobalID* conn = elemConn != NULL ? elemConn + e*numNodes : NULL;
+    const double* load = elemLoads != NULL ? elemLoads + e*numRows : NULL;
+
+    if (elemStiffness == NULL) {
+      if (load != NULL) {
+        CHK_ERR( sumInElemRHS(elemBlockID, elemIDs[e], conn, load) );
+      }
+      continue;
+    }
+
+    const double* stiff = elemStiffness + e*numRows*numRows;
+    for(int i=0; i<numRows; ++i) {
+      stiffRows[i] = stiff + i*numRows;
+    }
+
+    if (load != NULL) {
+      CHK_ERR( sumInElem(elemBlockID, elemIDs[e], conn, &stiffRows[0],
+                         load, elemFormat) );
+    }
+    else {
+      CHK_ERR( sumInElemMatrix(elemBlockID, elemIDs[e], conn, &stiffRows[0],
+                               elemFormat) );
+    }
+  }
+
+  return(0);
+}
+
 //------------------------------------------------------------------------------
 const NodeDescriptor* Filter::findNode(GlobalID nodeID) const {
 //
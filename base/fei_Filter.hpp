@@ -78,6 +78,17 @@ class Filter {
                             const GlobalID* /*elemConn*/,
                             const double* /*elemLoad*/) { return(0); }
 
+   /** Batched element input. This default implementation unpacks the batch
+       and makes one sumInElem (or sumInElemMatrix/sumInElemRHS) call per
+       element. */
+   virtual int sumInElemBlockMatrix(GlobalID elemBlockID,
+                                    int numElems,
+                                    const GlobalID* elemIDs,
+                                    const GlobalID* elemConn,
+                                    const double* elemStiffness,
+                                    const double* elemLoads,
+                                    int elemFormat);
+
     virtual int loadCRMult(int CRMultID, 
                    int numCRNodes,
                    const GlobalID* CRNodes, 
@@ -230,6 +241,20 @@ class Filter {
    static void copyStiffness(const double* const* elemStiff, int numRows,
                              int elemFormat, double** copy);
 
+   /** Number of coefficients in one element-stiffness table stored
+       contiguously in 'elemFormat': numRows*numRows for the dense formats,
+       numRows*(numRows+1)/2 for the symmetric ones. Returns -1 if elemFormat
+       is not recognized.
+   */
+   static int packedStiffnessSize(int numRows, int elemFormat);
+
+   /** Point rows[i] at the i-th row (column, for the column formats) of an
+       element-stiffness table stored contiguously in 'elemFormat', so that
+       the table can be handed on without being copied.
+   */
+   static void packedStiffnessRows(const double* packed, int numRows,
+                                   int elemFormat, const double** rows);
+
    void setLogStream(std::ostream* logstrm);
    std::ostream* logStream();
 
@@ -0,0 +1,86 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_macros.hpp>
+
+#include <fei_defs.h>
+#include <fei_Filter.hpp>
+#include <fei_FiniteElementData.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+#undef fei_file
+#define fei_file "fei_FiniteElementData.cpp"
+#include <fei_ErrMacros.hpp>
+
+//------------------------------------------------------------------------------
+int FiniteElementData::setElemMatrixInPlace(int elemBlockID,
+                                            int elemID,
+                                            int numNodes,
+                                            const int* nodeNumbers,
+                                            const int* numDofPerNode,
+                                            const int* dof_ids,
+                                            int elemFormat,
+                                            const double* const* coefs)
+{
+  if (elemFormat == FEI_DENSE_ROW) {
+    return( setElemMatrix(elemBlockID, elemID, numNodes, nodeNumbers,
+                          numDofPerNode, dof_ids, coefs) );
+  }
+
+  int numRows = 0;
+  for(int i=0; i<numNodes; ++i) numRows += numDofPerNode[i];
+
+  std::vector<double> dense(numRows*numRows);
+  std::vector<double*> denseRows(numRows);
+  for(int i=0; i<numRows; ++i) denseRows[i] = &dense[i*numRows];
+
+  try {
+    Filter::copyStiffness(coefs, numRows, elemFormat, &denseRows[0]);
+  }
+  catch(std::runtime_error& exc) {
+    fei::console_out() << exc.what() << FEI_ENDL;
+    ERReturn(-1);
+  }
+
+  std::vector<const double*> rows(denseRows.begin(), denseRows.end());
+  return( setElemMatrix(elemBlockID, elemID, numNodes, nodeNumbers,
+                        numDofPerNode, dof_ids, &rows[0]) );
+}
+
+//------------------------------------------------------------------------------
+int FiniteElementData::setElemMatrices(int elemBlockID,
+                                       int numElems,
+                                       const int* elemIDs,
+                                       int numNodes,
+                                       const int* nodeNumbers,
+                                       const int* numDofPerNode,
+                                       const int* dof_ids,
+                                       int elemFormat,
+                                       const double* coefs)
+{
+  int numRows = 0;
+  for(int i=0; i<numNodes; ++i) numRows += numDofPerNode[i];
+
+  int elemSize = Filter::packedStiffnessSize(numRows, elemFormat);
+  if (elemSize < 0) ERReturn(-1);
+  if (numRows <= 0) return(0);
+
+  std::vector<const double*> rows(numRows);
+  for(int e=0; e<numElems; ++e) {
+    Filter::packedStiffnessRows(coefs + e*elemSize, numRows, elemFormat,
+                                &rows[0]);
+
+    CHK_ERR( setElemMatrixInPlace(elemBlockID, elemIDs[e], numNodes,
+                                  nodeNumbers + e*numNodes, numDofPerNode,
+                                  dof_ids, elemFormat, &rows[0]) );
+  }
+
+  return(0);
+}
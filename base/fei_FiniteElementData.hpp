@@ -132,6 +132,64 @@ class FiniteElementData {
                              const int* dof_ids,
                              const double* coefs) = 0;
 
+   /** For passing an element-stiffness array in the layout in which the
+    application supplied it. The coefficients are the application's own and
+    are not copied by the FEI; an implementation which can use them in place
+    (e.g., one which only keeps pointers to element data) may do so for as long
+    as the application keeps them alive and unchanged.
+    The default implementation expands non-FEI_DENSE_ROW tables into a dense
+    copy and calls setElemMatrix.
+    @param elemBlockID Identifier for the element-block that this element
+        belongs to.
+    @param elemID Locally zero-based identifier for this element.
+    @param numNodes Number of nodes on this element.
+    @param nodeNumbers List of length numNodes
+    @param numDofPerNode List of length numNodes.
+    @param dof_ids List of length sum(numDofPerNode[i])
+    @param elemFormat One of FEI_DENSE_ROW, FEI_DENSE_COL,
+    FEI_UPPER_SYMM_ROW, FEI_LOWER_SYMM_ROW, FEI_UPPER_SYMM_COL or
+    FEI_LOWER_SYMM_COL (see fei_defs.h).
+    @param coefs C-style table in elemFormat. For the symmetric formats
+    each row (or column) holds only its part of the triangle.
+   */
+   virtual int setElemMatrixInPlace(int elemBlockID,
+                                    int elemID,
+                                    int numNodes,
+                                    const int* nodeNumbers,
+                                    const int* numDofPerNode,
+                                    const int* dof_ids,
+                                    int elemFormat,
+                                    const double* const* coefs);
+
+   /** For passing the element-stiffness arrays of several elements of one
+    element-block at once. All elements of a block have the same
+    numDofPerNode and dof_ids. As with setElemMatrixInPlace, 'coefs' is the
+    application's own array and is not copied by the FEI.
+    The default implementation makes one setElemMatrixInPlace call per
+    element.
+    @param elemBlockID Identifier for the element-block.
+    @param numElems Number of elements.
+    @param elemIDs List of length numElems.
+    @param numNodes Number of nodes per element.
+    @param nodeNumbers Packed list of length numElems*numNodes.
+    @param numDofPerNode List of length numNodes.
+    @param dof_ids List of length sum(numDofPerNode[i]).
+    @param elemFormat As for setElemMatrixInPlace.
+    @param coefs numElems element tables stored back to back. Each holds
+    n*n coefficients for the dense formats and n*(n+1)/2 for the symmetric
+    formats, where n is sum(numDofPerNode[i]). Within a symmetric table,
+    the rows (or columns) are stored one after another.
+   */
+   virtual int setElemMatrices(int elemBlockID,
+                               int numElems,
+                               const int* elemIDs,
+                               int numNodes,
+                               const int* nodeNumbers,
+                               const int* numDofPerNode,
+                               const int* dof_ids,
+                               int elemFormat,
+                               const double* coefs);
+
    /** Specify dirichlet boundary-condition values.
     @param numBCs Number of boundary-condition values.
     @param nodeNumbers List of length numBCs.
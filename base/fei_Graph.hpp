@@ -24,26 +24,30 @@ namespace fei {
     virtual ~Graph(){}
 
     /** alias for the 'table_type' data container */
-    typedef snl_fei::RaggedTable<snl_fei::MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >
+    typedef snl_fei::RaggedTable<
+              snl_fei::MapContig<fei::ctg_set<GlobalOrdinal>*>,
+              fei::ctg_set<GlobalOrdinal> >
       table_type;
 
     /** alias for table_row_type, which is a row of the table */
-    typedef fei::ctg_set<int> table_row_type;
+    typedef fei::ctg_set<GlobalOrdinal> table_row_type;
 
     /** alias for the type of the remotely-owned portion of the table data */
-    typedef snl_fei::RaggedTable<std::map<int,fei::ctg_set<int>*>,fei::ctg_set<int> > 
+    typedef snl_fei::RaggedTable<std::map<GlobalOrdinal,
+                                          fei::ctg_set<GlobalOrdinal>*>,
+                                 fei::ctg_set<GlobalOrdinal> >
       remote_table_type;
 
     /** Add indices to a specified row of the table */
-    virtual int addIndices(int row,
+    virtual int addIndices(GlobalOrdinal row,
 		   int len,
-		   const int* indices) = 0;
+		   const GlobalOrdinal* indices) = 0;
 
     /** Add a symmetric block of indices. The array of indices will serve as
 	both row-numbers, and as column-numbers in those rows.
     */
     virtual int addSymmetricIndices(int numIndices,
-			    int* indices,
+			    GlobalOrdinal* indices,
 			    bool diagonal=false) = 0;
 
     /** gather all remotely-owned table portions to owning processors */
@@ -30,15 +30,17 @@ fei::GraphReducer::~GraphReducer()
 }
 
 //----------------------------------------------------------------------------
-int fei::GraphReducer::addIndices(int row, int len, const int* indices)
+int fei::GraphReducer::addIndices(GlobalOrdinal row, int len,
+                                  const GlobalOrdinal* indices)
 {
   reducer_->addGraphIndices(1, &row, len, indices, *target_);
   return(0);
 }
 
 //----------------------------------------------------------------------------
-int fei::GraphReducer::addSymmetricIndices(int numIndices, int* indices,
-                                         bool diagonal)
+int fei::GraphReducer::addSymmetricIndices(int numIndices,
+                                           GlobalOrdinal* indices,
+                                           bool diagonal)
 {
   reducer_->addSymmetricGraphIndices(numIndices, indices, diagonal, *target_);
   return(0);
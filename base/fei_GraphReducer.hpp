@@ -29,15 +29,15 @@ namespace fei {
     virtual ~GraphReducer();
 
     /** Add indices to a specified row of the table */
-    int addIndices(int row,
+    int addIndices(GlobalOrdinal row,
 		   int len,
-		   const int* indices);
+		   const GlobalOrdinal* indices);
 
     /** Add a symmetric block of indices. The array of indices will serve as
 	both row-numbers, and as column-numbers in those rows.
     */
     int addSymmetricIndices(int numIndices,
-			    int* indices,
+			    GlobalOrdinal* indices,
 			    bool diagonal=false);
 
     /** gather all remotely-owned table portions to owning processors */
@@ -12,6 +12,7 @@
 #include <fei_EqnComm.hpp>
 #include <fei_CommUtils.hpp>
 #include <fei_TemplateUtils.hpp>
+#include <fei_impl_utils.hpp>
 #include <fei_VectorSpace.hpp>
 
 #undef fei_file
@@ -19,7 +20,8 @@
 #include <fei_ErrMacros.hpp>
 
 //----------------------------------------------------------------------------
-fei::Graph_Impl::Graph_Impl(MPI_Comm comm, int firstLocalRow, int lastLocalRow)
+fei::Graph_Impl::Graph_Impl(MPI_Comm comm, GlobalOrdinal firstLocalRow,
+                            GlobalOrdinal lastLocalRow)
   : localGraphData_(NULL),
     remoteGraphData_(),
     eqnComm_(),
@@ -37,7 +39,8 @@ fei::Graph_Impl::Graph_Impl(MPI_Comm comm, int firstLocalRow, int lastLocalRow)
   for(int p=0; p<numProcs_; ++p) {
     remoteGraphData_[p] = new remote_table_type(-1, -1);
   }
-  eqnComm_.reset(new fei::EqnComm(comm_, lastLocalRow-firstLocalRow+1));
+  int numLocalRows = static_cast<int>(lastLocalRow-firstLocalRow+1);
+  eqnComm_.reset(new fei::EqnComm(comm_, numLocalRows));
   localGraphData_       = new table_type(firstLocalRow_, lastLocalRow_);
 }
 
@@ -51,7 +54,8 @@ fei::Graph_Impl::~Graph_Impl()
 }
 
 //----------------------------------------------------------------------------
-int fei::Graph_Impl::addIndices(int row, int len, const int* indices)
+int fei::Graph_Impl::addIndices(GlobalOrdinal row, int len,
+                                const GlobalOrdinal* indices)
 {
   if (row < 0) {
     return(-1);
@@ -67,8 +71,9 @@ int fei::Graph_Impl::addIndices(int row, int len, const int* indices)
 }
 
 //----------------------------------------------------------------------------
-int fei::Graph_Impl::addSymmetricIndices(int numIndices, int* indices,
-					bool diagonal)
+int fei::Graph_Impl::addSymmetricIndices(int numIndices,
+                                         GlobalOrdinal* indices,
+                                         bool diagonal)
 {
   if (diagonal) {
     addDiagonals(numIndices, indices);
@@ -111,13 +116,13 @@ int fei::Graph_Impl::addSymmetricIndices(int numIndices, int* indices,
 }
 
 //----------------------------------------------------------------------------
-void fei::Graph_Impl::addDiagonals(int numIndices, int* indices)
+void fei::Graph_Impl::addDiagonals(int numIndices, GlobalOrdinal* indices)
 {
   bool all_local = true;
   int i;
   if (numProcs_ > 1) {
     for(i=0; i<numIndices; ++i) {
-      int ind = indices[i];
+      GlobalOrdinal ind = indices[i];
       if (ind < 0) {
         throw std::runtime_error("fei::Graph_Impl::addDiagonals given negative index");
       }
@@ -140,7 +145,7 @@ void fei::Graph_Impl::addDiagonals(int numIndices, int* indices)
   }
   else {
     for(i=0; i<numIndices; ++i) {
-      int ind = indices[i];
+      GlobalOrdinal ind = indices[i];
       if (ind >= firstLocalRow_ && ind <= lastLocalRow_) {
 	  localGraphData_->addIndices(ind, 1, &ind);
       }
@@ -216,7 +221,7 @@ int fei::Graph_Impl::gatherFromOverlap()
   fei::mirrorProcs(comm_, sendProcs, recvProcs);
 
   //next we'll declare arrays to receive into.
-  std::vector<std::vector<int> > recv_ints(recvProcs.size());
+  std::vector<std::vector<char> > recv_bytes(recvProcs.size());
 
   //...and an array for the sizes of the recv buffers:
   std::vector<int> recv_sizes(recvProcs.size());
@@ -225,7 +230,6 @@ int fei::Graph_Impl::gatherFromOverlap()
 
   int tag1 = 11113;
 
-  unsigned offset = 0;
   for(unsigned i=0; i<recvProcs.size(); ++i) {
     MPI_Irecv(&recv_sizes[i], 1, MPI_INT, recvProcs[i],
               tag1, comm_, &mpiReqs[i]);
@@ -233,16 +237,16 @@ int fei::Graph_Impl::gatherFromOverlap()
 
   //now we'll pack our to-be-sent data into buffers, and send the
   //sizes to the receiving procs:
-  std::vector<std::vector<int> > send_ints(sendProcs.size());
+  std::vector<std::vector<char> > send_bytes(sendProcs.size());
 
   for(unsigned i=0; i<sendProcs.size(); ++i) {
     int proc = sendProcs[i];
 
-    fei::packRaggedTable(*(remoteGraphData_[proc]), send_ints[i]);
+    fei::packRaggedTable(*(remoteGraphData_[proc]), send_bytes[i]);
 
-    int isize = send_ints[i].size();
+    int bsize = send_bytes[i].size();
 
-    MPI_Send(&isize, 1, MPI_INT, proc, tag1, comm_);
+    MPI_Send(&bsize, 1, MPI_INT, proc, tag1, comm_);
   }
 
   if (mpiReqs.size() > 0) {
@@ -251,11 +255,11 @@ int fei::Graph_Impl::gatherFromOverlap()
 
   //now resize our recv buffers, and post the recvs.
   for(size_t i=0; i<recvProcs.size(); ++i) {
-    int intsize = recv_sizes[i];
+    int bsize = recv_sizes[i];
 
-    recv_ints[i].resize(intsize);
+    recv_bytes[i].resize(bsize);
 
-    MPI_Irecv(&(recv_ints[i][0]), intsize, MPI_INT, recvProcs[i],
+    MPI_Irecv(&(recv_bytes[i][0]), bsize, MPI_CHAR, recvProcs[i],
               tag1, comm_, &mpiReqs[i]);
   }
 
@@ -263,7 +267,7 @@ int fei::Graph_Impl::gatherFromOverlap()
   for(size_t i=0; i<sendProcs.size(); ++i) {
     int proc = sendProcs[i];
 
-    MPI_Send(&(send_ints[i][0]), send_ints[i].size(), MPI_INT,
+    MPI_Send(&(send_bytes[i][0]), send_bytes[i].size(), MPI_CHAR,
              proc, tag1, comm_);
   }
 
@@ -271,16 +275,26 @@ int fei::Graph_Impl::gatherFromOverlap()
     MPI_Waitall(mpiReqs.size(), &mpiReqs[0], &mpiStatuses[0]);
   }
 
+  //unpack the rows that fei::packRaggedTable encoded.
+  std::vector<GlobalOrdinal> cols;
   for(unsigned i=0; i<recvProcs.size(); ++i) {
-    std::vector<int> recvdata = recv_ints[i];
-    int numRows = recvdata[0];
-    int* rowNumbers = &recvdata[1];
-    int* rowLengths = rowNumbers+numRows;
-    int* packedCols = rowLengths+numRows;
-    offset = 0;
+    const char* data = &(recv_bytes[i][0]);
+    const char* data_end = data + recv_bytes[i].size();
+
+    int numRows = 0;
+    data = fei::impl_utils::decode_indices(data, data_end, 1, 0, &numRows);
+
+    GlobalOrdinal row = 0;
     for(int r=0; r<numRows; ++r) {
-      addIndices(rowNumbers[r], rowLengths[r], &packedCols[offset]);
-      offset += rowLengths[r];
+      int rowLen = 0;
+      data = fei::impl_utils::decode_indices(data, data_end, 1, row, &row);
+      data = fei::impl_utils::decode_indices(data, data_end, 1, 0, &rowLen);
+      cols.resize(rowLen);
+      if (rowLen > 0) {
+        data = fei::impl_utils::decode_indices(data, data_end, rowLen,
+                                               row, &cols[0]);
+      }
+      addIndices(row, rowLen, rowLen > 0 ? &cols[0] : NULL);
     }
   }
 
@@ -289,7 +303,7 @@ int fei::Graph_Impl::gatherFromOverlap()
 }
 
 //----------------------------------------------------------------------------
-int fei::Graph_Impl::getLocalRowLength(int row)
+int fei::Graph_Impl::getLocalRowLength(GlobalOrdinal row)
 {
   table_row_type* colIndices = localGraphData_->getRow(row);
   if (colIndices == NULL) {
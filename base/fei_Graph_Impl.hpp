@@ -21,21 +21,22 @@ namespace fei {
   class Graph_Impl : public fei::Graph {
   public:
     /** constructor */
-    Graph_Impl(MPI_Comm comm, int firstLocalRow, int lastLocalRow);
+    Graph_Impl(MPI_Comm comm, GlobalOrdinal firstLocalRow,
+               GlobalOrdinal lastLocalRow);
 
     /** destructor */
     virtual ~Graph_Impl();
 
     /** Add indices to a specified row of the table */
-    int addIndices(int row,
+    int addIndices(GlobalOrdinal row,
 		   int len,
-		   const int* indices);
+		   const GlobalOrdinal* indices);
 
     /** Add a symmetric block of indices. The array of indices will serve as
 	both row-numbers, and as column-numbers in those rows.
     */
     int addSymmetricIndices(int numIndices,
-			    int* indices,
+			    GlobalOrdinal* indices,
 			    bool diagonal=false);
 
     /** gather all remotely-owned table portions to owning processors */
@@ -70,16 +71,16 @@ namespace fei {
     int getNumLocalNonzeros() const;
 
     /** Get the length of a specified locally-owned row. */
-    int getLocalRowLength(int row);
+    int getLocalRowLength(GlobalOrdinal row);
 
   private:
-    void addDiagonals(int numIndices, int* indices);
+    void addDiagonals(int numIndices, GlobalOrdinal* indices);
 
     table_type* localGraphData_;
     std::vector<remote_table_type*> remoteGraphData_;
     fei::SharedPtr<fei::EqnComm> eqnComm_;
 
-    int firstLocalRow_, lastLocalRow_;
+    GlobalOrdinal firstLocalRow_, lastLocalRow_;
     int localProc_, numProcs_;
     MPI_Comm comm_;
   };//class Graph_Impl
@@ -14,8 +14,10 @@
 
 namespace fei {
   /** Abstract interface for adding index mappings to a table of indices,
-      such as an algebraic matrix-graph.
+      such as an algebraic matrix-graph. INDEX_TYPE is the type of the rows
+      and indices (int, or fei::GlobalOrdinal for a global matrix-graph).
   */
+  template<typename INDEX_TYPE>
   class IndexTable {
   public:
     /** Constructor */
@@ -27,21 +29,21 @@ namespace fei {
     /** Input function to add diagonals to the index table.
      */
     virtual void addDiagonals(int numIndices,
-			      const int* indices) = 0;
+			      const INDEX_TYPE* indices) = 0;
 
     /** Input function 'addIndices' specifies the row of the table to be
 	operated on, and a list of indices to be added to that row.
     */
-    virtual void addIndices(int row,
+    virtual void addIndices(INDEX_TYPE row,
 			    int numIndices,
-			    const int* indices) = 0;
+			    const INDEX_TYPE* indices) = 0;
 
     /** Input function for adding a list of indices to multiple rows.
      */
     virtual void addIndices(int numRows,
-			    const int* rows,
+			    const INDEX_TYPE* rows,
 			    int numIndices,
-			    const int* indices) = 0;
+			    const INDEX_TYPE* indices) = 0;
   };//class IndexTable
 
 }//namespace fei
@@ -66,6 +66,8 @@ LinSysCoreFilter::LinSysCoreFilter(FEI_Implementation* owner,
    firstRemEqnExchange_(true),
    needToCallMatrixLoadComplete_(false),
    resolveConflictRequested_(false),
+   packedEqnExchange_(false),
+   frozenEqnExchange_(false),
    localStartRow_(0),             //
    localEndRow_(0),               //Initialize all private variables here,
    numLocalEqns_(0),              //in the order that they are declared.
@@ -99,6 +101,18 @@ LinSysCoreFilter::LinSysCoreFilter(FEI_Implementation* owner,
    iworkSpace2_(),
    dworkSpace_(),
    dworkSpace2_(),
+   localPtRows_(),
+   localBlkRows_(),
+   localPtRowCoefs_(),
+   batchIndices_(),
+   batchEqns_(),
+   batchStiff_(),
+   batchRowPtrs_(),
+   batchElemPtrs_(),
+   batchLoadPtrs_(),
+   batchIndPtrs_(),
+   localSoln_(),
+   localSolnValid_(false),
    eStiff_(NULL),
    eStiff1D_(NULL),
    eLoad_(NULL)
@@ -198,6 +212,9 @@ int LinSysCoreFilter::initialize()
 
   eqnCommMgr_ = problemStructure_->getEqnCommMgr().deepCopy();
   if (eqnCommMgr_ == NULL) ERReturn(-1);
+  localSolnValid_ = false;
+  eqnCommMgr_->setPackedExchange(packedEqnExchange_);
+  eqnCommMgr_->setFreezePattern(frozenEqnExchange_);
 
   int err = createEqnCommMgr_put();
   if (err != 0) ERReturn(err);
@@ -217,10 +234,12 @@ int LinSysCoreFilter::initialize()
     // let's prepare some arrays for handing the matrix structure to
     // the linear system.
 
+    //the row pointers in 'indices' point directly into the structure's
+    //packed column-index array, nothing is copied here.
     std::vector<int> rowLengths;
-    CHK_ERR( problemStructure_->getMatrixRowLengths(rowLengths) );
+    std::vector<int*> indices;
+    CHK_ERR( problemStructure_->getMatrixStructure(indices, rowLengths) );
 
-    int numReducedEqns = problemStructure_->getNumLocalReducedEqns();
     int maxBlkSize = problemStructure_->getGlobalMaxBlkSize();
     std::vector<int> blkSizes(numLocalReducedEqnBlks_, 1);
 
@@ -229,20 +248,9 @@ int LinSysCoreFilter::initialize()
       numNonzeros += rowLengths[ii];
     }
 
-    std::vector<int> indices_1D(numNonzeros);
-    std::vector<int*> indices(numReducedEqns);
-
-    int offset = 0;
-    for(size_t ii=0; ii<rowLengths.size(); ++ii) {
-      indices[ii] = &(indices_1D[offset]);
-      offset += rowLengths[ii];
-    }
-
     if (maxBlkSize == 0) ERReturn(-1);
 
     if (maxBlkSize == 1) {
-      CHK_ERR( problemStructure_->getMatrixStructure(&indices[0], rowLengths) );
-
       debugOutput("#LinSysCoreFilter calling point lsc_->setMatrixStructure");
       CHK_ERR( lsc_->setMatrixStructure(&indices[0], &rowLengths[0],
                                         &indices[0], &rowLengths[0], &blkSizes[0]) );
@@ -254,11 +262,11 @@ int LinSysCoreFilter::initialize()
         new int*[numLocalReducedEqnBlks_] : NULL;
       if (blkIndices == NULL && numLocalReducedEqnBlks_ != 0) ERReturn(-1);
 
-      CHK_ERR( problemStructure_->getMatrixStructure(&indices[0], rowLengths,
+      CHK_ERR( problemStructure_->getMatrixStructure(indices, rowLengths,
                                                      blkIndices, blkIndices_1D,
                                                      blkRowLengths, blkSizes) );
 
-      offset = 0;
+      int offset = 0;
       for(int ii=0; ii<numLocalReducedEqnBlks_; ++ii) {
         blkIndices[ii] = &(blkIndices_1D[offset]);
         offset += blkRowLengths[ii];
@@ -913,6 +921,7 @@ int LinSysCoreFilter::resetInitialGuess(double s) {
     values[i] = s;
   }
 
+  localSolnValid_ = false;
   CHK_ERR( lsc_->putInitialGuess(eqns, values, numReducedRows_) );
 
   delete [] eqns;
@@ -1089,6 +1098,131 @@ int LinSysCoreFilter::sumInElemRHS(GlobalID elemBlockID,
                           elemLoad, -1));
 }
 
+//------------------------------------------------------------------------------
+int LinSysCoreFilter::sumInElemBlockMatrix(GlobalID elemBlockID,
+                                           int numElems,
+                                           const GlobalID* elemIDs,
+                                           const GlobalID* elemConn,
+                                           const double* elemStiffness,
+                                           const double* elemLoads,
+                                           int elemFormat)
+{
+  if (Filter::logStream() != NULL && outputLevel_ > 2) {
+    (*logStream()) << "FEI: sumInElemBlockMatrix" << FEI_ENDL <<"#blkID" << FEI_ENDL
+                      << static_cast<int>(elemBlockID) << FEI_ENDL
+                      << "#n-elems" << FEI_ENDL << numElems << FEI_ENDL;
+  }
+
+  if (elemStiffness != NULL &&
+      elemFormat != FEI_DENSE_ROW && elemFormat != FEI_DENSE_COL) {
+    fei::console_out() << "LinSysCoreFilter::sumInElemBlockMatrix ERROR, elemFormat="
+             << elemFormat << " not supported."<<FEI_ENDL;
+    ERReturn(-1);
+  }
+
+  if (numElems <= 0) return(FEI_SUCCESS);
+
+  //Slave-eqn reduction and block-entry matrices are handled per element by
+  //generalElemInput, so in those cases there's nothing to gain by batching.
+  if (problemStructure_->numSlaveEquations() != 0 || blockMatrix_) {
+    return( Filter::sumInElemBlockMatrix(elemBlockID, numElems, elemIDs,
+                                         elemConn, elemStiffness, elemLoads,
+                                         elemFormat) );
+  }
+
+  BlockDescriptor* block = NULL;
+  CHK_ERR( problemStructure_->getBlockDescriptor(elemBlockID, block) );
+
+  int numElemRows = block->getNumEqnsPerElement();
+  int interleave = block->getInterleaveStrategy();
+  if (numElemRows <= 0) return(FEI_SUCCESS);
+
+  int numRows = numElems*numElemRows;
+
+  //scatter indices for the whole batch, packed element by element.
+  batchIndices_.resize(numRows);
+  batchIndPtrs_.resize(numElems);
+  for(int e=0; e<numElems; ++e) {
+    int* indPtr = &batchIndices_[e*numElemRows];
+    problemStructure_->getScatterIndices_ID(elemBlockID, elemIDs[e],
+                                            interleave, indPtr);
+    batchIndPtrs_[e] = indPtr;
+  }
+
+  if (elemStiffness != NULL) {
+    const double* stiff = elemStiffness;
+
+    if (elemFormat == FEI_DENSE_COL) {
+      int elemSize = numElemRows*numElemRows;
+      batchStiff_.resize(numElems*elemSize);
+      for(int e=0; e<numElems; ++e) {
+        const double* src = elemStiffness + e*elemSize;
+        double* dest = &batchStiff_[e*elemSize];
+        for(int i=0; i<numElemRows; ++i) {
+          for(int j=0; j<numElemRows; ++j) {
+            dest[i*numElemRows+j] = src[j*numElemRows+i];
+          }
+        }
+      }
+      stiff = &batchStiff_[0];
+    }
+
+    batchRowPtrs_.resize(numRows);
+    batchElemPtrs_.resize(numElems);
+    for(int r=0; r<numRows; ++r) {
+      batchRowPtrs_[r] = stiff + r*numElemRows;
+    }
+    for(int e=0; e<numElems; ++e) {
+      batchElemPtrs_[e] = &batchRowPtrs_[e*numElemRows];
+    }
+
+    //Not checking the return-value, as in generalElemInput.
+    lsc_->setStiffnessMatrices(elemBlockID, numElems, elemIDs,
+                               &batchElemPtrs_[0], numElemRows,
+                               &batchIndPtrs_[0]);
+
+    //Sum the whole batch into one local matrix, so that each distinct row
+    //is handed to the LinearSystemCore (or to eqnCommMgr_ if the row is
+    //remotely-owned) only once.
+    const fei::GlobalOrdinal* batchEqns =
+      fei::impl_utils::global_indices(numRows, &batchIndices_[0], batchEqns_);
+    fei::FillableMat batchMat;
+    for(int r=0; r<numRows; ++r) {
+      batchMat.sumInRow(batchEqns[r],
+                        batchEqns + (r/numElemRows)*numElemRows,
+                        batchRowPtrs_[r], numElemRows);
+    }
+
+    fei::CSRMat csrBatchMat(batchMat);
+    CHK_ERR( sumIntoMatrix(csrBatchMat) );
+
+    newMatrixData_ = true;
+  }
+
+  if (elemLoads != NULL) {
+    batchLoadPtrs_.resize(numElems);
+    for(int e=0; e<numElems; ++e) {
+      batchLoadPtrs_[e] = elemLoads + e*numElemRows;
+    }
+
+    lsc_->setLoadVectors(elemBlockID, numElems, elemIDs,
+                         &batchLoadPtrs_[0], numElemRows,
+                         &batchIndPtrs_[0]);
+
+    fei::CSVec batchRHS;
+    fei::add_entries(batchRHS, numRows,
+                     fei::impl_utils::global_indices(numRows,
+                                                     &batchIndices_[0],
+                                                     batchEqns_),
+                     elemLoads);
+    CHK_ERR( sumIntoRHS(batchRHS) );
+
+    newVectorData_ = true;
+  }
+
+  return(FEI_SUCCESS);
+}
+
 //------------------------------------------------------------------------------
 int LinSysCoreFilter::generalElemInput(GlobalID elemBlockID,
                                        GlobalID elemID,
@@ -1324,7 +1458,12 @@ int LinSysCoreFilter::implementAllBCs() {
 
    //now separate the boundary-condition equations into arrays
    fei::FillableMat bcEqns_mat(bcEqns);
-   fei::impl_utils::separate_BC_eqns(bcEqns_mat, essEqns, essGamma);
+   std::vector<fei::GlobalOrdinal> bcEqnNumbers;
+   fei::impl_utils::separate_BC_eqns(bcEqns_mat, bcEqnNumbers, essGamma);
+   essEqns.resize(bcEqnNumbers.size());
+   for(size_t i=0; i<bcEqnNumbers.size(); ++i) {
+     essEqns[i] = fei::impl_utils::int_index(bcEqnNumbers[i]);
+   }
 
    std::vector<double> essAlpha(essEqns.size(), 1);
 
@@ -1510,6 +1649,10 @@ int LinSysCoreFilter::exchangeRemoteEquations()
 int LinSysCoreFilter::unpackRemoteContributions(EqnCommMgr& eqnCommMgr,
                                                 int assemblyMode)
 {
+  if (eqnCommMgr.packedExchange()) {
+    return( unpackPackedRemoteContributions(eqnCommMgr, assemblyMode) );
+  }
+
   int numRecvEqns = eqnCommMgr.getNumLocalEqns();
   std::vector<int>& recvEqnNumbers = eqnCommMgr.localEqnNumbers();
   std::vector<fei::CSVec*>& recvEqns = eqnCommMgr.localEqns();
@@ -1525,6 +1668,8 @@ int LinSysCoreFilter::unpackRemoteContributions(EqnCommMgr& eqnCommMgr,
     coefs[i] = &(recvEqns[i]->coefs()[0]);
   }
 
+  std::vector<int> iwork;
+
   for(i=0; i<numRecvEqns; i++) {
 
     int eqn = recvEqnNumbers[i];
@@ -1549,7 +1694,10 @@ int LinSysCoreFilter::unpackRemoteContributions(EqnCommMgr& eqnCommMgr,
       //contribute this equation to the matrix,
       CHK_ERR( giveToLocalReducedMatrix(1, &(recvEqnNumbers[i]),
                                         recvEqns[i]->size(),
-                                        &(recvEqns[i]->indices()[0]),
+                                        fei::impl_utils::int_indices(
+                                          recvEqns[i]->size(),
+                                          &(recvEqns[i]->indices()[0]),
+                                          iwork),
                                         &(coefs[i]), assemblyMode ) );
     }
 
@@ -1567,6 +1715,68 @@ int LinSysCoreFilter::unpackRemoteContributions(EqnCommMgr& eqnCommMgr,
   return(0);
 }
 
+//------------------------------------------------------------------------------
+int LinSysCoreFilter::unpackPackedRemoteContributions(EqnCommMgr& eqnCommMgr,
+                                                      int assemblyMode)
+{
+  //the received equations are read straight out of the eqn comm mgr's
+  //per-processor receive buffers.
+  bool newCoefs = eqnCommMgr.newCoefData();
+  bool newRHSs = eqnCommMgr.newRHSData();
+
+  size_t numRecvProcs = eqnCommMgr.getNumSharingProcs();
+  for(size_t p=0; p<numRecvProcs; ++p) {
+    int numEqns = 0;
+    const int* eqnNumbers = NULL;
+    const int* eqnLengths = NULL;
+    const int* indices = NULL;
+    const double* coefs = NULL;
+    int numRHSs = 0;
+    const double* rhsCoefs = NULL;
+    CHK_ERR( eqnCommMgr.getPackedRecvEqns(p, numEqns, eqnNumbers, eqnLengths,
+                                          indices, coefs, numRHSs, rhsCoefs) );
+
+    int offset = 0;
+    for(int i=0; i<numEqns; ++i) {
+      int eqn = eqnNumbers[i];
+      int len = eqnLengths[i];
+      if ((reducedStartRow_ > eqn) || (reducedEndRow_ < eqn)) {
+        fei::console_out() << "LinSysCoreFilter::unpackRemoteContributions: ERROR, recvEqn "
+             << eqn << " out of range. (localStartRow_: " << reducedStartRow_
+             << ", localEndRow_: " << reducedEndRow_ << ", localRank_: "
+             << localRank_ << ")" << FEI_ENDL;
+        MPI_Abort(comm_, -1);
+      }
+
+      const double* eqnCoefs = coefs + offset;
+      for(int ii=0; ii<len; ii++) {
+        if (eqnCoefs[ii] > 1.e+200) {
+          fei::console_out() << localRank_ << ": LinSysCoreFilter::unpackRemoteContributions: "
+               << "WARNING, coefs["<<i<<"]["<<ii<<"]: " << eqnCoefs[ii]
+               << FEI_ENDL;
+          MPI_Abort(comm_, -1);
+        }
+      }
+
+      if (len > 0 && newCoefs) {
+        CHK_ERR( giveToLocalReducedMatrix(1, &eqn, len, indices+offset,
+                                          &eqnCoefs, assemblyMode) );
+      }
+
+      if (newRHSs) {
+        for(int j=0; j<numRHSs; j++) {
+          CHK_ERR( giveToLocalReducedRHS(1, &(rhsCoefs[i*numRHSs+j]),
+                                         &eqn, assemblyMode) );
+        }
+      }
+
+      offset += len;
+    }
+  }
+
+  return(0);
+}
+
 //------------------------------------------------------------------------------
 int LinSysCoreFilter::exchangeRemoteBCs(std::vector<int>& essEqns,
                                         std::vector<double>& essAlpha,
@@ -1611,10 +1821,14 @@ int LinSysCoreFilter::exchangeRemoteBCs(std::vector<int>& essEqns,
 
     int** indices = new int*[numRemoteEssBCEqns];
     double** coefs = new double*[numRemoteEssBCEqns];
+    std::vector<std::vector<int> > intIndices(numRemoteEssBCEqns);
 
     for(int i=0; i<numRemoteEssBCEqns; i++) {
       coefs[i] = &(remEssBCEqns[i]->coefs()[0]);
-      indices[i] = &(remEssBCEqns[i]->indices()[0]);
+      indices[i] = const_cast<int*>(fei::impl_utils::int_indices(
+                                      remEssBCEqns[i]->size(),
+                                      &(remEssBCEqns[i]->indices()[0]),
+                                      intIndices[i]));
       remEssBCEqnLengths[i] = remEssBCEqns[i]->size();
     }
 
@@ -1953,6 +2167,22 @@ int LinSysCoreFilter::parameters(int numParams, const char *const* paramStrings)
          resolveConflictRequested_ = true;
       }
 
+      param1 = snl_fei::getParam("FEI_PACKED_EQN_EXCHANGE",
+                                 numParams, paramStrings);
+      if ( param1 != NULL){
+        packedEqnExchange_ = true;
+        if (eqnCommMgr_ != NULL) eqnCommMgr_->setPackedExchange(true);
+        if (eqnCommMgr_put_ != NULL) eqnCommMgr_put_->setPackedExchange(true);
+      }
+
+      param1 = snl_fei::getParam("FEI_FROZEN_EQN_EXCHANGE",
+                                 numParams, paramStrings);
+      if ( param1 != NULL){
+        frozenEqnExchange_ = true;
+        if (eqnCommMgr_ != NULL) eqnCommMgr_->setFreezePattern(true);
+        if (eqnCommMgr_put_ != NULL) eqnCommMgr_put_->setFreezePattern(true);
+      }
+
       param1 = snl_fei::getParamValue("internalFei", numParams,paramStrings);
       if ( param1 != NULL ){
         std::string str(param1);
@@ -2072,6 +2302,7 @@ int LinSysCoreFilter::solve(int& status, double& sTime) {
  
    double start = fei::utils::cpu_time();
 
+   localSolnValid_ = false;
    CHK_ERR( lsc_->launchSolver(status, iterations_) );
 
    sTime = fei::utils::cpu_time() - start;
@@ -2104,6 +2335,8 @@ int LinSysCoreFilter::setNumRHSVectors(int numRHSs, int* rhsIDs){
   //(we need to set the number of RHSs in the eqn comm manager)
   eqnCommMgr_->setNumRHSs(numRHSs_);
 
+  localSolnValid_ = false;
+
    return(FEI_SUCCESS);
 }
 
@@ -2119,6 +2352,7 @@ int LinSysCoreFilter::setCurrentRHS(int rhsID)
    currentRHS_ = index;
 
    lsc_->setRHSID(rhsID);
+   localSolnValid_ = false;
 
    return(FEI_SUCCESS);
 }
@@ -2129,32 +2363,46 @@ int LinSysCoreFilter::giveToMatrix_symm_noSlaves(int numPtRows,
                                                  const double* const* coefs,
                                                  int mode)
 {
+  return( giveToMatrix_noSlaves(numPtRows, ptRowNumbers,
+                                numPtRows, ptRowNumbers, coefs, mode) );
+}
+
+//------------------------------------------------------------------------------
+int LinSysCoreFilter::giveToMatrix_noSlaves(int numPtRows,
+                                            const int* ptRows,
+                                            int numPtCols,
+                                            const int* ptCols,
+                                            const double* const* coefs,
+                                            int mode)
+{
+  //Remote rows go to eqnCommMgr_ one at a time, and the local rows are then
+  //passed to the LinearSystemCore as a single dense block.
+  localPtRows_.resize(0);
+  localPtRowCoefs_.resize(0);
+
   for(int i=0; i<numPtRows; i++) {
-    int row = ptRowNumbers[i];
-    const double* valptr = coefs[i];
+    int row = ptRows[i];
     if (row < localStartRow_ || row > localEndRow_) {
-      eqnCommMgr_->addRemoteEqn(row, valptr, ptRowNumbers, numPtRows);
+      eqnCommMgr_->addRemoteEqn(row, coefs[i], ptCols, numPtCols);
       continue;
     }
 
-    if (mode == ASSEMBLE_SUM) {
-      if (Filter::logStream() != NULL && 0) {
-        FEI_OSTREAM& os = *logStream();
-        os << "#  calling sumIntoSystemMatrix, row: " << ptRowNumbers[i]
-           << ", columns: ";
-        for(int j=0; j<numPtRows; ++j) os << ptRowNumbers[j] << " ";
-        os << FEI_ENDL;
-      }
+    localPtRows_.push_back(row);
+    localPtRowCoefs_.push_back(coefs[i]);
+  }
 
-      CHK_ERR( lsc_->sumIntoSystemMatrix(1, &(ptRowNumbers[i]),
-                                         numPtRows, ptRowNumbers,
-                                         &valptr) );
-    }
-    else {
-      CHK_ERR( lsc_->putIntoSystemMatrix(1, &(ptRowNumbers[i]),
-                                         numPtRows, ptRowNumbers,
-                                         &valptr) );
-    }
+  int numLocalRows = localPtRows_.size();
+  if (numLocalRows == 0) return(0);
+
+  if (mode == ASSEMBLE_SUM) {
+    CHK_ERR( lsc_->sumIntoSystemMatrix(numLocalRows, &localPtRows_[0],
+                                       numPtCols, ptCols,
+                                       &localPtRowCoefs_[0]) );
+  }
+  else {
+    CHK_ERR( lsc_->putIntoSystemMatrix(numLocalRows, &localPtRows_[0],
+                                       numPtCols, ptCols,
+                                       &localPtRowCoefs_[0]) );
   }
 
   return(0);
@@ -2169,53 +2417,46 @@ int LinSysCoreFilter::giveToBlkMatrix_symm_noSlaves(int numPtRows,
                                                     const double* const* coefs,
                                                     int mode)
 {
-  int i;
-  if ((int)dworkSpace2_.size() < numPtRows) {
-    dworkSpace2_.resize(numPtRows);
+  if (mode == ASSEMBLE_PUT) {
+    return( giveToMatrix_noSlaves(numPtRows, ptRowNumbers,
+                                  numPtRows, ptRowNumbers, coefs, mode) );
   }
-  const double* * valptr = &dworkSpace2_[0];
-  for(i=0; i<numPtRows; i++) {
-    int row = ptRowNumbers[i];
-    valptr[i] = coefs[i];
-    if (row < localStartRow_ || row > localEndRow_) {
-      eqnCommMgr_->addRemoteEqn(row, valptr[i], ptRowNumbers, numPtRows);
-      continue;
-    }
 
-    if (mode == ASSEMBLE_PUT) {
-       CHK_ERR( lsc_->putIntoSystemMatrix(1, &(ptRowNumbers[i]),
-                                         numPtRows, ptRowNumbers,
-                                         &(valptr[i])) );
-   }
-  }
+  //Remote rows go to eqnCommMgr_, and the local block-rows are gathered so
+  //that they can be passed to the LinearSystemCore in a single call.
+  localPtRows_.resize(0);
+  localPtRowCoefs_.resize(0);
+  localBlkRows_.resize(0);
 
   int offset = 0;
-  for(i=0; i<numBlkRows; i++) {
+  for(int i=0; i<numBlkRows; i++) {
+    int blkSize = blkRowSizes[i];
     int row = ptRowNumbers[offset];
     if (row < localStartRow_ || row > localEndRow_) {
-      offset += blkRowSizes[i];
+      for(int j=offset; j<offset+blkSize; ++j) {
+        eqnCommMgr_->addRemoteEqn(ptRowNumbers[j], coefs[j],
+                                  ptRowNumbers, numPtRows);
+      }
+      offset += blkSize;
       continue;
     }
 
-    if (mode == ASSEMBLE_SUM) {
-      if (Filter::logStream() != NULL && 0) {
-        FEI_OSTREAM& os = *logStream();
-        os << "#  calling sumIntoSystemMatrix, row: " << ptRowNumbers[i]
-           << ", columns: ";
-        for(int j=0; j<numPtRows; ++j) os << ptRowNumbers[j] << " ";
-        os << FEI_ENDL;
-      }
-      
-      CHK_ERR(lsc_->sumIntoSystemMatrix(blkRowSizes[i],&(ptRowNumbers[offset]),
-                                        numPtRows, ptRowNumbers,
-                                        1, &(blkRowNumbers[i]),
-                                        numBlkRows, blkRowNumbers,
-                                        &(valptr[offset])) );
+    localBlkRows_.push_back(blkRowNumbers[i]);
+    for(int j=offset; j<offset+blkSize; ++j) {
+      localPtRows_.push_back(ptRowNumbers[j]);
+      localPtRowCoefs_.push_back(coefs[j]);
     }
-    
-    offset += blkRowSizes[i];
+    offset += blkSize;
   }
 
+  if (localBlkRows_.empty()) return(0);
+
+  CHK_ERR( lsc_->sumIntoSystemMatrix(localPtRows_.size(), &localPtRows_[0],
+                                     numPtRows, ptRowNumbers,
+                                     localBlkRows_.size(), &localBlkRows_[0],
+                                     numBlkRows, blkRowNumbers,
+                                     &localPtRowCoefs_[0]) );
+
   return(0);
 }
 
@@ -2227,31 +2468,8 @@ int LinSysCoreFilter::giveToMatrix(int numPtRows, const int* ptRows,
   try {
 
   if (problemStructure_->numSlaveEquations() == 0) {
-    for(int i=0; i<numPtRows; i++) {
-      if (ptRows[i] < localStartRow_ || ptRows[i] > localEndRow_) {
-        eqnCommMgr_->addRemoteEqn(ptRows[i], values[i], ptCols, numPtCols);
-        continue;
-      }
-
-      if (mode == ASSEMBLE_SUM) {
-        if (Filter::logStream() != NULL && 0) {
-          FEI_OSTREAM& os = *logStream();
-          os << "#  calling sumIntoSystemMatrix, row: " << ptRows[i]
-             << ", columns: ";
-          for(int j=0; j<numPtCols; ++j) os << ptCols[j] << " ";
-          os << FEI_ENDL;
-        }
-
-        CHK_ERR( lsc_->sumIntoSystemMatrix(1, &(ptRows[i]),
-                                           numPtCols, ptCols,
-                                           &(values[i])) );
-      }
-      else {
-        CHK_ERR( lsc_->putIntoSystemMatrix(1, &(ptRows[i]),
-                                           numPtCols, ptCols,
-                                           &(values[i])) );
-      }
-    }
+    CHK_ERR( giveToMatrix_noSlaves(numPtRows, ptRows, numPtCols, ptCols,
+                                   values, mode) );
   }
   else {
     iworkSpace_.resize(numPtCols);
@@ -2393,16 +2611,20 @@ int LinSysCoreFilter::giveToLocalReducedMatrix(int numPtRows, const int* ptRows,
 //------------------------------------------------------------------------------
 int LinSysCoreFilter::sumIntoMatrix(fei::CSRMat& mat)
 {
-  const std::vector<int>& rowNumbers = mat.getGraph().rowNumbers;
+  const std::vector<fei::GlobalOrdinal>& rowNumbers = mat.getGraph().rowNumbers;
   const std::vector<int>& rowOffsets = mat.getGraph().rowOffsets;
-  const std::vector<int>& pckColInds = mat.getGraph().packedColumnIndices;
+  const std::vector<fei::GlobalOrdinal>& pckColInds =
+    mat.getGraph().packedColumnIndices;
   const std::vector<double>& pckCoefs = mat.getPackedCoefs();
 
+  //LinearSystemCore only takes int eqn-numbers.
+  std::vector<int> iwork;
   for(size_t i=0; i<rowNumbers.size(); ++i) {
-    int row = rowNumbers[i];
+    int row = fei::impl_utils::int_index(rowNumbers[i]);
     int offset = rowOffsets[i];
     int rowlen = rowOffsets[i+1]-offset;
-    const int* indices = &pckColInds[offset];
+    const int* indices =
+      fei::impl_utils::int_indices(rowlen, &pckColInds[offset], iwork);
     const double* coefs = &pckCoefs[offset];
 
     if (giveToMatrix(1, &row, rowlen, indices, &coefs, ASSEMBLE_SUM) != 0) {
@@ -2493,7 +2715,8 @@ int LinSysCoreFilter::getFromMatrix(int numPtRows, const int* ptRows,
 
     for(int j=0; j<numColsPerRow; j++) {
       int offset = rowColOffsets[i] + j;
-      int colIndex = fei::binarySearch(ptCols[offset], remEqns[eqnIndex]->indices());
+      int colIndex = fei::binarySearch(fei::GlobalOrdinal(ptCols[offset]),
+                                       remEqns[eqnIndex]->indices());
       if (colIndex < 0) ERReturn(-1);
 
       values[i][j] = remEqns[eqnIndex]->coefs()[colIndex];
@@ -2697,10 +2920,14 @@ int LinSysCoreFilter::giveToLocalReducedRHS(int num, const double* values,
 //------------------------------------------------------------------------------
 int LinSysCoreFilter::sumIntoRHS(fei::CSVec& vec)
 {
-  std::vector<int>& indices = vec.indices();
+  std::vector<fei::GlobalOrdinal>& indices = vec.indices();
   std::vector<double>& coefs = vec.coefs();
 
-  CHK_ERR( giveToRHS(indices.size(), &coefs[0], &indices[0], ASSEMBLE_SUM) );
+  std::vector<int> iwork;
+  CHK_ERR( giveToRHS(indices.size(), &coefs[0],
+                     fei::impl_utils::int_indices(indices.size(), &indices[0],
+                                                  iwork),
+                     ASSEMBLE_SUM) );
 
   return(FEI_SUCCESS);
 }
@@ -2815,7 +3042,7 @@ int LinSysCoreFilter::getEqnSolnEntry(int eqnNumber, double& solnValue)
     //This is a slave-equation, so construct its solution-value as the linear-
     //combination of the master-equations it is defined in terms of.
 
-    std::vector<int>* masterEqns = NULL;
+    std::vector<fei::GlobalOrdinal>* masterEqns = NULL;
     std::vector<double>* masterCoefs = NULL;
     CHK_ERR( problemStructure_->getMasterEqnNumbers(eqnNumber, masterEqns) );
     CHK_ERR( problemStructure_->getMasterEqnCoefs(eqnNumber, masterCoefs) );
@@ -2826,7 +3053,7 @@ int LinSysCoreFilter::getEqnSolnEntry(int eqnNumber, double& solnValue)
 
     double coef = 0.0;
     for(int i=0; i<len; i++) {
-      int mEqn = (*masterEqns)[i];
+      int mEqn = fei::impl_utils::int_index((*masterEqns)[i]);
       int mReducedeqn;
       problemStructure_->translateToReducedEqn(mEqn, mReducedeqn);
 
@@ -2877,11 +3104,64 @@ int LinSysCoreFilter::getReducedSolnEntry(int eqnNumber, double& solnValue)
   //local in the underlying assembled linear system. i.e., it isn't a slave-
   //equation, it isn't remotely owned, etc.
   //
+  if (localSolnValid_) {
+    solnValue = localSoln_[eqnNumber - reducedStartRow_];
+    return(FEI_SUCCESS);
+  }
+
   CHK_ERR( lsc_->getSolnEntry(eqnNumber, solnValue) );
 
   return(FEI_SUCCESS);
 }
 
+//------------------------------------------------------------------------------
+int LinSysCoreFilter::loadLocalSoln()
+{
+  //Copy the whole local solution out of lsc_ with a single getSolution call.
+  //The copy stays valid until something (solve, a 'put' of solution values,
+  //a change of RHS) may have altered the solution held by lsc_.
+  //
+  if (localSolnValid_) return(FEI_SUCCESS);
+
+  int len = numReducedRows_ > 0 ? numReducedRows_ : 0;
+  localSoln_.assign(len, 0.0);
+
+  //If lsc_ can't provide the whole solution, leave the copy invalid and the
+  //values will be retrieved one at a time with getSolnEntry instead.
+  if (len > 0 && lsc_->getSolution(&localSoln_[0], len) != 0) {
+    return(FEI_SUCCESS);
+  }
+
+  localSolnValid_ = true;
+  return(FEI_SUCCESS);
+}
+
+//------------------------------------------------------------------------------
+int LinSysCoreFilter::getEqnSolnEntries(int firstEqn, int numEqns,
+                                        double* results)
+{
+  //Retrieve the solution-values for the 'numEqns' consecutive equations
+  //starting at firstEqn (e.g., the equations of one field at one node).
+  //When they are all locally owned and there are no slave equations, they
+  //are simply copied out of localSoln_. Otherwise each goes through
+  //getEqnSolnEntry.
+  //
+  if (localSolnValid_ && problemStructure_->numSlaveEquations() == 0 &&
+      firstEqn >= reducedStartRow_ && firstEqn+numEqns-1 <= reducedEndRow_) {
+    const double* soln = &localSoln_[firstEqn - reducedStartRow_];
+    for(int k=0; k<numEqns; ++k) {
+      results[k] = soln[k];
+    }
+    return(FEI_SUCCESS);
+  }
+
+  for(int k=0; k<numEqns; ++k) {
+    CHK_ERR( getEqnSolnEntry(firstEqn+k, results[k]) );
+  }
+
+  return(FEI_SUCCESS);
+}
+
 //------------------------------------------------------------------------------
 int LinSysCoreFilter::unpackSolution()
 {
@@ -2905,6 +3185,10 @@ int LinSysCoreFilter::unpackSolution()
   int numRecvEqns = eqnCommMgr_->getNumLocalEqns();
   std::vector<int>& recvEqnNumbers = eqnCommMgr_->localEqnNumbers();
 
+  if (numRecvEqns > 0) {
+    CHK_ERR( loadLocalSoln() );
+  }
+
   for(int i=0; i<numRecvEqns; i++) {
     int eqn = recvEqnNumbers[i];
 
@@ -2948,6 +3232,8 @@ int LinSysCoreFilter::getBlockNodeSolution(GlobalID elemBlockID,
 
    if (numActiveNodes <= 0) return(0);
 
+   CHK_ERR( loadLocalSoln() );
+
    int numSolnParams = 0;
 
    BlockDescriptor* block = NULL;
@@ -2998,11 +3284,8 @@ int LinSysCoreFilter::getBlockNodeSolution(GlobalID elemBlockID,
           int thisEqn = -1;
           node->getFieldEqnNumber(fieldIDs[j], thisEqn);
 
-          double answer;
-          for(int k=0; k<size; k++) {
-            CHK_ERR( getEqnSolnEntry(thisEqn+k, answer) )
-              results[numSolnParams++] = answer;
-          }
+          CHK_ERR( getEqnSolnEntries(thisEqn, size, &results[numSolnParams]) );
+          numSolnParams += size;
         }
       }//for(j<numFields)loop
    }
@@ -3025,6 +3308,8 @@ int LinSysCoreFilter::getNodalSolution(int numNodes,
 
   if (numActiveNodes <= 0) return(0);
 
+  CHK_ERR( loadLocalSoln() );
+
   int numSolnParams = 0;
 
   //Traverse the node list, checking if nodes are local.
@@ -3071,11 +3356,8 @@ int LinSysCoreFilter::getNodalSolution(int numNodes,
       int thisEqn = -1;
       node->getFieldEqnNumber(fieldIDs[j], thisEqn);
 
-      double answer;
-      for(int k=0; k<size; k++) {
-        CHK_ERR( getEqnSolnEntry(thisEqn+k, answer) )
-          results[numSolnParams++] = answer;
-      }
+      CHK_ERR( getEqnSolnEntries(thisEqn, size, &results[numSolnParams]) );
+      numSolnParams += size;
     }//for(j<numFields)loop
   }
 
@@ -3103,6 +3385,8 @@ int LinSysCoreFilter::getBlockFieldNodeSolution(GlobalID elemBlockID,
 
   if (numActiveNodes <= 0) return(0);
 
+  CHK_ERR( loadLocalSoln() );
+
   BlockDescriptor* block = NULL;
   CHK_ERR( problemStructure_->getBlockDescriptor(elemBlockID, block) );
 
@@ -3150,12 +3434,7 @@ int LinSysCoreFilter::getBlockFieldNodeSolution(GlobalID elemBlockID,
      bool hasField = node->getFieldEqnNumber(fieldID, eqnNumber);
      if (!hasField) continue;
 
-     int offset = fieldSize*i;
-     for(int j=0; j<fieldSize; j++) {
-       double answer = 0.0;
-       CHK_ERR( getEqnSolnEntry(eqnNumber+j, answer) );
-       results[offset+j] = answer;
-     }
+     CHK_ERR( getEqnSolnEntries(eqnNumber, fieldSize, &results[fieldSize*i]) );
    }
 
    return(FEI_SUCCESS);
@@ -3174,6 +3453,8 @@ int LinSysCoreFilter::getNodalFieldSolution(int fieldID,
 
   if (numActiveNodes <= 0) return(0);
 
+  CHK_ERR( loadLocalSoln() );
+
   int fieldSize = problemStructure_->getFieldSize(fieldID);
   if (fieldSize <= 0) ERReturn(-1);
 
@@ -3212,12 +3493,7 @@ int LinSysCoreFilter::getNodalFieldSolution(int fieldID,
     //next loop iteration.
     if (!hasField) continue;
 
-    int offset = fieldSize*i;
-    for(int j=0; j<fieldSize; j++) {
-      double answer = 0.0;
-      CHK_ERR( getEqnSolnEntry(eqnNumber+j, answer) );
-      results[offset+j] = answer;
-    }
+    CHK_ERR( getEqnSolnEntries(eqnNumber, fieldSize, &results[fieldSize*i]) );
   }
 
   return(FEI_SUCCESS);
@@ -3232,6 +3508,8 @@ int LinSysCoreFilter::putBlockNodeSolution(GlobalID elemBlockID,
         
    debugOutput("FEI: putBlockNodeSolution");
 
+   localSolnValid_ = false;
+
    int numActiveNodes = problemStructure_->getNumActiveNodes();
 
    if (numActiveNodes <= 0) return(0);
@@ -3355,6 +3633,7 @@ int LinSysCoreFilter::putBlockFieldNodeSolution(GlobalID elemBlockID,
                                       &numbers[0], numNodes, estimates));
    }
    else {
+     localSolnValid_ = false;
      CHK_ERR(lsc_->putInitialGuess(&numbers[0], &data[0], count));
    }
 
@@ -3416,6 +3695,8 @@ int LinSysCoreFilter::putBlockElemSolution(GlobalID elemBlockID,
 {
    debugOutput("FEI: putBlockElemSolution");
 
+   localSolnValid_ = false;
+
    BlockDescriptor* block = NULL;
    CHK_ERR( problemStructure_->getBlockDescriptor(elemBlockID, block) )
 
@@ -3489,6 +3770,8 @@ int LinSysCoreFilter::putCRMultipliers(int numMultCRs,
 {
   debugOutput("FEI: putCRMultipliers");
 
+  localSolnValid_ = false;
+
   for(int j = 0; j < numMultCRs; j++) {
     ConstraintType* multCR = NULL;
     CHK_ERR( problemStructure_->getMultConstRecord(CRIDs[j], multCR) );
@@ -3548,6 +3831,8 @@ int LinSysCoreFilter::putNodalFieldSolution(int fieldID,
 {
   debugOutput("FEI: putNodalFieldSolution");
 
+  localSolnValid_ = false;
+
   if (fieldID < 0) {
     return(putNodalFieldData(fieldID, numNodes, nodeIDs, nodeData));
   }
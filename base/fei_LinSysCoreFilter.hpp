@@ -82,6 +82,14 @@ class LinSysCoreFilter : public Filter {
                     const GlobalID* elemConn,
                     const double* elemLoad);
 
+   virtual int sumInElemBlockMatrix(GlobalID elemBlockID,
+                            int numElems,
+                            const GlobalID* elemIDs,
+                            const GlobalID* elemConn,
+                            const double* elemStiffness,
+                            const double* elemLoads,
+                            int elemFormat);
+
     virtual int loadCRMult(int CRMultID, 
                    int numCRNodes,
                    const GlobalID* CRNodes, 
@@ -244,6 +252,9 @@ class LinSysCoreFilter : public Filter {
    int unpackRemoteContributions(EqnCommMgr& eqnCommMgr,
 				 int assemblyMode);
 
+   int unpackPackedRemoteContributions(EqnCommMgr& eqnCommMgr,
+                                       int assemblyMode);
+
    int loadFEDataMultCR(int CRID,
 			int numCRNodes,
 			const GlobalID* CRNodes, 
@@ -311,6 +322,11 @@ class LinSysCoreFilter : public Filter {
 				  const double* const* coefs,
 				  int mode);
 
+   int giveToMatrix_noSlaves(int numPtRows, const int* ptRows,
+                             int numPtCols, const int* ptCols,
+                             const double* const* coefs,
+                             int mode);
+
    int giveToBlkMatrix_symm_noSlaves(int numPtRows, const int* ptRows,
 				     int numBlkRows, const int* blkRowNumbers,
 				     const int* blkRowSizes,
@@ -353,6 +369,10 @@ class LinSysCoreFilter : public Filter {
 
    int getReducedSolnEntry(int eqnNumber, double& solnValue);
 
+   int getEqnSolnEntries(int firstEqn, int numEqns, double* results);
+
+   int loadLocalSoln();
+
    int formResidual(double* residValues, int numLocalEqns);
 
    int getRemoteSharedEqns(int numPtRows, const int* ptRows,
@@ -401,6 +421,8 @@ class LinSysCoreFilter : public Filter {
     bool needToCallMatrixLoadComplete_;
 
     bool resolveConflictRequested_;
+    bool packedEqnExchange_;
+    bool frozenEqnExchange_;
 
     int localStartRow_, localEndRow_, numLocalEqns_, numGlobalEqns_;
     int reducedStartRow_, reducedEndRow_, numReducedRows_;
@@ -447,6 +469,22 @@ class LinSysCoreFilter : public Filter {
     std::vector<int> iworkSpace_, iworkSpace2_;
     std::vector<double> dworkSpace_;
     std::vector<const double*> dworkSpace2_;
+    std::vector<int> localPtRows_, localBlkRows_;
+    std::vector<const double*> localPtRowCoefs_;
+
+    std::vector<int> batchIndices_;
+    std::vector<fei::GlobalOrdinal> batchEqns_;
+    std::vector<double> batchStiff_;
+    std::vector<const double*> batchRowPtrs_;
+    std::vector<const double* const*> batchElemPtrs_;
+    std::vector<const double*> batchLoadPtrs_;
+    std::vector<const int*> batchIndPtrs_;
+
+    //copy of the local (reduced) solution, taken with one getSolution call
+    //and served to the solution-return functions until the solution in lsc_
+    //may have changed.
+    std::vector<double> localSoln_;
+    bool localSolnValid_;
 
     double** eStiff_;
     double* eStiff1D_;
@@ -114,3 +114,19 @@ int fei::LinearSystem::loadEssentialBCs(int numIDs,
   return(0);
 }
 
+//----------------------------------------------------------------------------
+int fei::LinearSystem::loadLagrangeConstraints(int numConstraints,
+                                               const int* constraintIDs,
+                                               const int* weightOffsets,
+                                               const double* weights,
+                                               const double* rhsValues)
+{
+  for(int i=0; i<numConstraints; ++i) {
+    int err = loadLagrangeConstraint(constraintIDs[i],
+                                     weights+weightOffsets[i], rhsValues[i]);
+    if (err != 0) return(err);
+  }
+
+  return(0);
+}
+
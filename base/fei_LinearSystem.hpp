@@ -67,7 +67,12 @@ namespace fei {
       { fei::SharedPtr<const fei::Matrix> const_mat(matrix_);
         return(const_mat); }
 
-    /** Set the right-hand-side for this linear system. */
+    /** Set the right-hand-side for this linear system. The rhs may hold
+        several vectors (see fei::Vector::getNumVectors()), e.g. for several
+        load cases with the same matrix. Boundary-condition and constraint
+        contributions are then applied to each of them, and the solution
+        vector should hold the same number of vectors.
+    */
     virtual void setRHS(fei::SharedPtr<fei::Vector>& rhs)
       { rhs_ = rhs; }
 
@@ -159,6 +164,25 @@ namespace fei {
 				       const double *weights,
 				       double rhsValue) = 0;
 
+    /** Lagrange constraint coefficient loading function for several
+	constraints at once. The default implementation simply calls
+	loadLagrangeConstraint for each constraint; implementations may
+	assemble the whole batch with fewer matrix operations.
+	@param numConstraints Input. Number of constraints being loaded.
+	@param constraintIDs Input. List of length numConstraints, each of
+	which must be the identifier of an initialized lagrange constraint.
+	@param weightOffsets Input. List of length numConstraints+1. The weights
+	for constraintIDs[i] are weights[weightOffsets[i]] through
+	weights[weightOffsets[i+1]-1].
+	@param weights Input. Packed list of weights for all constraints.
+	@param rhsValues Input. List of length numConstraints.
+    */
+    virtual int loadLagrangeConstraints(int numConstraints,
+                                        const int* constraintIDs,
+                                        const int* weightOffsets,
+                                        const double* weights,
+                                        const double* rhsValues);
+
     /** Penalty constraint coefficient loading function.
 	@param constraintID Input. Must be an identifier of a lagrange 
 	constraint that was initialized on the fei::MatrixGraph object which
@@ -187,19 +211,20 @@ namespace fei {
     /** Query whether a specified equation-index has a prescribed
 	essential boundary-condition.
     */
-    virtual bool eqnIsEssentialBC(int globalEqnIndex) const = 0;
+    virtual bool eqnIsEssentialBC(GlobalOrdinal globalEqnIndex) const = 0;
 
     /** Fill caller-supplied vectors with the global equation-indices (which
 	reside on the local processor) that have essential boundary-conditions
 	prescribed, and fill a second vector with the prescribed values.
     */
-    virtual void getEssentialBCs(std::vector<int>& bcEqns,
+    virtual void getEssentialBCs(std::vector<GlobalOrdinal>& bcEqns,
                                  std::vector<double>& bcVals) const = 0;
 
     /** Fill a caller-supplied vector with the global equation-indices (which
        reside on the local processor) that are involved in constraint-relations.
     */
-    virtual void getConstrainedEqns(std::vector<int>& crEqns) const = 0;
+    virtual void
+      getConstrainedEqns(std::vector<GlobalOrdinal>& crEqns) const = 0;
 
    protected:
     fei::SharedPtr<fei::Matrix> matrix_;
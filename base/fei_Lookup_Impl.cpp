@@ -15,6 +15,7 @@
 #include <snl_fei_Utils.hpp>
 #include <fei_TemplateUtils.hpp>
 #include <fei_CommUtils.hpp>
+#include <fei_impl_utils.hpp>
 
 #include <snl_fei_Constraint.hpp>
 
@@ -67,8 +68,8 @@ int fei::Lookup_Impl::getEqnNumber(int nodeNumber, int fieldID)
 
   fei::Record<int>* node = (*nnp_iter).second;
 
-  std::vector<int>& eqnNums = vspace_->getEqnNumbers();
-  int* eqnNumbers = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
+  std::vector<GlobalOrdinal>& eqnNums = vspace_->getEqnNumbers();
+  GlobalOrdinal* eqnNumbers = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
   if (eqnNumbers == NULL) {
     throw std::runtime_error("Fatal error in fei::Lookup_Impl::getEqnNumber");
   }
@@ -76,7 +77,7 @@ int fei::Lookup_Impl::getEqnNumber(int nodeNumber, int fieldID)
   int offset = -1;
   int err = node->getFieldMask()->getFieldEqnOffset(fieldID, offset);
   if (err == 0) {
-    return(eqnNumbers[offset]);
+    return( fei::impl_utils::int_index(eqnNumbers[offset]) );
   }
 
   return -1;
@@ -85,7 +86,7 @@ int fei::Lookup_Impl::getEqnNumber(int nodeNumber, int fieldID)
 //----------------------------------------------------------------------------
 int fei::Lookup_Impl::getAssociatedNodeNumber(int eqnNumber)
 {
-  std::map<int,fei::Record<int>*>::iterator
+  std::map<GlobalOrdinal,fei::Record<int>*>::iterator
     enp_iter = eqnnumPairs_.find(eqnNumber);
 
   if (enp_iter == eqnnumPairs_.end()) return(-1);
@@ -98,7 +99,7 @@ int fei::Lookup_Impl::getAssociatedNodeNumber(int eqnNumber)
 //----------------------------------------------------------------------------
 int fei::Lookup_Impl::getAssociatedNodeID(int eqnNumber)
 {
-  std::map<int,fei::Record<int>*>::iterator
+  std::map<GlobalOrdinal,fei::Record<int>*>::iterator
     enp_iter = eqnnumPairs_.find(eqnNumber);
 
   if (enp_iter == eqnnumPairs_.end()) return(-1);
@@ -111,7 +112,7 @@ int fei::Lookup_Impl::getAssociatedNodeID(int eqnNumber)
 //----------------------------------------------------------------------------
 int fei::Lookup_Impl::getAssociatedFieldID(int eqnNumber)
 {
-  std::map<int,fei::Record<int>*>::iterator
+  std::map<GlobalOrdinal,fei::Record<int>*>::iterator
     enp_iter = eqnnumPairs_.find(eqnNumber);
 
   if (enp_iter == eqnnumPairs_.end()) return(-1);
@@ -122,7 +123,7 @@ int fei::Lookup_Impl::getAssociatedFieldID(int eqnNumber)
   const std::vector<int>& fieldIDs = fm->getFieldIDs();
   const std::vector<int>& fieldSizes = fm->getFieldSizes();
 
-  const std::vector<int>& eqnNumbers = vspace_->getEqnNumbers();
+  const std::vector<GlobalOrdinal>& eqnNumbers = vspace_->getEqnNumbers();
 
   int baseEqnOffset = node->getOffsetIntoEqnNumbers();
   int numNodalEqns = fm->getNumIndices();
@@ -132,7 +133,7 @@ int fei::Lookup_Impl::getAssociatedFieldID(int eqnNumber)
   }
 
   int offset = 0;
-  int eqn = eqnNumbers[baseEqnOffset];
+  GlobalOrdinal eqn = eqnNumbers[baseEqnOffset];
   while(eqn < eqnNumber && offset < numNodalEqns) {
     eqn = eqnNumbers[baseEqnOffset + ++offset];
   }
@@ -195,7 +196,7 @@ int fei::Lookup_Impl::buildDatabases()
     return(0);
   }
 
-  std::vector<int>& vspcEqnNumbers = vspace_->getEqnNumbers();
+  std::vector<GlobalOrdinal>& vspcEqnNumbers = vspace_->getEqnNumbers();
 
   std::vector<fei::Record<int> >& rvec = collection->getRecords();
 
@@ -207,11 +208,12 @@ int fei::Lookup_Impl::buildDatabases()
     nodenumPairs_.insert(int_node_pair);
 
     int numEqns = node->getFieldMask()->getNumIndices();
-    int* eqnNumbers = &vspcEqnNumbers[0]
-                    + node->getOffsetIntoEqnNumbers();
+    GlobalOrdinal* eqnNumbers = &vspcEqnNumbers[0]
+                              + node->getOffsetIntoEqnNumbers();
 
     for(int eq=0; eq<numEqns; ++eq) {
-      std::pair<int,fei::Record<int>* > eqn_node_pair(eqnNumbers[eq], node);
+      std::pair<GlobalOrdinal,fei::Record<int>* >
+        eqn_node_pair(eqnNumbers[eq], node);
       eqnnumPairs_.insert(eqn_node_pair);
     }
   }
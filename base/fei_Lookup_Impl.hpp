@@ -259,7 +259,7 @@ namespace fei {
     int nodeIDType_;
 
     std::map<int, fei::Record<int>*> nodenumPairs_;
-    std::map<int,fei::Record<int>*> eqnnumPairs_;
+    std::map<GlobalOrdinal,fei::Record<int>*> eqnnumPairs_;
 
     std::map<int,std::vector<int>*> nodenumSubdomainDB_;
 
@@ -0,0 +1,76 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_macros.hpp>
+
+#include <fei_Matrix.hpp>
+#include <fei_VectorSpace.hpp>
+
+#include <vector>
+
+#undef fei_file
+#define fei_file "fei_Matrix.cpp"
+#include <fei_ErrMacros.hpp>
+
+namespace {
+
+int local_to_global(fei::Matrix& matrix,
+                    int numRows, const int* localRows,
+                    int numCols, const int* localCols,
+                    std::vector<fei::GlobalOrdinal>& rows,
+                    std::vector<fei::GlobalOrdinal>& cols)
+{
+  fei::SharedPtr<fei::MatrixGraph> mgraph = matrix.getMatrixGraph();
+  if (mgraph.get() == NULL) ERReturn(-1);
+
+  fei::SharedPtr<fei::VectorSpace> rowSpace = mgraph->getRowSpace();
+  fei::SharedPtr<fei::VectorSpace> colSpace = mgraph->getColSpace();
+  if (colSpace.get() == NULL) colSpace = rowSpace;
+
+  rows.resize(numRows);
+  cols.resize(numCols);
+  if (numRows > 0) {
+    CHK_ERR( rowSpace->getGlobalIndicesFromLocal(numRows, localRows, &rows[0]) );
+  }
+  if (numCols > 0) {
+    CHK_ERR( colSpace->getGlobalIndicesFromLocal(numCols, localCols, &cols[0]) );
+  }
+
+  return(0);
+}
+
+}//namespace <anonymous>
+
+//----------------------------------------------------------------------------
+int fei::Matrix::sumInLocal(int numRows, const int* localRows,
+                            int numCols, const int* localCols,
+                            const double* const* values,
+                            int format)
+{
+  std::vector<fei::GlobalOrdinal> rows, cols;
+  CHK_ERR( local_to_global(*this, numRows, localRows, numCols, localCols,
+                           rows, cols) );
+
+  return( sumIn(numRows, numRows>0 ? &rows[0] : NULL,
+                numCols, numCols>0 ? &cols[0] : NULL, values, format) );
+}
+
+//----------------------------------------------------------------------------
+int fei::Matrix::copyInLocal(int numRows, const int* localRows,
+                             int numCols, const int* localCols,
+                             const double* const* values,
+                             int format)
+{
+  std::vector<fei::GlobalOrdinal> rows, cols;
+  CHK_ERR( local_to_global(*this, numRows, localRows, numCols, localCols,
+                           rows, cols) );
+
+  return( copyIn(numRows, numRows>0 ? &rows[0] : NULL,
+                 numCols, numCols>0 ? &cols[0] : NULL, values, format) );
+}
+
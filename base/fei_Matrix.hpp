@@ -71,7 +71,7 @@ namespace fei {
         @param length Output. Length of the row.
         @return error-code non-zero if any error occurs.
     */
-    virtual int getRowLength(int row, int& length) const = 0;
+    virtual int getRowLength(GlobalOrdinal row, int& length) const = 0;
 
     /** Set a specified scalar throughout the matrix. */
     virtual int putScalar(double scalar) = 0;
@@ -85,7 +85,8 @@ namespace fei {
        @param len Length of the caller-allocated coefs and indices arrays
        @return error-code non-zero if any error occurs.
    */
-    virtual int copyOutRow(int row, int len, double* coefs, int* indices) const = 0;
+    virtual int copyOutRow(GlobalOrdinal row, int len,
+                           double* coefs, GlobalOrdinal* indices) const = 0;
 
     /** Sum coefficients into the matrix, adding them to any coefficients that
         may already exist at the specified row/column locations.
@@ -99,8 +100,8 @@ namespace fei {
         0 means row-wise or row-major, 3 means column-major.
         Others not recognized
      */
-    virtual int sumIn(int numRows, const int* rows,
-                      int numCols, const int* cols,
+    virtual int sumIn(int numRows, const GlobalOrdinal* rows,
+                      int numCols, const GlobalOrdinal* cols,
                       const double* const* values,
                       int format=0) = 0;
 
@@ -116,11 +117,38 @@ namespace fei {
         0 means row-wise or row-major, 3 means column-major.
         Others not recognized
     */
-    virtual int copyIn(int numRows, const int* rows,
-                       int numCols, const int* cols,
+    virtual int copyIn(int numRows, const GlobalOrdinal* rows,
+                       int numCols, const GlobalOrdinal* cols,
                        const double* const* values,
                       int format=0) = 0;
 
+    /** Sum coefficients into the matrix, specifying row/column locations by
+        local indices rather than global equation numbers. Row indices are
+        local indices of the matrix-graph's row-space, and column indices
+        are local indices of its column-space (or of the row-space if there
+        is no separate column-space). See fei::VectorSpace::getLocalIndexMap()
+        for the local numbering, and
+        fei::MatrixGraph::getConnectivityLocalIndices() for obtaining local
+        indices for a connectivity-list.
+
+        The default implementation translates the local indices to global
+        indices and calls sumIn. Implementations that store local structure
+        may override it to avoid the global-to-local lookups.
+        Other arguments are as for sumIn.
+    */
+    virtual int sumInLocal(int numRows, const int* localRows,
+                           int numCols, const int* localCols,
+                           const double* const* values,
+                           int format=0);
+
+    /** Copy coefficients into the matrix, specifying row/column locations by
+        local indices. (See sumInLocal.)
+    */
+    virtual int copyInLocal(int numRows, const int* localRows,
+                            int numCols, const int* localCols,
+                            const double* const* values,
+                            int format=0);
+
     /** Sum coefficients into the matrix, specifying row/column locations by
         identifier/fieldID pairs.
         @param fieldID Input. field-identifier for which data is being input.
@@ -255,7 +283,61 @@ namespace fei {
     virtual bool changedSinceMark() = 0;
 
     virtual double* getBeginPointer() { return NULL; }
-    virtual int getOffset(int row, int col) { return -1; }
+
+    /** Notify the matrix that coefficients were modified directly through
+        the pointer returned by getBeginPointer(), so that a subsequent
+        changedSinceMark() query returns true.
+    */
+    virtual void markCoefsChanged() {}
+
+    virtual int getOffset(GlobalOrdinal row, GlobalOrdinal col) { return -1; }
+
+    /** Enforce essential (dirichlet) boundary-conditions by symmetric
+        elimination performed directly on the locally-owned storage of the
+        matrix, in a single pass over its coefficients. Locally-owned rows
+        that are bc eqns are replaced by a unit diagonal. If modifyColumns is
+        true, bc columns are zeroed in all other locally-owned rows, and
+        the amounts (-A[row,bc]*bcValue) to be summed into the rhs for those
+        rows are appended to rhsRows/rhsCoefs.
+
+        @param numBCEqns Number of bc eqns. When modifyColumns is true this
+        must include remotely-owned bc eqns (i.e., the global union).
+        @param bcEqns Sorted list of global bc eqns.
+        @param bcValues Prescribed values corresponding to bcEqns.
+        @param modifyColumns Whether to zero bc columns.
+        @param rhsRows Output. Rows whose rhs entry must be adjusted.
+        @param rhsCoefs Output. Amounts to be summed into the rhs.
+        @return 0 if successful, -1 if this matrix doesn't provide direct
+        access to its storage, in which case the matrix is unchanged and the
+        caller should fall back to row-by-row enforcement.
+    */
+    virtual int eliminateEssentialBCs(int numBCEqns,
+                                      const GlobalOrdinal* bcEqns,
+                                      const double* bcValues,
+                                      bool modifyColumns,
+                                      std::vector<GlobalOrdinal>& rhsRows,
+                                      std::vector<double>& rhsCoefs)
+    { return -1; }
+
+    /** Obtain the positions of a block of coefficients in the matrix'
+        storage, so that they can later be updated directly through the
+        pointer returned by getBeginPointer(), without searching for them.
+        Positions remain valid as long as the matrix structure is unchanged.
+
+        @param numRows Number of rows.
+        @param rows Global equation numbers, which must be locally-owned.
+        @param numCols Number of columns.
+        @param cols Global equation numbers.
+        @param offsets Output. Caller-allocated array of length
+        numRows*numCols, filled in row-major order with offsets relative to
+        getBeginPointer().
+        @return 0 if successful, -1 if the matrix doesn't provide direct
+        access to its storage or if any position is not present locally.
+    */
+    virtual int getCoefOffsets(int numRows, const GlobalOrdinal* rows,
+                               int numCols, const GlobalOrdinal* cols,
+                               int* offsets)
+    { return -1; }
 
   };//class Matrix
 }//namespace fei
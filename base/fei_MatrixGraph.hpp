@@ -502,7 +502,7 @@ class MatrixGraph {
    virtual int getConnectivityIndices(int blockID,
                               int connectivityID,
                               int indicesAllocLen,
-                              int* indices,
+                              GlobalOrdinal* indices,
                               int& numIndices) = 0;
 
     /** Obtain the scatter-indices for both the row- and column-dimension,
@@ -511,12 +511,24 @@ class MatrixGraph {
    virtual int getConnectivityIndices(int blockID,
                               int connectivityID,
                               int rowIndicesAllocLen,
-                              int* rowIndices,
+                              GlobalOrdinal* rowIndices,
                               int& numRowIndices,
                               int colIndicesAllocLen,
-                              int* colIndices,
+                              GlobalOrdinal* colIndices,
                               int& numColIndices) = 0;
 
+    /** Obtain the scatter-indices associated with a connectivity list, as
+        local indices of the row-space (see
+        fei::VectorSpace::getLocalIndexMap()), for assembly with
+        fei::Matrix::sumInLocal and fei::Vector::sumInLocal. Returns -1 if
+        any of the indices isn't local (its local index is set to -1).
+    */
+   virtual int getConnectivityLocalIndices(int blockID,
+                                   int connectivityID,
+                                   int indicesAllocLen,
+                                   int* localIndices,
+                                   int& numIndices) = 0;
+
    /** Query associated with Pattern rather than connectivity-block.
     */
    virtual int getPatternNumIndices(int patternID,
@@ -526,7 +538,7 @@ class MatrixGraph {
     */
    virtual int getPatternIndices(int patternID,
                          const int* IDs,
-                         std::vector<int>& indices) = 0;
+                         std::vector<GlobalOrdinal>& indices) = 0;
 
    /** Query number of local lagrange constraints */
    virtual int getLocalNumLagrangeConstraints() const = 0;
@@ -559,7 +571,7 @@ class MatrixGraph {
        interest to application users of fei:: methods.
     */
    virtual int getConstraintConnectivityIndices(ConstraintType* cr,
-                                        std::vector<int>& globalIndices) = 0;
+                               std::vector<GlobalOrdinal>& globalIndices) = 0;
 
    /** Won't typically be of
        interest to application users of fei:: methods.
@@ -594,7 +606,8 @@ class MatrixGraph {
    virtual fei::SharedPtr<fei::SparseRowGraph> getRemotelyOwnedGraphRows() = 0;
 
    /** fill a vector with eqn-numbers of constrained ids */
-   virtual void getConstrainedIndices(std::vector<int>& crindices) const = 0;
+   virtual void
+     getConstrainedIndices(std::vector<GlobalOrdinal>& crindices) const = 0;
 };//class MatrixGraph
 }//namespace fei
 
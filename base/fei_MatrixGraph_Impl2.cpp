@@ -10,6 +10,8 @@
 
 #include <limits>
 #include <cmath>
+#include <algorithm>
+#include <utility>
 
 #include <fei_MatrixGraph_Impl2.hpp>
 
@@ -121,6 +123,7 @@ fei::MatrixGraph_Impl2::MatrixGraph_Impl2(fei::SharedPtr<fei::VectorSpace> rowSp
    dbgprefix_("MatGrph: "),
    tmpIntArray1_(),
    tmpIntArray2_(),
+   tmpGlobalIndices_(),
    includeAllSlaveConstraints_(false)
 {
   localProc_ = fei::localProc(comm_);
@@ -876,7 +879,7 @@ int fei::MatrixGraph_Impl2::getPatternNumIndices(int patternID,
 //------------------------------------------------------------------------------
 int fei::MatrixGraph_Impl2::getPatternIndices(int patternID,
                                         const int* IDs,
-                                        std::vector<int>& indices)
+                                        std::vector<GlobalOrdinal>& indices)
 {
   std::map<int,fei::Pattern*>::iterator
     p_iter = patterns_.find(patternID);
@@ -1183,7 +1186,7 @@ int fei::MatrixGraph_Impl2::initComplete()
     simpleProblem_ = true;
   }
 
-  std::vector<int>& eqnNums = rowSpace_->getEqnNumbers();
+  std::vector<GlobalOrdinal>& eqnNums = rowSpace_->getEqnNumbers();
   vspcEqnPtr_ = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
 
   //If there are slave constraints (on any processor), we need to create
@@ -1302,14 +1305,16 @@ fei::MatrixGraph_Impl2::createGraph(bool blockEntryGraph,
 {
   fei::SharedPtr<fei::SparseRowGraph> localRows;
 
-  std::vector<int> globalOffsets;
+  std::vector<GlobalOrdinal> globalOffsets;
 
   if (blockEntryGraph) {
     if (reducer_.get() != NULL) {
       throw std::runtime_error("fei::MatrixGraph_Impl2::createGraph ERROR, can't specify both block-entry assembly and slave-constraint reduction.");
     }
 
-    rowSpace_->getGlobalBlkIndexOffsets(globalOffsets);
+    std::vector<int> blkOffsets;
+    rowSpace_->getGlobalBlkIndexOffsets(blkOffsets);
+    globalOffsets.assign(blkOffsets.begin(), blkOffsets.end());
   }
   else {
     rowSpace_->getGlobalIndexOffsets(globalOffsets);
@@ -1317,11 +1322,11 @@ fei::MatrixGraph_Impl2::createGraph(bool blockEntryGraph,
 
   if ((int)globalOffsets.size() < localProc_+2) return localRows;
 
-  int firstOffset = globalOffsets[localProc_];
-  int lastOffset = globalOffsets[localProc_+1] - 1;
+  GlobalOrdinal firstOffset = globalOffsets[localProc_];
+  GlobalOrdinal lastOffset = globalOffsets[localProc_+1] - 1;
 
   if (reducer_.get() != NULL) {
-    std::vector<int>& reduced_eqns = reducer_->getLocalReducedEqns();
+    std::vector<GlobalOrdinal>& reduced_eqns = reducer_->getLocalReducedEqns();
     if (!reduced_eqns.empty()) {
       firstOffset = reduced_eqns[0];
       lastOffset = reduced_eqns[reduced_eqns.size()-1];
@@ -1394,13 +1399,13 @@ int fei::MatrixGraph_Impl2::createSlaveMatrices()
     return(0);
   }
 
-  std::vector<int>& eqnNums = rowSpace_->getEqnNumbers();
+  std::vector<GlobalOrdinal>& eqnNums = rowSpace_->getEqnNumbers();
   vspcEqnPtr_ = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
 
   fei::SharedPtr<fei::FillableMat> local_D(new fei::FillableMat);
   fei::SharedPtr<fei::CSVec> local_g(new fei::CSVec);
 
-  std::vector<int> masterEqns;
+  std::vector<GlobalOrdinal> masterEqns;
   std::vector<double> masterCoefs;
 
   std::map<int,ConstraintType*>::const_iterator
@@ -1415,7 +1420,7 @@ int fei::MatrixGraph_Impl2::createSlaveMatrices()
     int slaveIDType = cr->getIDType();
     int slaveFieldID = cr->getSlaveFieldID();
     int offsetIntoSlaveField = cr->getOffsetIntoSlaveField();
-    int slaveEqn = -1;
+    GlobalOrdinal slaveEqn = -1;
     CHK_ERR( rowSpace_->getGlobalIndex(slaveIDType, slaveID,
                                        slaveFieldID, 0, offsetIntoSlaveField,
                                        slaveEqn) );
@@ -1431,13 +1436,14 @@ int fei::MatrixGraph_Impl2::createSlaveMatrices()
     masterEqns.resize(masterWeights.size());
     masterCoefs.resize(masterWeights.size());
 
-    int* masterEqnsPtr = &(masterEqns[0]);
+    GlobalOrdinal* masterEqnsPtr = &(masterEqns[0]);
     double* masterCoefsPtr = &(masterCoefs[0]);
 
     int offset = 0;
     for(size_t j=0; j<masterIDTypes.size(); ++j) {
       fei::Record<int>* masterRecord = masterRecColls[j]->getRecordWithLocalID(masterRecords[j]);
-      int* eqnNumbers = vspcEqnPtr_+masterRecord->getOffsetIntoEqnNumbers();
+      GlobalOrdinal* eqnNumbers =
+        vspcEqnPtr_+masterRecord->getOffsetIntoEqnNumbers();
       fei::FieldMask* mask = masterRecord->getFieldMask();
       int eqnOffset = 0;
       if (!simpleProblem_) {
@@ -1449,7 +1455,7 @@ int fei::MatrixGraph_Impl2::createSlaveMatrices()
 
       unsigned fieldSize = rowSpace_->getFieldSize(masterFieldIDs[j]);
 
-      int eqn = eqnNumbers[eqnOffset];
+      GlobalOrdinal eqn = eqnNumbers[eqnOffset];
       for(unsigned k=0; k<fieldSize; ++k) {
         masterEqnsPtr[offset++] = eqn+k;
       }
@@ -1529,10 +1535,13 @@ int fei::MatrixGraph_Impl2::createSlaveMatrices()
   if (reducer_.get() == NULL) {
     reducer_.reset(new fei::Reducer(D_, g_, comm_));
 
-    std::vector<int> indices;
+    std::vector<GlobalOrdinal> indices;
     rowSpace_->getIndices_Owned(indices);
 
     reducer_->setLocalUnreducedEqns(indices);
+
+    rowSpace_->getIndices_SharedAndOwned(indices);
+    reducer_->setGhostUnreducedEqns(indices);
   }
   else {
     reducer_->initialize();
@@ -1574,14 +1583,15 @@ fei::MatrixGraph_Impl2::getRemotelyOwnedGraphRows()
 }
 
 //----------------------------------------------------------------------------
-void fei::MatrixGraph_Impl2::getConstrainedIndices(std::vector<int>& crindices) const
+void fei::MatrixGraph_Impl2::getConstrainedIndices(
+                                    std::vector<GlobalOrdinal>& crindices) const
 {
   if (constrained_indices_.empty()) {
     crindices.clear();
     return;
   }
 
-  std::set<int>::const_iterator
+  std::set<GlobalOrdinal>::const_iterator
     s_iter = constrained_indices_.begin(),
     s_end = constrained_indices_.end();
 
@@ -1596,7 +1606,8 @@ void fei::MatrixGraph_Impl2::getConstrainedIndices(std::vector<int>& crindices)
 //----------------------------------------------------------------------------
 int fei::MatrixGraph_Impl2::addLagrangeConstraintsToGraph(fei::Graph* graph)
 {
-  std::vector<int> indices;
+  std::vector<GlobalOrdinal> indices;
+  std::vector<std::pair<GlobalOrdinal,GlobalOrdinal> > colContribs;
   std::map<int,ConstraintType*>::const_iterator
     cr_iter = lagrangeConstraints_.begin(),
     cr_end  = lagrangeConstraints_.end();
@@ -1610,54 +1621,68 @@ int fei::MatrixGraph_Impl2::addLagrangeConstraintsToGraph(fei::Graph* graph)
     CHK_ERR( getConstraintConnectivityIndices(cr, indices) );
 
     int numIndices = indices.size();
-    int* indicesPtr = &(indices[0]);
+    GlobalOrdinal* indicesPtr = &(indices[0]);
 
     for(int i=0; i<numIndices; ++i) {
       constrained_indices_.insert(indicesPtr[i]);
     }
 
-    int crEqnRow = -1, tmp;
+    GlobalOrdinal crEqnRow = -1, eqn = -1;
+    int blkEqn = -1;
     if (blockEntryGraph_) {
       CHK_ERR( rowSpace_->getGlobalBlkIndex(cr->getIDType(),
-                                                   crID, crEqnRow) );
-      cr->setBlkEqnNumber(crEqnRow);
+                                                   crID, blkEqn) );
+      cr->setBlkEqnNumber(blkEqn);
+      crEqnRow = blkEqn;
       CHK_ERR( rowSpace_->getGlobalIndex(cr->getIDType(),
-                                                crID, tmp) );
-      cr->setEqnNumber(tmp);
+                                                crID, eqn) );
+      cr->setEqnNumber(eqn);
     }
     else {
       CHK_ERR( rowSpace_->getGlobalIndex(cr->getIDType(),
                                                 crID, crEqnRow) );
       cr->setEqnNumber(crEqnRow);
       CHK_ERR( rowSpace_->getGlobalBlkIndex(cr->getIDType(),
-                                                   crID, tmp) );
-      cr->setBlkEqnNumber(tmp);
+                                                   crID, blkEqn) );
+      cr->setBlkEqnNumber(blkEqn);
     }
 
-    //now add the row contribution
-    CHK_ERR( graph->addIndices(crEqnRow, numIndices, &(indices[0])) );
+    //the column contribution is simply the transpose of the row
+    //contribution. Collect it for all constraints so that each constrained
+    //row is added to the graph once rather than once per constraint.
+    for(int k=0; k<numIndices; ++k) {
+      colContribs.push_back(std::make_pair(indicesPtr[k], crEqnRow));
+    }
 
+    //now add the row contribution.
     //Let's add a diagonal entry to the graph for this constraint-equation,
     //just in case we need to fiddle with this equation later (e.g. discard the
     //constraint equation and replace it with a dirichlet boundary condition...).
-    CHK_ERR( graph->addIndices(crEqnRow, 1, &crEqnRow) );
-
-    //and finally, add the column contribution (which is simply the transpose
-    //of the row contribution)
-    for(int k=0; k<numIndices; ++k) {
-      CHK_ERR( graph->addIndices(indicesPtr[k], 1, &crEqnRow) );
-    }
+    indices.push_back(crEqnRow);
+    CHK_ERR( graph->addIndices(crEqnRow, numIndices+1, &(indices[0])) );
 
     ++cr_iter;
   }
 
+  std::sort(colContribs.begin(), colContribs.end());
+
+  size_t i = 0;
+  while(i < colContribs.size()) {
+    GlobalOrdinal row = colContribs[i].first;
+    indices.clear();
+    for(; i<colContribs.size() && colContribs[i].first == row; ++i) {
+      indices.push_back(colContribs[i].second);
+    }
+    CHK_ERR( graph->addIndices(row, indices.size(), &(indices[0])) );
+  }
+
   return(0);
 }
 
 //----------------------------------------------------------------------------
 int fei::MatrixGraph_Impl2::
 getConstraintConnectivityIndices(ConstraintType* cr,
-                                 std::vector<int>& globalIndices)
+                                 std::vector<GlobalOrdinal>& globalIndices)
 {
   std::vector<int>& fieldSizes = tmpIntArray1_;
   std::vector<int>& ones = tmpIntArray2_;
@@ -1703,7 +1728,7 @@ getConstraintConnectivityIndices(ConstraintType* cr,
 //----------------------------------------------------------------------------
 int fei::MatrixGraph_Impl2::addPenaltyConstraintsToGraph(fei::Graph* graph)
 {
-  std::vector<int> indices;
+  std::vector<GlobalOrdinal> indices;
   std::map<int,ConstraintType*>::const_iterator
     cr_iter = penaltyConstraints_.begin(),
     cr_end  = penaltyConstraints_.end();
@@ -1881,13 +1906,13 @@ fei::ConnectivityBlock* fei::MatrixGraph_Impl2::getConnectivityBlock(int blockID
 int fei::MatrixGraph_Impl2::getConnectivityIndices(int blockID,
                                              int connectivityID,
                                              int indicesAllocLen,
-                                             int* indices,
+                                             GlobalOrdinal* indices,
                                              int& numIndices)
 {
   fei::ConnectivityBlock* cblock = getConnectivityBlock(blockID);
   if (cblock == NULL) return(-1);
 
-  std::vector<int>& eqnNums = rowSpace_->getEqnNumbers();
+  std::vector<GlobalOrdinal>& eqnNums = rowSpace_->getEqnNumbers();
   vspcEqnPtr_ = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
 
   fei::Pattern* pattern = cblock->getRowPattern();
@@ -1942,20 +1967,41 @@ int fei::MatrixGraph_Impl2::getConnectivityIndices(int blockID,
   return(0);
 }
 
+//----------------------------------------------------------------------------
+int fei::MatrixGraph_Impl2::getConnectivityLocalIndices(int blockID,
+                                                  int connectivityID,
+                                                  int indicesAllocLen,
+                                                  int* localIndices,
+                                                  int& numIndices)
+{
+  tmpGlobalIndices_.resize(indicesAllocLen > 0 ? indicesAllocLen : 1);
+  CHK_ERR( getConnectivityIndices(blockID, connectivityID, indicesAllocLen,
+                                  &tmpGlobalIndices_[0], numIndices) );
+
+  int len = numIndices > indicesAllocLen ? indicesAllocLen : numIndices;
+  int err = 0;
+  for(int i=0; i<len; ++i) {
+    localIndices[i] = rowSpace_->getLocalIndex(tmpGlobalIndices_[i]);
+    if (localIndices[i] < 0) err = -1;
+  }
+
+  return(err);
+}
+
 //----------------------------------------------------------------------------
 int fei::MatrixGraph_Impl2::getConnectivityIndices(int blockID,
                                              int connectivityID,
                                              int rowIndicesAllocLen,
-                                             int* rowIndices,
+                                             GlobalOrdinal* rowIndices,
                                              int& numRowIndices,
                                              int colIndicesAllocLen,
-                                             int* colIndices,
+                                             GlobalOrdinal* colIndices,
                                              int& numColIndices)
 {
   fei::ConnectivityBlock* cblock = getConnectivityBlock(blockID);
   if (cblock == NULL) return(-1);
 
-  std::vector<int>& eqnNums = rowSpace_->getEqnNumbers();
+  std::vector<GlobalOrdinal>& eqnNums = rowSpace_->getEqnNumbers();
   vspcEqnPtr_ = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
 
   fei::Pattern* pattern = cblock->getRowPattern();
@@ -2076,8 +2122,8 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_multiField_symmetric(fei::Graph* gra
   int numIndices = blockEntryGraph_ ?
     pattern->getNumIDs() : pattern->getNumIndices();
   int checkNumIndices = numIndices;
-  std::vector<int> indices(numIndices);
-  int* indicesPtr = &indices[0];
+  std::vector<GlobalOrdinal> indices(numIndices);
+  GlobalOrdinal* indicesPtr = &indices[0];
 
   const int* numFieldsPerID = pattern->getNumFieldsPerID();
   const int* fieldIDs = pattern->getFieldIDs();
@@ -2171,14 +2217,14 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_multiField_nonsymmetric(fei::Graph*
   int numIDs = pattern->getNumIDs();
   int numIndices = blockEntryGraph_ ? numIDs : pattern->getNumIndices();
   int checkNumIndices = numIndices;
-  std::vector<int> indices(numIndices);
-  int* indicesPtr = &indices[0];
+  std::vector<GlobalOrdinal> indices(numIndices);
+  GlobalOrdinal* indicesPtr = &indices[0];
 
   int numColIDs = colpattern->getNumIDs();
   int numColIndices = blockEntryGraph_ ? numColIDs : colpattern->getNumIndices();
   int checkNumColIndices = numColIndices;
-  std::vector<int> colindices(numColIndices);
-  int* colindicesPtr = &colindices[0];
+  std::vector<GlobalOrdinal> colindices(numColIndices);
+  GlobalOrdinal* colindicesPtr = &colindices[0];
 
   const int* numFieldsPerID = pattern->getNumFieldsPerID();
   const int* fieldIDs = pattern->getFieldIDs();
@@ -2259,7 +2305,7 @@ int fei::MatrixGraph_Impl2::getConnectivityIndices_multiField(const snl_fei::Rec
                                                           const int* fieldIDs,
                                                           const int* fieldSizes,
                                                           int indicesAllocLen,
-                                                          int* indices,
+                                                          GlobalOrdinal* indices,
                                                           int& numIndices)
 {
   numIndices = 0;
@@ -2275,7 +2321,7 @@ int fei::MatrixGraph_Impl2::getConnectivityIndices_multiField(const snl_fei::Rec
     }
 
     const fei::FieldMask* fieldMask = record->getFieldMask();
-    int* eqnNumbers = vspcEqnPtr_ + record->getOffsetIntoEqnNumbers();
+    GlobalOrdinal* eqnNumbers = vspcEqnPtr_ + record->getOffsetIntoEqnNumbers();
 
     for(int nf=0; nf<numFieldsPerID[i]; ++nf) {
       int eqnOffset = 0;
@@ -2308,8 +2354,8 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_singleField_symmetric(fei::Graph* gr
   int numIDs = pattern->getNumIDs();
   int numIndices = blockEntryGraph_ ? numIDs : pattern->getNumIndices();
   int checkNumIndices = numIndices;
-  std::vector<int> indices(numIndices);
-  int* indicesPtr = &indices[0];
+  std::vector<GlobalOrdinal> indices(numIndices);
+  GlobalOrdinal* indicesPtr = &indices[0];
 
   const int* fieldIDs = pattern->getFieldIDs();
 
@@ -2380,15 +2426,22 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_singleField_nonsymmetric(fei::Graph*
   int numIDs = pattern->getNumIDs();
   int numIndices = blockEntryGraph_ ? numIDs : pattern->getNumIndices();
   int checkNumIndices = numIndices;
-  std::vector<int> indices(numIndices);
-  int* indicesPtr = &indices[0];
+  std::vector<GlobalOrdinal> indices(numIndices);
+  GlobalOrdinal* indicesPtr = &indices[0];
 
   int numColIDs = colpattern->getNumIDs();
   int numColIndices = blockEntryGraph_ ?
     numColIDs : colpattern->getNumIndices();
   int checkNumColIndices = numColIndices;
-  std::vector<int> colindices(numColIndices);
-  int* colindicesPtr = &colindices[0];
+  std::vector<GlobalOrdinal> colindices(numColIndices);
+  GlobalOrdinal* colindicesPtr = &colindices[0];
+
+  //block-eqns come out of the vector-space as ints.
+  std::vector<int> blkIndices, blkColIndices;
+  if (blockEntryGraph_) {
+    blkIndices.resize(numIndices);
+    blkColIndices.resize(numColIndices);
+  }
 
   const int* fieldIDs = pattern->getFieldIDs();
 
@@ -2417,11 +2470,14 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_singleField_nonsymmetric(fei::Graph*
     if (blockEntryGraph_) {
       rowSpace_->getGlobalBlkIndicesL(numIDs, pattern->getRecordCollections(),
                                       records, checkNumIndices,
-                                            indicesPtr, numIndices);
+                                            &blkIndices[0], numIndices);
+      indices.assign(blkIndices.begin(), blkIndices.begin()+numIndices);
 
       colSpace_->getGlobalBlkIndicesL(numColIDs, colpattern->getRecordCollections(),
                                       colRecords, checkNumColIndices,
-                                            colindicesPtr, numColIndices);
+                                            &blkColIndices[0], numColIndices);
+      colindices.assign(blkColIndices.begin(),
+                        blkColIndices.begin()+numColIndices);
     }
     else {
       rowSpace_->getGlobalIndicesL(numIDs, pattern->getRecordCollections(),
@@ -2454,7 +2510,7 @@ int fei::MatrixGraph_Impl2::getConnectivityIndices_singleField(const snl_fei::Re
                                                              int fieldID,
                                                              int fieldSize,
                                                              int indicesAllocLen,
-                                                             int* indices,
+                                                             GlobalOrdinal* indices,
                                                              int& numIndices)
 {
   numIndices = 0;
@@ -2469,7 +2525,7 @@ int fei::MatrixGraph_Impl2::getConnectivityIndices_singleField(const snl_fei::Re
       continue;
     }
 
-    int* eqnNumbers = vspcEqnPtr_+record->getOffsetIntoEqnNumbers();
+    GlobalOrdinal* eqnNumbers = vspcEqnPtr_+record->getOffsetIntoEqnNumbers();
 
     int eqnOffset = 0;
     if (!simpleProblem_) {
@@ -2502,7 +2558,7 @@ int fei::MatrixGraph_Impl2::getConnectivityIndices_noField(const snl_fei::Record
                                                          int* records,
                                                          int numRecords,
                                                          int indicesAllocLen,
-                                                         int* indices,
+                                                         GlobalOrdinal* indices,
                                                          int& numIndices)
 {
   numIndices = 0;
@@ -2510,7 +2566,7 @@ int fei::MatrixGraph_Impl2::getConnectivityIndices_noField(const snl_fei::Record
   for(int i=0; i<numRecords; ++i) {
 
     const fei::Record<int>* record = recordCollections[i]->getRecordWithLocalID(records[i]);
-    int* eqnNumbers = vspcEqnPtr_+record->getOffsetIntoEqnNumbers();
+    GlobalOrdinal* eqnNumbers = vspcEqnPtr_+record->getOffsetIntoEqnNumbers();
 
     if (blockEntryGraph_) {
       indices[numIndices++] = record->getNumber();
@@ -2530,8 +2586,8 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_noField_symmetric(fei::Graph* graph,
   fei::Pattern* pattern = cblock->getRowPattern();
   int numIDs = pattern->getNumIDs();
   int numIndices = pattern->getNumIndices();
-  std::vector<int> indices(numIndices);
-  int* indicesPtr = &indices[0];
+  std::vector<GlobalOrdinal> indices(numIndices);
+  GlobalOrdinal* indicesPtr = &indices[0];
 
   std::map<int,int>& connIDs = cblock->getConnectivityIDs();
   std::vector<int>& rowrecords = cblock->getRowConnectivities();
@@ -2578,8 +2634,8 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_noField_symmetric(fei::Graph* graph,
 int fei::MatrixGraph_Impl2::addBlockToGraph_sparse(fei::Graph* graph,
                                              fei::ConnectivityBlock* cblock)
 {
-  std::vector<int> row_indices;
-  std::vector<int> indices;
+  std::vector<GlobalOrdinal> row_indices;
+  std::vector<GlobalOrdinal> indices;
 
   fei::Pattern* pattern = cblock->getRowPattern();
   const snl_fei::RecordCollection*const* recordCollections = pattern->getRecordCollections();
@@ -2624,7 +2680,7 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_sparse(fei::Graph* graph,
     }
 
     indices.resize(fieldSize*rowlen);
-    int* indicesPtr = &indices[0];
+    GlobalOrdinal* indicesPtr = &indices[0];
     int* crecords = &(colrecords[offset]);
 
     if (haveField) {
@@ -2644,7 +2700,7 @@ int fei::MatrixGraph_Impl2::addBlockToGraph_sparse(fei::Graph* graph,
 
     //now we have the indices, so we're ready to push them into
     //the graph container
-    int* row_ind_ptr = &row_indices[0];
+    GlobalOrdinal* row_ind_ptr = &row_indices[0];
     for(int i=0; i<fieldSize; ++i) {
       CHK_ERR( graph->addIndices(row_ind_ptr[i], fieldSize*rowlen,
                                  indicesPtr) );
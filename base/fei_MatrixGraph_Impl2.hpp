@@ -500,7 +500,7 @@ class MatrixGraph_Impl2 : public fei::MatrixGraph, private fei::Logger {
    int getConnectivityIndices(int blockID,
                               int connectivityID,
                               int indicesAllocLen,
-                              int* indices,
+                              GlobalOrdinal* indices,
                               int& numIndices);
 
     /** Obtain the scatter-indices for both the row- and column-dimension,
@@ -509,12 +509,21 @@ class MatrixGraph_Impl2 : public fei::MatrixGraph, private fei::Logger {
    int getConnectivityIndices(int blockID,
                               int connectivityID,
                               int rowIndicesAllocLen,
-                              int* rowIndices,
+                              GlobalOrdinal* rowIndices,
                               int& numRowIndices,
                               int colIndicesAllocLen,
-                              int* colIndices,
+                              GlobalOrdinal* colIndices,
                               int& numColIndices);
 
+    /** Obtain the scatter-indices associated with a connectivity list, as
+        local indices of the row-space.
+    */
+   int getConnectivityLocalIndices(int blockID,
+                                   int connectivityID,
+                                   int indicesAllocLen,
+                                   int* localIndices,
+                                   int& numIndices);
+
    /** Query associated with Pattern rather than connectivity-block.
     */
    int getPatternNumIndices(int patternID,
@@ -524,7 +533,7 @@ class MatrixGraph_Impl2 : public fei::MatrixGraph, private fei::Logger {
     */
    int getPatternIndices(int patternID,
                          const int* IDs,
-                         std::vector<int>& indices);
+                         std::vector<GlobalOrdinal>& indices);
 
    /** Query number of local lagrange constraints */
    int getLocalNumLagrangeConstraints() const;
@@ -557,7 +566,7 @@ class MatrixGraph_Impl2 : public fei::MatrixGraph, private fei::Logger {
        interest to application users of fei:: methods.
     */
    int getConstraintConnectivityIndices(ConstraintType* cr,
-                                        std::vector<int>& globalIndices);
+                               std::vector<GlobalOrdinal>& globalIndices);
 
    /** Won't typically be of
        interest to application users of fei:: methods.
@@ -590,7 +599,7 @@ class MatrixGraph_Impl2 : public fei::MatrixGraph, private fei::Logger {
    fei::SharedPtr<fei::SparseRowGraph> getRemotelyOwnedGraphRows();
 
    /** fill a vector with eqn-numbers of constrained ids */
-   void getConstrainedIndices(std::vector<int>& crindices) const;
+   void getConstrainedIndices(std::vector<GlobalOrdinal>& crindices) const;
 
  private:
    int createAlgebraicGraph(bool blockEntryGraph,
@@ -618,21 +627,21 @@ class MatrixGraph_Impl2 : public fei::MatrixGraph, private fei::Logger {
                                          const int* fieldIDs,
                                          const int* fieldSizes,
                                          int indicesAllocLen,
-                                         int* indices,
+                                         GlobalOrdinal* indices,
                                          int& numIndices);
 
    int getConnectivityIndices_singleField(const snl_fei::RecordCollection*const* recordCollections,
                                           int* records, int numRecords,
                                           int fieldID, int fieldSize,
                                           int indicesAllocLen,
-                                          int* indices,
+                                          GlobalOrdinal* indices,
                                           int& numIndices);
 
    int getConnectivityIndices_noField(const snl_fei::RecordCollection*const* recordCollections,
                                       int* records,
                                       int numRecords,
                                       int indicesAllocLen,
-                                      int* indices,
+                                      GlobalOrdinal* indices,
                                       int& numIndices);
 
    int getConnectivityRecords(fei::VectorSpace* vecSpace,
@@ -704,10 +713,11 @@ class MatrixGraph_Impl2 : public fei::MatrixGraph, private fei::Logger {
    std::string dbgprefix_;
 
    std::vector<int> tmpIntArray1_, tmpIntArray2_;
+   std::vector<GlobalOrdinal> tmpGlobalIndices_;
 
-   int* vspcEqnPtr_;
+   GlobalOrdinal* vspcEqnPtr_;
 
-   std::set<int> constrained_indices_;
+   std::set<GlobalOrdinal> constrained_indices_;
 
    bool includeAllSlaveConstraints_;
 };//class MatrixGraph_Impl2
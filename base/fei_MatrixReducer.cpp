@@ -69,7 +69,7 @@ int MatrixReducer::putScalar(double scalar)
 { return(target_->putScalar(scalar)); }
 
 int
-MatrixReducer::getRowLength(int row, int& length) const
+MatrixReducer::getRowLength(GlobalOrdinal row, int& length) const
 {
   if (reducer_->isSlaveEqn(row)) {
     FEI_OSTRINGSTREAM osstr;
@@ -77,12 +77,13 @@ MatrixReducer::getRowLength(int row, int& length) const
     throw std::runtime_error(osstr.str());
   }
 
-  int reducedrow = reducer_->translateToReducedEqn(row);
+  GlobalOrdinal reducedrow = reducer_->translateToReducedEqn(row);
   return(target_->getRowLength(reducedrow, length));
 }
 
 int
-MatrixReducer::copyOutRow(int row, int len, double* coefs, int* indices) const
+MatrixReducer::copyOutRow(GlobalOrdinal row, int len,
+                          double* coefs, GlobalOrdinal* indices) const
 {
   if (reducer_->isSlaveEqn(row)) {
     FEI_OSTRINGSTREAM osstr;
@@ -91,7 +92,7 @@ MatrixReducer::copyOutRow(int row, int len, double* coefs, int* indices) const
     throw std::runtime_error(osstr.str());
   }
 
-  int reducedrow = reducer_->translateToReducedEqn(row);
+  GlobalOrdinal reducedrow = reducer_->translateToReducedEqn(row);
   int err = target_->copyOutRow(reducedrow, len, coefs, indices);
   for(int i=0; i<len; ++i) {
     indices[i] = reducer_->translateFromReducedEqn(indices[i]);
@@ -100,8 +101,8 @@ MatrixReducer::copyOutRow(int row, int len, double* coefs, int* indices) const
 }
 
 int
-MatrixReducer::sumIn(int numRows, const int* rows,
-                     int numCols, const int* cols,
+MatrixReducer::sumIn(int numRows, const GlobalOrdinal* rows,
+                     int numCols, const GlobalOrdinal* cols,
                      const double* const* values,
                      int format)
 {
@@ -111,8 +112,8 @@ MatrixReducer::sumIn(int numRows, const int* rows,
 }
 
 int
-MatrixReducer::copyIn(int numRows, const int* rows,
-                      int numCols, const int* cols,
+MatrixReducer::copyIn(int numRows, const GlobalOrdinal* rows,
+                      int numCols, const GlobalOrdinal* cols,
                       const double* const* values,
                       int format)
 {
@@ -135,9 +136,9 @@ MatrixReducer::sumInFieldData(int fieldID,
     target_->getMatrixGraph()->getColSpace();
 
   unsigned fieldSize = rowSpace->getFieldSize(fieldID);
-  std::vector<int> indices(fieldSize*2);
-  int* rowIndices = &indices[0];
-  int* colIndices = rowIndices+fieldSize;
+  std::vector<GlobalOrdinal> indices(fieldSize*2);
+  GlobalOrdinal* rowIndices = &indices[0];
+  GlobalOrdinal* colIndices = rowIndices+fieldSize;
 
   rowSpace->getGlobalIndices(1, &rowID, idType, fieldID, rowIndices);
   colSpace->getGlobalIndices(1, &colID, idType, fieldID, colIndices);
@@ -182,9 +183,9 @@ MatrixReducer::sumIn(int blockID, int connectivityID,
   int numRowIndices, numColIndices, dummy;
   matGraph->getConnectivityNumIndices(blockID, numRowIndices, numColIndices);
 
-  std::vector<int> indices(numRowIndices+numColIndices);
-  int* rowIndices = &indices[0];
-  int* colIndices = rowIndices+numRowIndices;
+  std::vector<GlobalOrdinal> indices(numRowIndices+numColIndices);
+  GlobalOrdinal* rowIndices = &indices[0];
+  GlobalOrdinal* colIndices = rowIndices+numRowIndices;
 
   matGraph->getConnectivityIndices(blockID, connectivityID,
                                    numRowIndices, rowIndices, dummy,
@@ -215,7 +216,7 @@ int MatrixReducer::writeToFile(const char* filename,
 			    bool matrixMarketFormat)
 {
   static char mmbanner[] = "%%MatrixMarket matrix coordinate real general";
-  std::vector<int>& localrows = reducer_->getLocalReducedEqns();
+  std::vector<GlobalOrdinal>& localrows = reducer_->getLocalReducedEqns();
   int localNumRows = localrows.size();
 
   int globalNNZ = 0;
@@ -258,17 +259,17 @@ int MatrixReducer::writeToFile(const char* filename,
     FEI_OFSTREAM& ofs = *outFile;
 
     int rowLength;
-    std::vector<int> work_indices;
+    std::vector<GlobalOrdinal> work_indices;
     std::vector<double> work_data1D;
 
     for(int i=0; i<localNumRows; ++i) {
-      int row = localrows[i];
+      GlobalOrdinal row = localrows[i];
       CHK_ERR( target_->getRowLength(row, rowLength) );
 
       work_indices.resize(rowLength);
       work_data1D.resize(rowLength);
 
-      int* indPtr = &work_indices[0];
+      GlobalOrdinal* indPtr = &work_indices[0];
       double* coefPtr = &work_data1D[0];
 
       CHK_ERR( target_->copyOutRow(row, rowLength, coefPtr, indPtr) );
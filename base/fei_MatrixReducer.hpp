@@ -68,7 +68,7 @@ namespace fei {
        @param length Output. Length of the row.
        @return error-code non-zero if any error occurs.
    */
-    int getRowLength(int row, int& length) const;
+    int getRowLength(GlobalOrdinal row, int& length) const;
 
    /** Obtain a copy of the coefficients and indices for a row of the matrix.
        @param row Global 0-based equation number
@@ -79,7 +79,8 @@ namespace fei {
        indices. (These indices will be global 0-based equation numbers.)
        @return error-code non-zero if any error occurs.
    */
-    int copyOutRow(int row, int len, double* coefs, int* indices) const;
+    int copyOutRow(GlobalOrdinal row, int len,
+                   double* coefs, GlobalOrdinal* indices) const;
 
     /** Sum coefficients into the matrix, adding them to any coefficients that
 	may already exist at the specified row/column locations.
@@ -92,8 +93,8 @@ namespace fei {
 	@param format For compatibility with old FEI elemFormat...
 	0 means row-wise or row-major, 3 means column-major. Others not recognized
      */
-    int sumIn(int numRows, const int* rows,
-	      int numCols, const int* cols,
+    int sumIn(int numRows, const GlobalOrdinal* rows,
+	      int numCols, const GlobalOrdinal* cols,
 	      const double* const* values,
 	      int format=0);
 
@@ -108,8 +109,8 @@ namespace fei {
 	@param format For compatibility with old FEI elemFormat...
 	0 means row-wise or row-major, 3 means column-major. Others not recognized
     */
-    int copyIn(int numRows, const int* rows,
-	       int numCols, const int* cols,
+    int copyIn(int numRows, const GlobalOrdinal* rows,
+	       int numCols, const GlobalOrdinal* cols,
 	       const double* const* values,
 	       int format=0);
 
@@ -205,17 +206,17 @@ namespace fei {
       { return(target_->usingBlockEntryStorage()); }
 
     /** for experts only */
-    int giveToUnderlyingMatrix(int numRows, const int* rows,
-			       int numCols, const int* cols,
+    int giveToUnderlyingMatrix(int numRows, const GlobalOrdinal* rows,
+			       int numCols, const GlobalOrdinal* cols,
 			       const double* const* values,
 			       bool sumInto,
 			       int format);
 
     /** for experts only */
-    int giveToUnderlyingBlockMatrix(int row,
+    int giveToUnderlyingBlockMatrix(GlobalOrdinal row,
 				    int rowDim,
 				    int numCols,
-				    const int* cols,
+				    const GlobalOrdinal* cols,
 				    const int* LDAs,
 				    const int* colDims,
 				    const double* const* values,
@@ -226,14 +227,14 @@ namespace fei {
     bool changedSinceMark();
 
   private:
-    int giveToMatrix(int numRows, const int* rows,
-		     int numCols, const int* cols,
+    int giveToMatrix(int numRows, const GlobalOrdinal* rows,
+		     int numCols, const GlobalOrdinal* cols,
 		     const double* const* values,
 		     bool sumInto,
 		     int format);
  
-    int giveToBlockMatrix(int numRows, const int* rows,
-			  int numCols, const int* cols,
+    int giveToBlockMatrix(int numRows, const GlobalOrdinal* rows,
+			  int numCols, const GlobalOrdinal* cols,
 			  const double* const* values,
 			  bool sumInto);
 
@@ -11,6 +11,8 @@
 
 #include <fei_macros.hpp>
 
+#include <vector>
+
 namespace fei {
   class Vector;
 
@@ -56,7 +58,8 @@ namespace fei {
         return NULL;
       }
 
-    static int getOffset(T* /*mat*/, int /*row*/, int /*col*/)
+    static int getOffset(T* /*mat*/, GlobalOrdinal /*row*/,
+                         GlobalOrdinal /*col*/)
       {
         return -1;
       }
@@ -75,7 +78,7 @@ namespace fei {
     /** Given a locally-owned global row number, query the length (number of
         nonzeros) of that row.
      */
-    static int getRowLength(T* mat, int row, int& length)
+    static int getRowLength(T* mat, GlobalOrdinal row, int& length)
       { return(-1); }
 
     /** Given a locally-owned global row number, pass out a copy of the
@@ -91,7 +94,8 @@ namespace fei {
 	that the specified row is not locally owned.
     */
     static int copyOutRow(T* mat,
-		      int row, int len, double* coefs, int* indices)
+		      GlobalOrdinal row, int len, double* coefs,
+		      GlobalOrdinal* indices)
       { return(-1); }
 
     /** Sum a C-style table of coefficient data into the underlying matrix.
@@ -99,12 +103,32 @@ namespace fei {
 	the 'rows' and 'cols' lists.
      */
     static int putValuesIn(T* mat,
-                           int numRows, const int* rows,
-                           int numCols, const int* cols,
+                           int numRows, const GlobalOrdinal* rows,
+                           int numCols, const GlobalOrdinal* cols,
                            const double* const* values,
                            bool sum_into)
       { return(-1); }
 
+    /** Query the local column number in the underlying matrix of global
+        column 'col', for use with putValuesInLocal. localCol is set to -1
+        if the column isn't in the local structure.
+        Return -1 if the underlying matrix doesn't store local column
+        numbers (or doesn't have them yet).
+    */
+    static int getLocalColumn(T* mat, GlobalOrdinal col, int& localCol)
+      { return(-1); }
+
+    /** Same as putValuesIn, with rows given as local row numbers
+        (0 .. numLocalRows-1, in the order of the locally-owned global rows)
+        and columns as local column numbers obtained from getLocalColumn.
+     */
+    static int putValuesInLocal(T* mat,
+                                int numRows, const int* localRows,
+                                int numCols, const int* localCols,
+                                const double* const* values,
+                                bool sum_into)
+      { return(-1); }
+
     /** Perform any necessary internal communications/synchronizations or other
         operations appropriate at end of data input. For some implementations
         this will be a no-op, so this "default implementation" returns 0. (The
@@ -119,6 +143,35 @@ namespace fei {
      on the local processor. */
     static int matvec(T* A, fei::Vector* x, fei::Vector* y)
     { return(-1); }
+
+    /** Eliminate essential boundary-conditions directly in the matrix's
+     own storage: zero the rows (leaving a unit diagonal) of locally-owned bc
+     eqns and, if modifyColumns is true, zero the bc columns of all other
+     local rows. Rows whose rhs must be adjusted by -A[row,bc]*bcValue are
+     appended to rhsRows with the amounts in rhsCoefs.
+     Return -1 (without modifying the matrix) if the underlying matrix
+     doesn't support direct access to its storage. bcEqns is sorted.
+    */
+    static int eliminateEssentialBCs(T* A,
+                                     int numBCEqns,
+                                     const GlobalOrdinal* bcEqns,
+                                     const double* bcValues,
+                                     bool modifyColumns,
+                                     std::vector<GlobalOrdinal>& rhsRows,
+                                     std::vector<double>& rhsCoefs)
+    { return(-1); }
+
+    /** Obtain, for each of the numRows*numCols (row,col) positions, the
+     offset of the corresponding coefficient from getBeginPointer(A).
+     offsets is filled in row-major order.
+     Return -1 if the underlying matrix doesn't support direct access to
+     its storage, or if any position is not present in the local storage.
+    */
+    static int getCoefOffsets(T* A,
+                              int numRows, const GlobalOrdinal* rows,
+                              int numCols, const GlobalOrdinal* cols,
+                              int* offsets)
+    { return(-1); }
   };//struct MatrixTraits
 
 }//namespace fei
@@ -0,0 +1,194 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#ifndef _fei_MatrixTraits_DistCSRMat_hpp_
+#define _fei_MatrixTraits_DistCSRMat_hpp_
+
+//This file defines matrix traits for fei::DistCSRMatrix matrices, of any
+//scalar type.
+//
+
+#include <fei_MatrixTraits.hpp>
+#include <fei_DistCSRMat.hpp>
+#include <fei_VectorTraits_DistVec.hpp>
+#include <fei_Vector_Impl.hpp>
+#include <fei_impl_utils.hpp>
+
+namespace fei {
+
+  /** Specialization for DistCSRMatrix. Coefficients are passed in and out
+      in double precision whatever the storage type; for single-precision
+      storage, getBeginPointer() gives the double accumulation copy, which
+      globalAssemble() rounds into the stored coefficients.
+  */
+  template<typename Scalar>
+  struct MatrixTraits<DistCSRMatrix<Scalar> > {
+
+    /** Return a string type-name for the underlying matrix */
+    static const char* typeName()
+      { return( DistCSRMatrix<Scalar>::typeName() ); }
+
+    static double* getBeginPointer(DistCSRMatrix<Scalar>* mat)
+      {
+        return( mat->getAssemblyCoefs() );
+      }
+
+    static int getOffset(DistCSRMatrix<Scalar>* mat,
+                         GlobalOrdinal row, GlobalOrdinal col)
+      {
+        return mat->getOffset(row, col);
+      }
+
+    static int setValues(DistCSRMatrix<Scalar>* mat, double scalar)
+      {
+        mat->setValues(scalar);
+        return(0);
+      }
+
+    static int getNumLocalRows(DistCSRMatrix<Scalar>* mat, int& numRows)
+    {
+      numRows = mat->numLocalRows();
+      return(0);
+    }
+
+    static int getRowLength(DistCSRMatrix<Scalar>* mat,
+                            GlobalOrdinal row, int& length)
+      {
+        length = mat->getRowLength(row);
+        if (length < 0) return(-1);
+        return(0);
+      }
+
+    static int copyOutRow(DistCSRMatrix<Scalar>* mat,
+                      GlobalOrdinal row, int len, double* coefs,
+                      GlobalOrdinal* indices)
+      {
+        return( mat->copyOutRow(row, len, coefs, indices) );
+      }
+
+    static int putValuesIn(DistCSRMatrix<Scalar>* mat,
+                           int numRows, const GlobalOrdinal* rows,
+                           int numCols, const GlobalOrdinal* cols,
+                           const double* const* values,
+                           bool sum_into)
+      {
+        for(int i=0; i<numRows; ++i) {
+          int err = mat->putRow(rows[i], numCols, cols, values[i], sum_into);
+          if (err != 0) return(err);
+        }
+        return(0);
+      }
+
+    static int getLocalColumn(DistCSRMatrix<Scalar>* mat,
+                              GlobalOrdinal col, int& localCol)
+      {
+        localCol = mat->getLocalCol(col);
+        return(0);
+      }
+
+    static int putValuesInLocal(DistCSRMatrix<Scalar>* mat,
+                                int numRows, const int* localRows,
+                                int numCols, const int* localCols,
+                                const double* const* values,
+                                bool sum_into)
+      {
+        for(int i=0; i<numRows; ++i) {
+          int err = mat->putRowLocal(localRows[i], numCols, localCols,
+                                     values[i], sum_into);
+          if (err != 0) return(err);
+        }
+        return(0);
+      }
+
+    /** The structure is fixed when the matrix is constructed, and data for
+        remotely-owned rows has already been sent to the owning processors
+        by fei::Matrix_Impl, so all that is left is to complete the
+        assembly of single-precision coefficients.
+    */
+    static int globalAssemble(DistCSRMatrix<Scalar>* mat)
+    {
+      mat->completeAssembly();
+      return(0);
+    }
+
+    static int matvec(DistCSRMatrix<Scalar>* mat,
+                      fei::Vector* x,
+                      fei::Vector* y)
+    {
+      fei::Vector_Impl<DistVec>* dvx =
+        dynamic_cast<fei::Vector_Impl<DistVec>* >(x);
+      fei::Vector_Impl<DistVec>* dvy =
+        dynamic_cast<fei::Vector_Impl<DistVec>* >(y);
+
+      if (dvx == NULL || dvy == NULL) {
+        return(-1);
+      }
+
+      return( mat->multiply(*(dvx->getUnderlyingVector()),
+                            *(dvy->getUnderlyingVector())) );
+    }
+
+    static int eliminateEssentialBCs(DistCSRMatrix<Scalar>* mat,
+                                     int numBCEqns,
+                                     const GlobalOrdinal* bcEqns,
+                                     const double* bcValues,
+                                     bool modifyColumns,
+                                     std::vector<GlobalOrdinal>& rhsRows,
+                                     std::vector<double>& rhsCoefs)
+    {
+      int numRows = mat->numLocalRows();
+      if (numRows < 1) return(0);
+
+      //the first numRows entries of the column-map are the local rows'
+      //global numbers.
+      const std::vector<GlobalOrdinal>& colMap = mat->getColMap();
+      double* coefs = mat->getAssemblyCoefs();
+
+      std::vector<double> rhsContribs(numRows);
+      fei::impl_utils::apply_essential_bcs_csr(numRows,
+                                               &colMap[0],
+                                               &(mat->getRowOffsets()[0]),
+                                               mat->getColIndices().empty() ?
+                                                 NULL : &(mat->getColIndices()[0]),
+                                               colMap.size(),
+                                               &colMap[0],
+                                               coefs,
+                                               numBCEqns, bcEqns, bcValues,
+                                               modifyColumns,
+                                               &rhsContribs[0]);
+
+      for(int i=0; i<numRows; ++i) {
+        if (rhsContribs[i] != 0.0) {
+          rhsRows.push_back(colMap[i]);
+          rhsCoefs.push_back(rhsContribs[i]);
+        }
+      }
+
+      return(0);
+    }
+
+    static int getCoefOffsets(DistCSRMatrix<Scalar>* mat,
+                              int numRows, const GlobalOrdinal* rows,
+                              int numCols, const GlobalOrdinal* cols,
+                              int* offsets)
+    {
+      for(int i=0; i<numRows; ++i) {
+        for(int j=0; j<numCols; ++j) {
+          int offset = mat->getOffset(rows[i], cols[j]);
+          if (offset < 0) return(-1);
+          offsets[i*numCols+j] = offset;
+        }
+      }
+      return(0);
+    }
+
+  };//struct MatrixTraits<DistCSRMatrix>
+}//namespace fei
+
+#endif // _fei_MatrixTraits_DistCSRMat_hpp_
+
@@ -29,7 +29,8 @@ namespace fei {
         return NULL;
       }
 
-    static int getOffset(FiniteElementData* /*fed*/, int row, int col)
+    static int getOffset(FiniteElementData* /*fed*/,
+                         GlobalOrdinal row, GlobalOrdinal col)
       {
         return -1;
       }
@@ -52,7 +53,8 @@ namespace fei {
 
     /** Given a global (zero-based) row number, query the length of that row.
      */
-    static int getRowLength(FiniteElementData* fed, int row, int& length)
+    static int getRowLength(FiniteElementData* fed,
+                            GlobalOrdinal row, int& length)
       {
 	return( -1 );
       }
@@ -70,7 +72,8 @@ namespace fei {
         that the specified row is not locally owned.
     */
     static int copyOutRow(FiniteElementData* fed,
-		      int row, int len, double* coefs, int* indices)
+		      GlobalOrdinal row, int len, double* coefs,
+                      GlobalOrdinal* indices)
       {
 	return( -1 );
       }
@@ -78,8 +81,8 @@ namespace fei {
     /** Sum a C-style table of coefficient data into the underlying matrix.
      */
     static int putValuesIn(FiniteElementData* fed,
-		     int numRows, const int* rows,
-		     int numCols, const int* cols,
+		     int numRows, const GlobalOrdinal* rows,
+		     int numCols, const GlobalOrdinal* cols,
 		     const double* const* values,
                           bool sum_into)
       {
@@ -103,6 +106,33 @@ namespace fei {
       return(-1);
     }
 
+    /** Direct bc-elimination is not supported for FiniteElementData. */
+    static int eliminateEssentialBCs(FiniteElementData* /*mat*/,
+                                     int /*numBCEqns*/,
+                                     const GlobalOrdinal* /*bcEqns*/,
+                                     const double* /*bcValues*/,
+                                     bool /*modifyColumns*/,
+                                     std::vector<GlobalOrdinal>& /*rhsRows*/,
+                                     std::vector<double>& /*rhsCoefs*/)
+    { return(-1); }
+
+    static int getCoefOffsets(FiniteElementData* /*mat*/,
+                              int /*numRows*/, const GlobalOrdinal* /*rows*/,
+                              int /*numCols*/, const GlobalOrdinal* /*cols*/,
+                              int* /*offsets*/)
+    { return(-1); }
+
+    static int getLocalColumn(FiniteElementData* /*mat*/,
+                              GlobalOrdinal /*col*/, int& /*localCol*/)
+    { return(-1); }
+
+    static int putValuesInLocal(FiniteElementData* /*mat*/,
+                                int /*numRows*/, const int* /*localRows*/,
+                                int /*numCols*/, const int* /*localCols*/,
+                                const double* const* /*values*/,
+                                bool /*sum_into*/)
+    { return(-1); }
+
   };//struct MatrixTraits
 }//namespace fei
 
@@ -15,6 +15,7 @@
 #include <fei_CSRMat.hpp>
 #include <fei_CSVec.hpp>
 #include <fei_Vector_Impl.hpp>
+#include <fei_impl_utils.hpp>
 
 namespace fei {
 
@@ -31,7 +32,8 @@ namespace fei {
         return NULL;
       }
 
-    static int getOffset(FillableMat* /*mat*/, int /*row*/, int /*col*/)
+    static int getOffset(FillableMat* /*mat*/,
+                         GlobalOrdinal /*row*/, GlobalOrdinal /*col*/)
       {
         return -1;
       }
@@ -55,7 +57,7 @@ namespace fei {
 
     /** Given a global (zero-based) row number, query the length of that row.
      */
-    static int getRowLength(FillableMat* mat, int row, int& length)
+    static int getRowLength(FillableMat* mat, GlobalOrdinal row, int& length)
       {
         try {
           const CSVec* matrixrow = mat->getRow(row);
@@ -80,12 +82,13 @@ namespace fei {
         that the specified row is not locally owned.
     */
     static int copyOutRow(FillableMat* mat,
-                      int row, int len, double* coefs, int* indices)
+                      GlobalOrdinal row, int len, double* coefs,
+                      GlobalOrdinal* indices)
       {
         try {
           const CSVec* matrixrow = mat->getRow(row);
 
-          const std::vector<int>& row_indices = matrixrow->indices();
+          const std::vector<GlobalOrdinal>& row_indices = matrixrow->indices();
           const std::vector<double>& row_coefs = matrixrow->coefs();
           const int rowlen = row_indices.size();
           for(int i=0; i<rowlen; ++i) {
@@ -104,8 +107,8 @@ namespace fei {
     /** Sum a C-style table of coefficient data into the underlying matrix.
      */
     static int putValuesIn(FillableMat* mat,
-                           int numRows, const int* rows,
-                           int numCols, const int* cols,
+                           int numRows, const GlobalOrdinal* rows,
+                           int numCols, const GlobalOrdinal* cols,
                            const double* const* values,
                            bool sum_into)
       {
@@ -156,6 +159,38 @@ namespace fei {
       return( 0 );
     }
 
+    /** Eliminate essential boundary-conditions directly in the rows of
+        the FillableMat. */
+    static int eliminateEssentialBCs(FillableMat* mat,
+                                     int numBCEqns,
+                                     const GlobalOrdinal* bcEqns,
+                                     const double* bcValues,
+                                     bool modifyColumns,
+                                     std::vector<GlobalOrdinal>& rhsRows,
+                                     std::vector<double>& rhsCoefs)
+    {
+      fei::impl_utils::apply_essential_bcs(*mat, numBCEqns, bcEqns, bcValues,
+                                           modifyColumns, rhsRows, rhsCoefs);
+      return( 0 );
+    }
+
+    static int getCoefOffsets(FillableMat* /*mat*/,
+                              int /*numRows*/, const GlobalOrdinal* /*rows*/,
+                              int /*numCols*/, const GlobalOrdinal* /*cols*/,
+                              int* /*offsets*/)
+    { return(-1); }
+
+    static int getLocalColumn(FillableMat* /*mat*/,
+                              GlobalOrdinal /*col*/, int& /*localCol*/)
+    { return(-1); }
+
+    static int putValuesInLocal(FillableMat* /*mat*/,
+                                int /*numRows*/, const int* /*localRows*/,
+                                int /*numCols*/, const int* /*localCols*/,
+                                const double* const* /*values*/,
+                                bool /*sum_into*/)
+    { return(-1); }
+
   };//struct MatrixTraits
 }//namespace fei
 
@@ -14,6 +14,7 @@
 //
 
 #include <fei_LinearProblemManager.hpp>
+#include <fei_impl_utils.hpp>
 
 namespace fei {
 
@@ -30,7 +31,8 @@ namespace fei {
         return NULL;
       }
 
-    static int getOffset(fei::LinearProblemManager* /*mat*/, int /*row*/, int /*col*/)
+    static int getOffset(fei::LinearProblemManager* /*mat*/,
+                         GlobalOrdinal /*row*/, GlobalOrdinal /*col*/)
       {
         return -1;
       }
@@ -54,9 +56,10 @@ namespace fei {
 
     /** Given a global (zero-based) row number, query the length of that row.
      */
-    static int getRowLength(fei::LinearProblemManager* mat, int row, int& length)
+    static int getRowLength(fei::LinearProblemManager* mat,
+                            GlobalOrdinal row, int& length)
       {
-	length = mat->getRowLength(row);
+	length = mat->getRowLength(fei::impl_utils::int_index(row));
         if (length < 0) return(length);
         return(0);
       }
@@ -74,22 +77,30 @@ namespace fei {
         that the specified row is not locally owned.
     */
     static int copyOutRow(fei::LinearProblemManager* mat,
-		      int row, int len, double* coefs, int* indices)
+		      GlobalOrdinal row, int len, double* coefs,
+		      GlobalOrdinal* indices)
       {
-	return( mat->copyOutMatrixRow(row, len, coefs, indices) );
+	std::vector<int> cols(len);
+	int err = mat->copyOutMatrixRow(fei::impl_utils::int_index(row), len,
+	                                coefs, len > 0 ? &cols[0] : NULL);
+	std::copy(cols.begin(), cols.end(), indices);
+	return(err);
       }
 
     /** Sum a C-style table of coefficient data into the underlying matrix.
      */
     static int putValuesIn(fei::LinearProblemManager* mat,
-                           int numRows, const int* rows,
-                           int numCols, const int* cols,
+                           int numRows, const GlobalOrdinal* rows,
+                           int numCols, const GlobalOrdinal* cols,
                            const double* const* values,
                            bool sum_into)
       {
-        return( mat->insertMatrixValues(numRows, rows,
-                                        numCols, cols,
-                                        values, sum_into) );
+        std::vector<int> rowWork, colWork;
+        return( mat->insertMatrixValues(numRows,
+                      fei::impl_utils::int_indices(numRows, rows, rowWork),
+                      numCols,
+                      fei::impl_utils::int_indices(numCols, cols, colWork),
+                      values, sum_into) );
       }
 
     /** Perform any necessary internal communications/synchronizations or other
@@ -107,6 +118,34 @@ namespace fei {
     {
       return( -1 );
     }
+
+    /** Direct bc-elimination is not supported for LinearProblemManager. */
+    static int eliminateEssentialBCs(fei::LinearProblemManager* /*mat*/,
+                                     int /*numBCEqns*/,
+                                     const GlobalOrdinal* /*bcEqns*/,
+                                     const double* /*bcValues*/,
+                                     bool /*modifyColumns*/,
+                                     std::vector<GlobalOrdinal>& /*rhsRows*/,
+                                     std::vector<double>& /*rhsCoefs*/)
+    { return(-1); }
+
+    static int getCoefOffsets(fei::LinearProblemManager* /*mat*/,
+                              int /*numRows*/, const GlobalOrdinal* /*rows*/,
+                              int /*numCols*/, const GlobalOrdinal* /*cols*/,
+                              int* /*offsets*/)
+    { return(-1); }
+
+    static int getLocalColumn(fei::LinearProblemManager* /*mat*/,
+                              GlobalOrdinal /*col*/, int& /*localCol*/)
+    { return(-1); }
+
+    static int putValuesInLocal(fei::LinearProblemManager* /*mat*/,
+                                int /*numRows*/, const int* /*localRows*/,
+                                int /*numCols*/, const int* /*localCols*/,
+                                const double* const* /*values*/,
+                                bool /*sum_into*/)
+    { return(-1); }
+
   };//struct MatrixTraits
 }//namespace fei
 
@@ -14,6 +14,7 @@
 //
 
 #include <fei_LinearSystemCore.hpp>
+#include <fei_impl_utils.hpp>
 
 namespace fei {
 
@@ -30,9 +31,11 @@ namespace fei {
          return lsc->getMatrixBeginPointer();
       }
 
-    static int getOffset(LinearSystemCore* lsc, int row, int col)
+    static int getOffset(LinearSystemCore* lsc,
+                         GlobalOrdinal row, GlobalOrdinal col)
       {
-         return lsc->getMatrixOffset(row,col);
+         return lsc->getMatrixOffset(fei::impl_utils::int_index(row),
+                                     fei::impl_utils::int_index(col));
       }
 
     /** Set a specified scalar value throughout the matrix.
@@ -53,9 +56,11 @@ namespace fei {
 
     /** Given a global (zero-based) row number, query the length of that row.
      */
-    static int getRowLength(LinearSystemCore* lsc, int row, int& length)
+    static int getRowLength(LinearSystemCore* lsc,
+                            GlobalOrdinal row, int& length)
       {
-	return( lsc->getMatrixRowLength(row, length) );
+	return( lsc->getMatrixRowLength(fei::impl_utils::int_index(row),
+	                                length) );
       }
 
     /** Given a global (zero-based) row number, pass out a copy of the contents
@@ -71,27 +76,37 @@ namespace fei {
         that the specified row is not locally owned.
     */
     static int copyOutRow(LinearSystemCore* lsc,
-		      int row, int len, double* coefs, int* indices)
+		      GlobalOrdinal row, int len, double* coefs,
+                      GlobalOrdinal* indices)
       {
         int dummy;
-	return( lsc->getMatrixRow(row, coefs, indices, len, dummy) );
+        std::vector<int> cols(len);
+	int err = lsc->getMatrixRow(fei::impl_utils::int_index(row), coefs,
+	                            len > 0 ? &cols[0] : NULL, len, dummy);
+        std::copy(cols.begin(), cols.end(), indices);
+        return(err);
       }
 
     /** Sum a C-style table of coefficient data into the underlying matrix.
      */
     static int putValuesIn(LinearSystemCore* lsc,
-                           int numRows, const int* rows,
-                           int numCols, const int* cols,
+                           int numRows, const GlobalOrdinal* rows,
+                           int numCols, const GlobalOrdinal* cols,
                            const double* const* values,
                            bool sum_into)
       {
+        std::vector<int> rowWork, colWork;
+        const int* eqnRows =
+          fei::impl_utils::int_indices(numRows, rows, rowWork);
+        const int* eqnCols =
+          fei::impl_utils::int_indices(numCols, cols, colWork);
         if (sum_into) {
-          return( lsc->sumIntoSystemMatrix(numRows, rows,
-                                           numCols, cols, values) );
+          return( lsc->sumIntoSystemMatrix(numRows, eqnRows,
+                                           numCols, eqnCols, values) );
         }
         else {
-	  return( lsc->putIntoSystemMatrix(numRows, rows,
-                                           numCols, cols, values) );
+	  return( lsc->putIntoSystemMatrix(numRows, eqnRows,
+                                           numCols, eqnCols, values) );
         }
       }
 
@@ -111,6 +126,34 @@ namespace fei {
     {
       return( -1 );
     }
+
+    /** Direct bc-elimination is not supported for LinearSystemCore. */
+    static int eliminateEssentialBCs(LinearSystemCore* /*mat*/,
+                                     int /*numBCEqns*/,
+                                     const GlobalOrdinal* /*bcEqns*/,
+                                     const double* /*bcValues*/,
+                                     bool /*modifyColumns*/,
+                                     std::vector<GlobalOrdinal>& /*rhsRows*/,
+                                     std::vector<double>& /*rhsCoefs*/)
+    { return(-1); }
+
+    static int getCoefOffsets(LinearSystemCore* /*mat*/,
+                              int /*numRows*/, const GlobalOrdinal* /*rows*/,
+                              int /*numCols*/, const GlobalOrdinal* /*cols*/,
+                              int* /*offsets*/)
+    { return(-1); }
+
+    static int getLocalColumn(LinearSystemCore* /*mat*/,
+                              GlobalOrdinal /*col*/, int& /*localCol*/)
+    { return(-1); }
+
+    static int putValuesInLocal(LinearSystemCore* /*mat*/,
+                                int /*numRows*/, const int* /*localRows*/,
+                                int /*numCols*/, const int* /*localCols*/,
+                                const double* const* /*values*/,
+                                bool /*sum_into*/)
+    { return(-1); }
+
   };//struct MatrixTraits
 }//namespace fei
 
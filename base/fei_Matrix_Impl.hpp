@@ -30,6 +30,7 @@
 #include <fei_MatrixGraph.hpp>
 #include <fei_Matrix_core.hpp>
 #include <snl_fei_Utils.hpp>
+#include <fei_impl_utils.hpp>
 
 #undef fei_file
 #define fei_file "fei_Matrix_Impl.hpp"
@@ -116,7 +117,7 @@ namespace fei {
        @param length Output. Length of the row.
        @return error-code non-zero if any error occurs.
    */
-    int getRowLength(int row, int& length) const;
+    int getRowLength(GlobalOrdinal row, int& length) const;
 
    /** Obtain a copy of the coefficients and indices for a row of the matrix.
        @param row Global 0-based equation number
@@ -127,7 +128,8 @@ namespace fei {
        indices. (These indices will be global 0-based equation numbers.)
        @return error-code non-zero if any error occurs.
    */
-    int copyOutRow(int row, int len, double* coefs, int* indices) const;
+    int copyOutRow(GlobalOrdinal row, int len,
+                   double* coefs, GlobalOrdinal* indices) const;
 
     /** Sum coefficients into the matrix, adding them to any coefficients that
         may already exist at the specified row/column locations.
@@ -140,8 +142,8 @@ namespace fei {
         @param format For compatibility with old FEI elemFormat...
         0 means row-wise or row-major, 3 means column-major. Others not recognized
      */
-    int sumIn(int numRows, const int* rows,
-              int numCols, const int* cols,
+    int sumIn(int numRows, const GlobalOrdinal* rows,
+              int numCols, const GlobalOrdinal* cols,
               const double* const* values,
               int format=0);
 
@@ -156,11 +158,33 @@ namespace fei {
         @param format For compatibility with old FEI elemFormat...
         0 means row-wise or row-major, 3 means column-major. Others not recognized
     */
-    int copyIn(int numRows, const int* rows,
-               int numCols, const int* cols,
+    int copyIn(int numRows, const GlobalOrdinal* rows,
+               int numCols, const GlobalOrdinal* cols,
                const double* const* values,
                int format=0);
 
+    /** Sum coefficients into the matrix, with rows and columns specified by
+        local indices (see fei::Matrix::sumInLocal). Locally-owned rows are
+        passed to the underlying matrix in its own local row and column
+        numbering, through a table from column-space local indices to the
+        underlying matrix's local columns that is built on first use.
+        If the underlying matrix doesn't store local column numbers, the
+        local indices are translated to global ones as in
+        fei::Matrix::sumInLocal.
+    */
+    int sumInLocal(int numRows, const int* localRows,
+                   int numCols, const int* localCols,
+                   const double* const* values,
+                   int format=0);
+
+    /** Copy coefficients into the matrix, with rows and columns specified by
+        local indices. (See sumInLocal.)
+    */
+    int copyInLocal(int numRows, const int* localRows,
+                    int numCols, const int* localCols,
+                    const double* const* values,
+                    int format=0);
+
     /** Sum coefficients into the matrix, specifying row/column locations by
         identifier/fieldID pairs.
         @param fieldID Input. field-identifier for which data is being input.
@@ -255,17 +279,17 @@ namespace fei {
       }
 
     /** for experts only */
-    int giveToUnderlyingMatrix(int numRows, const int* rows,
-                               int numCols, const int* cols,
+    int giveToUnderlyingMatrix(int numRows, const GlobalOrdinal* rows,
+                               int numCols, const GlobalOrdinal* cols,
                                const double* const* values,
                                bool sumInto,
                                int format);
 
     /** for experts only */
-    int giveToUnderlyingBlockMatrix(int row,
+    int giveToUnderlyingBlockMatrix(GlobalOrdinal row,
                                     int rowDim,
                                     int numCols,
-                                    const int* cols,
+                                    const GlobalOrdinal* cols,
                                     const int* LDAs,
                                     const int* colDims,
                                     const double* const* values,
@@ -280,12 +304,15 @@ namespace fei {
         return fei::MatrixTraits<T>::getBeginPointer(matrix_.get());
       }
 
-    int getOffset(int row, int col)
+    /** Implementation of fei::Matrix::markCoefsChanged */
+    void markCoefsChanged() { changedSinceMark_ = true; }
+
+    int getOffset(GlobalOrdinal row, GlobalOrdinal col)
       {
         fei::SharedPtr<fei::MatrixGraph> mgraph = getMatrixGraph();
         fei::SharedPtr<fei::VectorSpace> rowspace = mgraph->getRowSpace();
         fei::SharedPtr<fei::VectorSpace> colspace = mgraph->getColSpace();
-        int row_index, col_index;
+        GlobalOrdinal row_index, col_index;
         int nodeType = 0;//fix this!!! hard-coded 0
         rowspace->getGlobalIndex(nodeType, row, row_index);
         colspace->getGlobalIndex(nodeType, col, col_index);
@@ -293,22 +320,52 @@ namespace fei {
         return fei::MatrixTraits<T>::getOffset(matrix_.get(),row_index,col_index);
       }
 
+    /** Implementation of fei::Matrix::eliminateEssentialBCs */
+    int eliminateEssentialBCs(int numBCEqns,
+                              const GlobalOrdinal* bcEqns,
+                              const double* bcValues,
+                              bool modifyColumns,
+                              std::vector<GlobalOrdinal>& rhsRows,
+                              std::vector<double>& rhsCoefs);
+
+    /** Implementation of fei::Matrix::getCoefOffsets */
+    int getCoefOffsets(int numRows, const GlobalOrdinal* rows,
+                       int numCols, const GlobalOrdinal* cols,
+                       int* offsets);
+
   private:
-    int giveToMatrix(int numRows, const int* rows,
-                     int numCols, const int* cols,
+    int giveToMatrix(int numRows, const GlobalOrdinal* rows,
+                     int numCols, const GlobalOrdinal* cols,
                      const double* const* values,
                      bool sumInto,
                      int format);
  
-    int giveToBlockMatrix(int numRows, const int* rows,
-                          int numCols, const int* cols,
+    int giveToBlockMatrix(int numRows, const GlobalOrdinal* rows,
+                          int numCols, const GlobalOrdinal* cols,
                           const double* const* values,
                           bool sumInto);
 
+    int giveToMatrixLocal(int numRows, const int* localRows,
+                          int numCols, const int* localCols,
+                          const double* const* values,
+                          bool sumInto,
+                          int format);
+
+    bool setupLocalColumns();
+
     fei::SharedPtr<T> matrix_;
     bool globalAssembleCalled_;
     bool changedSinceMark_;
     std::string dbgprefix_;
+
+    //local column in the underlying matrix of each column-space local
+    //index (-1 for columns that aren't in the local structure), built on
+    //first use by sumInLocal/copyInLocal.
+    std::vector<int> localColTable_;
+    bool haveLocalColTable_;
+    std::vector<int> work_localRows_;
+    std::vector<int> work_localCols_;
+    std::vector<const double*> work_localValues_;
   };//class Matrix_Impl
 }//namespace fei
 
@@ -334,6 +391,8 @@ template<typename T>
 inline void fei::Matrix_Impl<T>::setMatrixGraph(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
 {
   Matrix_core::setMatrixGraph(matrixGraph);
+  localColTable_.clear();
+  haveLocalColTable_ = false;
 }
 
 //----------------------------------------------------------------------------
@@ -353,8 +412,67 @@ inline bool fei::Matrix_Impl<T>::changedSinceMark()
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::giveToUnderlyingMatrix(int numRows, const int* rows,
-                                               int numCols, const int* cols,
+int fei::Matrix_Impl<T>::eliminateEssentialBCs(int numBCEqns,
+                                          const GlobalOrdinal* bcEqns,
+                                          const double* bcValues,
+                                          bool modifyColumns,
+                                          std::vector<GlobalOrdinal>& rhsRows,
+                                          std::vector<double>& rhsCoefs)
+{
+  if (haveBlockMatrix() || haveFEMatrix()) {
+    return(-1);
+  }
+
+  int err = fei::MatrixTraits<T>::eliminateEssentialBCs(matrix_.get(),
+                                                        numBCEqns, bcEqns,
+                                                        bcValues,
+                                                        modifyColumns,
+                                                        rhsRows, rhsCoefs);
+  if (err != 0) {
+    return(err);
+  }
+
+  if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
+    FEI_OSTREAM& os = *output_stream_;
+    os << dbgprefix_<<"eliminateEssentialBCs numBCEqns="<<numBCEqns
+       << ", num rhs mods="<<rhsRows.size()<<FEI_ENDL;
+  }
+
+  changedSinceMark_ = true;
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Matrix_Impl<T>::getCoefOffsets(int numRows,
+                                        const GlobalOrdinal* rows,
+                                        int numCols,
+                                        const GlobalOrdinal* cols,
+                                        int* offsets)
+{
+  if (haveBlockMatrix() || haveFEMatrix()) {
+    return(-1);
+  }
+
+  //shared (remotely-owned) rows are held in the overlap matrices until
+  //gatherFromOverlap, so only locally-owned rows have storage positions.
+  for(int i=0; i<numRows; ++i) {
+    if (rows[i] < firstLocalOffset() || rows[i] > lastLocalOffset()) {
+      return(-1);
+    }
+  }
+
+  return( fei::MatrixTraits<T>::getCoefOffsets(matrix_.get(),
+                                                numRows, rows,
+                                                numCols, cols, offsets) );
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Matrix_Impl<T>::giveToUnderlyingMatrix(int numRows,
+                                               const GlobalOrdinal* rows,
+                                               int numCols,
+                                               const GlobalOrdinal* cols,
                                                const double* const* values,
                                                bool sumInto,
                                                int format)
@@ -386,25 +504,30 @@ int fei::Matrix_Impl<T>::giveToUnderlyingMatrix(int numRows, const int* rows,
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::giveToUnderlyingBlockMatrix(int row,
+int fei::Matrix_Impl<T>::giveToUnderlyingBlockMatrix(GlobalOrdinal row,
                                                     int rowDim,
                                                     int numCols,
-                                                    const int* cols,
+                                                    const GlobalOrdinal* cols,
                                                     const int* LDAs,
                                                     const int* colDims,
                                                     const double* const* values,
                                                     bool sumInto)
 {
+  //block matrices are addressed with int block-equations.
+  int blkRow = fei::impl_utils::int_index(row);
+  std::vector<int> work;
+  const int* blkCols = fei::impl_utils::int_indices(numCols, cols, work);
+
   if (sumInto) {
     if ( snl_fei::BlockMatrixTraits<T>::sumIn(matrix_.get(),
-                                         row, rowDim, numCols, cols,
+                                         blkRow, rowDim, numCols, blkCols,
                                          LDAs, colDims, values) != 0) {
       ERReturn(-1);
     }
   }
   else {
     if ( snl_fei::BlockMatrixTraits<T>::copyIn(matrix_.get(),
-                                          row, rowDim, numCols, cols,
+                                          blkRow, rowDim, numCols, blkCols,
                                           LDAs, colDims, values) != 0) {
       ERReturn(-1);
     }
@@ -441,7 +564,12 @@ fei::Matrix_Impl<T>::Matrix_Impl(fei::SharedPtr<T> matrix,
     matrix_(matrix),
     globalAssembleCalled_(false),
     changedSinceMark_(true),
-    dbgprefix_("MatImpl: ")
+    dbgprefix_("MatImpl: "),
+    localColTable_(),
+    haveLocalColTable_(false),
+    work_localRows_(),
+    work_localCols_(),
+    work_localValues_()
 {
   if (strcmp(snl_fei::FEMatrixTraits<T>::typeName(), "unsupported")) {
     setFEMatrix(true);
@@ -466,7 +594,8 @@ fei::Matrix_Impl<T>::Matrix_Impl(fei::SharedPtr<T> matrix,
         if (rowLength == 0) continue;
         zeros.resize(rowLength, 0.0);
         const double* zerosPtr = &zeros[0];
-        const int* cols = &srg->packedColumnIndices[srg->rowOffsets[row]];
+        const GlobalOrdinal* cols =
+          &srg->packedColumnIndices[srg->rowOffsets[row]];
         sumIn(1, &srg->rowNumbers[row], rowLength, cols, &zerosPtr);
       }
       setCommSizes();
@@ -495,10 +624,11 @@ int fei::Matrix_Impl<T>::parameters(const fei::ParameterSet& paramset)
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::getRowLength(int row, int& length) const
+int fei::Matrix_Impl<T>::getRowLength(GlobalOrdinal row, int& length) const
 {
   if (haveBlockMatrix()) {
-    return( snl_fei::BlockMatrixTraits<T>::getPointRowLength(matrix_.get(), row, length) );
+    return( snl_fei::BlockMatrixTraits<T>::getPointRowLength(matrix_.get(),
+                                  fei::impl_utils::int_index(row), length) );
   }
   else {
     int code = fei::MatrixTraits<T>::getRowLength(matrix_.get(), row, length);
@@ -549,8 +679,8 @@ int fei::Matrix_Impl<T>::putScalar(double scalar)
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::copyOutRow(int row, int len,
-                                   double* coefs, int* indices) const
+int fei::Matrix_Impl<T>::copyOutRow(GlobalOrdinal row, int len,
+                                   double* coefs, GlobalOrdinal* indices) const
 {
   if (len < 1) {
     return 0;
@@ -558,9 +688,13 @@ int fei::Matrix_Impl<T>::copyOutRow(int row, int len,
 
   if (haveBlockMatrix()) {
     int dummy;
-    return( snl_fei::BlockMatrixTraits<T>::copyOutPointRow(matrix_.get(), firstLocalOffset(),
-                                                  row, len,
-                                                  coefs, indices, dummy));
+    std::vector<int> int_indices(len);
+    int err = snl_fei::BlockMatrixTraits<T>::copyOutPointRow(matrix_.get(),
+                                   fei::impl_utils::int_index(firstLocalOffset()),
+                                   fei::impl_utils::int_index(row), len,
+                                   coefs, &int_indices[0], dummy);
+    std::copy(int_indices.begin(), int_indices.end(), indices);
+    return(err);
   }
   else {
     int code = fei::MatrixTraits<T>::copyOutRow(matrix_.get(), row, len,
@@ -570,7 +704,7 @@ int fei::Matrix_Impl<T>::copyOutRow(int row, int len,
       const FillableMat* remote_mat = getRemotelyOwnedMatrix(proc);
       if (remote_mat->hasRow(row)) {
         const CSVec* row_entries = remote_mat->getRow(row);
-        const std::vector<int>& row_indices = row_entries->indices();
+        const std::vector<GlobalOrdinal>& row_indices = row_entries->indices();
         const std::vector<double>& row_coefs = row_entries->coefs();
         for(size_t i=0; i<row_indices.size(); ++i) {
           indices[i] = row_indices[i];
@@ -584,8 +718,8 @@ int fei::Matrix_Impl<T>::copyOutRow(int row, int len,
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::sumIn(int numRows, const int* rows,
-                              int numCols, const int* cols,
+int fei::Matrix_Impl<T>::sumIn(int numRows, const GlobalOrdinal* rows,
+                              int numCols, const GlobalOrdinal* cols,
                               const double* const* values,
                               int format)
 {
@@ -607,8 +741,8 @@ int fei::Matrix_Impl<T>::sumIn(int numRows, const int* rows,
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::copyIn(int numRows, const int* rows,
-                               int numCols, const int* cols,
+int fei::Matrix_Impl<T>::copyIn(int numRows, const GlobalOrdinal* rows,
+                               int numCols, const GlobalOrdinal* cols,
                                const double* const* values,
                                int format)
 {
@@ -627,6 +761,38 @@ int fei::Matrix_Impl<T>::copyIn(int numRows, const int* rows,
   return( giveToMatrix( numRows, rows, numCols, cols, values, false, format) );
 }
 
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Matrix_Impl<T>::sumInLocal(int numRows, const int* localRows,
+                                    int numCols, const int* localCols,
+                                    const double* const* values,
+                                    int format)
+{
+  if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
+    FEI_OSTREAM& os = *output_stream_;
+    os << dbgprefix_<<"sumInLocal"<<FEI_ENDL;
+  }
+
+  return( giveToMatrixLocal(numRows, localRows, numCols, localCols, values,
+                            true, format) );
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Matrix_Impl<T>::copyInLocal(int numRows, const int* localRows,
+                                     int numCols, const int* localCols,
+                                     const double* const* values,
+                                     int format)
+{
+  if (output_level_ > fei::BRIEF_LOGS && output_stream_ != NULL) {
+    FEI_OSTREAM& os = *output_stream_;
+    os << dbgprefix_<<"copyInLocal"<<FEI_ENDL;
+  }
+
+  return( giveToMatrixLocal(numRows, localRows, numCols, localCols, values,
+                            false, format) );
+}
+
 //----------------------------------------------------------------------------
 template<typename T>
 int fei::Matrix_Impl<T>::sumInFieldData(int fieldID,
@@ -643,7 +809,7 @@ int fei::Matrix_Impl<T>::sumInFieldData(int fieldID,
   if (fieldSize <= 0) ERReturn(-1);
 
   work_indices_.resize(fieldSize*2);
-  int* indicesPtr = &work_indices_[0];
+  GlobalOrdinal* indicesPtr = &work_indices_[0];
   int i;
 
   CHK_ERR( vspace->getGlobalIndices(1, &rowID, idType, fieldID, indicesPtr));
@@ -722,7 +888,7 @@ int fei::Matrix_Impl<T>::sumIn(int blockID, int connectivityID,
   rspace->getGlobalIndicesL(pattern, rowConn, work_indices2_);
 
   int numRowIndices = work_indices2_.size();
-  int* rowIndices = &work_indices2_[0];
+  GlobalOrdinal* rowIndices = &work_indices2_[0];
 
   if (haveFEMatrix() || haveBlockMatrix()) {
     FieldDofMap<int>& fdofmap = rspace->getFieldDofMap();
@@ -742,8 +908,8 @@ int fei::Matrix_Impl<T>::sumIn(int blockID, int connectivityID,
     }
 
     const int* numIndicesPerID = pattern->getNumIndicesPerID();
-    work_indices_.resize(numIDs+numDofs);
-    int i, *nodeNumbers = &work_indices_[0];
+    work_ints_.resize(numIDs+numDofs);
+    int i, *nodeNumbers = &work_ints_[0];
     int* dof_ids = nodeNumbers+numIDs;
 
     int nodeType = 0;
@@ -779,7 +945,7 @@ int fei::Matrix_Impl<T>::sumIn(int blockID, int connectivityID,
       }
 
       int numPtIndices = pattern->getNumIndices();
-      int* ptIndices = &work_indices2_[0];
+      GlobalOrdinal* ptIndices = &work_indices2_[0];
 
       int numPtColIndices = symmetric ? numPtIndices : colpattern->getNumIndices();
 
@@ -861,7 +1027,7 @@ int fei::Matrix_Impl<T>::sumIn(int blockID, int connectivityID,
   }
 
   int numColIndices = symmetric ? numRowIndices : colpattern->getNumIndices();
-  int* colIndices = rowIndices;
+  GlobalOrdinal* colIndices = rowIndices;
   const int* colConn = NULL;
 
   if (!symmetric) {
@@ -955,8 +1121,8 @@ int fei::Matrix_Impl<T>::gatherFromOverlap(bool accumulate)
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::giveToMatrix(int numRows, const int* rows,
-                                     int numCols, const int* cols,
+int fei::Matrix_Impl<T>::giveToMatrix(int numRows, const GlobalOrdinal* rows,
+                                     int numCols, const GlobalOrdinal* cols,
                                      const double* const* values,
                                      bool sumInto,
                                      int format)
@@ -989,7 +1155,7 @@ int fei::Matrix_Impl<T>::giveToMatrix(int numRows, const int* rows,
   int numRemote = 0;
   int* workIntPtr = &work_ints_[0];
   for(i=0; i<numRows; ++i) {
-    int row = rows[i];
+    GlobalOrdinal row = rows[i];
     if (row < firstLocalOffset() || row > lastLocalOffset()) {
       ++numRemote;
       workIntPtr[i] = 1;
@@ -1013,7 +1179,7 @@ int fei::Matrix_Impl<T>::giveToMatrix(int numRows, const int* rows,
   }
 
   for(i=0; i<numRows; ++i) {
-    int row = rows[i];
+    GlobalOrdinal row = rows[i];
     const double*const rowvalues = myvalues[i];
 
     if (workIntPtr[i] > 0) {
@@ -1049,8 +1215,142 @@ int fei::Matrix_Impl<T>::giveToMatrix(int numRows, const int* rows,
 
 //----------------------------------------------------------------------------
 template<typename T>
-int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows, const int* rows,
-                                          int numCols, const int* cols,
+bool fei::Matrix_Impl<T>::setupLocalColumns()
+{
+  if (haveLocalColTable_) return(true);
+
+  fei::SharedPtr<fei::MatrixGraph> mgraph = getMatrixGraph();
+  if (mgraph.get() == NULL) return(false);
+
+  //the owned local indices of the row-space must be the underlying
+  //matrix's local rows.
+  fei::SharedPtr<fei::VectorSpace> rowSpace = mgraph->getRowSpace();
+  const std::vector<GlobalOrdinal>& rowMap = rowSpace->getLocalIndexMap();
+  int numOwned = rowSpace->getNumIndices_Owned();
+  if (numOwned != getLocalNumRows()) return(false);
+  if (numOwned > 0 && rowMap[0] != firstLocalOffset()) return(false);
+
+  fei::SharedPtr<fei::VectorSpace> colSpace = mgraph->getColSpace();
+  if (colSpace.get() == NULL) colSpace = rowSpace;
+
+  const std::vector<GlobalOrdinal>& colMap = colSpace->getLocalIndexMap();
+  localColTable_.resize(colMap.size());
+  for(size_t i=0; i<colMap.size(); ++i) {
+    int err = fei::MatrixTraits<T>::getLocalColumn(matrix_.get(), colMap[i],
+                                                   localColTable_[i]);
+    if (err != 0) {
+      localColTable_.clear();
+      return(false);
+    }
+  }
+
+  haveLocalColTable_ = true;
+  return(true);
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Matrix_Impl<T>::giveToMatrixLocal(int numRows, const int* localRows,
+                                           int numCols, const int* localCols,
+                                           const double* const* values,
+                                           bool sumInto,
+                                           int format)
+{
+  if (numRows == 0 || numCols == 0) {
+    return(0);
+  }
+
+  if (haveBlockMatrix() || haveFEMatrix() || !setupLocalColumns()) {
+    if (sumInto) {
+      return( fei::Matrix::sumInLocal(numRows, localRows, numCols, localCols,
+                                      values, format) );
+    }
+    return( fei::Matrix::copyInLocal(numRows, localRows, numCols, localCols,
+                                     values, format) );
+  }
+
+  if (format != FEI_DENSE_ROW && format != FEI_DENSE_COL) {
+    return(-1);
+  }
+
+  const double** myvalues = const_cast<const double**>(values);
+  if (format != FEI_DENSE_ROW) {
+    copyTransposeToWorkArrays(numRows, numCols, values,
+                              work_data1D_, work_data2D_);
+    myvalues = &work_data2D_[0];
+  }
+
+  const int numColLIDs = localColTable_.size();
+  work_localCols_.resize(numCols);
+  for(int j=0; j<numCols; ++j) {
+    if (localCols[j] < 0 || localCols[j] >= numColLIDs) {
+      ERReturn(-1);
+    }
+    work_localCols_[j] = localColTable_[localCols[j]];
+  }
+
+  //owned rows' local indices are the underlying matrix's local rows. The
+  //other rows are shared-but-not-owned, and go to the remotely-owned
+  //matrices with global indices.
+  const int numOwned = getLocalNumRows();
+  work_localRows_.resize(numRows);
+  work_localValues_.resize(numRows);
+  std::vector<int> remoteRows;
+  std::vector<const double*> remoteValues;
+  int numLocal = 0;
+  for(int i=0; i<numRows; ++i) {
+    if (localRows[i] >= 0 && localRows[i] < numOwned) {
+      work_localRows_[numLocal] = localRows[i];
+      work_localValues_[numLocal++] = myvalues[i];
+    }
+    else {
+      remoteRows.push_back(localRows[i]);
+      remoteValues.push_back(myvalues[i]);
+    }
+  }
+
+  if (numLocal > 0) {
+    int err = fei::MatrixTraits<T>::putValuesInLocal(matrix_.get(), numLocal,
+                                                     &work_localRows_[0],
+                                                     numCols,
+                                                     &work_localCols_[0],
+                                                     &work_localValues_[0],
+                                                     sumInto);
+    changedSinceMark_ = true;
+    if (err != 0) {
+      FEI_OSTRINGSTREAM osstr;
+      osstr << "fei::Matrix_Impl::giveToMatrixLocal ERROR: err="<<err
+        << " returned from MatrixTraits::putValuesInLocal.";
+      throw std::runtime_error(osstr.str());
+    }
+  }
+
+  if (!remoteRows.empty()) {
+    fei::SharedPtr<fei::VectorSpace> rowSpace =
+      getMatrixGraph()->getRowSpace();
+    fei::SharedPtr<fei::VectorSpace> colSpace =
+      getMatrixGraph()->getColSpace();
+    if (colSpace.get() == NULL) colSpace = rowSpace;
+
+    int numRemote = remoteRows.size();
+    std::vector<GlobalOrdinal> rows(numRemote), cols(numCols);
+    CHK_ERR( rowSpace->getGlobalIndicesFromLocal(numRemote, &remoteRows[0],
+                                                 &rows[0]) );
+    CHK_ERR( colSpace->getGlobalIndicesFromLocal(numCols, localCols,
+                                                 &cols[0]) );
+    CHK_ERR( giveToMatrix(numRemote, &rows[0], numCols, &cols[0],
+                          &remoteValues[0], sumInto, FEI_DENSE_ROW) );
+  }
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows,
+                                          const GlobalOrdinal* rows,
+                                          int numCols,
+                                          const GlobalOrdinal* cols,
                                           const double* const* values,
                                           bool sumInto)
 {
@@ -1067,19 +1367,19 @@ int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows, const int* rows,
   snl_fei::PointBlockMap* pointBlockMap = vecSpace()->getPointBlockMap();
 
   if (sumInto && numProcs() == 1) {
-    std::vector<int> temp((numRows+numCols)*2);
-    int* tempPtr = &temp[0];
-    int* blkRows = tempPtr;
-    int* blkRowOffsets = tempPtr+numRows;
-    int* blkCols = blkRowOffsets+numRows;
-    int* blkColOffsets = blkCols+numCols;
+    std::vector<GlobalOrdinal> blkEqns(numRows+numCols);
+    std::vector<int> blkOffsets(numRows+numCols);
+    GlobalOrdinal* blkRows = &blkEqns[0];
+    int* blkRowOffsets = &blkOffsets[0];
+    GlobalOrdinal* blkCols = blkRows+numRows;
+    int* blkColOffsets = blkRowOffsets+numRows;
 
     CHK_ERR( convertPtToBlk(numRows, rows, numCols, cols,
                             blkRows, blkRowOffsets,
                             blkCols, blkColOffsets) );
 
-    std::vector<int> blockRows, blockRowSizes;
-    std::vector<int> blockCols, blockColSizes;
+    std::vector<GlobalOrdinal> blockRows, blockCols;
+    std::vector<int> blockRowSizes, blockColSizes;
     for(int i=0; i<numRows; ++i) fei::sortedListInsert(blkRows[i], blockRows);
     for(int i=0; i<numCols; ++i) fei::sortedListInsert(blkCols[i], blockCols);
 
@@ -1140,7 +1440,7 @@ int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows, const int* rows,
   int coefBlkLen = maxBlkEqnSize*maxBlkEqnSize*2;
 
   for(int i=0; i<numRows; ++i) {
-    int row = rows[i];
+    GlobalOrdinal row = rows[i];
 
     if (row < firstLocalOffset() || row > lastLocalOffset()) {
       int proc = eqnComm_->getOwnerProc(row);
@@ -1155,13 +1455,14 @@ int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows, const int* rows,
       continue;
     }
 
-    int blockRow = pointBlockMap->eqnToBlkEqn(row);
+    GlobalOrdinal blockRow = pointBlockMap->eqnToBlkEqn(row);
     int blockRowSize = pointBlockMap->getBlkEqnSize(blockRow);
     int blockRowOffset = pointBlockMap->getBlkEqnOffset(blockRow, row);
 
     int blockRowLength = 0;
-    CHK_ERR( snl_fei::BlockMatrixTraits<T>::getRowLength(matrix_.get(), blockRow,
-                                                blockRowLength) );
+    CHK_ERR( snl_fei::BlockMatrixTraits<T>::getRowLength(matrix_.get(),
+                                      fei::impl_utils::int_index(blockRow),
+                                      blockRowLength) );
 
     std::vector<int> blkCols(blockRowLength);
     int* blkCols_ptr = &blkCols[0];
@@ -1179,7 +1480,8 @@ int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows, const int* rows,
 
     int checkRowLen = 0;
     CHK_ERR( snl_fei::BlockMatrixTraits<T>::copyOutRow(matrix_.get(),
-                                              blockRow, blockRowLength,
+                                      fei::impl_utils::int_index(blockRow),
+                                              blockRowLength,
                                               blockRowSize,
                                               blkCols_ptr,
                                               blkColDims_ptr,
@@ -1193,7 +1495,8 @@ int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows, const int* rows,
     }
 
     for(int j=0; j<numCols; ++j) {
-      int blockCol, blkOffset;
+      GlobalOrdinal blockCol;
+      int blkOffset;
       CHK_ERR( pointBlockMap->getPtEqnInfo(cols[j], blockCol, blkOffset) );
 
       for(int jj=0; jj<blockRowLength; ++jj) {
@@ -1212,8 +1515,9 @@ int fei::Matrix_Impl<T>::giveToBlockMatrix(int numRows, const int* rows,
     }
 
     //Now put the block-row back into the matrix
+    std::vector<GlobalOrdinal> blkColEqns(blkCols.begin(), blkCols.end());
     CHK_ERR( giveToUnderlyingBlockMatrix(blockRow, blockRowSize,
-                                         blockRowLength, blkCols_ptr,
+                                         blockRowLength, &blkColEqns[0],
                                          &LDAs[0],
                                          blkColDims_ptr,
                                          coefs_2D_ptr,
@@ -1248,19 +1552,19 @@ int fei::Matrix_Impl<T>::writeToFile(const char* filename,
   fei::SharedPtr<fei::VectorSpace> vspace = mgraph->getRowSpace();
 
   int globalNNZ = 0;
-  int globalNumRows = vspace->getGlobalNumIndices();
+  GlobalOrdinal globalNumRows = vspace->getGlobalNumIndices();
   int localNumRows = vspace->getNumIndices_Owned();
 
   fei::SharedPtr<fei::VectorSpace> cspace = mgraph->getColSpace();
-  int globalNumCols = globalNumRows;
+  GlobalOrdinal globalNumCols = globalNumRows;
   if (cspace.get() != NULL) {
     globalNumCols = cspace->getGlobalNumIndices();
   }
 
-  std::vector<int> indices_owned;
+  std::vector<GlobalOrdinal> indices_owned;
   int localNNZ = 0;
   CHK_ERR( vspace->getIndices_Owned(indices_owned) );
-  int* rowsPtr = &indices_owned[0];
+  GlobalOrdinal* rowsPtr = &indices_owned[0];
   for(int i=0; i<localNumRows; ++i) {
     int len;
     CHK_ERR( getRowLength(rowsPtr[i], len) );
@@ -1293,13 +1597,13 @@ int fei::Matrix_Impl<T>::writeToFile(const char* filename,
 
     int rowLength;
 
-    for(int i=firstLocalOffset(); i<=lastLocalOffset(); ++i) {
+    for(GlobalOrdinal i=firstLocalOffset(); i<=lastLocalOffset(); ++i) {
       CHK_ERR( getRowLength(i, rowLength) );
 
       work_indices_.resize(rowLength);
       work_data1D_.resize(rowLength);
 
-      int* indPtr = &work_indices_[0];
+      GlobalOrdinal* indPtr = &work_indices_[0];
       double* coefPtr = &work_data1D_[0];
 
       CHK_ERR( copyOutRow(i, rowLength, coefPtr, indPtr) );
@@ -1347,10 +1651,10 @@ int fei::Matrix_Impl<T>::writeToStream(FEI_OSTREAM& ostrm,
 
   int globalNNZ = 0;
   int localNumRows = vspace->getNumIndices_Owned();
-  std::vector<int> indices_owned;
+  std::vector<GlobalOrdinal> indices_owned;
   int localNNZ = 0;
   CHK_ERR( vspace->getIndices_Owned(indices_owned));
-  int* rowsPtr = &indices_owned[0];
+  GlobalOrdinal* rowsPtr = &indices_owned[0];
   for(int i=0; i<localNumRows; ++i) {
     int len;
     CHK_ERR( getRowLength(rowsPtr[i], len) );
@@ -1366,7 +1670,7 @@ int fei::Matrix_Impl<T>::writeToStream(FEI_OSTREAM& ostrm,
     if (p != localProc()) continue;
 
     if (p==0) {
-      int globalSize = globalOffsets()[numProcs()]-1;
+      GlobalOrdinal globalSize = globalOffsets()[numProcs()]-1;
       if (matrixMarketFormat) {
         ostrm << mmbanner << FEI_ENDL;
         ostrm << globalSize << " " << globalSize << " " << globalNNZ << FEI_ENDL;
@@ -1378,13 +1682,13 @@ int fei::Matrix_Impl<T>::writeToStream(FEI_OSTREAM& ostrm,
 
     int rowLength;
 
-    for(int i=firstLocalOffset(); i<=lastLocalOffset(); ++i) {
+    for(GlobalOrdinal i=firstLocalOffset(); i<=lastLocalOffset(); ++i) {
       CHK_ERR( getRowLength(i, rowLength) );
 
       work_indices_.resize(rowLength);
       work_data1D_.resize(rowLength);
 
-      int* indPtr = &work_indices_[0];
+      GlobalOrdinal* indPtr = &work_indices_[0];
       double* coefPtr = &work_data1D_[0];
 
       CHK_ERR( copyOutRow(i, rowLength, coefPtr, indPtr) );
@@ -11,6 +11,13 @@
 #include "fei_Matrix_core.hpp"
 #include "fei_sstream.hpp"
 #include "fei_fstream.hpp"
+#include "fei_impl_utils.hpp"
+
+#include <algorithm>
+
+#undef fei_file
+#define fei_file "fei_Matrix_Local.cpp"
+#include "fei_ErrMacros.hpp"
 
 namespace fei {
 
@@ -21,7 +28,14 @@ Matrix_Local::Matrix_Local(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
    coefs_(sparseRowGraph->packedColumnIndices.size(), 0.0),
    stateChanged_(false),
    work_data1D_(),
-   work_data2D_()
+   work_data2D_(),
+   multiplyColSpace_(NULL),
+   multiplyRowSpace_(NULL),
+   localColIndices_(),
+   localRowIndices_(),
+   lidRowIndices_(),
+   lidColIndices_(),
+   colPositions_()
 {
 }
 
@@ -65,7 +79,10 @@ Matrix_Local::getMatrixGraph() const
 
 void
 Matrix_Local::setMatrixGraph(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
-{ matrixGraph_ = matrixGraph; }
+{
+  matrixGraph_ = matrixGraph;
+  lidRowIndices_.clear();
+}
 
 int
 Matrix_Local::getGlobalNumRows() const
@@ -76,15 +93,41 @@ Matrix_Local::getLocalNumRows() const
 { return( getGlobalNumRows() ); }
 
 int
-Matrix_Local::getRowIndex(int rowNumber) const
+Matrix_Local::getRowIndex(GlobalOrdinal rowNumber) const
 {
-  int* rows = &(sparseRowGraph_->rowNumbers[0]);
+  GlobalOrdinal* rows = &(sparseRowGraph_->rowNumbers[0]);
   int numRows = getLocalNumRows();
   return( fei::binarySearch(rowNumber, rows, numRows) );
 }
 
+void
+Matrix_Local::setupLocalIndices()
+{
+  if (!lidRowIndices_.empty()) return;
+
+  const std::vector<GlobalOrdinal>& localIndexMap =
+    matrixGraph_->getRowSpace()->getLocalIndexMap();
+
+  lidRowIndices_.resize(localIndexMap.size());
+  for(size_t i=0; i<localIndexMap.size(); ++i) {
+    lidRowIndices_[i] = getRowIndex(localIndexMap[i]);
+  }
+
+  fei::SharedPtr<fei::VectorSpace> colSpace = matrixGraph_->getColSpace();
+  if (colSpace.get() == NULL) colSpace = matrixGraph_->getRowSpace();
+
+  const std::vector<GlobalOrdinal>& colIndices =
+    sparseRowGraph_->packedColumnIndices;
+  lidColIndices_.resize(colIndices.size());
+  for(size_t i=0; i<colIndices.size(); ++i) {
+    lidColIndices_[i] = colSpace->getLocalIndex(colIndices[i]);
+  }
+
+  colPositions_.assign(colSpace->getLocalIndexMap().size(), -1);
+}
+
 int
-Matrix_Local::getRowLength(int row, int& length) const
+Matrix_Local::getRowLength(GlobalOrdinal row, int& length) const
 {
   int idx = getRowIndex(row);
   if (idx < 0) return(idx);
@@ -103,7 +146,8 @@ Matrix_Local::putScalar(double scalar)
 }
 
 int
-Matrix_Local::copyOutRow(int row, int len, double* coefs, int* indices) const
+Matrix_Local::copyOutRow(GlobalOrdinal row, int len,
+                         double* coefs, GlobalOrdinal* indices) const
 {
   int idx = getRowIndex(row);
   if (idx < 0) return(idx);
@@ -121,8 +165,8 @@ Matrix_Local::copyOutRow(int row, int len, double* coefs, int* indices) const
 }
 
 int
-Matrix_Local::giveToMatrix(int numRows, const int* rows,
-                      int numCols, const int* cols,
+Matrix_Local::giveToMatrix(int numRows, const GlobalOrdinal* rows,
+                      int numCols, const GlobalOrdinal* cols,
                       const double* const* values,
                       bool sumInto,
                       int format)
@@ -151,7 +195,7 @@ Matrix_Local::giveToMatrix(int numRows, const int* rows,
     int offset = sparseRowGraph_->rowOffsets[idx];
     int len = sparseRowGraph_->rowOffsets[idx+1] - offset;
 
-    int* colInds = &(sparseRowGraph_->packedColumnIndices[offset]);
+    GlobalOrdinal* colInds = &(sparseRowGraph_->packedColumnIndices[offset]);
     double* coefs   = &(coefs_[offset]);
 
     for(int j=0; j<numCols; ++j) {
@@ -174,8 +218,8 @@ Matrix_Local::giveToMatrix(int numRows, const int* rows,
 }
 
 int
-Matrix_Local::sumIn(int numRows, const int* rows,
-                    int numCols, const int* cols,
+Matrix_Local::sumIn(int numRows, const GlobalOrdinal* rows,
+                    int numCols, const GlobalOrdinal* cols,
                     const double* const* values,
                     int format)
 {
@@ -184,8 +228,8 @@ Matrix_Local::sumIn(int numRows, const int* rows,
 }
 
 int
-Matrix_Local::copyIn(int numRows, const int* rows,
-                       int numCols, const int* cols,
+Matrix_Local::copyIn(int numRows, const GlobalOrdinal* rows,
+                       int numCols, const GlobalOrdinal* cols,
                        const double* const* values,
                       int format)
 {
@@ -193,6 +237,109 @@ Matrix_Local::copyIn(int numRows, const int* rows,
                        false, format) );
 }
 
+int
+Matrix_Local::sumInLocal(int numRows, const int* localRows,
+                         int numCols, const int* localCols,
+                         const double* const* values,
+                         int format)
+{
+  return( giveToMatrixLocal(numRows, localRows, numCols, localCols, values,
+                            true, format) );
+}
+
+int
+Matrix_Local::copyInLocal(int numRows, const int* localRows,
+                          int numCols, const int* localCols,
+                          const double* const* values,
+                          int format)
+{
+  return( giveToMatrixLocal(numRows, localRows, numCols, localCols, values,
+                            false, format) );
+}
+
+int
+Matrix_Local::giveToMatrixLocal(int numRows, const int* localRows,
+                                int numCols, const int* localCols,
+                                const double* const* values,
+                                bool sumInto, int format)
+{
+  if (numRows == 0 || numCols == 0) {
+    return(0);
+  }
+
+  if (format != FEI_DENSE_ROW && format != FEI_DENSE_COL) {
+    return(-1);
+  }
+
+  const double** myvalues = const_cast<const double**>(values);
+  if (format != FEI_DENSE_ROW) {
+    fei::Matrix_core::copyTransposeToWorkArrays(numRows, numCols, values,
+                              work_data1D_, work_data2D_);
+    myvalues = &work_data2D_[0];
+  }
+
+  setupLocalIndices();
+
+  const int numRowLIDs = lidRowIndices_.size();
+  const int numColLIDs = colPositions_.size();
+  for(int j=0; j<numCols; ++j) {
+    if (localCols[j] < 0 || localCols[j] >= numColLIDs) {
+      throw std::runtime_error("fei::Matrix_Local::sumInLocal ERROR, local col out of range.");
+    }
+  }
+
+  int* colPositions = colPositions_.empty() ? NULL : &colPositions_[0];
+
+  for(int i=0; i<numRows; ++i) {
+    int idx = -1;
+    if (localRows[i] >= 0 && localRows[i] < numRowLIDs) {
+      idx = lidRowIndices_[localRows[i]];
+    }
+    if (idx < 0) {
+      throw std::runtime_error("fei::Matrix_Local::sumInLocal ERROR, row not found.");
+    }
+
+    int offset = sparseRowGraph_->rowOffsets[idx];
+    int len = sparseRowGraph_->rowOffsets[idx+1] - offset;
+
+    const int* rowLIDs = &lidColIndices_[offset];
+    double* coefs = &(coefs_[offset]);
+
+    //scatter the row's positions into the local column table, look up the
+    //incoming columns, then clear the table for the next row.
+    for(int k=0; k<len; ++k) {
+      if (rowLIDs[k] >= 0) colPositions[rowLIDs[k]] = k;
+    }
+
+    bool found = true;
+    for(int j=0; j<numCols; ++j) {
+      int pos = colPositions[localCols[j]];
+      if (pos < 0) {
+        found = false;
+        break;
+      }
+
+      if (sumInto) {
+        coefs[pos] += myvalues[i][j];
+      }
+      else {
+        coefs[pos] = myvalues[i][j];
+      }
+    }
+
+    for(int k=0; k<len; ++k) {
+      if (rowLIDs[k] >= 0) colPositions[rowLIDs[k]] = -1;
+    }
+
+    if (!found) {
+      throw std::runtime_error("fei::Matrix_Local::sumInLocal ERROR, col not found.");
+    }
+  }
+
+  stateChanged_ = true;
+  return(0);
+}
+
 int
 Matrix_Local::sumInFieldData(int fieldID,
                                int idType,
@@ -205,7 +352,7 @@ Matrix_Local::sumInFieldData(int fieldID,
   fei::SharedPtr<fei::VectorSpace> cspace = matrixGraph_->getColSpace();
 
   int fieldSize = (int)rspace->getFieldSize(fieldID);
-  std::vector<int> indices(2*fieldSize);
+  std::vector<GlobalOrdinal> indices(2*fieldSize);
 
   rspace->getGlobalIndex(idType, rowID, fieldID, indices[0]);
   for(int i=1; i<fieldSize; ++i) {
@@ -250,7 +397,7 @@ Matrix_Local::sumIn(int blockID, int connectivityID,
                     int format)
 {
   int numIndices = matrixGraph_->getConnectivityNumIndices(blockID);
-  std::vector<int> indices(numIndices);
+  std::vector<GlobalOrdinal> indices(numIndices);
 
   matrixGraph_->getConnectivityIndices(blockID, connectivityID,
                                        numIndices, &indices[0], numIndices);
@@ -267,8 +414,77 @@ int
 Matrix_Local::multiply(fei::Vector* x,
                        fei::Vector* y)
 {
-  FEI_COUT << "fei::Matrix_Local::multiply NOT IMPLEMENTED."<<FEI_ENDL;
-  return(-1);
+  fei::Vector_Local* lx = dynamic_cast<fei::Vector_Local*>(x);
+  fei::Vector_Local* ly = dynamic_cast<fei::Vector_Local*>(y);
+  if (lx == NULL || ly == NULL) {
+    fei::console_out() << "fei::Matrix_Local::multiply ERROR, x and y must "
+       << "be fei::Vector_Local objects."<<FEI_ENDL;
+    return(-1);
+  }
+
+  CHK_ERR( setupMultiply(*lx, *ly) );
+
+  std::vector<double>& xcoefs = lx->getCoefs();
+  std::vector<double>& ycoefs = ly->getCoefs();
+
+  int numRows = getLocalNumRows();
+  work_data1D_.resize(numRows);
+
+  if (numRows > 0 && !coefs_.empty()) {
+    const int* rowOffsets = &(sparseRowGraph_->rowOffsets[0]);
+    fei::impl_utils::csr_matvec(numRows, rowOffsets, rowOffsets+1,
+                                &localColIndices_[0], &coefs_[0],
+                                &xcoefs[0], false, &work_data1D_[0]);
+  }
+  else {
+    std::fill(work_data1D_.begin(), work_data1D_.end(), 0.0);
+  }
+
+  std::fill(ycoefs.begin(), ycoefs.end(), 0.0);
+  for(int i=0; i<numRows; ++i) {
+    ycoefs[localRowIndices_[i]] = work_data1D_[i];
+  }
+
+  return(0);
+}
+
+int
+Matrix_Local::setupMultiply(fei::Vector_Local& x, fei::Vector_Local& y)
+{
+  const fei::VectorSpace* colSpace = x.getVectorSpace().get();
+  const fei::VectorSpace* rowSpace = y.getVectorSpace().get();
+
+  if (colSpace != multiplyColSpace_) {
+    std::vector<GlobalOrdinal>& cols = sparseRowGraph_->packedColumnIndices;
+    localColIndices_.resize(cols.size());
+    for(size_t i=0; i<cols.size(); ++i) {
+      localColIndices_[i] = x.getLocalIndex(cols[i]);
+      if (localColIndices_[i] < 0) {
+        fei::console_out() << "fei::Matrix_Local::multiply ERROR, column "
+           << cols[i] << " not found in x."<<FEI_ENDL;
+        multiplyColSpace_ = NULL;
+        return(-1);
+      }
+    }
+    multiplyColSpace_ = colSpace;
+  }
+
+  if (rowSpace != multiplyRowSpace_) {
+    std::vector<GlobalOrdinal>& rows = sparseRowGraph_->rowNumbers;
+    localRowIndices_.resize(rows.size());
+    for(size_t i=0; i<rows.size(); ++i) {
+      localRowIndices_[i] = y.getLocalIndex(rows[i]);
+      if (localRowIndices_[i] < 0) {
+        fei::console_out() << "fei::Matrix_Local::multiply ERROR, row "
+           << rows[i] << " not found in y."<<FEI_ENDL;
+        multiplyRowSpace_ = NULL;
+        return(-1);
+      }
+    }
+    multiplyRowSpace_ = rowSpace;
+  }
+
+  return(0);
 }
 
 void
@@ -323,9 +539,9 @@ Matrix_Local::writeToStream(FEI_OSTREAM& ostrm,
     ostrm << numRows << " " << numCols << " "<< FEI_ENDL;
   }
 
-  std::vector<int>& rowNumbers = sparseRowGraph_->rowNumbers;
+  std::vector<GlobalOrdinal>& rowNumbers = sparseRowGraph_->rowNumbers;
   std::vector<int>& rowOffsets = sparseRowGraph_->rowOffsets;
-  std::vector<int>& colIndices = sparseRowGraph_->packedColumnIndices;
+  std::vector<GlobalOrdinal>& colIndices = sparseRowGraph_->packedColumnIndices;
 
   ostrm.setf(IOS_SCIENTIFIC, IOS_FLOATFIELD);
   ostrm.precision(13);
@@ -364,7 +580,75 @@ bool
 Matrix_Local::changedSinceMark()
 { return(stateChanged_); }
 
-const std::vector<int>&
+int
+Matrix_Local::eliminateEssentialBCs(int numBCEqns,
+                                    const GlobalOrdinal* bcEqns,
+                                    const double* bcValues,
+                                    bool modifyColumns,
+                                    std::vector<GlobalOrdinal>& rhsRows,
+                                    std::vector<double>& rhsCoefs)
+{
+  std::vector<GlobalOrdinal>& rowNumbers = sparseRowGraph_->rowNumbers;
+  int numRows = rowNumbers.size();
+  if (numRows < 1 || coefs_.empty()) return(0);
+
+  std::vector<double> rhsContribs(numRows);
+  fei::impl_utils::apply_essential_bcs_csr(numRows, &rowNumbers[0],
+                                   &(sparseRowGraph_->rowOffsets[0]),
+                                   &(sparseRowGraph_->packedColumnIndices[0]),
+                                   &coefs_[0],
+                                   numBCEqns, bcEqns, bcValues,
+                                   modifyColumns, &rhsContribs[0]);
+
+  for(int i=0; i<numRows; ++i) {
+    if (rhsContribs[i] != 0.0) {
+      rhsRows.push_back(rowNumbers[i]);
+      rhsCoefs.push_back(rhsContribs[i]);
+    }
+  }
+
+  stateChanged_ = true;
+  return(0);
+}
+
+double*
+Matrix_Local::getBeginPointer()
+{
+  return( coefs_.empty() ? NULL : &coefs_[0] );
+}
+
+void
+Matrix_Local::markCoefsChanged()
+{
+  stateChanged_ = true;
+}
+
+int
+Matrix_Local::getCoefOffsets(int numRows, const GlobalOrdinal* rows,
+                             int numCols, const GlobalOrdinal* cols,
+                             int* offsets)
+{
+  for(int i=0; i<numRows; ++i) {
+    int idx = getRowIndex(rows[i]);
+    if (idx < 0) return(-1);
+
+    int offset = sparseRowGraph_->rowOffsets[idx];
+    int len = sparseRowGraph_->rowOffsets[idx+1] - offset;
+    const GlobalOrdinal* colInds =
+      &(sparseRowGraph_->packedColumnIndices[offset]);
+
+    for(int j=0; j<numCols; ++j) {
+      int idx2 = fei::binarySearch(cols[j], colInds, len);
+      if (idx2 < 0) return(-1);
+
+      offsets[i*numCols+j] = offset + idx2;
+    }
+  }
+
+  return(0);
+}
+
+const std::vector<GlobalOrdinal>&
 Matrix_Local::getRowNumbers() const
 { return( sparseRowGraph_->rowNumbers ); }
 
@@ -372,7 +656,7 @@ const std::vector<int>&
 Matrix_Local::getRowOffsets() const
 { return( sparseRowGraph_->rowOffsets ); }
 
-const std::vector<int>&
+const std::vector<GlobalOrdinal>&
 Matrix_Local::getColumnIndices() const
 { return( sparseRowGraph_->packedColumnIndices ); }
 
@@ -13,6 +13,7 @@
 #include <fei_MatrixGraph.hpp>
 #include <fei_Matrix.hpp>
 #include <fei_SparseRowGraph.hpp>
+#include <fei_Vector_Local.hpp>
 
 #include <vector>
 
@@ -57,7 +58,7 @@ class Matrix_Local : public fei::Matrix {
        @param length Output. Length of the row.
        @return error-code non-zero if any error occurs.
    */
-    int getRowLength(int row, int& length) const;
+    int getRowLength(GlobalOrdinal row, int& length) const;
 
     /** Set a specified scalar throughout the matrix. */
     int putScalar(double scalar);
@@ -71,7 +72,8 @@ class Matrix_Local : public fei::Matrix {
        @param len Length of the caller-allocated coefs and indices arrays
        @return error-code non-zero if any error occurs.
    */
-    int copyOutRow(int row, int len, double* coefs, int* indices) const;
+    int copyOutRow(GlobalOrdinal row, int len,
+                   double* coefs, GlobalOrdinal* indices) const;
 
     /** Sum coefficients into the matrix, adding them to any coefficients that
         may already exist at the specified row/column locations.
@@ -85,8 +87,8 @@ class Matrix_Local : public fei::Matrix {
         0 means row-wise or row-major, 3 means column-major.
         Others not recognized
      */
-    int sumIn(int numRows, const int* rows,
-                      int numCols, const int* cols,
+    int sumIn(int numRows, const GlobalOrdinal* rows,
+                      int numCols, const GlobalOrdinal* cols,
                       const double* const* values,
                       int format=0);
 
@@ -102,11 +104,29 @@ class Matrix_Local : public fei::Matrix {
         0 means row-wise or row-major, 3 means column-major.
         Others not recognized
     */
-    int copyIn(int numRows, const int* rows,
-                       int numCols, const int* cols,
+    int copyIn(int numRows, const GlobalOrdinal* rows,
+                       int numCols, const GlobalOrdinal* cols,
                        const double* const* values,
                       int format=0);
 
+    /** Sum coefficients into the matrix, with rows and columns specified by
+        local indices (see fei::Matrix::sumInLocal). Rows and columns are
+        found through local-index tables built on first use, rather than by
+        searching the row numbers and column-indices.
+    */
+    int sumInLocal(int numRows, const int* localRows,
+                   int numCols, const int* localCols,
+                   const double* const* values,
+                   int format=0);
+
+    /** Copy coefficients into the matrix, with rows and columns specified by
+        local indices.
+    */
+    int copyInLocal(int numRows, const int* localRows,
+                    int numCols, const int* localCols,
+                    const double* const* values,
+                    int format=0);
+
     /** Sum coefficients into the matrix, specifying row/column locations by
         identifier/fieldID pairs.
         @param fieldID Input. field-identifier for which data is being input.
@@ -173,6 +193,9 @@ class Matrix_Local : public fei::Matrix {
     int globalAssemble();
 
     /** Form a matrix-vector product y = 'this' * x
+        x and y must be fei::Vector_Local objects, and every column of this
+        matrix must be held locally in x. Entries of y that aren't rows of
+        this matrix are set to zero.
      */
     int multiply(fei::Vector* x,
                          fei::Vector* y);
@@ -235,28 +258,71 @@ class Matrix_Local : public fei::Matrix {
     */
     bool changedSinceMark();
 
-    const std::vector<int>& getRowNumbers() const;
+    /** Implementation of fei::Matrix::eliminateEssentialBCs */
+    int eliminateEssentialBCs(int numBCEqns,
+                              const GlobalOrdinal* bcEqns,
+                              const double* bcValues,
+                              bool modifyColumns,
+                              std::vector<GlobalOrdinal>& rhsRows,
+                              std::vector<double>& rhsCoefs);
+
+    double* getBeginPointer();
+
+    /** Implementation of fei::Matrix::markCoefsChanged */
+    void markCoefsChanged();
+
+    /** Implementation of fei::Matrix::getCoefOffsets */
+    int getCoefOffsets(int numRows, const GlobalOrdinal* rows,
+                       int numCols, const GlobalOrdinal* cols,
+                       int* offsets);
+
+    const std::vector<GlobalOrdinal>& getRowNumbers() const;
 
     const std::vector<int>& getRowOffsets() const;
 
-    const std::vector<int>& getColumnIndices() const;
+    const std::vector<GlobalOrdinal>& getColumnIndices() const;
 
     const std::vector<double>& getCoefs() const;
 
  private:
-  int getRowIndex(int rowNumber) const;
+  int getRowIndex(GlobalOrdinal rowNumber) const;
+
+  int setupMultiply(fei::Vector_Local& x, fei::Vector_Local& y);
 
-  int giveToMatrix(int numRows, const int* rows,
-                      int numCols, const int* cols,
+  int giveToMatrix(int numRows, const GlobalOrdinal* rows,
+                      int numCols, const GlobalOrdinal* cols,
                       const double* const* values,
                       bool sumInto, int format);
 
+  int giveToMatrixLocal(int numRows, const int* localRows,
+                        int numCols, const int* localCols,
+                        const double* const* values,
+                        bool sumInto, int format);
+
+  void setupLocalIndices();
+
   fei::SharedPtr<fei::MatrixGraph> matrixGraph_;
   fei::SharedPtr<fei::SparseRowGraph> sparseRowGraph_;
   std::vector<double> coefs_;
   bool stateChanged_;
   std::vector<double> work_data1D_;
   std::vector<const double*> work_data2D_;
+
+  //positions in the Vector_Local coefficient arrays of this matrix's
+  //columns and rows, for the vector-spaces last passed to multiply().
+  const fei::VectorSpace* multiplyColSpace_;
+  const fei::VectorSpace* multiplyRowSpace_;
+  std::vector<int> localColIndices_;
+  std::vector<int> localRowIndices_;
+
+  //position in rowNumbers of each local index of the row-space (-1 for
+  //local indices that aren't rows of this matrix), and the column-space
+  //local index of each entry of packedColumnIndices. colPositions_ is
+  //indexed by column-space local index and holds -1 except while a row is
+  //being assembled in giveToMatrixLocal, when it holds positions in that row.
+  std::vector<int> lidRowIndices_;
+  std::vector<int> lidColIndices_;
+  std::vector<int> colPositions_;
 };//class Matrix_Local
 }//namespace fei
 
@@ -0,0 +1,762 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2007 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_ParameterSet.hpp>
+#include "fei_Matrix_LocalBlock.hpp"
+#include "fei_Matrix_core.hpp"
+#include "fei_VectorSpace.hpp"
+#include "fei_ConnectivityBlock.hpp"
+#include "fei_Pattern.hpp"
+#include "fei_CommUtils.hpp"
+#include "snl_fei_PointBlockMap.hpp"
+#include "fei_ArrayUtils.hpp"
+#include "fei_sstream.hpp"
+#include "fei_fstream.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#undef fei_file
+#define fei_file "fei_Matrix_LocalBlock.cpp"
+#include "fei_ErrMacros.hpp"
+
+namespace fei {
+
+//y = A*x for block-rows whose blocks are all N-by-N. The y-block is kept
+//in N accumulators across the row, and the block loops are unrolled.
+template<int N>
+void uniform_blk_matvec(int numBlkRows, const int* rowOffsets,
+                        const int* localRows, const int* localCols,
+                        const double* coefs, const double* x, double* y)
+{
+  for(int i=0; i<numBlkRows; ++i) {
+    double sums[N];
+    for(int r=0; r<N; ++r) sums[r] = 0.0;
+
+    const double* blk = coefs + rowOffsets[i]*N*N;
+    for(int k=rowOffsets[i]; k<rowOffsets[i+1]; ++k) {
+      const double* xblk = x + localCols[k];
+      double xvals[N];
+      for(int c=0; c<N; ++c) xvals[c] = xblk[c];
+
+      for(int r=0; r<N; ++r) {
+        for(int c=0; c<N; ++c) {
+          sums[r] += blk[r*N+c]*xvals[c];
+        }
+      }
+      blk += N*N;
+    }
+
+    double* yblk = y + localRows[i];
+    for(int r=0; r<N; ++r) yblk[r] = sums[r];
+  }
+}
+
+//----------------------------------------------------------------------------
+Matrix_LocalBlock::Matrix_LocalBlock(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
+                                     fei::SharedPtr<fei::SparseRowGraph> blkGraph)
+ : matrixGraph_(matrixGraph),
+   blkGraph_(blkGraph),
+   rowPtBlkMap_(NULL),
+   colPtBlkMap_(NULL),
+   rowPtEqns_(),
+   rowSizes_(),
+   colPtEqns_(),
+   colSizes_(),
+   blkOffsets_(),
+   coefs_(),
+   numPtRows_(0),
+   uniformBlkSize_(0),
+   stateChanged_(false),
+   work_ptIndices_(),
+   work_blkIndices_(),
+   multiplyColSpace_(NULL),
+   multiplyRowSpace_(NULL),
+   localColIndices_(),
+   localRowIndices_()
+{
+  fei::SharedPtr<fei::VectorSpace> rspace = matrixGraph_->getRowSpace();
+  fei::SharedPtr<fei::VectorSpace> cspace = matrixGraph_->getColSpace();
+  if (cspace.get() == NULL) cspace = rspace;
+
+  rowPtBlkMap_ = rspace->getPointBlockMap();
+  colPtBlkMap_ = cspace->getPointBlockMap();
+
+  std::vector<GlobalOrdinal>& rowNumbers = blkGraph_->rowNumbers;
+  std::vector<int>& rowOffsets = blkGraph_->rowOffsets;
+  std::vector<GlobalOrdinal>& colIndices = blkGraph_->packedColumnIndices;
+
+  int numRows = rowNumbers.size();
+  rowPtEqns_.resize(numRows);
+  rowSizes_.resize(numRows);
+  for(int i=0; i<numRows; ++i) {
+    if (rowPtBlkMap_->getBlkEqnInfo(rowNumbers[i], rowPtEqns_[i],
+                                    rowSizes_[i]) != 0) {
+      throw std::runtime_error("fei::Matrix_LocalBlock ERROR, block-row not found in point-block map.");
+    }
+    numPtRows_ += rowSizes_[i];
+  }
+
+  int numBlks = colIndices.size();
+  colPtEqns_.resize(numBlks);
+  colSizes_.resize(numBlks);
+  blkOffsets_.resize(numBlks+1);
+  blkOffsets_[0] = 0;
+  for(int i=0; i<numRows; ++i) {
+    for(int k=rowOffsets[i]; k<rowOffsets[i+1]; ++k) {
+      if (colPtBlkMap_->getBlkEqnInfo(colIndices[k], colPtEqns_[k],
+                                      colSizes_[k]) != 0) {
+        throw std::runtime_error("fei::Matrix_LocalBlock ERROR, block-col not found in point-block map.");
+      }
+      blkOffsets_[k+1] = blkOffsets_[k] + rowSizes_[i]*colSizes_[k];
+    }
+  }
+
+  coefs_.assign(blkOffsets_[numBlks], 0.0);
+
+  if (numRows > 0) {
+    uniformBlkSize_ = rowSizes_[0];
+    for(int i=0; i<numRows; ++i) {
+      if (rowSizes_[i] != uniformBlkSize_) uniformBlkSize_ = 0;
+    }
+    for(int k=0; k<numBlks; ++k) {
+      if (colSizes_[k] != uniformBlkSize_) uniformBlkSize_ = 0;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+Matrix_LocalBlock::~Matrix_LocalBlock()
+{
+}
+
+//----------------------------------------------------------------------------
+fei::SharedPtr<fei::Matrix>
+Matrix_LocalBlock::create_Matrix_LocalBlock(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
+{
+  fei::SharedPtr<fei::SparseRowGraph> srg =
+    matrixGraph->createGraph(true, true);
+  fei::SharedPtr<fei::Matrix> mat(new fei::Matrix_LocalBlock(matrixGraph, srg));
+  return(mat);
+}
+
+//----------------------------------------------------------------------------
+const char*
+Matrix_LocalBlock::typeName()
+{ return( "fei::Matrix_LocalBlock" ); }
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::parameters(const fei::ParameterSet& /*paramset*/)
+{
+  return(0);
+}
+
+fei::SharedPtr<fei::MatrixGraph>
+Matrix_LocalBlock::getMatrixGraph() const
+{ return( matrixGraph_ ); }
+
+void
+Matrix_LocalBlock::setMatrixGraph(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
+{ matrixGraph_ = matrixGraph; }
+
+int
+Matrix_LocalBlock::getGlobalNumRows() const
+{ return( numPtRows_ ); }
+
+int
+Matrix_LocalBlock::getLocalNumRows() const
+{ return( numPtRows_ ); }
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::getBlkRowIndex(GlobalOrdinal blkRow) const
+{
+  const std::vector<GlobalOrdinal>& rows = blkGraph_->rowNumbers;
+  if (rows.empty()) return(-1);
+  return( fei::binarySearch(blkRow, &rows[0], rows.size()) );
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::getBlkIndex(int blkRowIndex, GlobalOrdinal blkCol) const
+{
+  int offset = blkGraph_->rowOffsets[blkRowIndex];
+  int len = blkGraph_->rowOffsets[blkRowIndex+1] - offset;
+  if (len < 1) return(-1);
+
+  const GlobalOrdinal* colInds = &(blkGraph_->packedColumnIndices[offset]);
+  int idx = fei::binarySearch(blkCol, colInds, len);
+  return( idx < 0 ? -1 : offset+idx );
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::getPointOffset(GlobalOrdinal ptRow,
+                                  GlobalOrdinal ptCol) const
+{
+  GlobalOrdinal blkRow = -1;
+  int rowOffset = -1;
+  if (rowPtBlkMap_->getPtEqnInfo(ptRow, blkRow, rowOffset) != 0) return(-1);
+
+  GlobalOrdinal blkCol = -1;
+  int colOffset = -1;
+  if (colPtBlkMap_->getPtEqnInfo(ptCol, blkCol, colOffset) != 0) return(-1);
+
+  int i = getBlkRowIndex(blkRow);
+  if (i < 0) return(-1);
+
+  int k = getBlkIndex(i, blkCol);
+  if (k < 0) return(-1);
+
+  return( blkOffsets_[k] + rowOffset*colSizes_[k] + colOffset );
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::getRowLength(GlobalOrdinal row, int& length) const
+{
+  GlobalOrdinal blkRow = -1;
+  int rowOffset = -1;
+  if (rowPtBlkMap_->getPtEqnInfo(row, blkRow, rowOffset) != 0) return(-1);
+
+  int i = getBlkRowIndex(blkRow);
+  if (i < 0) return(i);
+
+  length = 0;
+  for(int k=blkGraph_->rowOffsets[i]; k<blkGraph_->rowOffsets[i+1]; ++k) {
+    length += colSizes_[k];
+  }
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::putScalar(double scalar)
+{
+  std::fill(coefs_.begin(), coefs_.end(), scalar);
+  stateChanged_ = true;
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::copyOutRow(GlobalOrdinal row, int len,
+                              double* coefs, GlobalOrdinal* indices) const
+{
+  GlobalOrdinal blkRow = -1;
+  int rowOffset = -1;
+  if (rowPtBlkMap_->getPtEqnInfo(row, blkRow, rowOffset) != 0) return(-1);
+
+  int i = getBlkRowIndex(blkRow);
+  if (i < 0) return(i);
+
+  int j = 0;
+  for(int k=blkGraph_->rowOffsets[i]; k<blkGraph_->rowOffsets[i+1]; ++k) {
+    const double* blkRowCoefs = &coefs_[blkOffsets_[k] + rowOffset*colSizes_[k]];
+    for(int c=0; c<colSizes_[k] && j<len; ++c, ++j) {
+      indices[j] = colPtEqns_[k] + c;
+      coefs[j] = blkRowCoefs[c];
+    }
+  }
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::giveToMatrix(int numRows, const GlobalOrdinal* rows,
+                                int numCols, const GlobalOrdinal* cols,
+                                const double* const* values,
+                                bool sumInto,
+                                int format)
+{
+  if (numRows == 0 || numCols == 0) {
+    return(0);
+  }
+
+  if (format != FEI_DENSE_ROW && format != FEI_DENSE_COL) {
+    return(-1);
+  }
+
+  for(int i=0; i<numRows; ++i) {
+    for(int j=0; j<numCols; ++j) {
+      int offset = getPointOffset(rows[i], cols[j]);
+      if (offset < 0) {
+        throw std::runtime_error("fei::Matrix_LocalBlock::sumIn ERROR, position not found.");
+      }
+
+      double value = format == FEI_DENSE_ROW ? values[i][j] : values[j][i];
+      if (sumInto) {
+        coefs_[offset] += value;
+      }
+      else {
+        coefs_[offset] = value;
+      }
+    }
+  }
+
+  stateChanged_ = true;
+  return(0);
+}
+
+int
+Matrix_LocalBlock::sumIn(int numRows, const GlobalOrdinal* rows,
+                         int numCols, const GlobalOrdinal* cols,
+                         const double* const* values,
+                         int format)
+{
+  return( giveToMatrix(numRows, rows, numCols, cols, values,
+                       true, format) );
+}
+
+int
+Matrix_LocalBlock::copyIn(int numRows, const GlobalOrdinal* rows,
+                          int numCols, const GlobalOrdinal* cols,
+                          const double* const* values,
+                          int format)
+{
+  return( giveToMatrix(numRows, rows, numCols, cols, values,
+                       false, format) );
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::sumInFieldData(int fieldID,
+                                  int idType,
+                                  int rowID,
+                                  int colID,
+                                  const double* const* data,
+                                  int format)
+{
+  fei::SharedPtr<fei::VectorSpace> rspace = matrixGraph_->getRowSpace();
+  fei::SharedPtr<fei::VectorSpace> cspace = matrixGraph_->getColSpace();
+  if (cspace.get() == NULL) cspace = rspace;
+
+  int fieldSize = (int)rspace->getFieldSize(fieldID);
+  std::vector<GlobalOrdinal> indices(2*fieldSize);
+
+  rspace->getGlobalIndex(idType, rowID, fieldID, indices[0]);
+  for(int i=1; i<fieldSize; ++i) {
+    indices[i] = indices[0]+i;
+  }
+
+  cspace->getGlobalIndex(idType, colID, fieldID, indices[fieldSize]);
+  for(int i=1; i<fieldSize; ++i) {
+    indices[fieldSize+i] = indices[fieldSize]+i;
+  }
+
+  return( giveToMatrix(fieldSize, &indices[0], fieldSize, &indices[fieldSize],
+                       data, true, format) );
+}
+
+int
+Matrix_LocalBlock::sumInFieldData(int fieldID,
+                                  int idType,
+                                  int rowID,
+                                  int colID,
+                                  const double* data,
+                                  int format)
+{
+  fei::SharedPtr<fei::VectorSpace> rspace = matrixGraph_->getRowSpace();
+
+  int fieldSize = (int)rspace->getFieldSize(fieldID);
+  std::vector<const double*> data2D(fieldSize);
+
+  int offset = 0;
+  for(int i=0; i<fieldSize; ++i) {
+    data2D[i] = &data[offset];
+    offset += fieldSize;
+  }
+
+  return( sumInFieldData(fieldID, idType, rowID, colID,
+                         &data2D[0], format) );
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::sumIn(int blockID, int connectivityID,
+                         const double* const* values,
+                         int format)
+{
+  if (format != FEI_DENSE_ROW && format != FEI_DENSE_COL) {
+    return(-1);
+  }
+
+  const fei::ConnectivityBlock* cblock =
+    matrixGraph_->getConnectivityBlock(blockID);
+  if (cblock == NULL) {
+    FEI_OSTRINGSTREAM osstr;
+    osstr << "fei::Matrix_LocalBlock::sumIn ERROR, unable to "
+          << "look up connectivity-block with ID "<<blockID;
+    throw std::runtime_error(osstr.str());
+  }
+
+  if (!cblock->isSymmetric()) {
+    //rectangular element matrices go through the point-entry path.
+    int numRowIndices = 0, numColIndices = 0;
+    CHK_ERR( matrixGraph_->getConnectivityNumIndices(blockID, numRowIndices,
+                                                     numColIndices) );
+    std::vector<GlobalOrdinal> rowIndices(numRowIndices);
+    std::vector<GlobalOrdinal> colIndices(numColIndices);
+    CHK_ERR( matrixGraph_->getConnectivityIndices(blockID, connectivityID,
+                                                  numRowIndices, &rowIndices[0],
+                                                  numRowIndices,
+                                                  numColIndices, &colIndices[0],
+                                                  numColIndices) );
+    return( giveToMatrix(numRowIndices, &rowIndices[0],
+                         numColIndices, &colIndices[0],
+                         values, true, format) );
+  }
+
+  const fei::Pattern* pattern = cblock->getRowPattern();
+  const int* rowConn = cblock->getRowConnectivity(connectivityID);
+  int numIDs = pattern->getNumIDs();
+  const int* indicesPerID = pattern->getNumIndicesPerID();
+
+  fei::SharedPtr<fei::VectorSpace> rspace = matrixGraph_->getRowSpace();
+  rspace->getGlobalIndicesL(pattern, rowConn, work_ptIndices_);
+
+  work_blkIndices_.resize(2*numIDs);
+  int* blkIndices = &work_blkIndices_[0];
+  int* blkRows = blkIndices+numIDs;
+  int numBlkIndices = 0;
+  rspace->getGlobalBlkIndicesL(numIDs, pattern->getRecordCollections(),
+                               rowConn, numIDs, blkIndices, numBlkIndices);
+
+  for(int i=0; i<numIDs; ++i) {
+    blkRows[i] = getBlkRowIndex(blkIndices[i]);
+    if (blkRows[i] < 0) {
+      throw std::runtime_error("fei::Matrix_LocalBlock::sumIn ERROR, row not found.");
+    }
+  }
+
+  const GlobalOrdinal* ptIndices = &work_ptIndices_[0];
+
+  int ri = 0;
+  for(int i=0; i<numIDs; ++i) {
+    int blkRowIndex = blkRows[i];
+    GlobalOrdinal rowPtEqn = rowPtEqns_[blkRowIndex];
+
+    int cj = 0;
+    for(int j=0; j<numIDs; ++j) {
+      //the same mesh-object in row- and column-space, so the column
+      //block-eqn is the row's block-eqn.
+      int k = getBlkIndex(blkRowIndex, blkIndices[j]);
+      if (k < 0) {
+        throw std::runtime_error("fei::Matrix_LocalBlock::sumIn ERROR, col not found.");
+      }
+
+      double* blk = &coefs_[blkOffsets_[k]];
+      int colSize = colSizes_[k];
+      GlobalOrdinal colPtEqn = colPtEqns_[k];
+
+      for(int r=0; r<indicesPerID[i]; ++r) {
+        double* blkRow = blk + (ptIndices[ri+r]-rowPtEqn)*colSize;
+        for(int c=0; c<indicesPerID[j]; ++c) {
+          double value = format == FEI_DENSE_ROW ?
+            values[ri+r][cj+c] : values[cj+c][ri+r];
+          blkRow[ptIndices[cj+c]-colPtEqn] += value;
+        }
+      }
+
+      cj += indicesPerID[j];
+    }
+
+    ri += indicesPerID[i];
+  }
+
+  stateChanged_ = true;
+  return(0);
+}
+
+int
+Matrix_LocalBlock::globalAssemble()
+{ return(0); }
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::multiply(fei::Vector* x,
+                            fei::Vector* y)
+{
+  fei::Vector_Local* lx = dynamic_cast<fei::Vector_Local*>(x);
+  fei::Vector_Local* ly = dynamic_cast<fei::Vector_Local*>(y);
+  if (lx == NULL || ly == NULL) {
+    fei::console_out() << "fei::Matrix_LocalBlock::multiply ERROR, x and y "
+       << "must be fei::Vector_Local objects."<<FEI_ENDL;
+    return(-1);
+  }
+
+  CHK_ERR( setupMultiply(*lx, *ly) );
+
+  std::vector<double>& xvec = lx->getCoefs();
+  std::vector<double>& yvec = ly->getCoefs();
+  std::fill(yvec.begin(), yvec.end(), 0.0);
+  if (coefs_.empty()) return(0);
+
+  const double* xcoefs = &xvec[0];
+  double* ycoefs = &yvec[0];
+  const double* coefs = &coefs_[0];
+  const int* rowOffsets = &(blkGraph_->rowOffsets[0]);
+  const int* localRows = rowSizes_.empty() ? NULL : &localRowIndices_[0];
+  const int* localCols = &localColIndices_[0];
+  const int numBlkRows = rowSizes_.size();
+
+  switch(uniformBlkSize_) {
+  case 1: uniform_blk_matvec<1>(numBlkRows, rowOffsets, localRows, localCols,
+                                coefs, xcoefs, ycoefs); return(0);
+  case 2: uniform_blk_matvec<2>(numBlkRows, rowOffsets, localRows, localCols,
+                                coefs, xcoefs, ycoefs); return(0);
+  case 3: uniform_blk_matvec<3>(numBlkRows, rowOffsets, localRows, localCols,
+                                coefs, xcoefs, ycoefs); return(0);
+  case 4: uniform_blk_matvec<4>(numBlkRows, rowOffsets, localRows, localCols,
+                                coefs, xcoefs, ycoefs); return(0);
+  case 5: uniform_blk_matvec<5>(numBlkRows, rowOffsets, localRows, localCols,
+                                coefs, xcoefs, ycoefs); return(0);
+  case 6: uniform_blk_matvec<6>(numBlkRows, rowOffsets, localRows, localCols,
+                                coefs, xcoefs, ycoefs); return(0);
+  default: break;
+  }
+
+  const int* blkOffsets = &blkOffsets_[0];
+  const int* colSizes = &colSizes_[0];
+
+  for(int i=0; i<numBlkRows; ++i) {
+    const int rowSize = rowSizes_[i];
+    double* yblk = ycoefs + localRows[i];
+
+    for(int k=rowOffsets[i]; k<rowOffsets[i+1]; ++k) {
+      const double* blk = coefs + blkOffsets[k];
+      const double* xblk = xcoefs + localCols[k];
+      const int colSize = colSizes[k];
+
+      for(int r=0; r<rowSize; ++r) {
+        double sum = 0.0;
+        for(int c=0; c<colSize; ++c) {
+          sum += blk[c]*xblk[c];
+        }
+        yblk[r] += sum;
+        blk += colSize;
+      }
+    }
+  }
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::setupMultiply(fei::Vector_Local& x, fei::Vector_Local& y)
+{
+  const fei::VectorSpace* colSpace = x.getVectorSpace().get();
+  const fei::VectorSpace* rowSpace = y.getVectorSpace().get();
+
+  //a block's point-equations are consecutive, so the block is contiguous in
+  //a Vector_Local if its first and last point-equations are both present.
+  if (colSpace != multiplyColSpace_) {
+    localColIndices_.resize(colPtEqns_.size());
+    for(size_t k=0; k<colPtEqns_.size(); ++k) {
+      int first = x.getLocalIndex(colPtEqns_[k]);
+      int last = x.getLocalIndex(colPtEqns_[k]+colSizes_[k]-1);
+      if (first < 0 || last-first != colSizes_[k]-1) {
+        fei::console_out() << "fei::Matrix_LocalBlock::multiply ERROR, column "
+           << colPtEqns_[k] << " not found in x."<<FEI_ENDL;
+        multiplyColSpace_ = NULL;
+        return(-1);
+      }
+      localColIndices_[k] = first;
+    }
+    multiplyColSpace_ = colSpace;
+  }
+
+  if (rowSpace != multiplyRowSpace_) {
+    localRowIndices_.resize(rowPtEqns_.size());
+    for(size_t i=0; i<rowPtEqns_.size(); ++i) {
+      int first = y.getLocalIndex(rowPtEqns_[i]);
+      int last = y.getLocalIndex(rowPtEqns_[i]+rowSizes_[i]-1);
+      if (first < 0 || last-first != rowSizes_[i]-1) {
+        fei::console_out() << "fei::Matrix_LocalBlock::multiply ERROR, row "
+           << rowPtEqns_[i] << " not found in y."<<FEI_ENDL;
+        multiplyRowSpace_ = NULL;
+        return(-1);
+      }
+      localRowIndices_[i] = first;
+    }
+    multiplyRowSpace_ = rowSpace;
+  }
+
+  return(0);
+}
+
+void
+Matrix_LocalBlock::setCommSizes()
+{
+}
+
+int
+Matrix_LocalBlock::gatherFromOverlap(bool accumulate)
+{
+  (void)accumulate;
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::writeToFile(const char* filename,
+                               bool matrixMarketFormat)
+{
+  fei::SharedPtr<fei::VectorSpace> vspace = matrixGraph_->getRowSpace();
+
+  MPI_Comm comm = vspace->getCommunicator();
+
+  int localProc = fei::localProc(comm);
+
+  FEI_OSTRINGSTREAM osstr;
+  osstr << filename << "." << localProc << ".mtx";
+  std::string fullname = osstr.str();
+
+  FEI_OFSTREAM ofstr(fullname.c_str(), IOS_OUT);
+
+  return( writeToStream(ofstr, matrixMarketFormat) );
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::writeToStream(FEI_OSTREAM& ostrm,
+                                 bool matrixMarketFormat)
+{
+  static char mmbanner[] = "%%MatrixMarket matrix coordinate real general";
+
+  fei::SharedPtr<fei::VectorSpace> cspace = matrixGraph_->getColSpace();
+  if (cspace.get() == NULL) cspace = matrixGraph_->getRowSpace();
+
+  int numCols = cspace->getEqnNumbers().size();
+  int nnz = coefs_.size();
+
+  if (matrixMarketFormat) {
+    ostrm << mmbanner << FEI_ENDL;
+    ostrm << numPtRows_ << " " << numCols << " " << nnz << FEI_ENDL;
+  }
+  else {
+    ostrm << numPtRows_ << " " << numCols << " "<< FEI_ENDL;
+  }
+
+  ostrm.setf(IOS_SCIENTIFIC, IOS_FLOATFIELD);
+  ostrm.precision(13);
+
+  int base = matrixMarketFormat ? 1 : 0;
+  std::vector<int>& rowOffsets = blkGraph_->rowOffsets;
+  for(size_t i=0; i<rowSizes_.size(); ++i) {
+    for(int r=0; r<rowSizes_[i]; ++r) {
+      GlobalOrdinal row = rowPtEqns_[i] + r;
+      for(int k=rowOffsets[i]; k<rowOffsets[i+1]; ++k) {
+        const double* blkRow = &coefs_[blkOffsets_[k] + r*colSizes_[k]];
+        for(int c=0; c<colSizes_[k]; ++c) {
+          ostrm << row+base << " " << colPtEqns_[k]+c+base
+             << " " << blkRow[c] << FEI_ENDL;
+        }
+      }
+    }
+  }
+
+  return(0);
+}
+
+bool
+Matrix_LocalBlock::usingBlockEntryStorage()
+{ return( true ); }
+
+void
+Matrix_LocalBlock::markState()
+{
+  stateChanged_ = false;
+}
+
+bool
+Matrix_LocalBlock::changedSinceMark()
+{ return(stateChanged_); }
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::eliminateEssentialBCs(int numBCEqns,
+                                         const GlobalOrdinal* bcEqns,
+                                         const double* bcValues,
+                                         bool modifyColumns,
+                                         std::vector<GlobalOrdinal>& rhsRows,
+                                         std::vector<double>& rhsCoefs)
+{
+  if (coefs_.empty() || numBCEqns < 1) return(0);
+
+  std::vector<int>& rowOffsets = blkGraph_->rowOffsets;
+
+  for(size_t i=0; i<rowSizes_.size(); ++i) {
+    for(int r=0; r<rowSizes_[i]; ++r) {
+      GlobalOrdinal row = rowPtEqns_[i] + r;
+      bool bcRow = fei::binarySearch(row, bcEqns, numBCEqns) >= 0;
+      if (!bcRow && !modifyColumns) continue;
+
+      double rhsContrib = 0.0;
+      for(int k=rowOffsets[i]; k<rowOffsets[i+1]; ++k) {
+        double* blkRow = &coefs_[blkOffsets_[k] + r*colSizes_[k]];
+        for(int c=0; c<colSizes_[k]; ++c) {
+          GlobalOrdinal col = colPtEqns_[k] + c;
+          if (bcRow) {
+            blkRow[c] = col == row ? 1.0 : 0.0;
+            continue;
+          }
+
+          int offset = fei::binarySearch(col, bcEqns, numBCEqns);
+          if (offset >= 0) {
+            rhsContrib -= blkRow[c]*bcValues[offset];
+            blkRow[c] = 0.0;
+          }
+        }
+      }
+
+      if (rhsContrib != 0.0) {
+        rhsRows.push_back(row);
+        rhsCoefs.push_back(rhsContrib);
+      }
+    }
+  }
+
+  stateChanged_ = true;
+  return(0);
+}
+
+double*
+Matrix_LocalBlock::getBeginPointer()
+{
+  return( coefs_.empty() ? NULL : &coefs_[0] );
+}
+
+void
+Matrix_LocalBlock::markCoefsChanged()
+{
+  stateChanged_ = true;
+}
+
+//----------------------------------------------------------------------------
+int
+Matrix_LocalBlock::getCoefOffsets(int numRows, const GlobalOrdinal* rows,
+                                  int numCols, const GlobalOrdinal* cols,
+                                  int* offsets)
+{
+  for(int i=0; i<numRows; ++i) {
+    for(int j=0; j<numCols; ++j) {
+      int offset = getPointOffset(rows[i], cols[j]);
+      if (offset < 0) return(-1);
+
+      offsets[i*numCols+j] = offset;
+    }
+  }
+
+  return(0);
+}
+
+}//namespace fei
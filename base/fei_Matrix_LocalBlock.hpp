@@ -0,0 +1,218 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2007 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#ifndef _fei_Matrix_LocalBlock_hpp_
+#define _fei_Matrix_LocalBlock_hpp_
+
+#include <fei_SharedPtr.hpp>
+#include <fei_MatrixGraph.hpp>
+#include <fei_Matrix.hpp>
+#include <fei_SparseRowGraph.hpp>
+#include <fei_Vector_Local.hpp>
+
+#include <vector>
+
+namespace fei {
+
+/** Local matrix with variable-block compressed-row storage.
+
+  This is the block-entry counterpart of fei::Matrix_Local. The structure
+  comes from the block-entry graph of a fei::MatrixGraph (one row and one
+  column per mesh-object, e.g. per node), and each nonzero block is a dense
+  rowSize-by-colSize array stored contiguously in row-major order. Block
+  sizes are the numbers of dofs at the row and column mesh-objects, as
+  given by the row vector-space's point-block map.
+
+  Only one column index is stored per block, so index storage is reduced
+  by the product of the block sizes compared with point-entry storage.
+  sumIn(blockID, connectivityID, ...) writes each node-node block of an
+  element matrix with a single search. The point-entry methods (sumIn
+  with equation numbers, copyOutRow, etc.) are also supported, but must
+  translate each equation to its block and offset.
+
+  Rows and columns of getBlkGraph() are global block-equation numbers.
+*/
+class Matrix_LocalBlock : public fei::Matrix {
+ public:
+  Matrix_LocalBlock(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
+                    fei::SharedPtr<fei::SparseRowGraph> blkGraph);
+
+  virtual ~Matrix_LocalBlock();
+
+  /** Create a Matrix_LocalBlock from the block-entry graph of matrixGraph,
+      including shared rows. */
+  static fei::SharedPtr<fei::Matrix>
+    create_Matrix_LocalBlock(fei::SharedPtr<fei::MatrixGraph> matrixGraph);
+
+  const char* typeName();
+
+  /** Method for supplying parameters
+  */
+  int parameters(const fei::ParameterSet& paramset);
+
+  fei::SharedPtr<fei::MatrixGraph> getMatrixGraph() const;
+
+  void setMatrixGraph(fei::SharedPtr<fei::MatrixGraph> matrixGraph);
+
+  /** Number of point-rows. */
+  int getGlobalNumRows() const;
+
+  /** Number of point-rows. */
+  int getLocalNumRows() const;
+
+  /** Length (number of point-entries) of point-row 'row'. */
+  int getRowLength(GlobalOrdinal row, int& length) const;
+
+  int putScalar(double scalar);
+
+  /** Copy out point-row 'row', with point column-indices. */
+  int copyOutRow(GlobalOrdinal row, int len,
+                 double* coefs, GlobalOrdinal* indices) const;
+
+  /** Sum point-entry coefficients into the matrix. rows and cols are
+      point-equation numbers. Throws std::runtime_error if a position isn't
+      in the matrix structure, as fei::Matrix_Local does.
+  */
+  int sumIn(int numRows, const GlobalOrdinal* rows,
+            int numCols, const GlobalOrdinal* cols,
+            const double* const* values,
+            int format=0);
+
+  /** Copy point-entry coefficients into the matrix. */
+  int copyIn(int numRows, const GlobalOrdinal* rows,
+             int numCols, const GlobalOrdinal* cols,
+             const double* const* values,
+             int format=0);
+
+  int sumInFieldData(int fieldID,
+                     int idType,
+                     int rowID,
+                     int colID,
+                     const double* const* data,
+                     int format=0);
+
+  int sumInFieldData(int fieldID,
+                     int idType,
+                     int rowID,
+                     int colID,
+                     const double* data,
+                     int format=0);
+
+  /** Sum an element matrix into the matrix, one node-node block at a time.
+      format may be FEI_DENSE_ROW or FEI_DENSE_COL.
+  */
+  int sumIn(int blockID, int connectivityID,
+            const double* const* values,
+            int format=0);
+
+  int globalAssemble();
+
+  /** Form y = 'this' * x. x and y must be fei::Vector_Local objects, and
+      every column of this matrix must be held locally in x. Entries of y
+      that aren't rows of this matrix are set to zero.
+  */
+  int multiply(fei::Vector* x,
+               fei::Vector* y);
+
+  void setCommSizes();
+
+  int gatherFromOverlap(bool accumulate = true);
+
+  int writeToFile(const char* filename,
+                  bool matrixMarketFormat=true);
+
+  int writeToStream(FEI_OSTREAM& ostrm,
+                    bool matrixMarketFormat=true);
+
+  /** Returns true. */
+  bool usingBlockEntryStorage();
+
+  void markState();
+
+  bool changedSinceMark();
+
+  /** Implementation of fei::Matrix::eliminateEssentialBCs */
+  int eliminateEssentialBCs(int numBCEqns,
+                            const GlobalOrdinal* bcEqns,
+                            const double* bcValues,
+                            bool modifyColumns,
+                            std::vector<GlobalOrdinal>& rhsRows,
+                            std::vector<double>& rhsCoefs);
+
+  double* getBeginPointer();
+
+  /** Implementation of fei::Matrix::markCoefsChanged */
+  void markCoefsChanged();
+
+  /** Implementation of fei::Matrix::getCoefOffsets. rows and cols are
+      point-equation numbers. */
+  int getCoefOffsets(int numRows, const GlobalOrdinal* rows,
+                     int numCols, const GlobalOrdinal* cols,
+                     int* offsets);
+
+  /** Block-entry structure. */
+  const fei::SparseRowGraph& getBlkGraph() const { return( *blkGraph_ ); }
+
+  /** Position in getCoefs() of each block (with the total number of
+      coefficients as the last entry). */
+  const std::vector<int>& getBlkOffsets() const { return( blkOffsets_ ); }
+
+  /** Point-size of each block-row. */
+  const std::vector<int>& getRowSizes() const { return( rowSizes_ ); }
+
+  /** Point-size of the column of each block. */
+  const std::vector<int>& getColSizes() const { return( colSizes_ ); }
+
+  const std::vector<double>& getCoefs() const { return( coefs_ ); }
+
+ private:
+  int getBlkRowIndex(GlobalOrdinal blkRow) const;
+
+  int getBlkIndex(int blkRowIndex, GlobalOrdinal blkCol) const;
+
+  int getPointOffset(GlobalOrdinal ptRow, GlobalOrdinal ptCol) const;
+
+  int setupMultiply(fei::Vector_Local& x, fei::Vector_Local& y);
+
+  int giveToMatrix(int numRows, const GlobalOrdinal* rows,
+                   int numCols, const GlobalOrdinal* cols,
+                   const double* const* values,
+                   bool sumInto, int format);
+
+  fei::SharedPtr<fei::MatrixGraph> matrixGraph_;
+  fei::SharedPtr<fei::SparseRowGraph> blkGraph_;
+  snl_fei::PointBlockMap* rowPtBlkMap_;
+  snl_fei::PointBlockMap* colPtBlkMap_;
+
+  //first point-equation and point-size of each block-row, and of the
+  //column of each block.
+  std::vector<GlobalOrdinal> rowPtEqns_;
+  std::vector<int> rowSizes_;
+  std::vector<GlobalOrdinal> colPtEqns_;
+  std::vector<int> colSizes_;
+
+  std::vector<int> blkOffsets_;
+  std::vector<double> coefs_;
+  int numPtRows_;
+
+  //the block size if every block is square with the same size, else 0.
+  int uniformBlkSize_;
+  bool stateChanged_;
+
+  std::vector<GlobalOrdinal> work_ptIndices_;
+  std::vector<int> work_blkIndices_;
+
+  const fei::VectorSpace* multiplyColSpace_;
+  const fei::VectorSpace* multiplyRowSpace_;
+  std::vector<int> localColIndices_;
+  std::vector<int> localRowIndices_;
+};//class Matrix_LocalBlock
+
+}//namespace fei
+
+#endif // _fei_Matrix_LocalBlock_hpp_
@@ -149,7 +149,7 @@ void fei::Matrix_core::setName(const char* name)
   name_ = name;
 }
 
-int fei::Matrix_core::getOwnerProc(int globalEqn) const
+int fei::Matrix_core::getOwnerProc(GlobalOrdinal globalEqn) const
 {
   int len = globalOffsets_.size();
   if (globalEqn > globalOffsets_[len-1]) return(-1);
@@ -288,11 +288,12 @@ int fei::Matrix_core::gatherFromOverlap(bool accumulate)
     int nrows = recvMat.getNumRows();
 
     for(int i=0; i<nrows; ++i) {
-      int row = recvMat.getGraph().rowNumbers[i];
+      GlobalOrdinal row = recvMat.getGraph().rowNumbers[i];
       int rowOffset = recvMat.getGraph().rowOffsets[i];
       int rowLen = recvMat.getGraph().rowOffsets[i+1] - rowOffset;
 
-      int* indices = &(recvMat.getGraph().packedColumnIndices[rowOffset]);
+      GlobalOrdinal* indices =
+        &(recvMat.getGraph().packedColumnIndices[rowOffset]);
       double* vals = &(recvMat.getPackedCoefs()[rowOffset]);
       int err = 0;
       if (haveBlockMatrix()) {
@@ -348,12 +349,12 @@ fei::Matrix_core::copyTransposeToWorkArrays(int numRows, int numCols,
 
 
 int fei::Matrix_core::convertPtToBlk(int numRows,
-				       const int* rows,
+				       const GlobalOrdinal* rows,
 				       int numCols,
-				       const int* cols,
-				       int* blkRows,
+				       const GlobalOrdinal* cols,
+				       GlobalOrdinal* blkRows,
 				       int* blkRowOffsets,
-				       int* blkCols,
+				       GlobalOrdinal* blkCols,
 				       int* blkColOffsets)
 {
   snl_fei::PointBlockMap* pointBlockMap = vecSpace_->getPointBlockMap();
@@ -29,8 +29,8 @@ class Matrix_core : protected fei::Logger {
 
   virtual ~Matrix_core();
 
-  virtual int giveToMatrix(int numRows, const int* rows,
-                           int numCols, const int* cols,
+  virtual int giveToMatrix(int numRows, const GlobalOrdinal* rows,
+                           int numCols, const GlobalOrdinal* cols,
                            const double* const* values,
                            bool sumInto,
                            int format) = 0;
@@ -123,21 +123,21 @@ class Matrix_core : protected fei::Logger {
  protected:
   void parameters(const fei::ParameterSet& paramset);
 
-  virtual int giveToUnderlyingMatrix(int numRows, const int* rows,
-                                     int numCols, const int* cols,
+  virtual int giveToUnderlyingMatrix(int numRows, const GlobalOrdinal* rows,
+                                     int numCols, const GlobalOrdinal* cols,
                                      const double* const* values,
                                      bool sumInto,
                                      int format) = 0;
 
-  virtual int giveToBlockMatrix(int numRows, const int* rows,
-                                          int numCols, const int* cols,
+  virtual int giveToBlockMatrix(int numRows, const GlobalOrdinal* rows,
+                                int numCols, const GlobalOrdinal* cols,
                                           const double* const* values,
                                           bool sumInto) = 0;
 
-  virtual int giveToUnderlyingBlockMatrix(int row,
+  virtual int giveToUnderlyingBlockMatrix(GlobalOrdinal row,
                                           int rowDim,
                                           int numCols,
-                                          const int* cols,
+                                          const GlobalOrdinal* cols,
                                           const int* LDAs,
                                           const int* colDims,
                                           const double* const* values,
@@ -167,12 +167,12 @@ class Matrix_core : protected fei::Logger {
                               double** blkValues);
 
   int convertPtToBlk(int numRows,
-                       const int* rows,
+                       const GlobalOrdinal* rows,
                        int numCols,
-                       const int* cols,
-                       int* blkRows,
+                       const GlobalOrdinal* cols,
+                       GlobalOrdinal* blkRows,
                        int* blkRowOffsets,
-                       int* blkCols,
+                       GlobalOrdinal* blkCols,
                        int* blkColOffsets);
 
   MPI_Comm getCommunicator() const { return( comm_ ); }
@@ -180,11 +180,12 @@ class Matrix_core : protected fei::Logger {
   const fei::SharedPtr<fei::VectorSpace> vecSpace() const { return( vecSpace_ ); }
   fei::SharedPtr<fei::VectorSpace> vecSpace() { return( vecSpace_ ); }
 
-  std::vector<int>& globalOffsets() { return( globalOffsets_ ); }
-  const std::vector<int>& globalOffsets() const { return( globalOffsets_ ); }
+  std::vector<GlobalOrdinal>& globalOffsets() { return( globalOffsets_ ); }
+  const std::vector<GlobalOrdinal>& globalOffsets() const
+  { return( globalOffsets_ ); }
 
-  int firstLocalOffset() const { return( firstLocalOffset_ ); }
-  int lastLocalOffset() const  { return( lastLocalOffset_ ); }
+  GlobalOrdinal firstLocalOffset() const { return( firstLocalOffset_ ); }
+  GlobalOrdinal lastLocalOffset() const  { return( lastLocalOffset_ ); }
 
   int numProcs() const { return( numProcs_ ); }
   int localProc() const { return( localProc_ ); }
@@ -195,12 +196,12 @@ class Matrix_core : protected fei::Logger {
   bool haveFEMatrix() const { return( haveFEMatrix_ ); }
   void setFEMatrix(bool flag) {haveFEMatrix_ = flag; }
 
-  int getOwnerProc(int globalEqn) const;
+  int getOwnerProc(GlobalOrdinal globalEqn) const;
 
   std::string name_;
 
-  std::vector<int> work_indices_;
-  std::vector<int> work_indices2_;
+  std::vector<GlobalOrdinal> work_indices_;
+  std::vector<GlobalOrdinal> work_indices2_;
 
   std::vector<int> work_ints_;
 
@@ -232,8 +233,8 @@ class Matrix_core : protected fei::Logger {
   bool haveBlockMatrix_;
   bool haveFEMatrix_;
 
-  std::vector<int> globalOffsets_;
-  int firstLocalOffset_, lastLocalOffset_;
+  std::vector<GlobalOrdinal> globalOffsets_;
+  GlobalOrdinal firstLocalOffset_, lastLocalOffset_;
 };//class Matrix_core
 }//namespace fei
 
@@ -21,6 +21,9 @@
 
 #include <fei_NodeDatabase.hpp>
 
+#include <algorithm>
+#include <map>
+
 #undef fei_file
 #define fei_file "fei_NodeCommMgr.cpp"
 #include <fei_ErrMacros.hpp>
@@ -41,12 +44,10 @@ NodeCommMgr::NodeCommMgr(MPI_Comm comm, const SNL_FEI_Structure& problemStructur
     remoteSharingProcs_(),
     nodesPerOwnerProc_(),
     nodesPerSharingProc_(),
+    neighborProcs_(),
     comm_(comm),
     numProcs_(1),
     localProc_(0),
-    maxFields_(0),
-    maxBlocks_(0),
-    maxSubdomains_(0),
     initCompleteCalled_(false),
     probStruc(problemStructure)
 {
@@ -133,54 +134,6 @@ int NodeCommMgr::informLocal(const NodeDescriptor& node) {
    return(0);
 }
 
-//------------------------------------------------------------------------------
-int NodeCommMgr::getGlobalMaxFieldsBlocks(int& maxFields, int& maxBlocks)
-{
-  std::vector<int> localMax(2, 0), globalMax(2, 0);
-
-  for(unsigned i=0; i<sharedNodeIDs.size(); i++) {
-    int numFlds = sharedNodes_[i]->getNumFields();
-    if (numFlds > localMax[0]) localMax[0] = numFlds;
-
-    int numBlks = sharedNodes_[i]->getNumBlocks();
-    if (numBlks > localMax[1]) localMax[1] = numBlks;
-  }
-
-  int err = fei::GlobalMax(comm_, localMax, globalMax);
-  if (err != 0) return(err);
-
-  maxFields = globalMax[0];
-  maxBlocks = globalMax[1];
-
-  return(0);
-}
-
-//------------------------------------------------------------------------------
-int NodeCommMgr::getGlobalMaxFieldsBlocksSubdomains()
-{
-  std::vector<int> localMax(3, 0), globalMax(3, 0);
-
-  for(unsigned i=0; i<sharedNodeIDs.size(); i++) {
-    int numFlds = sharedNodes_[i]->getNumFields();
-    if (numFlds > localMax[0]) localMax[0] = numFlds;
-
-    int numBlks = sharedNodes_[i]->getNumBlocks();
-    if (numBlks > localMax[1]) localMax[1] = numBlks;
-
-    int numShrd = sharingProcs_[i]->size();
-    if (numShrd > localMax[2]) localMax[2] = numShrd;
-  }
-
-  int err = fei::GlobalMax(comm_, localMax, globalMax);
-  if (err != 0) return(err);
-
-  maxFields_     = globalMax[0];
-  maxBlocks_     = globalMax[1];
-  maxSubdomains_ = globalMax[2];
-
-  return(0);
-}
-
 //------------------------------------------------------------------------------
 std::vector<int>& NodeCommMgr::getSendProcs()
 {
@@ -203,10 +156,9 @@ int NodeCommMgr::getSendMessageLength(int destProc, int& messageLength)
     ERReturn(-1);
   }
 
-  int idx = rs_iter - remoteSharingProcs_.begin();
-
-  int len = 7+maxFields_*2 + maxBlocks_ + maxSubdomains_;
-  messageLength = nodesPerSharingProc_[idx] * (len+1);
+  int numNodes = 0;
+  int len = getLocalNodeDataLength(destProc, numNodes);
+  messageLength = numNodes + len;
   return(0);
 }
 
@@ -220,13 +172,12 @@ int NodeCommMgr::getSendMessage(int destProc, std::vector<int>& message)
     ERReturn(-1);
   }
 
-  int idx = rs_iter - remoteSharingProcs_.begin();
-  int len = 0;
-  CHK_ERR( getSendMessageLength(destProc, len) );
-  message.resize(len);
+  int numNodes = 0;
+  int len = getLocalNodeDataLength(destProc, numNodes);
+  message.resize(numNodes + len);
+  if (message.empty()) return(0);
 
-  packLocalNodesAndData(&message[0], destProc,
-			nodesPerSharingProc_[idx], len);
+  packLocalNodesAndData(&message[0], destProc, numNodes, len);
   return(0);
 }
 
@@ -300,12 +251,24 @@ int NodeCommMgr::exchangeEqnInfo()
 #ifndef FEI_SER
    if (numProcs_ == 1) return(0);
 
-   //each proc will find out a max. number of fields, blocks
-   //and subdomains to expect per node.
+   //Messages are packed to their exact lengths and each is sized on arrival,
+   //so no global max of fields/blocks/subdomains per node is needed, and
+   //only one message goes to each remote sharing proc.
 
-   CHK_ERR( getGlobalMaxFieldsBlocksSubdomains() );
+   size_t numSendProcs = remoteSharingProcs_.size();
+   std::vector<std::vector<int> > sendMsgs(numSendProcs), recvMsgs;
+   for(size_t i=0; i<numSendProcs; ++i) {
+     CHK_ERR( getSendMessage(remoteSharingProcs_[i], sendMsgs[i]) );
+   }
 
-   CHK_ERR( fei::exchange(comm_, this) );
+   int eqnInfoTag = 19905;
+   CHK_ERR( fei::exchangeDataProbe(comm_, eqnInfoTag,
+                                   remoteSharingProcs_, sendMsgs,
+                                   remoteOwnerProcs_, recvMsgs) );
+
+   for(size_t i=0; i<remoteOwnerProcs_.size(); ++i) {
+     CHK_ERR( processRecvMessage(remoteOwnerProcs_[i], recvMsgs[i]) );
+   }
 
    setNodeNumbersArray();
 
@@ -314,6 +277,30 @@ int NodeCommMgr::exchangeEqnInfo()
    return(0);
 }
 
+//------------------------------------------------------------------------------
+int NodeCommMgr::getLocalNodeDataLength(int proc, int& numNodes)
+{
+  //Returns the exact length of the per-node data that packLocalNodesAndData
+  //packs for 'proc' (not counting the leading nodeIDs), and sets numNodes to
+  //the number of locally-owned nodes that 'proc' shares.
+  numNodes = 0;
+  int len = 0;
+
+  for(unsigned i=0; i<sharedNodeIDs.size(); i++) {
+    NodeDescriptor* node = sharedNodes_[i];
+    if (node->getOwnerProc() != localProc_) continue;
+
+    std::vector<int>& sProcs = *(sharingProcs_[i]);
+    if (fei::binarySearch(proc, &sProcs[0], sProcs.size()) < 0) continue;
+
+    ++numNodes;
+    len += 6 + 2*node->getNumFields() + node->getNumBlocks()
+         + sharedNodeSubdomains[i].size();
+  }
+
+  return(len);
+}
+
 //------------------------------------------------------------------------------
 void NodeCommMgr::packLocalNodesAndData(int* data, 
                                        int proc, int numNodes, int len)
@@ -329,12 +316,8 @@ void NodeCommMgr::packLocalNodesAndData(int* data,
 //     'numFields' pairs of (fieldID,eqnNumber)
 //     subdomain list, length 'numSubdomains'
 //
-//Incoming parameter len is:
-//  numNodes * (7 + maxFields*2 + maxBlocks + maxSubdomains),
-//where maxFields is the maximum number of fields associated with any node,
-//maxBlocks is the maximum number of blocks associated with any node, and
-//maxSubdomains is the maximum number of subdomains containing any node.
-//data is of length numNodes*(len+1).
+//Incoming parameter len is the exact length of the per-node data, as
+//computed by getLocalNodeDataLength. data is of length numNodes+len.
 //
 //The above data will all be packed into the 'data' list, with nodeIDs 
 //occupying the first numNodes positions, followed by the rest of the data.
@@ -402,12 +385,12 @@ void NodeCommMgr::packLocalNodesAndData(int* data,
 }
 
 //------------------------------------------------------------------------------
-void NodeCommMgr::packRemoteNodesAndData(GlobalID* data,
-					 int proc, int numNodes, int len)
+void NodeCommMgr::packRemoteNodesAndData(std::vector<GlobalID>& data,
+					 int proc)
 {
 //
-//This function packs up the nodeIDs owned by proc, as well as the list
-//containing, for each node, the following:
+//This function packs, for each node owned by proc, the following:
+//   nodeID
 //   residesLocally (0 or 1) indicating whether it appears in the local
 //       processor's element domain.
 //   numFields
@@ -416,17 +399,10 @@ void NodeCommMgr::packRemoteNodesAndData(GlobalID* data,
 //     'numFields' entries of (fieldID)
 //     'numBlocks' entries of (block)
 //
-//Incoming parameter len is numNodes * (3 + maxFields + maxBlocks),
-//where maxFields is the maximum number of fields associated with any node,
-//and maxBlocks is the maximum number of blocks associated with any node.
-//nodeIDs is of length numNodes, and
-//data is of length numNodes*len.
-//
-//The above data will all be put in the 'data' list, with the nodeIDs
-//occupying the first numNodes positions, followed by the rest of the data.
+//Each node's entries are contiguous, so 'data' is exactly as long as the
+//information it carries.
 //
-   int nodeCounter = 0;
-   int offset = 0;
+   data.resize(0);
 
    for(unsigned i=0; i<sharedNodeIDs.size(); i++) {
       NodeDescriptor* node = sharedNodes_[i];
@@ -434,13 +410,6 @@ void NodeCommMgr::packRemoteNodesAndData(GlobalID* data,
       int thisProc = node->getOwnerProc();
       if (thisProc != proc) continue;
 
-      if (nodeCounter >= numNodes) {
-         fei::console_out() << localProc_ << ": NodeCommMgr::packRemoteNodesAndData: ERROR,"
-              << " nodeCounter >= numNodes: " << numNodes << FEI_ENDL;
-      }
-
-      data[nodeCounter++] = node->getGlobalNodeID();
-
       int numFields = node->getNumFields();
       int numBlocks = node->getNumBlocks();
       const int* fieldIDsPtr = node->getFieldIDList();
@@ -448,59 +417,22 @@ void NodeCommMgr::packRemoteNodesAndData(GlobalID* data,
       const std::vector<unsigned>& nodeBlocks = node->getBlockIndexList();
       int lindex = fei::binarySearch(sharedNodeIDs[i], &localNodeIDs[0], localNodeIDs.size());
 
-      data[numNodes+offset++] = (lindex >= 0) ? 1 : 0;
-      data[numNodes+offset++] = (GlobalID)numFields;
-      data[numNodes+offset++] = (GlobalID)numBlocks;
-      data[numNodes+offset++] = (GlobalID)node->getNumNodalDOF();
+      data.push_back(node->getGlobalNodeID());
+      data.push_back((lindex >= 0) ? 1 : 0);
+      data.push_back((GlobalID)numFields);
+      data.push_back((GlobalID)numBlocks);
+      data.push_back((GlobalID)node->getNumNodalDOF());
 
       for(int j=0; j<numFields; j++) {
-         if (offset >= len) {
-            fei::console_out() << "NodeCommMgr::packRemoteNodesAndData: ERROR,"
-                 << " offset >= len." << FEI_ENDL;
-         }
-
-         data[numNodes+offset++] = (GlobalID)fieldIDsPtr[j];
+         data.push_back((GlobalID)fieldIDsPtr[j]);
       }
 
       for(int k=0; k<numBlocks; k++) {
-         if (offset >= len) {
-            fei::console_out() << "NodeCommMgr::packRemoteNodesAndData: ERROR,"
-                 << " offset >= len." << FEI_ENDL;
-         }
-
-         data[numNodes+offset++] = probStruc.getBlockID(nodeBlocks[k]);
+         data.push_back(probStruc.getBlockID(nodeBlocks[k]));
       }
    }
 }
 
-//------------------------------------------------------------------------------
-int NodeCommMgr::createProcList(std::vector<int>& itemsPerProc,
-                                std::vector<int>& procs)
-{
-//
-//This function looks through the itemsPerProc list and counts how many
-//positions in this list are greater than 0. Then it creates a list of
-//the indices of those positions. i.e., itemsPerProc is a list of how many
-//items are to be sent to or recvd from each proc. When itemsPerProc is
-//greater than 0, that proc is put in the sharingProcs list.
-//
-   int numProcs = 0;
-   int len = itemsPerProc.size();
-
-   for(int i=0; i<len; i++) {
-      if (itemsPerProc[i] > 0) numProcs++;
-   }
-
-   procs.resize(numProcs);
-
-   int offset = 0;
-
-   for(int i=0; i<len; i++) {
-      if (itemsPerProc[i] > 0) procs[offset++] = i;
-   }
-   return(0);
-}
-
 //------------------------------------------------------------------------------
 int NodeCommMgr::getSharedNodeIndex_num(int nodeNumber)
 {
@@ -615,6 +547,10 @@ int NodeCommMgr::initComplete(NodeDatabase& nodeDB, bool safetyCheck)
     sharedNodes_[ii]->setOwnerProc(proc);
   }
 
+  //All of the communication below is confined to the processors that share
+  //at least one node with us.
+  createNeighborProcs();
+
   //One of the tasks of this object is to gather information on the number
   //of subdomains each shared node appears in. So one thing we'll do here is
   //size and zero the array that will hold that information.
@@ -639,13 +575,15 @@ int NodeCommMgr::initComplete(NodeDatabase& nodeDB, bool safetyCheck)
   }
 
   err = createProcLists();
+  if (err != 0) return(err);
 
   if (safetyCheck) {
     err = checkSharedNodeInfo();
     if (err != 0) return(-1);
   }
 
-  exchangeSharedRemoteFieldsBlks();
+  err = exchangeSharedRemoteFieldsBlks();
+  if (err != 0) return(err);
 
   initCompleteCalled_ = true;
 
@@ -665,54 +603,69 @@ int NodeCommMgr::checkSharedNodeInfo()
   //the return-value is 0. If the shared-node info is found to be wrong, then
   //one or more messages will be written to stderr, and the return-value is -1.
   //
-  //This is a collective function, which is relatively expensive. It does a
-  //few global reductions...
+  //This is a collective function. It does a couple of global reductions, and
+  //one exchange with each neighboring processor.
   //
 
   if (numProcs_==1) return(0);
 
-  //Make sure that the processors we think are "remote owner"
-  //procs, think we are a "remote sharing" proc, and vice-versa.
-
-  std::vector<int> globalOwnerProcs, globalSharingProcs;
-  std::vector<int> recvOwnerLengths, recvSharingLengths;
-
-  std::vector<int> globalNodesPerOwnerProcs, globalNodesPerSharingProcs;
-  std::vector<int> recvNodesPerOwnerLengths, recvNodesPerSharingLengths;
-
-  //First, gather up each processor's list of remote procs and nodes-per-proc
-  //onto all other processors...
-
-  CHK_ERR( fei::Allgatherv(comm_, remoteOwnerProcs_,
-				 recvOwnerLengths, globalOwnerProcs) );
+  //First, the set of processors that think they share nodes with us must be
+  //the same as the set of processors we think we share nodes with. The
+  //neighbor exchange below relies on that, so bail out before it if not.
+  std::vector<int> mirrorNeighbors;
+  CHK_ERR( fei::mirrorProcs(comm_, neighborProcs_, mirrorNeighbors) );
+  std::sort(mirrorNeighbors.begin(), mirrorNeighbors.end());
+
+  int err = 0;
+  if (mirrorNeighbors != neighborProcs_) {
+    fei::console_out() << "FEI NodeCommMgr::checkSharedNodeInfo ERROR. Local proc ("
+         << localProc_ << ") shares nodes with " << neighborProcs_.size()
+         << " procs, but " << mirrorNeighbors.size()
+         << " procs think they share nodes with proc " << localProc_ << FEI_ENDL;
+    err = -1;
+  }
 
-  CHK_ERR( fei::Allgatherv(comm_, nodesPerOwnerProc_,
-				 recvNodesPerOwnerLengths,
-				 globalNodesPerOwnerProcs) );
+  int globalErr = 0;
+  CHK_ERR( fei::GlobalSum(comm_, err, globalErr) );
+  if (globalErr != 0) return(globalErr);
+
+  //Now send each neighbor the number of nodes we own that it shares, and
+  //the number of nodes it owns that we share.
+  size_t numNeighbors = neighborProcs_.size();
+  std::vector<std::vector<int> > sendCounts(numNeighbors), recvCounts;
+  for(size_t n=0; n<numNeighbors; ++n) {
+    int proc = neighborProcs_[n];
+    int sindex = fei::binarySearch(proc, &remoteSharingProcs_[0],
+                                   remoteSharingProcs_.size());
+    int oindex = fei::binarySearch(proc, &remoteOwnerProcs_[0],
+                                   remoteOwnerProcs_.size());
+    sendCounts[n].resize(2, 0);
+    if (sindex >= 0) sendCounts[n][0] = nodesPerSharingProc_[sindex];
+    if (oindex >= 0) sendCounts[n][1] = nodesPerOwnerProc_[oindex];
+  }
 
-  CHK_ERR( fei::Allgatherv(comm_, remoteSharingProcs_,
-				 recvSharingLengths, globalSharingProcs) );
+  int checkTag = 19907;
+  CHK_ERR( fei::exchangeDataProbe(comm_, checkTag, neighborProcs_, sendCounts,
+                                  neighborProcs_, recvCounts) );
 
-  CHK_ERR( fei::Allgatherv(comm_, nodesPerSharingProc_,
-				 recvNodesPerSharingLengths,
-				 globalNodesPerSharingProcs) );
+  std::vector<int> neighborOwnedCounts(numNeighbors, 0);
+  std::vector<int> neighborSharedCounts(numNeighbors, 0);
+  for(size_t n=0; n<numNeighbors; ++n) {
+    if (recvCounts[n].size() != 2) ERReturn(-1);
+    neighborSharedCounts[n] = recvCounts[n][0];
+    neighborOwnedCounts[n] = recvCounts[n][1];
+  }
 
-  //Now check the consistency of the global "owners" data against local "sharing"
-  //data.
-  int err =  checkCommArrays( "owners",
-			      globalOwnerProcs, globalNodesPerOwnerProcs,
-			      recvOwnerLengths,
-			      nodesPerSharingProc_, remoteSharingProcs_ );
+  //Now check the consistency of the neighbors' "owners" data against local
+  //"sharing" data.
+  err =  checkCommArrays( "owners", neighborOwnedCounts,
+			  nodesPerSharingProc_, remoteSharingProcs_ );
 
-  //Now check the consistency of the global "sharing" data against local "owners"
-  //data.
-  err +=  checkCommArrays( "sharing",
-			   globalSharingProcs, globalNodesPerSharingProcs,
-			   recvSharingLengths,
+  //Now check the consistency of the neighbors' "sharing" data against local
+  //"owners" data.
+  err +=  checkCommArrays( "sharing", neighborSharedCounts,
 			   nodesPerOwnerProc_, remoteOwnerProcs_ );
 
-  int globalErr = 0;
-
   CHK_ERR( fei::GlobalSum(comm_, err, globalErr) );
 
   return(globalErr);
@@ -720,52 +673,54 @@ int NodeCommMgr::checkSharedNodeInfo()
 
 //------------------------------------------------------------------------------
 int NodeCommMgr::checkCommArrays(const char* whichCheck,
-				 std::vector<int>& globalRemoteProcs,
-				 std::vector<int>& globalNodesPerRemoteProc,
-				 std::vector<int>& globalRemoteProcLengths,
+				 std::vector<int>& neighborNodesPerProc,
 				 std::vector<int>& nodesPerRemoteProc,
 				 std::vector<int>& remoteProcs)
 {
-  int offset = 0;
-
-  for(int i=0; i<numProcs_; i++) {
-    int length = globalRemoteProcLengths[i];
+  //neighborNodesPerProc[n] is the number of nodes that neighborProcs_[n]
+  //says it has in common with us, in the role given by 'whichCheck'.
+  for(size_t n=0; n<neighborProcs_.size(); n++) {
+    int i = neighborProcs_[n];
+    int numShared = neighborNodesPerProc[n];
+
+    int index = fei::binarySearch(i, &remoteProcs[0], remoteProcs.size());
+    int numWeThinkWeShare = index < 0 ? 0 : nodesPerRemoteProc[index];
+
+    if (numShared > 0 && index < 0) {
+      //we don't think proc i shares any nodes with us in this role.
+      fei::console_out() << "FEI NodeCommMgr::checkSharedNodeInfo "<<whichCheck
+	   << " ERROR. Local proc (" << localProc_ 
+	   << ") doesn't share nodes with proc " << i << " but proc " << i
+	   << " thinks it shares nodes with proc " << localProc_ << FEI_ENDL;
+      return(-1);
+    }
 
-    if (i==localProc_) { offset += length; continue; }
+    if (numWeThinkWeShare != numShared) {
+      fei::console_out() << "FEI NodeCommMgr::checkSharedNodeInfo "<<whichCheck
+	   << " ERROR. Local proc (" << localProc_ << ") thinks it shares "
+	   << numWeThinkWeShare << " nodes with proc " << i << ", but proc " 
+	   << i << " thinks it shares " << numShared << " nodes with proc "
+	   << localProc_ << "." << FEI_ENDL;
+      return(-1);
+    }
+  }
 
-    for(int j=0; j<length; j++) {
-      if (globalRemoteProcs[offset+j] == localProc_) {
-	//proc i says that we (localProc_) own nodes that it shares.
-	int numShared = globalNodesPerRemoteProc[offset+j];
+  return(0);
+}
 
-	int index = fei::binarySearch(i, &remoteProcs[0], remoteProcs.size());
-	if (index < 0) {
-	  //we don't think proc i shares any nodes that we own.
-	  fei::console_out() << "FEI NodeCommMgr::checkSharedNodeInfo "<<whichCheck
-	       << " ERROR. Local proc (" << localProc_ 
-	       << ") doesn't share nodes with proc " << i << " but proc " << i
-	       << " thinks it shares nodes with proc " << localProc_ << FEI_ENDL;
-	  return(-1);
-	}
+//------------------------------------------------------------------------------
+void NodeCommMgr::createNeighborProcs()
+{
+  neighborProcs_.resize(0);
 
-	//We think that we own nodesPerRemoteProc[index] nodes that proc i
-	//shares.
-	int numWeThinkWeShare = nodesPerRemoteProc[index];
-	if (numWeThinkWeShare != numShared) {
-	  fei::console_out() << "FEI NodeCommMgr::checkSharedNodeInfo "<<whichCheck
-	       << " ERROR. Local proc (" << localProc_ << ") thinks it shares "
-	       << numWeThinkWeShare << " nodes with proc " << i << ", but proc " 
-	       << i << " thinks it shares " << numShared << " nodes with proc "
-	       << localProc_ << "." << FEI_ENDL;
-	  return(-1);
-	}
+  for(unsigned i=0; i<sharingProcs_.size(); i++) {
+    std::vector<int>& shProcs = *(sharingProcs_[i]);
+    for(unsigned j=0; j<shProcs.size(); j++) {
+      if (shProcs[j] != localProc_) {
+        fei::sortedListInsert(shProcs[j], neighborProcs_);
       }
     }
-
-    offset += length;
   }
-
-  return(0);
 }
 
 //------------------------------------------------------------------------------
@@ -798,34 +753,39 @@ int NodeCommMgr::adjustSharedOwnership()
     }
   }
 
-  //Now we need to let the other processors know that the remote nodes 
-  //aren't owned by us. This is going to require some communication. We'll
-  //gather the nodeIDs onto all processors, after which each processor
-  //will reset the owner proc for that node. (Later, as an optimization, I'll
-  //do this without all-to-all communication.)
-
-  std::vector<GlobalID> allRemoteNodeIDs;
-  std::vector<int> numPerProc;
+  //Now we need to let the other sharing processors know that the remote
+  //nodes aren't owned by us. Each nodeID goes only to the neighbors that
+  //share that node, packed into one message per neighbor.
+  //
+  //Each exchange below receives from every neighbor, so the neighbor sets
+  //must be symmetric or MPI_Probe waits for a message that is never sent.
+  //If the shared-node declarations are inconsistent they aren't, so first
+  //add any procs that think they share nodes with us. (Those get empty
+  //messages, and the safety check reports the inconsistency.)
+  if (numProcs_ > 1) {
+    std::vector<int> mirrorNeighbors;
+    CHK_ERR( fei::mirrorProcs(comm_, neighborProcs_, mirrorNeighbors) );
+    for(size_t n=0; n<mirrorNeighbors.size(); ++n) {
+      fei::sortedListInsert(mirrorNeighbors[n], neighborProcs_);
+    }
+  }
 
-  err = fei::Allgatherv(comm_, remoteNodeIDs, numPerProc, allRemoteNodeIDs);
-  if (err != 0) return(-1);
+  size_t numNeighbors = neighborProcs_.size();
+  std::vector<std::vector<GlobalID> > sendIDs(numNeighbors), recvIDs;
+  packNodeIDsForSharingProcs(remoteNodeIDs, sendIDs);
 
-  //Now we need to run through the global list of 'special' nodes, and for the ones
-  //that we do own (appear locally), add them to a new list that will be once again
-  //globally gathered. That new list will then be used by each processor in setting
-  //the nodes' real owners.
+  int releaseTag = 19908;
+  CHK_ERR( fei::exchangeDataProbe(comm_, releaseTag, neighborProcs_, sendIDs,
+                                  neighborProcs_, recvIDs) );
 
-  //we'll keep the 'new' list in remoteNodeIDs.
+  //Of the nodes released by our neighbors, the ones that appear locally make
+  //us a candidate owner. We'll keep that list in remoteNodeIDs, and send it
+  //to the other processors that share those nodes.
   remoteNodeIDs.resize(0);
 
-  int offset = 0;
-  for(unsigned i=0; i<numPerProc.size(); i++) {
-    for(int j=0; j<numPerProc[i]; j++) {
-
-      //skip the nodes that we sent, we already know we don't own those.
-      if ((int)i==localProc_) {offset++; continue;}
-
-      GlobalID nodeID = allRemoteNodeIDs[offset++];
+  for(size_t n=0; n<numNeighbors; n++) {
+    for(size_t j=0; j<recvIDs[n].size(); j++) {
+      GlobalID nodeID = recvIDs[n][j];
       int index = getSharedNodeIndex(nodeID);
 
       //if it's not even one of our shared nodes, then continue.
@@ -837,31 +797,68 @@ int NodeCommMgr::adjustSharedOwnership()
     }
   }
 
-  //now re-gather the remoteNodeIDs list to all processors. This time, we should only
-  //receive nodeIDs from processors that can be valid owners. i.e., processors that
-  //have those nodes in at least one local element.
-  err = fei::Allgatherv(comm_, remoteNodeIDs, numPerProc, allRemoteNodeIDs);
-  if (err != 0) return(-1);
-
-  //Now we run the 'allRemoteNodeIDs' list for the last time, setting the owner-proc
-  //for each node. We'll run the list from the back to the front so that if multiple
-  //processors are possible owners, the lowest-numbered one will be the last one that
-  //get's set.
-  offset = allRemoteNodeIDs.size()-1;
-  for(int i=(int)numPerProc.size()-1; i>=0; i--) {
-    for(int j=0; j<numPerProc[i]; j++) {
-      GlobalID nodeID = allRemoteNodeIDs[offset--];
-      int index = getSharedNodeIndex(nodeID);
+  packNodeIDsForSharingProcs(remoteNodeIDs, sendIDs);
+
+  int candidateTag = 19909;
+  CHK_ERR( fei::exchangeDataProbe(comm_, candidateTag, neighborProcs_, sendIDs,
+                                  neighborProcs_, recvIDs) );
+
+  //Now set the owner-proc for each of those nodes to be the lowest-numbered
+  //candidate, which may be the local processor.
+  std::vector<int> lowestCandidate(sharedNodeIDs.size(), -1);
+
+  for(size_t j=0; j<remoteNodeIDs.size(); j++) {
+    lowestCandidate[getSharedNodeIndex(remoteNodeIDs[j])] = localProc_;
+  }
+
+  for(size_t n=0; n<numNeighbors; n++) {
+    int proc = neighborProcs_[n];
+    for(size_t j=0; j<recvIDs[n].size(); j++) {
+      int index = getSharedNodeIndex(recvIDs[n][j]);
 
       if (index < 0) continue;
 
-      sharedNodes_[index]->setOwnerProc(i);
+      if (lowestCandidate[index] < 0 || proc < lowestCandidate[index]) {
+        lowestCandidate[index] = proc;
+      }
+    }
+  }
+
+  for(unsigned i=0; i<sharedNodeIDs.size(); i++) {
+    if (lowestCandidate[i] >= 0) {
+      sharedNodes_[i]->setOwnerProc(lowestCandidate[i]);
     }
   }
 
   return(0);
 }
 
+//------------------------------------------------------------------------------
+void NodeCommMgr::packNodeIDsForSharingProcs(std::vector<GlobalID>& nodeIDs,
+                                  std::vector<std::vector<GlobalID> >& sendIDs)
+{
+  //Put each of 'nodeIDs' in the outgoing list of every neighbor that shares
+  //it. sendIDs is indexed like neighborProcs_.
+  sendIDs.resize(neighborProcs_.size());
+  for(size_t n=0; n<sendIDs.size(); n++) {
+    sendIDs[n].resize(0);
+  }
+
+  for(size_t j=0; j<nodeIDs.size(); j++) {
+    int index = getSharedNodeIndex(nodeIDs[j]);
+    if (index < 0) continue;
+
+    std::vector<int>& shProcs = *(sharingProcs_[index]);
+    for(unsigned k=0; k<shProcs.size(); k++) {
+      if (shProcs[k] == localProc_) continue;
+
+      int n = fei::binarySearch(shProcs[k], &neighborProcs_[0],
+                                neighborProcs_.size());
+      sendIDs[n].push_back(nodeIDs[j]);
+    }
+  }
+}
+
 //------------------------------------------------------------------------------
 void NodeCommMgr::setNodeNumbersArray()
 {
@@ -875,12 +872,13 @@ void NodeCommMgr::setNodeNumbersArray()
 //------------------------------------------------------------------------------
 int NodeCommMgr::createProcLists()
 {
-  std::vector<int> localNodesPerProc(numProcs_, 0);
-  std::vector<int> remoteNodesPerProc(numProcs_, 0);
+  std::map<int,int> localNodesPerProc;
+  std::map<int,int> remoteNodesPerProc;
 
   //first, figure out how many locally-owned nodes each remote processor is
   //associated with, and how many remotely-owned nodes we'll be recv'ing info
-  //about from each remote processor.
+  //about from each remote processor. Only processors that actually share
+  //nodes with us get an entry.
 
   for(unsigned i=0; i<sharedNodeIDs.size(); i++) {
     int proc = sharedNodes_[i]->getOwnerProc();
@@ -902,27 +900,22 @@ int NodeCommMgr::createProcLists()
 
   //now create condensed lists of remote owner procs, and
   //remote sharing procs.
-  int err = createProcList(remoteNodesPerProc, remoteOwnerProcs_);
-  if (err != 0) return(err);
-
-  err = createProcList(localNodesPerProc, remoteSharingProcs_);
-  if (err != 0) return(err);
-
-
-  nodesPerOwnerProc_.resize(remoteOwnerProcs_.size());
-
-  nodesPerSharingProc_.resize(remoteSharingProcs_.size());
-
-  int offset = 0;
-  for(int i=0; i<numProcs_; i++) {
-    if (remoteNodesPerProc[i] > 0) 
-      nodesPerOwnerProc_[offset++] = remoteNodesPerProc[i];
+  remoteOwnerProcs_.resize(0);
+  nodesPerOwnerProc_.resize(0);
+  std::map<int,int>::const_iterator
+    r_iter = remoteNodesPerProc.begin(), r_end = remoteNodesPerProc.end();
+  for(; r_iter != r_end; ++r_iter) {
+    remoteOwnerProcs_.push_back(r_iter->first);
+    nodesPerOwnerProc_.push_back(r_iter->second);
   }
 
-  offset = 0;
-  for(int i=0; i<numProcs_; i++) {
-    if (localNodesPerProc[i] > 0) 
-      nodesPerSharingProc_[offset++] = localNodesPerProc[i];
+  remoteSharingProcs_.resize(0);
+  nodesPerSharingProc_.resize(0);
+  std::map<int,int>::const_iterator
+    l_iter = localNodesPerProc.begin(), l_end = localNodesPerProc.end();
+  for(; l_iter != l_end; ++l_iter) {
+    remoteSharingProcs_.push_back(l_iter->first);
+    nodesPerSharingProc_.push_back(l_iter->second);
   }
 
   return(0);
@@ -931,87 +924,51 @@ int NodeCommMgr::createProcLists()
 //------------------------------------------------------------------------------
 int NodeCommMgr::exchangeSharedRemoteFieldsBlks()
 {
-  //first each proc will find out a max. number of fields and blocks to expect
-  //per node.
+  //Each proc sends to the owner of each of its remotely-owned shared nodes
+  //one message, holding the data packed by packRemoteNodesAndData for all
+  //of the nodes that proc owns. The messages are exactly as long as the
+  //data they carry, so no global max of fields and blocks per node is
+  //needed.
 
   //most of this function is #ifdef'd according to whether FEI_SER is
   //defined.
 #ifndef FEI_SER
-  int maxFields, maxBlocks;
-  int err = getGlobalMaxFieldsBlocks(maxFields, maxBlocks);
-  if (err) return(-1);
+  size_t numSendProcs = remoteOwnerProcs_.size();
+  std::vector<std::vector<GlobalID> > sendData(numSendProcs), recvData;
 
-  //now we can allocate lists to recv into and launch the irecv's.
-  //from each processor, we'll recv a list of length:
-  //            num-nodes*(4+ maxFields + maxBlocks)
-
-  int len = 4 + maxFields + maxBlocks;
-
-  GlobalID** recvData = NULL;
-  MPI_Request* recvDataReqs = NULL;
-
-  unsigned i, numRecvProcs = remoteSharingProcs_.size();
-
-  if (numRecvProcs > 0) {
-    recvData = new GlobalID*[numRecvProcs];
-    recvDataReqs = new MPI_Request[numRecvProcs];
+  for(size_t i=0; i<numSendProcs; i++) {
+    packRemoteNodesAndData(sendData[i], remoteOwnerProcs_[i]);
   }
 
   int dataTag = 19904;
+  CHK_ERR( fei::exchangeDataProbe(comm_, dataTag, remoteOwnerProcs_, sendData,
+                                  remoteSharingProcs_, recvData) );
 
-  int numRcvStarted = 0;
-  for(i=0; i<remoteSharingProcs_.size(); i++) {
-    int numRecvNodes = nodesPerSharingProc_[i];
-    recvData[i] = new GlobalID[numRecvNodes*(len+1)];
-    MPI_Irecv(recvData[i], numRecvNodes*(len+1),
-	      fei::mpiTraits<GlobalID>::mpi_type(),
-	      remoteSharingProcs_[i], dataTag, comm_, &recvDataReqs[i]);
-    numRcvStarted++;
-  }
-
-  //next, send all outgoing messages.
-
-  fei::Barrier(comm_);
-
-  for(i=0; i<remoteOwnerProcs_.size(); i++) {
-    int numSendNodes = nodesPerOwnerProc_[i];
-
-    std::vector<GlobalID> sendData(numSendNodes*(len+1), 0);
-
-    packRemoteNodesAndData(&sendData[0], remoteOwnerProcs_[i],
-                           numSendNodes, numSendNodes*len);
+  //now put away the node field info.
+  for(size_t index=0; index<remoteSharingProcs_.size(); index++) {
+    int remoteProc = remoteSharingProcs_[index];
+    std::vector<GlobalID>& rdata = recvData[index];
 
-    MPI_Send(&sendData[0], sendData.size(),
-	      fei::mpiTraits<GlobalID>::mpi_type(),
-	     remoteOwnerProcs_[i], dataTag, comm_);
-  }
-
-  //finally, complete the irecvs and put away the node field info.
-  int numCompleted = 0;
-  for(i=0; i<remoteSharingProcs_.size(); i++) {
-    MPI_Status status;
-    int index = i;
-    MPI_Wait(&recvDataReqs[index], &status);
-    numCompleted++;
-    int remoteProc = status.MPI_SOURCE;
-
-    int offset = 0;
+    size_t offset = 0;
     int numNodes = nodesPerSharingProc_[index];
 
     for(int j=0; j<numNodes; j++) {
-      int nIndex = fei::binarySearch(recvData[index][j], &sharedNodeIDs[0], sharedNodeIDs.size());
+      int nIndex = -1;
+      if (offset+5 <= rdata.size()) {
+        nIndex = fei::binarySearch(rdata[offset], &sharedNodeIDs[0], sharedNodeIDs.size());
+      }
       if (nIndex < 0) {
-	fei::console_out() << "NodeCommMgr::exchangeSharedRemote...: error, unknown nodeID "
-	     << (int)recvData[index][j] << ", " << j
-	     << "th node recvd from proc "
-	     <<remoteSharingProcs_[index]
+	fei::console_out() << "NodeCommMgr::exchangeSharedRemote...: error, unknown nodeID, "
+	     << j << "th node recvd from proc "
+	     << remoteProc
 	     << ". Probably a communication mis-match, we expected " 
 	     << numNodes
 	     << " nodes from that proc, but recvd less than that." << FEI_ENDL;
 	std::abort();
       }
+      ++offset;
 
-      int residesRemotely = (int)recvData[index][numNodes+offset++];
+      int residesRemotely = (int)rdata[offset++];
 
       if (residesRemotely) {
         std::vector<int>& snSubd = sharedNodeSubdomains[nIndex];
@@ -1021,19 +978,18 @@ int NodeCommMgr::exchangeSharedRemoteFieldsBlks()
           snSubd.insert(sn_iter, remoteProc);
         }
       }
-      int numFields       = (int)recvData[index][numNodes+offset++];
-      int numBlocks       = (int)recvData[index][numNodes+offset++];
-      sharedNodes_[nIndex]->
- 	     setNumNodalDOF((int)recvData[index][numNodes+offset++]);
+      int numFields       = (int)rdata[offset++];
+      int numBlocks       = (int)rdata[offset++];
+      sharedNodes_[nIndex]->setNumNodalDOF((int)rdata[offset++]);
 
       for(int fld=0; fld<numFields; fld++) {
-        int fieldID = (int)recvData[index][numNodes+offset++];
+        int fieldID = (int)rdata[offset++];
 
         sharedNodes_[nIndex]->addField(fieldID);
       }
 
       for(int blk=0; blk<numBlocks; blk++) {
-        int blk_idx = probStruc.getIndexOfBlock(recvData[index][numNodes+offset++]);
+        int blk_idx = probStruc.getIndexOfBlock(rdata[offset++]);
         //if blk_idx < 0 it means the incoming blockID doesn't exist on this proc
         if (blk_idx >= 0) {
           sharedNodes_[nIndex]->addBlockIndex(blk_idx);
@@ -1042,20 +998,6 @@ int NodeCommMgr::exchangeSharedRemoteFieldsBlks()
     }
   }
 
-  if (numRcvStarted != numCompleted) {
-    fei::console_out() << "NodeCommMgr::exchangeSharedRemote...: recv-send mismatch;"
-         << " numRcvStarted: " << numRcvStarted << ", numCompleted: "
-         << numCompleted << FEI_ENDL;
-    std::abort();
-  }
-
-  for(i=0; i<numRecvProcs; i++) {
-    delete [] recvData[i];
-  }
-
-  delete [] recvData;
-  delete [] recvDataReqs;
-
 #endif //#ifndef FEI_SER
 
   return(0);
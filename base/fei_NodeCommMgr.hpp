@@ -32,6 +32,10 @@
   
     For all nodes that we don't own, we need to receive the field-IDs
     and equation numbers.
+
+  All of this communication takes place only between processors that
+  share nodes with each other, with one exactly-sized message per
+  neighboring processor per phase.
 */
 
 class NodeCommMgr : public fei::MessageHandler<int> {
@@ -90,32 +94,29 @@ class NodeCommMgr : public fei::MessageHandler<int> {
    int checkSharedNodeInfo();
 
    int checkCommArrays(const char* whichCheck,
-		       std::vector<int>& globalRemoteProcs,
-		       std::vector<int>& globalNodesPerRemoteProc,
-		       std::vector<int>& globalRemoteProcLengths,
+		       std::vector<int>& neighborNodesPerProc,
 		       std::vector<int>& nodesPerRemoteProc,
 		       std::vector<int>& remoteProcs);
 
    void setNodeNumbersArray();
 
+   int getLocalNodeDataLength(int proc, int& numNodes);
+
    void packLocalNodesAndData(int* data, int proc,
                              int numNodes, int len);
-   void packRemoteNodesAndData(GlobalID* data, int proc,
-                             int numNodes, int len);
+   void packRemoteNodesAndData(std::vector<GlobalID>& data, int proc);
+
+   void createNeighborProcs();
+
+   void packNodeIDsForSharingProcs(std::vector<GlobalID>& nodeIDs,
+                                   std::vector<std::vector<GlobalID> >& sendIDs);
 
    int adjustSharedOwnership();
 
    int createProcLists();
 
-   int createProcList(std::vector<int>& itemsPerProc,
-		       std::vector<int>& procs);
-
    int exchangeSharedRemoteFieldsBlks();
 
-   int getGlobalMaxFieldsBlocks(int& maxFields, int& maxBlocks);
-
-   int getGlobalMaxFieldsBlocksSubdomains();
-
    NodeDescriptor** sharedNodes_;
    bool sharedNodesAllocated_;
 
@@ -139,13 +140,13 @@ class NodeCommMgr : public fei::MessageHandler<int> {
    std::vector<int> remoteOwnerProcs_, remoteSharingProcs_;
    std::vector<int> nodesPerOwnerProc_, nodesPerSharingProc_;
 
+   //sorted union of the sharing procs of all shared nodes, excluding
+   //localProc_. All shared-node setup communication is confined to these.
+   std::vector<int> neighborProcs_;
+
    MPI_Comm comm_;
    int numProcs_, localProc_;
 
-   int maxFields_;
-   int maxBlocks_;
-   int maxSubdomains_;
-
    bool initCompleteCalled_;
    const SNL_FEI_Structure& probStruc;
 };
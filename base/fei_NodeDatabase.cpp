@@ -14,18 +14,51 @@
 
 #include <fei_macros.hpp>
 #include <fei_TemplateUtils.hpp>
+
+#include <algorithm>
 #undef fei_file
 #define fei_file "fei_NodeDatabase.cpp"
 
 #include <fei_ErrMacros.hpp>
 
+namespace {
+template<typename PAIR>
+struct lessFirst {
+  bool operator()(const PAIR& a, const PAIR& b) const
+  { return( a.first < b.first ); }
+};
+
+//Sort (key,node) pairs by key, keeping only the first entry for each key
+//(like successive std::map::insert calls would), and split them into the
+//parallel arrays 'keys' and 'nodes'.
+void sortAndSplit(std::vector<std::pair<int,NodeDescriptor*> >& pairs,
+                  std::vector<int>& keys,
+                  std::vector<NodeDescriptor*>& nodes)
+{
+  std::stable_sort(pairs.begin(), pairs.end(),
+                   lessFirst<std::pair<int,NodeDescriptor*> >());
+
+  keys.resize(0);
+  nodes.resize(0);
+  keys.reserve(pairs.size());
+  nodes.reserve(pairs.size());
+
+  for(size_t i=0; i<pairs.size(); ++i) {
+    if (!keys.empty() && keys.back() == pairs[i].first) continue;
+    keys.push_back(pairs[i].first);
+    nodes.push_back(pairs[i].second);
+  }
+}
+}//namespace <anonymous>
+
 //------------------------------------------------------------------------------
 NodeDatabase::NodeDatabase(std::map<int,int>* fieldDatabase,
                            NodeCommMgr* nodeCommMgr)
   : nodePtrs_(),
-    eqnNumbers_(0), eqnNodeIndices_(),
     nodeIDs_(),
-    nodeNumbers_(),
+    pendingNodeIDs_(),
+    eqnNumbers_(0), eqnNodePtrs_(),
+    nodeNumbers_(), nodeNumberPtrs_(),
     synchronized_(false),
     need_to_alloc_and_sync_(true),
     fieldDB_(fieldDatabase),
@@ -82,16 +115,15 @@ int NodeDatabase::getNodeWithNumber(int nodeNumber, const NodeDescriptor*& node)
 {
   if (!synchronized_) ERReturn(-1);
 
-  std::map<int,int>::const_iterator iter = nodeNumbers_.find(nodeNumber);
-  if (iter == nodeNumbers_.end()) {
+  int index = fei::binarySearch(nodeNumber, nodeNumbers_);
+  if (index < 0) {
     // The node wasn't found, return a NULL ptr.
     node = NULL;
     // Indicate that the node is NULL.
     return -1;
   }
 
-  int index = iter->second;
-  node = nodePtrs_[index];
+  node = nodeNumberPtrs_[index];
 
   return(0);
 }
@@ -103,10 +135,10 @@ int NodeDatabase::getNodeWithEqn(int eqnNumber, const NodeDescriptor*& node) con
   int index = fei::binarySearch(eqnNumber, eqnNumbers_, insertPoint);
 
   if (index >= 0) {
-    node = nodePtrs_[eqnNodeIndices_[index]];
+    node = eqnNodePtrs_[index];
   }
   else if (insertPoint > 0) {
-    node = nodePtrs_[eqnNodeIndices_[insertPoint-1]];
+    node = eqnNodePtrs_[insertPoint-1];
   }
   else {
     //We only reach this line if insertPoint==0, which means the specified
@@ -136,6 +168,7 @@ int NodeDatabase::getNodeWithEqn(int eqnNumber, const NodeDescriptor*& node) con
 //------------------------------------------------------------------------------
 void NodeDatabase::getNodeAtIndex(int i, const NodeDescriptor*& node) const
 {
+  insertPendingNodeIDs();
   int nnodes = nodePtrs_.size();
   if (i>=0 && i < nnodes) {
     node = nodePtrs_[i];
@@ -148,6 +181,7 @@ void NodeDatabase::getNodeAtIndex(int i, const NodeDescriptor*& node) const
 //------------------------------------------------------------------------------
 void NodeDatabase::getNodeAtIndex(int i, NodeDescriptor*& node)
 {
+  insertPendingNodeIDs();
   int nnodes = nodePtrs_.size();
   if (i>=0 && i < nnodes) {
     node = nodePtrs_[i];
@@ -160,6 +194,7 @@ void NodeDatabase::getNodeAtIndex(int i, NodeDescriptor*& node)
 //------------------------------------------------------------------------------
 int NodeDatabase::countLocalNodalEqns(int localRank)
 {
+  insertPendingNodeIDs();
   int numEqns = 0;
 
   for(size_t i=0; i<nodePtrs_.size(); i++) {
@@ -183,6 +218,7 @@ int NodeDatabase::countLocalNodalEqns(int localRank)
 //------------------------------------------------------------------------------
 int NodeDatabase::countLocalNodeDescriptors(int localRank)
 {
+  insertPendingNodeIDs();
   int numLocal = 0;
   for(size_t i=0; i<nodePtrs_.size(); i++) {
     if (nodePtrs_[i]->getOwnerProc() == localRank) numLocal++;
@@ -194,34 +230,21 @@ int NodeDatabase::countLocalNodeDescriptors(int localRank)
 //------------------------------------------------------------------------------
 int NodeDatabase::getIndexOfID(GlobalID nodeID) const
 {
-  std::map<GlobalID,int>::const_iterator
-    iter = nodeIDs_.find(nodeID);
-
-  if (iter == nodeIDs_.end()) return(-1);
-
-  return( iter->second );
+  insertPendingNodeIDs();
+  return( fei::binarySearch(nodeID, nodeIDs_) );
 }
 
 //------------------------------------------------------------------------------
 int NodeDatabase::initNodeID(GlobalID nodeID)
 {
-  static NodeDescriptor dummyNode;
-
-  int index = nodeIDs_.size();
-  std::map<GlobalID,int>::iterator
-    iter = nodeIDs_.lower_bound(nodeID);
-
-  if (iter == nodeIDs_.end() || iter->first != nodeID) {
-    nodeIDs_.insert(iter, std::make_pair(nodeID,index));
-
-    NodeDescriptor* nodePtr = nodePool_.allocate(1);
-    nodePool_.construct(nodePtr, dummyNode);
-
-    nodePtr->setGlobalNodeID(nodeID);
-
-    nodePtrs_.push_back(nodePtr);
-
-    need_to_alloc_and_sync_ = true;
+  pendingNodeIDs_.push_back(nodeID);
+  need_to_alloc_and_sync_ = true;
+
+  //Keep the buffer of repeated IDs from growing without bound. Merging once
+  //the buffer is as long as the sorted list keeps the cost linear overall.
+  if (pendingNodeIDs_.size() > 1024 &&
+      pendingNodeIDs_.size() > nodeIDs_.size()) {
+    insertPendingNodeIDs();
   }
 
   return(0);
@@ -230,8 +253,6 @@ int NodeDatabase::initNodeID(GlobalID nodeID)
 //------------------------------------------------------------------------------
 int NodeDatabase::initNodeIDs(GlobalID* nodeIDs, int numNodes)
 {
-  static NodeDescriptor dummyNode;
-
   for(int i=0; i<numNodes; i++) {
     initNodeID(nodeIDs[i]);
   }
@@ -239,39 +260,80 @@ int NodeDatabase::initNodeIDs(GlobalID* nodeIDs, int numNodes)
   return(0);
 }
 
+//------------------------------------------------------------------------------
+void NodeDatabase::insertPendingNodeIDs() const
+{
+  if (pendingNodeIDs_.empty()) return;
+
+  static NodeDescriptor dummyNode;
+
+  std::sort(pendingNodeIDs_.begin(), pendingNodeIDs_.end());
+  pendingNodeIDs_.erase(std::unique(pendingNodeIDs_.begin(),
+                                    pendingNodeIDs_.end()),
+                        pendingNodeIDs_.end());
+
+  size_t numOld = nodeIDs_.size();
+  size_t numPending = pendingNodeIDs_.size();
+
+  std::vector<GlobalID> mergedIDs;
+  std::vector<NodeDescriptor*> mergedPtrs;
+  mergedIDs.reserve(numOld+numPending);
+  mergedPtrs.reserve(numOld+numPending);
+
+  size_t i = 0, j = 0;
+  while(i < numOld || j < numPending) {
+    if (j >= numPending ||
+        (i < numOld && nodeIDs_[i] <= pendingNodeIDs_[j])) {
+      if (j < numPending && nodeIDs_[i] == pendingNodeIDs_[j]) ++j;
+      mergedIDs.push_back(nodeIDs_[i]);
+      mergedPtrs.push_back(nodePtrs_[i]);
+      ++i;
+    }
+    else {
+      NodeDescriptor* nodePtr = nodePool_.allocate(1);
+      nodePool_.construct(nodePtr, dummyNode);
+      nodePtr->setGlobalNodeID(pendingNodeIDs_[j]);
+
+      mergedIDs.push_back(pendingNodeIDs_[j]);
+      mergedPtrs.push_back(nodePtr);
+      ++j;
+    }
+  }
+
+  nodeIDs_.swap(mergedIDs);
+  nodePtrs_.swap(mergedPtrs);
+  pendingNodeIDs_.clear();
+}
+
 //------------------------------------------------------------------------------
 int NodeDatabase::synchronize(int firstLocalNodeNumber,
                               int firstLocalEqn,
                               int localRank,
                               MPI_Comm comm)
 {
-  eqnNumbers_.reserve(nodePtrs_.size());
-  eqnNodeIndices_.reserve(nodePtrs_.size());
+  insertPendingNodeIDs();
 
-  eqnNumbers_.resize(0);
-  eqnNodeIndices_.resize(0);
+  std::vector<std::pair<int,NodeDescriptor*> > eqnNodes, numberNodes;
+  eqnNodes.reserve(nodePtrs_.size());
+  numberNodes.reserve(nodePtrs_.size());
 
   firstLocalNodeNumber_ = firstLocalNodeNumber;
   int nodeNumber = firstLocalNodeNumber;
   int numEqns = 0;
-  
-  nodeNumbers_.clear();
 
   numLocalNodes_ = 0;
-  std::map<GlobalID,int>::iterator
-    iter = nodeIDs_.begin(), iter_end = nodeIDs_.end();
 
-  for(; iter!=iter_end; ++iter) {
-    int i = iter->second;
-    NodeDescriptor* node = NULL;
-    getNodeAtIndex(i, node);
+  //nodePtrs_ is in nodeID order, so node-numbers and equation-numbers are
+  //assigned to locally-owned nodes in ascending nodeID order.
+  for(size_t i=0; i<nodePtrs_.size(); ++i) {
+    NodeDescriptor* node = nodePtrs_[i];
     if (node==NULL) continue;
 
     int numFields = node->getNumFields();
     const int* fieldIDList = node->getFieldIDList();
 
     int numNodalDOF = 0;
-    int firstEqnNumber, eqnNumber;
+    int firstEqnNumber = -1, eqnNumber = -1;
 
     for(int j=0; j<numFields; j++) {
       int numFieldParams = (*fieldDB_)[fieldIDList[j]];
@@ -291,15 +353,14 @@ int NodeDatabase::synchronize(int firstLocalNodeNumber,
       node->setNodeNumber(nodeNumber++);
       numLocalNodes_++;
 
-      int insertPoint = fei::sortedListInsert(firstEqnNumber, eqnNumbers_);
-      if (insertPoint == -2) ERReturn(-2);
-      if (insertPoint >= 0) eqnNodeIndices_.insert(eqnNodeIndices_.begin()+insertPoint, i);
+      if (numFields > 0) {
+        eqnNodes.push_back(std::make_pair(firstEqnNumber, node));
+      }
     }
 
     node->setNumNodalDOF(numNodalDOF);
 
-    int thisNodeNumber = node->getNodeNumber();
-    nodeNumbers_.insert(std::make_pair(thisNodeNumber, i));
+    numberNodes.push_back(std::make_pair(node->getNodeNumber(), node));
   }
 
   lastLocalNodeNumber_ = nodeNumber - 1;
@@ -312,28 +373,28 @@ int NodeDatabase::synchronize(int firstLocalNodeNumber,
   CHK_ERR( nodeCommMgr_->exchangeEqnInfo() );
 
   //Now finish up by inserting equation-numbers for shared nodes into our
-  //eqnNumbers_ and eqnNodeIndices_ lists, for future lookups...
+  //eqnNumbers_ and eqnNodePtrs_ lists, for future lookups...
 
   int numSharedNodes = nodeCommMgr_->getNumSharedNodes();
   for(int i=0; i<numSharedNodes; i++) {
-    NodeDescriptor& node = nodeCommMgr_->getSharedNodeAtIndex(i);
-    GlobalID nodeID = node.getGlobalNodeID();
-    int index = getIndexOfID(nodeID);
-    int nDOF = node.getNumNodalDOF();
+    NodeDescriptor& shNode = nodeCommMgr_->getSharedNodeAtIndex(i);
+    NodeDescriptor* node = NULL;
+    if (getNodeWithID(shNode.getGlobalNodeID(), node) != 0) continue;
+    int nDOF = shNode.getNumNodalDOF();
     if (nDOF <= 0) {
       continue;
       //FEI_COUT << "localRank " << localRank << ", node "<<nodeID<<" has nDOF=" << nDOF<<FEI_ENDL;
       //ERReturn(-1);
     }
-    int firstEqn = node.getFieldEqnNumbers()[0];
-    int insertPoint = fei::sortedListInsert(firstEqn, eqnNumbers_);
-    if (insertPoint == -2) ERReturn(-2);
-    if (insertPoint >= 0) eqnNodeIndices_.insert(eqnNodeIndices_.begin()+insertPoint, index);
+    int firstEqn = shNode.getFieldEqnNumbers()[0];
+    eqnNodes.push_back(std::make_pair(firstEqn, node));
 
-    int thisNodeNumber = node.getNodeNumber();
-    nodeNumbers_.insert(std::make_pair(thisNodeNumber, index));
+    numberNodes.push_back(std::make_pair(shNode.getNodeNumber(), node));
   }
 
+  sortAndSplit(eqnNodes, eqnNumbers_, eqnNodePtrs_);
+  sortAndSplit(numberNodes, nodeNumbers_, nodeNumberPtrs_);
+
   synchronized_ = true;
   need_to_alloc_and_sync_ = false;
 
@@ -347,11 +408,11 @@ int NodeDatabase::getAssociatedNodeNumber(int eqnNumber)
   int index = fei::binarySearch(eqnNumber, eqnNumbers_, insertPoint);
 
   if (index >= 0) {
-    return( nodePtrs_[eqnNodeIndices_[index]]->getNodeNumber() );
+    return( eqnNodePtrs_[index]->getNodeNumber() );
   }
 
   if (insertPoint > 0) {
-    NodeDescriptor& node = *(nodePtrs_[eqnNodeIndices_[insertPoint-1]]);
+    NodeDescriptor& node = *(eqnNodePtrs_[insertPoint-1]);
     const int* fieldEqnNumbers = node.getFieldEqnNumbers();
     const int* fieldIDList = node.getFieldIDList();
     int numFields = node.getNumFields();
@@ -387,7 +448,7 @@ int NodeDatabase::getAssociatedFieldID(int eqnNumber)
 
   if (index2 < 0) ERReturn(-1);
 
-  NodeDescriptor& node = *(nodePtrs_[eqnNodeIndices_[index2]]);
+  NodeDescriptor& node = *(eqnNodePtrs_[index2]);
 
   const int* fieldEqnNumbers = node.getFieldEqnNumbers();
   const int* fieldIDList = node.getFieldIDList();
@@ -17,6 +17,7 @@
 #include "fei_mpi.h"
 
 #include <map>
+#include <vector>
 
 /** Container that holds NodeDescriptors, and is able to reference them by
  global identifiers, or by nodeNumbers or eqnNumbers.
@@ -41,6 +42,13 @@ The goal of this class is to be able to provide a node's descriptor as fast as
 possible, given a nodeID, nodeNumber, or eqnNumber. Binary searches are used wherever
 possible.
 
+All three lookups are backed by flat sorted arrays rather than node-based
+maps. NodeDescriptors are stored in nodeID order, so the index of a node is
+its position in the sorted nodeID list. nodeIDs passed to initNodeID are
+buffered and merged into the sorted list in batches, the next time a lookup
+needs them (or when the buffer grows large), so that initializing nodes
+element-by-element doesn't cost a sorted insertion per node.
+
 The return-value of all functions in this class (except trivial query/accessor
 functions) is an error-code. If the function is successful, the error-code is 
 0. If a node-not-found error occurs, -1 is returned. If an allocation fails, 
@@ -75,12 +83,14 @@ class NodeDatabase {
   /** Obtain number-of-node-descriptors (in function's return-value). Note that
       this remains 0 until after allocateNodeDescriptors() is called.
    */
-  int getNumNodeDescriptors() const { return( nodePtrs_.size() ); };
+  int getNumNodeDescriptors() const
+    { insertPendingNodeIDs(); return( nodePtrs_.size() ); };
 
-  /** Obtain the set of nodeIDs. This is available anytime, and doesn't
-      necessarily imply that there is a corresponding array of NodeDescriptors.
+  /** Obtain the sorted list of nodeIDs. The i-th entry is the nodeID of the
+      NodeDescriptor returned by getNodeAtIndex(i).
   */
-  std::map<GlobalID,int>& getNodeIDs() { return( nodeIDs_ ); };
+  const std::vector<GlobalID>& getNodeIDs() const
+    { insertPendingNodeIDs(); return( nodeIDs_ ); };
 
   /** Given a nodeID, return the corresponding node-descriptor. This function is
       only available after allocateNodeDescriptors() has been called 
@@ -198,21 +208,29 @@ class NodeDatabase {
 
   void deleteMemory();
 
-  std::vector<NodeDescriptor*> nodePtrs_;
+  /** Merge the buffered nodeIDs from initNodeID into nodeIDs_, creating
+      NodeDescriptors for the ones that aren't already present. */
+  void insertPendingNodeIDs() const;
+
+  mutable std::vector<NodeDescriptor*> nodePtrs_; //parallel to nodeIDs_
+
+  mutable std::vector<GlobalID> nodeIDs_; //sorted, unique list of nodeIDs.
+
+  mutable std::vector<GlobalID> pendingNodeIDs_; //nodeIDs passed to
+                                //initNodeID that haven't yet been merged
+                                //into nodeIDs_. unsorted, may hold repeats.
 
   std::vector<int> eqnNumbers_;  //eqnNumbers_ will be a sorted list of the
                                   //first global equation number at each node
                                   //in nodePtrs_.
                                   //the relationship between eqnNumbers_ and
-  std::vector<int> eqnNodeIndices_;  //eqnNodeIndices_ is like this:
+  std::vector<NodeDescriptor*> eqnNodePtrs_; //eqnNodePtrs_ is like this:
                                   //if eqn == eqnNumbers_[i], then
-                                  //  nodePtrs_[eqnNodeIndices_[i]] points to
+                                  //  eqnNodePtrs_[i] points to
                                   //  the node with 'eqn'
 
-  std::map<GlobalID,int> nodeIDs_; //nodeIDs_ maps node-ID to an index into
-                                //the nodePtrs_ array of NodeDescriptors.
-
-  std::map<int,int> nodeNumbers_;
+  std::vector<int> nodeNumbers_;  //sorted list of node-numbers, with
+  std::vector<NodeDescriptor*> nodeNumberPtrs_; //the corresponding nodes.
 
   bool synchronized_;
   bool need_to_alloc_and_sync_;
@@ -223,7 +241,7 @@ class NodeDatabase {
   int numLocalNodes_;
   int firstLocalNodeNumber_, lastLocalNodeNumber_;
 
-  fei_Pool_alloc<NodeDescriptor> nodePool_;
+  mutable fei_Pool_alloc<NodeDescriptor> nodePool_;
 };
 
 #endif
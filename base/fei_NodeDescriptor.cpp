@@ -17,9 +17,10 @@ NodeDescriptor::NodeDescriptor()
  : nodeID_((GlobalID)-1),
    nodeNumber_(-1),
    numNodalDOF_(0),
-   fieldIDList_(NULL),
-   fieldEqnNumbers_(NULL),
+   fieldIDList_(inlineFieldIDs_),
+   fieldEqnNumbers_(inlineFieldEqnNumbers_),
    numFields_(0),
+   fieldCapacity_(NUM_INLINE_FIELDS),
    blkEqnNumber_(0),
    ownerProc_(-1),
    blockList_()
@@ -30,8 +31,9 @@ NodeDescriptor::NodeDescriptor()
 
 //======Destructor==============================================================
 NodeDescriptor::~NodeDescriptor() {
-  delete [] fieldIDList_;
-  delete [] fieldEqnNumbers_;
+  //fieldEqnNumbers_ lives in the same allocation as fieldIDList_ once the
+  //lists have outgrown the inline buffers.
+  if (fieldIDList_ != inlineFieldIDs_) delete [] fieldIDList_;
   numFields_ = 0;
 }
 
@@ -41,29 +43,46 @@ void NodeDescriptor::addField(int fieldID) {
 //Add a field identifier to this node, ONLY if that field identifier
 //is not already present.
 //
-//If fieldID is added, lengthen the corresponding list for equation numbers.
+//If fieldID is added, the corresponding slot in fieldEqnNumbers_ is set to
+//-99 for now. The calling code (BASE_FEI) will set the fieldEqnNumber for
+//this fieldID using setFieldEqnNumber(...).
 //
+   int insertPoint = -1;
+   int index = fei::binarySearch(fieldID, fieldIDList_, numFields_,
+                                 insertPoint);
+   if (index >= 0) return;
 
-   int tmp = numFields_;
-   int allocLen = numFields_;
-   int index = fei::sortedListInsert(fieldID, fieldIDList_, numFields_,
-                                         allocLen);
-
-   //index is the position at which fieldID was inserted, or found
-
-   //if tmp < numFields_ then fieldID wasn't already present
-   if (tmp < numFields_) {
-      //
-      //if the length of fieldIDList_ changed, let's lengthen the 
-      //fieldEqnNumbers_ list.
-      //fieldEqnNumbers_ will have an empty position 'index', which we'll set to
-      //-99 for now. The calling code (BASE_FEI) will set the fieldEqnNumber for
-      //this fieldID using setFieldEqnNumber(...).
-      //
-
-      allocLen = numFields_ - 1;
-      fei::listInsert(-99, index, fieldEqnNumbers_, tmp, allocLen);
+   if (numFields_ == fieldCapacity_) growFieldLists();
+
+   for(int i=numFields_; i>insertPoint; --i) {
+      fieldIDList_[i] = fieldIDList_[i-1];
+      fieldEqnNumbers_[i] = fieldEqnNumbers_[i-1];
    }
+
+   fieldIDList_[insertPoint] = fieldID;
+   fieldEqnNumbers_[insertPoint] = -99;
+   ++numFields_;
+}
+
+//==============================================================================
+void NodeDescriptor::growFieldLists() {
+//
+//Double the capacity of the field lists. Both lists are carved out of one
+//allocation: field-IDs in the first half, equation-numbers in the second.
+//
+   int newCapacity = 2*fieldCapacity_;
+   int* newStorage = new int[2*newCapacity];
+
+   for(int i=0; i<numFields_; ++i) {
+      newStorage[i] = fieldIDList_[i];
+      newStorage[newCapacity+i] = fieldEqnNumbers_[i];
+   }
+
+   if (fieldIDList_ != inlineFieldIDs_) delete [] fieldIDList_;
+
+   fieldIDList_ = newStorage;
+   fieldEqnNumbers_ = newStorage + newCapacity;
+   fieldCapacity_ = newCapacity;
 }
 
 //==============================================================================
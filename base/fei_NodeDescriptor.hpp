@@ -31,6 +31,12 @@
     small dense sub-blocks of a block-entry sparse matrix. Each node is 
     associated with a number of element-blocks, and each node has exactly one
     associated global 0-based block-equation number.
+
+  The field-ID and equation-number lists are held in a small inline buffer
+  that covers the common case of a few fields per node, so that creating and
+  populating a node doesn't require any heap allocations. Only nodes with
+  more than NUM_INLINE_FIELDS fields spill over into a single heap-allocated
+  array.
 */
 
 class NodeDescriptor {
@@ -39,8 +45,9 @@ class NodeDescriptor {
 
    NodeDescriptor(const NodeDescriptor& src)
     : nodeID_(src.nodeID_), nodeNumber_(src.nodeNumber_),
-      numNodalDOF_(0), fieldIDList_(NULL),
-      fieldEqnNumbers_(NULL), numFields_(0), blkEqnNumber_(0),
+      numNodalDOF_(0), fieldIDList_(inlineFieldIDs_),
+      fieldEqnNumbers_(inlineFieldEqnNumbers_), numFields_(0),
+      fieldCapacity_(NUM_INLINE_FIELDS), blkEqnNumber_(0),
       ownerProc_(src.ownerProc_), blockList_()
    {}
 
@@ -103,8 +110,9 @@ class NodeDescriptor {
  private:
    NodeDescriptor& operator=(const NodeDescriptor& src);
 
-   void allocFieldLists();
-   void allocBlockList();
+   void growFieldLists();
+
+   enum { NUM_INLINE_FIELDS = 3 };
 
    GlobalID nodeID_;
 
@@ -118,6 +126,10 @@ class NodeDescriptor {
                           //have more than one associated equation), this
                           //is the first equation number
    int numFields_;
+   int fieldCapacity_;
+
+   int inlineFieldIDs_[NUM_INLINE_FIELDS];
+   int inlineFieldEqnNumbers_[NUM_INLINE_FIELDS];
 
    int blkEqnNumber_;
 
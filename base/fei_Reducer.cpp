@@ -19,6 +19,8 @@
 #include <fei_Vector.hpp>
 #include <fei_impl_utils.hpp>
 
+#include <algorithm>
+
 namespace fei {
 
 Reducer::Reducer(fei::SharedPtr<FillableMat> globalSlaveDependencyMatrix,
@@ -55,6 +57,10 @@ Reducer::Reducer(fei::SharedPtr<FillableMat> globalSlaveDependencyMatrix,
    lastLocalReducedEqn_(0),
    lowestGlobalSlaveEqn_(0),
    highestGlobalSlaveEqn_(0),
+   reducedEqnTable_(),
+   tableFirstEqn_(0),
+   firstGhostEqn_(0),
+   lastGhostEqn_(-1),
    localProc_(0),
    numProcs_(1),
    comm_(comm),
@@ -106,7 +112,7 @@ Reducer::initialize()
   int slaveOffset = 0;
   int num_consecutive = 0;
   while(slaveOffset < numGlobalSlaves_-1) {
-    int gap = slavesPtr_[slaveOffset+1]-slavesPtr_[slaveOffset]-1;
+    GlobalOrdinal gap = slavesPtr_[slaveOffset+1]-slavesPtr_[slaveOffset]-1;
     if (gap > 0) {
       nonslaves_[nonslave_counter] = slavesPtr_[slaveOffset]+1;
       nonslaves_[numGlobalSlaves_+nonslave_counter++] = num_consecutive;
@@ -122,7 +128,7 @@ Reducer::initialize()
   nonslaves_[numGlobalSlaves_+nonslave_counter++] = num_consecutive;
 
   reverse_.resize(nonslave_counter);
-  int first = lowestGlobalSlaveEqn_;
+  GlobalOrdinal first = lowestGlobalSlaveEqn_;
   reverse_[0] = first;
   for(int i=1; i<nonslave_counter; ++i) {
     reverse_[i] = reverse_[i-1] +
@@ -143,6 +149,69 @@ Reducer::initialize()
   if (numGlobalSlaves_ < 1) {
     throw std::runtime_error("ERROR: don't use fei::Reducer when numGlobalSlaves==0. Report to Alan Williams.");
   }
+
+  initTranslationTable();
+}
+
+void
+Reducer::initTranslationTable()
+{
+  reducedEqnTable_.clear();
+  if (localUnreducedEqns_.empty()) {
+    return;
+  }
+
+  GlobalOrdinal first = localUnreducedEqns_[0];
+  GlobalOrdinal last = localUnreducedEqns_[localUnreducedEqns_.size()-1];
+
+  //cover the ghost eqns too, unless they are so far from the local eqns
+  //that the table would be mostly unused.
+  if (lastGhostEqn_ >= firstGhostEqn_) {
+    GlobalOrdinal gfirst = std::min(first, firstGhostEqn_);
+    GlobalOrdinal glast = std::max(last, lastGhostEqn_);
+    GlobalOrdinal maxLen = 2*(last-first+1) + 4096;
+    if (glast - gfirst < maxLen) {
+      first = gfirst;
+      last = glast;
+    }
+  }
+
+  tableFirstEqn_ = first;
+  reducedEqnTable_.resize(last-first+1);
+
+  //walk the window and the sorted global slave list together. The reduced
+  //eqn is the unreduced eqn minus the number of slaves below it.
+  int numSlavesBelow =
+    std::lower_bound(slavesPtr_, slavesPtr_+numGlobalSlaves_, first) - slavesPtr_;
+  GlobalOrdinal* table = &reducedEqnTable_[0];
+  for(GlobalOrdinal eqn=first; eqn<=last; ++eqn) {
+    if (numSlavesBelow < numGlobalSlaves_ &&
+        slavesPtr_[numSlavesBelow] == eqn) {
+      *table++ = -1;
+      ++numSlavesBelow;
+    }
+    else {
+      *table++ = eqn - numSlavesBelow;
+    }
+  }
+}
+
+void
+Reducer::setGhostUnreducedEqns(
+                     const std::vector<GlobalOrdinal>& ghostUnreducedEqns)
+{
+  if (ghostUnreducedEqns.empty()) {
+    firstGhostEqn_ = 0;
+    lastGhostEqn_ = -1;
+  }
+  else {
+    firstGhostEqn_ = *std::min_element(ghostUnreducedEqns.begin(),
+                                       ghostUnreducedEqns.end());
+    lastGhostEqn_ = *std::max_element(ghostUnreducedEqns.begin(),
+                                      ghostUnreducedEqns.end());
+  }
+
+  initTranslationTable();
 }
 
 Reducer::Reducer(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
@@ -171,6 +240,10 @@ Reducer::Reducer(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
    lastLocalReducedEqn_(0),
    lowestGlobalSlaveEqn_(0),
    highestGlobalSlaveEqn_(0),
+   reducedEqnTable_(),
+   tableFirstEqn_(0),
+   firstGhostEqn_(0),
+   lastGhostEqn_(-1),
    localProc_(0),
    numProcs_(1),
    comm_(),
@@ -186,9 +259,12 @@ Reducer::Reducer(fei::SharedPtr<fei::MatrixGraph> matrixGraph)
   comm_ = vecSpace->getCommunicator();
   initialize();
 
-  std::vector<int> indices;
+  std::vector<GlobalOrdinal> indices;
   vecSpace->getIndices_Owned(indices);
   setLocalUnreducedEqns(indices);
+
+  vecSpace->getIndices_SharedAndOwned(indices);
+  setGhostUnreducedEqns(indices);
 }
 
 Reducer::~Reducer()
@@ -201,7 +277,8 @@ Reducer::~Reducer()
 }
 
 void
-Reducer::setLocalUnreducedEqns(const std::vector<int>& localUnreducedEqns)
+Reducer::setLocalUnreducedEqns(
+                     const std::vector<GlobalOrdinal>& localUnreducedEqns)
 {
   if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
     FEI_OSTREAM& os = *output_stream_;
@@ -236,7 +313,8 @@ Reducer::setLocalUnreducedEqns(const std::vector<int>& localUnreducedEqns)
         os << dbgprefix_<<" slave " << localUnreducedEqns_[i] << " depends on ";
         int offset = csrD_.getGraph().rowOffsets[idx];
         int rowlen = csrD_.getGraph().rowOffsets[idx+1]-offset;
-        int* indices = &(csrD_.getGraph().packedColumnIndices[offset]);
+        GlobalOrdinal* indices =
+          &(csrD_.getGraph().packedColumnIndices[offset]);
         for(int j=0; j<rowlen; ++j) {
           os << indices[j] << " ";
         }
@@ -281,7 +359,7 @@ Reducer::setLocalUnreducedEqns(const std::vector<int>& localUnreducedEqns)
   }
 
   unsigned offset = 0;
-  int eqn = firstLocalReducedEqn_;
+  GlobalOrdinal eqn = firstLocalReducedEqn_;
   for(unsigned i=0; i<localUnreducedEqns_.size(); ++i) {
     if (isSlaveEqn_[i] == false) {
       localReducedEqns_[offset++] = eqn++;
@@ -299,6 +377,8 @@ Reducer::setLocalUnreducedEqns(const std::vector<int>& localUnreducedEqns)
        <<", firstLocalReducedEqn_="<<firstLocalReducedEqn_
        <<", lastLocalReducedEqn_="<<lastLocalReducedEqn_<<FEI_ENDL;
   }
+
+  initTranslationTable();
 }
 
 void
@@ -312,17 +392,17 @@ Reducer::addGraphEntries(fei::SharedPtr<fei::SparseRowGraph> matrixGraph)
   //iterate through the incoming matrixGraph, putting its contents into
   //Kdd, Kdi, Kid and Kii as appropriate.
 
-  std::vector<int>& rowNumbers = matrixGraph->rowNumbers;
+  std::vector<GlobalOrdinal>& rowNumbers = matrixGraph->rowNumbers;
   std::vector<int>& rowOffsets = matrixGraph->rowOffsets;
-  std::vector<int>& packedCols = matrixGraph->packedColumnIndices;
+  std::vector<GlobalOrdinal>& packedCols = matrixGraph->packedColumnIndices;
 
   for(unsigned i=0; i<rowNumbers.size(); ++i) {
-    int row = rowNumbers[i];
+    GlobalOrdinal row = rowNumbers[i];
 
     bool slave_row = isSlaveEqn(row);
 
     int rowLength = rowOffsets[i+1]-rowOffsets[i];
-    int* cols = &packedCols[rowOffsets[i]];
+    GlobalOrdinal* cols = &packedCols[rowOffsets[i]];
 
     if (slave_row) {
       fei::CSVec* Kdd_row = Kdd_.create_or_getRow(row);
@@ -371,13 +451,13 @@ Reducer::expand_work_arrays(int size)
   delete [] int_array_;
   delete [] double_array_;
   bool_array_ = new bool[array_len_];
-  int_array_ = new int[array_len_];
+  int_array_ = new GlobalOrdinal[array_len_];
   double_array_ = new double[array_len_];
 }
 
 void
-Reducer::addGraphIndices(int numRows, const int* rows,
-                         int numCols, const int* cols,
+Reducer::addGraphIndices(int numRows, const GlobalOrdinal* rows,
+                         int numCols, const GlobalOrdinal* cols,
                          fei::Graph& graph)
 {
   expand_work_arrays(numCols);
@@ -424,7 +504,7 @@ Reducer::addGraphIndices(int numRows, const int* rows,
       }
 
       if (num_non_slave_cols > 0) {
-        int reduced_row = translateToReducedEqn(rows[i]);
+        GlobalOrdinal reduced_row = translateToReducedEqn(rows[i]);
         graph.addIndices(reduced_row, num_non_slave_cols, int_array_);
       }
     }
@@ -436,7 +516,8 @@ Reducer::addGraphIndices(int numRows, const int* rows,
 }
 
 void
-Reducer::addSymmetricGraphIndices(int numIndices, const int* indices,
+Reducer::addSymmetricGraphIndices(int numIndices,
+                                  const GlobalOrdinal* indices,
                                   bool diagonal,
                                   fei::Graph& graph)
 {
@@ -591,12 +672,12 @@ Reducer::assembleReducedMatrix(fei::Matrix& matrix)
 }
 
 bool
-Reducer::isSlaveEqn(int unreducedEqn) const
+Reducer::isSlaveEqn(GlobalOrdinal unreducedEqn) const
 {
   int num = localUnreducedEqns_.size();
 
-  int offset = num>0 ? unreducedEqn - localUnreducedEqns_[0] : -1;
-  if (offset < 0 || offset >= (int)localUnreducedEqns_.size()) {
+  GlobalOrdinal offset = num>0 ? unreducedEqn - localUnreducedEqns_[0] : -1;
+  if (offset < 0 || offset >= num) {
     return(isSlaveCol(unreducedEqn));
   }
 
@@ -604,13 +685,14 @@ Reducer::isSlaveEqn(int unreducedEqn) const
 }
 
 void
-Reducer::getSlaveMasterEqns(int slaveEqn, std::vector<int>& masterEqns)
+Reducer::getSlaveMasterEqns(GlobalOrdinal slaveEqn,
+                            std::vector<GlobalOrdinal>& masterEqns)
 {
   masterEqns.clear();
 
-  std::vector<int>& rows = csrD_.getGraph().rowNumbers;
+  std::vector<GlobalOrdinal>& rows = csrD_.getGraph().rowNumbers;
 
-  std::vector<int>::iterator iter =
+  std::vector<GlobalOrdinal>::iterator iter =
     std::lower_bound(rows.begin(), rows.end(), slaveEqn);
 
   if (iter == rows.end() || *iter != slaveEqn) {
@@ -621,7 +703,8 @@ Reducer::getSlaveMasterEqns(int slaveEqn, std::vector<int>& masterEqns)
 
   int rowBegin = csrD_.getGraph().rowOffsets[offset];
   int rowEnd = csrD_.getGraph().rowOffsets[offset+1];
-  std::vector<int>& cols = csrD_.getGraph().packedColumnIndices;
+  std::vector<GlobalOrdinal>& cols =
+    csrD_.getGraph().packedColumnIndices;
 
   for(int j=rowBegin; j<rowEnd; ++j) {
     masterEqns.push_back(cols[j]);
@@ -629,17 +712,31 @@ Reducer::getSlaveMasterEqns(int slaveEqn, std::vector<int>& masterEqns)
 }
 
 bool
-Reducer::isSlaveCol(int unreducedEqn) const
+Reducer::isSlaveCol(GlobalOrdinal unreducedEqn) const
 {
+  GlobalOrdinal offset = unreducedEqn - tableFirstEqn_;
+  if (offset >= 0 && offset < (GlobalOrdinal)reducedEqnTable_.size()) {
+    return( reducedEqnTable_[offset] < 0 );
+  }
+
   int idx = fei::binarySearch(unreducedEqn,
                                   slavesPtr_, numGlobalSlaves_);
   
   return(idx>=0);
 }
 
-int
-Reducer::translateToReducedEqn(int eqn) const
+GlobalOrdinal
+Reducer::translateToReducedEqn(GlobalOrdinal eqn) const
 {
+  GlobalOrdinal offset = eqn - tableFirstEqn_;
+  if (offset >= 0 && offset < (GlobalOrdinal)reducedEqnTable_.size()) {
+    GlobalOrdinal reducedEqn = reducedEqnTable_[offset];
+    if (reducedEqn < 0) {
+      throw std::runtime_error("Reducer::translateToReducedEqn ERROR, input is slave eqn.");
+    }
+    return(reducedEqn);
+  }
+
   if (eqn < lowestGlobalSlaveEqn_) {
     return(eqn);
   }
@@ -659,8 +756,8 @@ Reducer::translateToReducedEqn(int eqn) const
   return(eqn - index);
 }
 
-int
-Reducer::translateFromReducedEqn(int reduced_eqn) const
+GlobalOrdinal
+Reducer::translateFromReducedEqn(GlobalOrdinal reduced_eqn) const
 {
   int index = -1;
   int offset = fei::binarySearch(reduced_eqn, &reverse_[0],
@@ -673,14 +770,14 @@ Reducer::translateFromReducedEqn(int reduced_eqn) const
     return(reduced_eqn);
   }
 
-  int adjustment = reduced_eqn - reverse_[index-1];
+  GlobalOrdinal adjustment = reduced_eqn - reverse_[index-1];
 
   return(nonslaves_[index-1] + adjustment);
 }
 
 int
-Reducer::addMatrixValues(int numRows, const int* rows,
-                         int numCols, const int* cols,
+Reducer::addMatrixValues(int numRows, const GlobalOrdinal* rows,
+                         int numCols, const GlobalOrdinal* cols,
                          const double* const* values,
                          bool sum_into,
                          fei::Matrix& feimat,
@@ -751,7 +848,7 @@ Reducer::addMatrixValues(int numRows, const int* rows,
     }
     else {//not slave row
       if (no_slave_cols) {
-        int reduced_row = int_array_[numCols+i];
+        GlobalOrdinal reduced_row = int_array_[numCols+i];
         const double* rowvals = myvalues[i];
         if (sum_into) {
           feimat.sumIn(1, &reduced_row, numCols, int_array_,
@@ -780,7 +877,7 @@ Reducer::addMatrixValues(int numRows, const int* rows,
       }
 
       if (num_non_slave_cols > 0) {
-        int reduced_row = int_array_[numCols+i];
+        GlobalOrdinal reduced_row = int_array_[numCols+i];
         if (sum_into) {
           feimat.sumIn(1, &reduced_row, num_non_slave_cols, int_array_,
                        &double_array_, format);
@@ -802,7 +899,7 @@ Reducer::addMatrixValues(int numRows, const int* rows,
 
 int
 Reducer::addVectorValues(int numValues,
-                         const int* globalIndices,
+                         const GlobalOrdinal* globalIndices,
                          const double* values,
                          bool sum_into,
                          bool soln_vector,
@@ -825,7 +922,8 @@ Reducer::addVectorValues(int numValues,
       if (!soln_vector) ++rhs_vec_counter_;
     }
     else {
-      int reduced_index = translateToReducedEqn(globalIndices[i]);
+      GlobalOrdinal reduced_index =
+        translateToReducedEqn(globalIndices[i]);
 
       if (sum_into) {
         feivec.sumIn(1, &reduced_index, &values[i], vectorIndex);
@@ -890,7 +988,7 @@ Reducer::assembleReducedVector(bool soln_vector,
 
 int
 Reducer::copyOutVectorValues(int numValues,
-                             const int* globalIndices,
+                             const GlobalOrdinal* globalIndices,
                              double* values,
                              bool soln_vector,
                              int vectorIndex,
@@ -903,7 +1001,7 @@ Reducer::copyOutVectorValues(int numValues,
 
   tmpVec1_.clear();
   tmpVec2_.clear();
-  std::vector<int> reduced_indices;
+  std::vector<GlobalOrdinal> reduced_indices;
   std::vector<int> offsets;
 
   for(int i=0; i<numValues; ++i) {
@@ -912,26 +1010,27 @@ Reducer::copyOutVectorValues(int numValues,
       offsets.push_back(i);
     }
     else {
-      int reduced_idx = translateToReducedEqn(globalIndices[i]);
+      GlobalOrdinal reduced_idx =
+        translateToReducedEqn(globalIndices[i]);
       feivec.copyOut(1, &reduced_idx, &values[i], vectorIndex);
     }
   }
 
   if (tmpVec1_.size() > 0) {
     fei::multiply_trans_CSRMat_CSVec(csrD_, tmpVec1_, tmpVec2_);
-    int* tmpVec2Indices = tmpVec2_.indices().empty() ? NULL : &(tmpVec2_.indices()[0]);
+    GlobalOrdinal* tmpVec2Indices = tmpVec2_.indices().empty() ? NULL : &(tmpVec2_.indices()[0]);
     double* tmpVec2Coefs = tmpVec2_.coefs().empty() ? NULL : &(tmpVec2_.coefs()[0]);
     for(size_t i=0; i<tmpVec2_.size(); ++i) {
       reduced_indices.push_back(translateToReducedEqn(tmpVec2Indices[i]));
     }
 
-    int* reduced_indices_ptr = reduced_indices.empty() ? NULL : &reduced_indices[0];
+    GlobalOrdinal* reduced_indices_ptr = reduced_indices.empty() ? NULL : &reduced_indices[0];
     feivec.copyOut(tmpVec2_.size(), reduced_indices_ptr, tmpVec2Coefs, vectorIndex);
 
     fei::multiply_CSRMat_CSVec(csrD_, tmpVec2_, tmpVec1_);
 
     if (g_nonzero_) {
-      int* ginds = &(csg_.indices()[0]);
+      GlobalOrdinal* ginds = &(csg_.indices()[0]);
       double* gcoefs = &(csg_.coefs()[0]);
       for(size_t ii=0; ii<csg_.size(); ++ii) {
         fei::add_entry(tmpVec1_, ginds[ii], gcoefs[ii]);
@@ -939,11 +1038,11 @@ Reducer::copyOutVectorValues(int numValues,
     }
 
     int len = tmpVec1_.size();
-    int* indices = &(tmpVec1_.indices()[0]);
+    GlobalOrdinal* indices = &(tmpVec1_.indices()[0]);
     double* coefs = &(tmpVec1_.coefs()[0]);
 
     for(unsigned ii=0; ii<offsets.size(); ++ii) {
-      int index = globalIndices[offsets[ii]];
+      GlobalOrdinal index = globalIndices[offsets[ii]];
       int idx = fei::binarySearch(index, indices, len);
       if (idx < 0) {
         continue;
@@ -956,7 +1055,7 @@ Reducer::copyOutVectorValues(int numValues,
   return(0);
 }
 
-std::vector<int>&
+std::vector<GlobalOrdinal>&
 Reducer::getLocalReducedEqns()
 {
   return(localReducedEqns_);
@@ -40,19 +40,30 @@ namespace fei {
     virtual ~Reducer();
 
     //@}
-    void setLocalUnreducedEqns(const std::vector<int>& localUnreducedEqns);
-
+    void setLocalUnreducedEqns(
+                     const std::vector<GlobalOrdinal>& localUnreducedEqns);
+
+    /** Specify the (unreduced) equations that will appear locally as
+        matrix columns or shared rows but are owned elsewhere. The dense
+        translation table used by translateToReducedEqn and isSlaveEqn is
+        extended to cover them, provided they lie reasonably close to the
+        locally-owned equations. Equations outside the table fall back to a
+        binary search of the global slave list.
+    */
+    void setGhostUnreducedEqns(
+                     const std::vector<GlobalOrdinal>& ghostUnreducedEqns);
     
     /** Set the matrix-graph structure. This is the nonzero structure for
         locally-owned matrix rows.
     */
     void addGraphEntries(fei::SharedPtr<fei::SparseRowGraph> matrixGraph);
 
-    void addGraphIndices(int numRows, const int* rows,
-                         int numCols, const int* cols,
+    void addGraphIndices(int numRows, const GlobalOrdinal* rows,
+                         int numCols, const GlobalOrdinal* cols,
                          fei::Graph& graph);
 
-    void addSymmetricGraphIndices(int numIndices, const int* indices,
+    void addSymmetricGraphIndices(int numIndices,
+                                  const GlobalOrdinal* indices,
                                   bool diagonal,
                                   fei::Graph& graph);
 
@@ -63,8 +74,8 @@ namespace fei {
         already exist at the specified locations. Otherwise (if sum_into is
         false) incoming values should overwrite already-existing values.
      */
-    int addMatrixValues(int numRows, const int* rows,
-                        int numCols, const int* cols,
+    int addMatrixValues(int numRows, const GlobalOrdinal* rows,
+                        int numCols, const GlobalOrdinal* cols,
                         const double* const* values,
                         bool sum_into,
                         fei::Matrix& feimat,
@@ -96,7 +107,7 @@ namespace fei {
                        values should be put into.
     */
     int addVectorValues(int numValues,
-                        const int* globalIndices,
+                        const GlobalOrdinal* globalIndices,
                         const double* values,
                         bool sum_into,
                         bool soln_vector,
@@ -104,22 +115,23 @@ namespace fei {
                         fei::Vector& feivec);
 
     int copyOutVectorValues(int numValues,
-                             const int* globalIndices,
+                             const GlobalOrdinal* globalIndices,
                              double* values,
                              bool soln_vector,
                              int vectorIndex,
                              fei::Vector& feivec);
 
-    void getSlaveMasterEqns(int slaveEqn, std::vector<int>& masterEqns);
-    bool isSlaveEqn(int unreducedEqn) const;
-    bool isSlaveCol(int unreducedEqn) const;
+    void getSlaveMasterEqns(GlobalOrdinal slaveEqn,
+                            std::vector<GlobalOrdinal>& masterEqns);
+    bool isSlaveEqn(GlobalOrdinal unreducedEqn) const;
+    bool isSlaveCol(GlobalOrdinal unreducedEqn) const;
 
     /** Given an equation-number in the caller's unreduced index-space,
       return the corresponding equation in the reduced space.
       If unreducedEqn is a slave, an exception will be thrown.
     */
-    int translateToReducedEqn(int unreducedEqn) const;
-    int translateFromReducedEqn(int reduced_eqn) const;
+    GlobalOrdinal translateToReducedEqn(GlobalOrdinal unreducedEqn) const;
+    GlobalOrdinal translateFromReducedEqn(GlobalOrdinal reduced_eqn) const;
     void assembleReducedGraph(fei::Graph* graph,
                               bool global_gather=true);
     void assembleReducedGraph(fei::SparseRowGraph* srgraph);
@@ -127,14 +139,16 @@ namespace fei {
     void assembleReducedVector(bool soln_vector,
                                fei::Vector& feivec);
 
-    std::vector<int>& getLocalReducedEqns();
+    std::vector<GlobalOrdinal>& getLocalReducedEqns();
 
     void initialize();
    private:
     void expand_work_arrays(int size);
 
+    void initTranslationTable();
+
     fei::CSRMat csrD_;
-    int* slavesPtr_;
+    GlobalOrdinal* slavesPtr_;
     fei::FillableMat Kii_, Kid_, Kdi_, Kdd_;
     fei::CSRMat csrKii, csrKid, csrKdi, csrKdd;
     fei::CSVec fi_, fd_;
@@ -145,17 +159,24 @@ namespace fei {
     fei::CSVec csg_;
     bool g_nonzero_;
 
-    std::vector<int> localUnreducedEqns_;
-    std::vector<int> localReducedEqns_;
-    std::vector<int> nonslaves_;
-    std::vector<int> reverse_;
+    std::vector<GlobalOrdinal> localUnreducedEqns_;
+    std::vector<GlobalOrdinal> localReducedEqns_;
+    std::vector<GlobalOrdinal> nonslaves_;
+    std::vector<GlobalOrdinal> reverse_;
     bool* isSlaveEqn_;
     int numGlobalSlaves_;
     int numLocalSlaves_;
-    int firstLocalReducedEqn_;
-    int lastLocalReducedEqn_;
-    int lowestGlobalSlaveEqn_;
-    int highestGlobalSlaveEqn_;
+    GlobalOrdinal firstLocalReducedEqn_;
+    GlobalOrdinal lastLocalReducedEqn_;
+    GlobalOrdinal lowestGlobalSlaveEqn_;
+    GlobalOrdinal highestGlobalSlaveEqn_;
+
+    //reducedEqnTable_[eqn-tableFirstEqn_] is the reduced eqn, or -1 if eqn
+    //is a slave.
+    std::vector<GlobalOrdinal> reducedEqnTable_;
+    GlobalOrdinal tableFirstEqn_;
+    GlobalOrdinal firstGhostEqn_;
+    GlobalOrdinal lastGhostEqn_;
 
     int localProc_;
     int numProcs_;
@@ -165,7 +186,7 @@ namespace fei {
     unsigned rhs_vec_counter_;
 
     bool* bool_array_;
-    int* int_array_;
+    GlobalOrdinal* int_array_;
     double* double_array_;
     int array_len_;
 
@@ -21,7 +21,7 @@ ReverseMapper::ReverseMapper(const VectorSpace& vspace)
   std::vector<int> idTypes;
   vspace.getIDTypes(idTypes);
 
-  const std::vector<int>& eqnNumbers = vspace.getEqnNumbers();
+  const std::vector<GlobalOrdinal>& eqnNumbers = vspace.getEqnNumbers();
 
   for(size_t idt=0; idt<idTypes.size(); ++idt) {
     const snl_fei::RecordCollection* recordcollection = NULL;
@@ -68,9 +68,10 @@ ReverseMapper::~ReverseMapper()
 {
 }
 
-EqnRecord ReverseMapper::getEqnRecord(int global_eqn, int option) const
+EqnRecord ReverseMapper::getEqnRecord(GlobalOrdinal global_eqn,
+                                      int option) const
 {
-  std::map<int,EqnRecord>::const_iterator
+  std::map<GlobalOrdinal,EqnRecord>::const_iterator
     iter = eqnmap_.find(global_eqn);
 
   if (iter == eqnmap_.end()) {
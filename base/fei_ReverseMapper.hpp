@@ -27,10 +27,10 @@ class ReverseMapper {
   /** destructor */
   virtual ~ReverseMapper();
 
-  EqnRecord getEqnRecord(int global_eqn, int option=0) const;
+  EqnRecord getEqnRecord(GlobalOrdinal global_eqn, int option=0) const;
 
  private:
-  std::map<int,EqnRecord> eqnmap_;
+  std::map<GlobalOrdinal,EqnRecord> eqnmap_;
 
   ReverseMapper(const ReverseMapper& src);
   ReverseMapper& operator=(const ReverseMapper& src);
@@ -0,0 +1,609 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_Solver_DistCSR.hpp>
+#include <fei_DistCSRMat.hpp>
+#include <fei_DistVec.hpp>
+#include <fei_Matrix_Impl.hpp>
+#include <fei_Vector_Impl.hpp>
+#include <fei_MatrixReducer.hpp>
+#include <fei_VectorReducer.hpp>
+#include <fei_MatrixTraits_DistCSRMat.hpp>
+#include <fei_VectorTraits_DistVec.hpp>
+#include <fei_LinearSystem.hpp>
+#include <fei_ParameterSet.hpp>
+#include <fei_CommUtils.hpp>
+#include <fei_iostream.hpp>
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+
+#undef fei_file
+#define fei_file "fei_Solver_DistCSR.cpp"
+#include <fei_ErrMacros.hpp>
+
+namespace fei {
+
+//----------------------------------------------------------------------------
+template<typename Scalar>
+static fei::DistCSRMatrix<Scalar>* get_DistCSRMatrix(fei::Matrix* matrix)
+{
+  fei::MatrixReducer* matred = dynamic_cast<fei::MatrixReducer*>(matrix);
+  if (matred != NULL) matrix = matred->getTargetMatrix().get();
+
+  fei::Matrix_Impl<fei::DistCSRMatrix<Scalar> >* dmat =
+    dynamic_cast<fei::Matrix_Impl<fei::DistCSRMatrix<Scalar> >*>(matrix);
+
+  return( dmat != NULL ? dmat->getMatrix().get() : NULL );
+}
+
+//----------------------------------------------------------------------------
+static fei::DistVec* get_DistVec(fei::Vector* vector)
+{
+  fei::VectorReducer* vecred = dynamic_cast<fei::VectorReducer*>(vector);
+  if (vecred != NULL) vector = vecred->getTargetVector().get();
+
+  fei::Vector_Impl<fei::DistVec>* dvec =
+    dynamic_cast<fei::Vector_Impl<fei::DistVec>*>(vector);
+
+  return( dvec != NULL ? dvec->getUnderlyingVector() : NULL );
+}
+
+//----------------------------------------------------------------------------
+static int globalDot(MPI_Comm comm, int len, const double* a, const double* b,
+                     double& result)
+{
+  double localSum = 0.0;
+  for(int i=0; i<len; ++i) localSum += a[i]*b[i];
+
+  return( fei::GlobalSum(comm, localSum, result) );
+}
+
+//----------------------------------------------------------------------------
+Solver_DistCSR::Solver_DistCSR()
+ : tolerance_(1.e-6),
+   maxIters_(500),
+   kspace_(30),
+   outputLevel_(0),
+   localProc_(0),
+   precondType_(PRECOND_JACOBI),
+   invDiag_(),
+   iluRowOffsets_(),
+   iluCols_(),
+   iluDiag_(),
+   iluCoefs_(),
+   iluCoefsF_()
+{
+}
+
+//----------------------------------------------------------------------------
+Solver_DistCSR::~Solver_DistCSR()
+{
+}
+
+//----------------------------------------------------------------------------
+int Solver_DistCSR::solve(fei::LinearSystem* linearSystem,
+                          fei::Matrix* preconditioningMatrix,
+                          const fei::ParameterSet& parameterSet,
+                          int& iterationsTaken,
+                          int& status)
+{
+  iterationsTaken = 0;
+  status = 1;
+
+  fei::SharedPtr<fei::Matrix> feiA = linearSystem->getMatrix();
+  fei::SharedPtr<fei::Vector> feix = linearSystem->getSolutionVector();
+  fei::SharedPtr<fei::Vector> feib = linearSystem->getRHS();
+
+  fei::DistCSRMat* A = get_DistCSRMatrix<double>(feiA.get());
+  fei::DistVec* x = get_DistVec(feix.get());
+  fei::DistVec* b = get_DistVec(feib.get());
+
+  if (A == NULL || x == NULL || b == NULL) {
+    fei::console_out() << "Solver_DistCSR::solve Error, couldn't obtain "
+       << "DistCSRMat/DistVec objects from fei container-objects."<<FEI_ENDL;
+    return(-1);
+  }
+
+  if (x->localSize() != A->numLocalRows() ||
+      b->localSize() != A->numLocalRows() ||
+      x->numVectors() != b->numVectors()) {
+    ERReturn(-1);
+  }
+
+  const fei::DistCSRMat* precondA = A;
+  const fei::DistCSRMatrix<float>* precondAF = NULL;
+  if (preconditioningMatrix != NULL) {
+    fei::DistCSRMat* pmat = get_DistCSRMatrix<double>(preconditioningMatrix);
+    if (pmat != NULL) precondA = pmat;
+    fei::DistCSRMatrix<float>* pmatF =
+      get_DistCSRMatrix<float>(preconditioningMatrix);
+    if (pmatF != NULL) {
+      pmatF->completeAssembly();
+      precondAF = pmatF;
+    }
+  }
+
+  localProc_ = fei::localProc(A->getCommunicator());
+
+  std::string solverName("cg");
+  std::string precondName("jacobi");
+  parameterSet.getStringParamValue("solver", solverName);
+  parameterSet.getStringParamValue("preconditioner", precondName);
+  parameterSet.getDoubleParamValue("tolerance", tolerance_);
+  parameterSet.getIntParamValue("maxIterations", maxIters_);
+  parameterSet.getIntParamValue("gmresRestart", kspace_);
+  parameterSet.getIntParamValue("outputLevel", outputLevel_);
+
+  std::transform(solverName.begin(), solverName.end(),
+                 solverName.begin(), ::tolower);
+  std::transform(precondName.begin(), precondName.end(),
+                 precondName.begin(), ::tolower);
+
+  //a failure to set up the preconditioner (e.g., a zero diagonal) must be
+  //agreed on, since the iterations are collective.
+  int err = precondAF != NULL ? setupPreconditioner(*precondAF, precondName)
+                              : setupPreconditioner(*precondA, precondName);
+  int localErr = err != 0 ? 1 : 0;
+  int globalErr = 0;
+  CHK_ERR( fei::GlobalMax(A->getCommunicator(), localErr, globalErr) );
+  if (globalErr != 0) {
+    if (localErr != 0) {
+      fei::console_out() << "Solver_DistCSR::solve Error, failed to set up "
+         << "preconditioner '"<<precondName<<"'."<<FEI_ENDL;
+    }
+    return(-1);
+  }
+
+  if (solverName == "gmres") {
+    if (b->numVectors() == 1) {
+      CHK_ERR( solveGMRES(*A, *b, *x, iterationsTaken, status) );
+      return(0);
+    }
+
+    //solve for each right-hand-side in turn, reusing the preconditioner.
+    const int n = A->numLocalRows();
+    fei::DistVec bv(A->getCommunicator(), A->firstLocalRow(), n);
+    fei::DistVec xv(A->getCommunicator(), A->firstLocalRow(), n);
+    int numConverged = 0;
+    for(int v=0; v<b->numVectors(); ++v) {
+      std::copy(b->getLocalCoefs(v), b->getLocalCoefs(v)+n, bv.getLocalCoefs());
+      std::copy(x->getLocalCoefs(v), x->getLocalCoefs(v)+n, xv.getLocalCoefs());
+
+      int iters = 0, vstatus = 1;
+      CHK_ERR( solveGMRES(*A, bv, xv, iters, vstatus) );
+      if (iters > iterationsTaken) iterationsTaken = iters;
+      if (vstatus == 0) ++numConverged;
+
+      std::copy(xv.getLocalCoefs(), xv.getLocalCoefs()+n, x->getLocalCoefs(v));
+    }
+    if (numConverged == b->numVectors()) status = 0;
+  }
+  else if (solverName == "cg") {
+    CHK_ERR( solveCG(*A, *b, *x, iterationsTaken, status) );
+  }
+  else {
+    fei::console_out() << "Solver_DistCSR::solve Error, unknown solver '"
+       << solverName << "'."<<FEI_ENDL;
+    return(-1);
+  }
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+template<typename Scalar>
+int Solver_DistCSR::setupPreconditioner(const fei::DistCSRMatrix<Scalar>& A,
+                                        const std::string& precond)
+{
+  invDiag_.clear();
+  iluRowOffsets_.clear();
+  iluCols_.clear();
+  iluDiag_.clear();
+  iluCoefs_.clear();
+  iluCoefsF_.clear();
+
+  if (precond == "none") {
+    precondType_ = PRECOND_NONE;
+    return(0);
+  }
+
+  const int numRows = A.numLocalRows();
+  const std::vector<int>& rowOffsets = A.getRowOffsets();
+  const std::vector<int>& ghostBegin = A.getGhostBegin();
+  const std::vector<int>& colIndices = A.getColIndices();
+  const std::vector<Scalar>& coefs = A.getCoefs();
+
+  if (precond == "jacobi") {
+    precondType_ = PRECOND_JACOBI;
+    invDiag_.assign(numRows, 0.0);
+
+    for(int i=0; i<numRows; ++i) {
+      for(int k=rowOffsets[i]; k<ghostBegin[i]; ++k) {
+        if (colIndices[k] == i) {
+          if (coefs[k] == 0.0) return(-1);
+          invDiag_[i] = 1.0/coefs[k];
+          break;
+        }
+      }
+      if (invDiag_[i] == 0.0) return(-1);
+    }
+
+    return(0);
+  }
+
+  if (precond != "ilu0") return(-1);
+
+  precondType_ = PRECOND_ILU0;
+
+  //copy the owned-column part of each row. Columns are already sorted
+  //within each row, and owned local column j is local row j.
+  iluRowOffsets_.resize(numRows+1);
+  iluDiag_.assign(numRows, -1);
+  iluRowOffsets_[0] = 0;
+  for(int i=0; i<numRows; ++i) {
+    for(int k=rowOffsets[i]; k<ghostBegin[i]; ++k) {
+      if (colIndices[k] == i) iluDiag_[i] = iluCols_.size();
+      iluCols_.push_back(colIndices[k]);
+      iluCoefs_.push_back(coefs[k]);
+    }
+    if (iluDiag_[i] < 0) return(-1);
+    iluRowOffsets_[i+1] = iluCols_.size();
+  }
+
+  //IKJ-ordered ILU(0): only entries in the original pattern are updated.
+  std::vector<int> colPos(numRows, -1);
+  for(int i=0; i<numRows; ++i) {
+    const int rowBegin = iluRowOffsets_[i];
+    const int rowEnd = iluRowOffsets_[i+1];
+    for(int k=rowBegin; k<rowEnd; ++k) colPos[iluCols_[k]] = k;
+
+    for(int k=rowBegin; k<iluDiag_[i]; ++k) {
+      const int kcol = iluCols_[k];
+      const double pivot = iluCoefs_[iluDiag_[kcol]];
+      if (pivot == 0.0) return(-1);
+
+      const double lik = iluCoefs_[k] / pivot;
+      iluCoefs_[k] = lik;
+
+      for(int j=iluDiag_[kcol]+1; j<iluRowOffsets_[kcol+1]; ++j) {
+        const int pos = colPos[iluCols_[j]];
+        if (pos >= 0) iluCoefs_[pos] -= lik*iluCoefs_[j];
+      }
+    }
+
+    for(int k=rowBegin; k<rowEnd; ++k) colPos[iluCols_[k]] = -1;
+
+    if (iluCoefs_[iluDiag_[i]] == 0.0) return(-1);
+  }
+
+  //the factors of a single-precision matrix are kept in single precision.
+  if (sizeof(Scalar) < sizeof(double)) {
+    iluCoefsF_.assign(iluCoefs_.begin(), iluCoefs_.end());
+    std::vector<double>().swap(iluCoefs_);
+  }
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+template<typename Scalar>
+static void ilu_solve(int numRows,
+                      const int* rowOffsets,
+                      const int* diag,
+                      const int* cols,
+                      const Scalar* coefs,
+                      const double* r,
+                      double* z)
+{
+  //forward solve with the unit-lower factor
+  for(int i=0; i<numRows; ++i) {
+    double sum = r[i];
+    for(int k=rowOffsets[i]; k<diag[i]; ++k) {
+      sum -= coefs[k]*z[cols[k]];
+    }
+    z[i] = sum;
+  }
+
+  //backward solve with the upper factor
+  for(int i=numRows-1; i>=0; --i) {
+    double sum = z[i];
+    for(int k=diag[i]+1; k<rowOffsets[i+1]; ++k) {
+      sum -= coefs[k]*z[cols[k]];
+    }
+    z[i] = sum/coefs[diag[i]];
+  }
+}
+
+//----------------------------------------------------------------------------
+void Solver_DistCSR::applyPreconditioner(int numRows,
+                                         const double* r, double* z) const
+{
+  if (precondType_ == PRECOND_JACOBI) {
+    for(int i=0; i<numRows; ++i) z[i] = invDiag_[i]*r[i];
+    return;
+  }
+
+  if (precondType_ == PRECOND_ILU0) {
+    if (numRows < 1) return;
+
+    if (!iluCoefsF_.empty()) {
+      ilu_solve(numRows, &iluRowOffsets_[0], &iluDiag_[0], &iluCols_[0],
+                &iluCoefsF_[0], r, z);
+    }
+    else {
+      ilu_solve(numRows, &iluRowOffsets_[0], &iluDiag_[0], &iluCols_[0],
+                &iluCoefs_[0], r, z);
+    }
+    return;
+  }
+
+  for(int i=0; i<numRows; ++i) z[i] = r[i];
+}
+
+//----------------------------------------------------------------------------
+int Solver_DistCSR::solveCG(fei::DistCSRMat& A,
+                            const fei::DistVec& b,
+                            fei::DistVec& x,
+                            int& iterationsTaken,
+                            int& status)
+{
+  //With several right-hand-sides, the same iteration runs on each of them
+  //at once, so each iteration does one matrix-vector product (one halo
+  //exchange) and one reduction per dot-product for all of them. A
+  //right-hand-side stops being updated once it has converged.
+  MPI_Comm comm = A.getCommunicator();
+  const int first = A.firstLocalRow();
+  const int n = A.numLocalRows();
+  const int nv = b.numVectors();
+
+  fei::DistVec r(comm, first, n, nv), z(comm, first, n, nv);
+  fei::DistVec p(comm, first, n, nv), q(comm, first, n, nv);
+
+  std::vector<double> bnorm, rnorm, rz, pq, rzNew;
+  CHK_ERR( b.dots(b, bnorm) );
+  for(int v=0; v<nv; ++v) {
+    bnorm[v] = std::sqrt(bnorm[v]);
+    if (bnorm[v] == 0.0) bnorm[v] = 1.0;
+  }
+
+  //r = b - A*x
+  CHK_ERR( A.multiply(x, q) );
+  CHK_ERR( r.update(1.0, b, 0.0) );
+  CHK_ERR( r.update(-1.0, q, 1.0) );
+
+  //active[v] is false once rhs v has converged (or broken down).
+  std::vector<char> active(nv, 1);
+  int numActive = nv, numConverged = 0;
+
+  CHK_ERR( r.dots(r, rnorm) );
+  for(int v=0; v<nv; ++v) {
+    if (std::sqrt(rnorm[v])/bnorm[v] <= tolerance_) {
+      active[v] = 0;
+      --numActive;
+      ++numConverged;
+    }
+  }
+  if (numActive == 0) {
+    status = 0;
+    return(0);
+  }
+
+  for(int v=0; v<nv; ++v) {
+    applyPreconditioner(n, r.getLocalCoefs(v), z.getLocalCoefs(v));
+  }
+
+  CHK_ERR( p.update(1.0, z, 0.0) );
+
+  CHK_ERR( r.dots(z, rz) );
+
+  for(int iter=1; iter<=maxIters_; ++iter) {
+    CHK_ERR( A.multiply(p, q) );
+
+    CHK_ERR( p.dots(q, pq) );
+
+    for(int v=0; v<nv; ++v) {
+      if (!active[v]) continue;
+      if (pq[v] <= 0.0) {
+        //the matrix or preconditioner isn't positive-definite.
+        active[v] = 0;
+        --numActive;
+        continue;
+      }
+
+      const double alpha = rz[v]/pq[v];
+      double* xv = x.getLocalCoefs(v);
+      double* rv = r.getLocalCoefs(v);
+      const double* pv = p.getLocalCoefs(v);
+      const double* qv = q.getLocalCoefs(v);
+      for(int i=0; i<n; ++i) {
+        xv[i] += alpha*pv[i];
+        rv[i] -= alpha*qv[i];
+      }
+    }
+    if (numActive == 0) break;
+    iterationsTaken = iter;
+
+    CHK_ERR( r.dots(r, rnorm) );
+    double maxResid = 0.0;
+    for(int v=0; v<nv; ++v) {
+      if (!active[v]) continue;
+      const double resid = std::sqrt(rnorm[v])/bnorm[v];
+      if (resid > maxResid) maxResid = resid;
+      if (resid <= tolerance_) {
+        active[v] = 0;
+        --numActive;
+        ++numConverged;
+      }
+    }
+    if (outputLevel_ > 0 && localProc_ == 0) {
+      FEI_COUT << "Solver_DistCSR cg iter " << iter << ", relative residual "
+               << maxResid << FEI_ENDL;
+    }
+    if (numActive == 0) break;
+
+    for(int v=0; v<nv; ++v) {
+      if (!active[v]) continue;
+      applyPreconditioner(n, r.getLocalCoefs(v), z.getLocalCoefs(v));
+    }
+
+    CHK_ERR( r.dots(z, rzNew) );
+
+    //p = z + beta*p
+    for(int v=0; v<nv; ++v) {
+      if (!active[v]) continue;
+      const double beta = rzNew[v]/rz[v];
+      rz[v] = rzNew[v];
+      double* pv = p.getLocalCoefs(v);
+      const double* zv = z.getLocalCoefs(v);
+      for(int i=0; i<n; ++i) pv[i] = zv[i] + beta*pv[i];
+    }
+  }
+
+  if (numConverged == nv) status = 0;
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+int Solver_DistCSR::solveGMRES(fei::DistCSRMat& A,
+                               const fei::DistVec& b,
+                               fei::DistVec& x,
+                               int& iterationsTaken,
+                               int& status)
+{
+  MPI_Comm comm = A.getCommunicator();
+  const int first = A.firstLocalRow();
+  const int n = A.numLocalRows();
+  const int m = kspace_ > 0 ? kspace_ : 30;
+
+  //Right-preconditioned restarted GMRES, with modified Gram-Schmidt. The
+  //Krylov basis is held as the m+1 vectors of V.
+  fei::DistVec V(comm, first, n, m+1);
+  fei::DistVec z(comm, first, n), w(comm, first, n);
+
+  std::vector<double> H((m+1)*m, 0.0);
+  std::vector<double> cs(m, 0.0), sn(m, 0.0), g(m+1, 0.0), y(m, 0.0);
+
+  double bnorm = 0.0;
+  CHK_ERR( b.norm2(bnorm) );
+  if (bnorm == 0.0) bnorm = 1.0;
+
+  int iter = 0;
+  while(true) {
+    //w = b - A*x
+    CHK_ERR( A.multiply(x, z) );
+    CHK_ERR( w.update(1.0, b, 0.0) );
+    CHK_ERR( w.update(-1.0, z, 1.0) );
+
+    double beta = 0.0;
+    CHK_ERR( w.norm2(beta) );
+    if (beta/bnorm <= tolerance_) {
+      status = 0;
+      break;
+    }
+    if (iter >= maxIters_) break;
+
+    double* v0 = V.getLocalCoefs(0);
+    const double* wcoefs = w.getLocalCoefs();
+    for(int i=0; i<n; ++i) v0[i] = wcoefs[i]/beta;
+
+    g.assign(m+1, 0.0);
+    g[0] = beta;
+
+    int k = 0;
+    bool converged = false;
+    while(k < m && iter < maxIters_) {
+      //w = A * M^{-1} * v_k
+      applyPreconditioner(n, V.getLocalCoefs(k), z.getLocalCoefs());
+
+      CHK_ERR( A.multiply(z, w) );
+
+      double* wc = w.getLocalCoefs();
+      double* hk = &H[k*(m+1)];
+      for(int j=0; j<=k; ++j) {
+        const double* vj = V.getLocalCoefs(j);
+        CHK_ERR( globalDot(comm, n, wc, vj, hk[j]) );
+        for(int i=0; i<n; ++i) wc[i] -= hk[j]*vj[i];
+      }
+
+      double hnext = 0.0;
+      CHK_ERR( w.norm2(hnext) );
+      hk[k+1] = hnext;
+      if (hnext != 0.0) {
+        double* vnext = V.getLocalCoefs(k+1);
+        for(int i=0; i<n; ++i) vnext[i] = wc[i]/hnext;
+      }
+
+      //apply the previous Givens rotations to the new column, then
+      //compute the rotation that eliminates its subdiagonal entry.
+      for(int j=0; j<k; ++j) {
+        double tmp = cs[j]*hk[j] + sn[j]*hk[j+1];
+        hk[j+1] = -sn[j]*hk[j] + cs[j]*hk[j+1];
+        hk[j] = tmp;
+      }
+
+      double denom = std::sqrt(hk[k]*hk[k] + hk[k+1]*hk[k+1]);
+      if (denom == 0.0) {
+        cs[k] = 1.0;
+        sn[k] = 0.0;
+      }
+      else {
+        cs[k] = hk[k]/denom;
+        sn[k] = hk[k+1]/denom;
+      }
+      hk[k] = cs[k]*hk[k] + sn[k]*hk[k+1];
+      hk[k+1] = 0.0;
+
+      g[k+1] = -sn[k]*g[k];
+      g[k] = cs[k]*g[k];
+
+      ++k;
+      ++iter;
+      iterationsTaken = iter;
+
+      double resid = std::abs(g[k])/bnorm;
+      if (outputLevel_ > 0 && localProc_ == 0) {
+        FEI_COUT << "Solver_DistCSR gmres iter " << iter
+                 << ", relative residual " << resid << FEI_ENDL;
+      }
+      if (resid <= tolerance_ || hnext == 0.0) {
+        converged = true;
+        break;
+      }
+    }
+
+    //solve the k-by-k upper-triangular system H*y = g
+    for(int i=k-1; i>=0; --i) {
+      double sum = g[i];
+      for(int j=i+1; j<k; ++j) sum -= H[j*(m+1)+i]*y[j];
+      double hii = H[i*(m+1)+i];
+      y[i] = hii != 0.0 ? sum/hii : 0.0;
+    }
+
+    //x += M^{-1} * (V*y)
+    double* wc = w.getLocalCoefs();
+    for(int i=0; i<n; ++i) wc[i] = 0.0;
+    for(int j=0; j<k; ++j) {
+      const double* vj = V.getLocalCoefs(j);
+      for(int i=0; i<n; ++i) wc[i] += y[j]*vj[i];
+    }
+    applyPreconditioner(n, wc, z.getLocalCoefs());
+    CHK_ERR( x.update(1.0, z, 1.0) );
+
+    if (converged) {
+      status = 0;
+      break;
+    }
+  }
+
+  return(0);
+}
+
+}//namespace fei
@@ -0,0 +1,123 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#ifndef _fei_Solver_DistCSR_hpp_
+#define _fei_Solver_DistCSR_hpp_
+
+#include <fei_macros.hpp>
+#include <fei_Solver.hpp>
+
+#include <string>
+#include <vector>
+
+namespace fei {
+
+template<typename Scalar> class DistCSRMatrix;
+class DistVec;
+
+/** fei::Solver implementation for linear-systems whose matrix and vectors
+    were created by fei::Factory_DistCSR. It needs no external solver
+    library.
+
+    The following control parameters are recognized (all are optional):
+    <ul>
+    <li>"solver" (string): "cg" (default) or "gmres"
+    <li>"preconditioner" (string): "Jacobi" (default), "ILU0" or "none".
+    ILU0 is a block-Jacobi preconditioner: each processor uses the
+    incomplete LU factorization of the part of its rows that couples only
+    locally-owned equations.
+    <li>"tolerance" (double): convergence is reached when the 2-norm of the
+    residual, relative to that of the right-hand-side, falls below this.
+    Default is 1.e-6.
+    <li>"maxIterations" (int): default is 500.
+    <li>"gmresRestart" (int): Krylov-space size for gmres. Default is 30.
+    <li>"outputLevel" (int): if greater than 0, the residual norm is printed
+    (by processor 0) at each iteration.
+    </ul>
+    If a preconditioningMatrix is passed to solve(), and it was also
+    created by fei::Factory_DistCSR, the preconditioner is computed from it
+    instead of from the linear-system's matrix. The preconditioning matrix
+    may have single-precision storage (see the "MATRIX_SCALAR_TYPE"
+    parameter of fei::Factory_DistCSR); the ILU0 factors of such a matrix
+    are computed in double but kept in single precision, while the
+    preconditioner is applied with double-precision vectors. The
+    linear-system's matrix itself must have double-precision storage.
+
+    If the linear-system's rhs and solution vectors hold several vectors
+    (the numVectors argument of createVector), all of the right-hand-sides
+    are solved for in one call. With "cg" they are iterated together, so
+    that each iteration does a single halo exchange and a single reduction
+    per dot-product for all of them; with "gmres" they are solved for one
+    after another. The preconditioner is computed once in either case.
+
+    On return from solve(), status is 0 if the solver converged (for every
+    right-hand-side) and 1 otherwise, and iterationsTaken is the largest
+    number taken for any right-hand-side.
+*/
+class Solver_DistCSR : public fei::Solver {
+ public:
+  /** Constructor */
+  Solver_DistCSR();
+
+  /** Destructor */
+  virtual ~Solver_DistCSR();
+
+  /** Implementation of fei::Solver::solve(). Returns -1 if the
+      linear-system's objects weren't created by fei::Factory_DistCSR, or
+      if the preconditioner can't be computed (e.g., because of a zero
+      diagonal).
+  */
+  int solve(fei::LinearSystem* linearSystem,
+            fei::Matrix* preconditioningMatrix,
+            const fei::ParameterSet& parameterSet,
+            int& iterationsTaken,
+            int& status);
+
+  void setMaxIters(int maxits) { maxIters_ = maxits; }
+  void setTolerance(double tol) { tolerance_ = tol; }
+
+ private:
+  template<typename Scalar>
+  int setupPreconditioner(const fei::DistCSRMatrix<Scalar>& A,
+                          const std::string& precond);
+  void applyPreconditioner(int numRows, const double* r, double* z) const;
+
+  int solveCG(fei::DistCSRMatrix<double>& A,
+              const fei::DistVec& b, fei::DistVec& x,
+              int& iterationsTaken, int& status);
+
+  int solveGMRES(fei::DistCSRMatrix<double>& A,
+                 const fei::DistVec& b, fei::DistVec& x,
+                 int& iterationsTaken, int& status);
+
+  enum { PRECOND_NONE, PRECOND_JACOBI, PRECOND_ILU0 };
+
+  double tolerance_;
+  int maxIters_;
+  int kspace_;
+  int outputLevel_;
+  int localProc_;
+
+  int precondType_;
+  std::vector<double> invDiag_;
+
+  //ILU(0) factors of the owned-column block, stored in CSR form with
+  //column indices sorted within each row. iluDiag_[i] is the position of
+  //row i's diagonal. The strictly lower part holds L (unit diagonal), the
+  //rest holds U. The factors are in iluCoefsF_ instead of iluCoefs_ if
+  //they were computed from a single-precision matrix.
+  std::vector<int> iluRowOffsets_;
+  std::vector<int> iluCols_;
+  std::vector<int> iluDiag_;
+  std::vector<double> iluCoefs_;
+  std::vector<float> iluCoefsF_;
+};//class Solver_DistCSR
+
+}//namespace fei
+
+#endif // _fei_Solver_DistCSR_hpp_
@@ -43,7 +43,7 @@ namespace fei {
     bool operator!=(const fei::SparseRowGraph& othergraph) const;
 
     /** Local row-numbers. */
-    std::vector<int> rowNumbers;
+    std::vector<GlobalOrdinal> rowNumbers;
 
     /** The starting offset of each row in the packedColumnIndices
         vector. The i-th row corresponds to positions rowOffsets[i] through
@@ -56,7 +56,7 @@ namespace fei {
     /** Contiguous array of column-indices for all local rows.
        See the comments for the 'rowOffsets' attribute, for information
        about accessing column-indices for a particular row, etc.*/
-    std::vector<int> packedColumnIndices;
+    std::vector<GlobalOrdinal> packedColumnIndices;
 
     /** whether this graph represents a block-entry matrix. */
     bool blockEntries;
@@ -83,9 +83,9 @@ inline bool SparseRowGraph::operator!=(const fei::SparseRowGraph& othergraph) co
     of row-numbers, return -1.
 */
 inline
-int find_row_start(int row, const SparseRowGraph& srg)
+int find_row_start(GlobalOrdinal row, const SparseRowGraph& srg)
 {
-  std::vector<int>::const_iterator rowNumbers_iter =
+  std::vector<GlobalOrdinal>::const_iterator rowNumbers_iter =
     std::lower_bound(srg.rowNumbers.begin(), srg.rowNumbers.end(), row);
   if (rowNumbers_iter == srg.rowNumbers.end() || *rowNumbers_iter != row) {
     return -1;
@@ -11,6 +11,7 @@
 
 #include <fei_iosfwd.hpp>
 #include <fei_SparseRowGraph.hpp>
+#include <fei_impl_utils.hpp>
 #include <snl_fei_RaggedTable.hpp>
 #include <snl_fei_Utils.hpp>
 
@@ -24,12 +25,12 @@ namespace fei {
 
   //------------------------------------------------------------------------
   /** dangerous function to copy a set to an
-   array, assuming the set contents are of type int
+   array, assuming the set contents can be assigned to type T
   */
-  template<typename SET_TYPE>
+  template<typename SET_TYPE, typename T>
     void copySetToArray(const SET_TYPE& set_obj,
 			int lenList,
-			int* list)
+			T* list)
     {
       int setsize = set_obj.size();
       int len = setsize > lenList ? lenList : setsize;
@@ -57,12 +58,12 @@ namespace fei {
     }
 
   /** dangerous function to copy map keys to an
-   array, assuming the keys are of type int
+   array, assuming the keys can be assigned to type T
   */
-  template<typename MAP_TYPE>
+  template<typename MAP_TYPE, typename T>
     void copyKeysToArray(const MAP_TYPE& map_obj,
 			 unsigned lenList,
-			 int* list)
+			 T* list)
     {
       unsigned i = 0;
       typename MAP_TYPE::const_iterator
@@ -75,11 +76,11 @@ namespace fei {
     }
 
   /** function to copy map keys to a
-   vector, assuming the keys are of type int
+   vector, assuming the keys can be assigned to type T
   */
-  template<typename MAP_TYPE>
+  template<typename MAP_TYPE, typename T>
     void copyKeysToVector(const MAP_TYPE& map_obj,
-                          std::vector<int>& keyvector)
+                          std::vector<T>& keyvector)
     {
       keyvector.resize(map_obj.size());
       if (map_obj.empty()) return;
@@ -172,10 +173,17 @@ namespace fei {
     }
   }
 
+  /** pack a ragged-table into a buffer of bytes for communication. The
+    row-numbers and column-indices are written with
+    fei::impl_utils::encode_indices, each row-number relative to the
+    previous one and each row's column-indices relative to its row-number,
+    so the buffer stays small regardless of the width of the index type. */
   template<typename MAP_TYPE, typename SET_TYPE>
     void packRaggedTable(snl_fei::RaggedTable<MAP_TYPE,SET_TYPE>& table,
-                       std::vector<int>& intdata)
+                       std::vector<char>& buffer)
     {
+      typedef typename SET_TYPE::key_type index_type;
+
       MAP_TYPE& map_obj = table.getMap();
       int numRows = map_obj.size();
 
@@ -183,31 +191,49 @@ namespace fei {
         m_iter = map_obj.begin(),
         m_end  = map_obj.end();
 
-      int nnz = 0;
+      std::vector<index_type> cols;
+      index_type prevRow = 0;
+      size_t num_bytes =
+        fei::impl_utils::num_bytes_encoded_indices(1, &numRows, 0);
 
       for(; m_iter != m_end; ++m_iter) {
         typename MAP_TYPE::value_type m_pair = *m_iter;
 
+        index_type row = m_pair.first;
         int rowLen = m_pair.second->size();
-        nnz += rowLen;
+        cols.resize(rowLen);
+        if (rowLen > 0) copySetToArray(*(m_pair.second), rowLen, &cols[0]);
+
+        using fei::impl_utils::num_bytes_encoded_indices;
+        num_bytes += num_bytes_encoded_indices(1, &row, prevRow);
+        num_bytes += num_bytes_encoded_indices(1, &rowLen, 0);
+        if (rowLen > 0) {
+          num_bytes += num_bytes_encoded_indices(rowLen, &cols[0], row);
+        }
+        prevRow = row;
       }
 
-      intdata.resize(1+2*numRows+nnz);
-      intdata[0] = numRows;
-      int* rowNumbers = &intdata[1];
-      int* rowLengths = rowNumbers+numRows;
-      int* packedCols = rowLengths+numRows;
+      buffer.resize(num_bytes);
+      if (num_bytes == 0) return;
 
-      m_iter = map_obj.begin();
-      unsigned offset = 0;
-      for(unsigned i=0; m_iter != m_end; ++m_iter, ++i) {
+      char* data = &buffer[0];
+      data = fei::impl_utils::encode_indices(1, &numRows, 0, data);
+
+      prevRow = 0;
+      for(m_iter = map_obj.begin(); m_iter != m_end; ++m_iter) {
         typename MAP_TYPE::value_type m_pair = *m_iter;
-        rowNumbers[i] = m_pair.first;
-        rowLengths[i] = m_pair.second->size();
 
-        int* colInds = &packedCols[offset];
-        copySetToArray(*(m_pair.second), rowLengths[i], colInds);
-        offset += rowLengths[i];
+        index_type row = m_pair.first;
+        int rowLen = m_pair.second->size();
+        cols.resize(rowLen);
+        if (rowLen > 0) copySetToArray(*(m_pair.second), rowLen, &cols[0]);
+
+        data = fei::impl_utils::encode_indices(1, &row, prevRow, data);
+        data = fei::impl_utils::encode_indices(1, &rowLen, 0, data);
+        if (rowLen > 0) {
+          data = fei::impl_utils::encode_indices(rowLen, &cols[0], row, data);
+        }
+        prevRow = row;
       }
     }
 
@@ -250,7 +276,7 @@ namespace fei {
           srg->rowNumbers[offset1] = m_pair.first;
           int rowLen = m_pair.second->size();
           srg->rowOffsets[offset1++] = rowOffset;
-          int* cols = &srg->packedColumnIndices[rowOffset];
+          GlobalOrdinal* cols = &srg->packedColumnIndices[rowOffset];
           copySetToArray(*(m_pair.second), rowLen, cols);
           rowOffset += rowLen;
         }
@@ -272,7 +298,7 @@ namespace fei {
       srg.rowNumbers.resize(numRows);
       srg.rowOffsets.resize(numRows+1);
 
-      int* rowNumPtr = numRows>0 ? &(srg.rowNumbers[0]): NULL;
+      GlobalOrdinal* rowNumPtr = numRows>0 ? &(srg.rowNumbers[0]): NULL;
       int* rowOffsPtr = &(srg.rowOffsets[0]);
 
       typename MAP_TYPE::iterator
@@ -293,7 +319,7 @@ namespace fei {
       rowOffsPtr[offset] = nnz;
 
       srg.packedColumnIndices.resize(nnz);
-      int* colPtr = numRows>0 ? &(srg.packedColumnIndices[0]) : NULL;
+      GlobalOrdinal* colPtr = numRows>0 ? &(srg.packedColumnIndices[0]) : NULL;
       offset = 0;
       m_iter = map_obj.begin();
       int i = 0;
@@ -301,7 +327,7 @@ namespace fei {
         typename MAP_TYPE::value_type m_pair = *m_iter;
 
         int rowLen = rowOffsPtr[i+1]-rowOffsPtr[i];
-        int* colInds = &(colPtr[offset]);
+        GlobalOrdinal* colInds = &(colPtr[offset]);
         copySetToArray(*(m_pair.second), rowLen, colInds);
         offset += rowLen;
       }
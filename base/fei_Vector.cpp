@@ -0,0 +1,51 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#include <fei_macros.hpp>
+
+#include <fei_Vector.hpp>
+#include <fei_VectorSpace.hpp>
+
+#include <vector>
+
+#undef fei_file
+#define fei_file "fei_Vector.cpp"
+#include <fei_ErrMacros.hpp>
+
+//----------------------------------------------------------------------------
+int fei::Vector::sumInLocal(int numValues, const int* localIndices,
+                            const double* values, int vectorIndex)
+{
+  if (numValues < 1) return(0);
+
+  fei::SharedPtr<fei::VectorSpace> vspace = getVectorSpace();
+  if (vspace.get() == NULL) ERReturn(-1);
+
+  std::vector<fei::GlobalOrdinal> indices(numValues);
+  CHK_ERR( vspace->getGlobalIndicesFromLocal(numValues, localIndices,
+                                             &indices[0]) );
+
+  return( sumIn(numValues, &indices[0], values, vectorIndex) );
+}
+
+//----------------------------------------------------------------------------
+int fei::Vector::copyInLocal(int numValues, const int* localIndices,
+                             const double* values, int vectorIndex)
+{
+  if (numValues < 1) return(0);
+
+  fei::SharedPtr<fei::VectorSpace> vspace = getVectorSpace();
+  if (vspace.get() == NULL) ERReturn(-1);
+
+  std::vector<fei::GlobalOrdinal> indices(numValues);
+  CHK_ERR( vspace->getGlobalIndicesFromLocal(numValues, localIndices,
+                                             &indices[0]) );
+
+  return( copyIn(numValues, &indices[0], values, vectorIndex) );
+}
+
@@ -99,22 +99,37 @@ namespace fei {
     /** Accumulate values into the vector, adding them to any values that
 	already exist for the specified indices.
     */
-    virtual int sumIn(int numValues, const int* indices, const double* values,
-		      int vectorIndex=0) = 0;
+    virtual int sumIn(int numValues, const GlobalOrdinal* indices,
+		      const double* values, int vectorIndex=0) = 0;
 
     /** Copy values into the vector overwriting any values that already exist
 	for the specified indices.
     */
-    virtual int copyIn(int numValues, const int* indices, const double* values,
-		       int vectorIndex=0) = 0;
+    virtual int copyIn(int numValues, const GlobalOrdinal* indices,
+		       const double* values, int vectorIndex=0) = 0;
+
+    /** Accumulate values into the vector, specifying locations by local
+	indices of the vector-space (see
+	fei::VectorSpace::getLocalIndexMap()) rather than by global indices.
+	The default implementation translates to global indices and calls
+	sumIn.
+    */
+    virtual int sumInLocal(int numValues, const int* localIndices,
+			   const double* values, int vectorIndex=0);
+
+    /** Copy values into the vector, specifying locations by local indices.
+	(See sumInLocal.)
+    */
+    virtual int copyInLocal(int numValues, const int* localIndices,
+			    const double* values, int vectorIndex=0);
 
     /** Retrieve a copy of values from the vector for the specified indices.
 	Note that if the specified indices are not local in the underlying
 	non-overlapping data decomposition, these values are not guaranteed to
 	be correct until after the scatterToOverlap() method has been called.
     */
-    virtual int copyOut(int numValues, const int* indices, double* values,
-			int vectorIndex=0) const = 0;
+    virtual int copyOut(int numValues, const GlobalOrdinal* indices,
+			double* values, int vectorIndex=0) const = 0;
 
     /** Update 'this' = b*'this' + a*x
      */
@@ -221,6 +236,14 @@ namespace fei {
     virtual int writeToStream(FEI_OSTREAM& ostrm,
 			      bool matrixMarketFormat=true) = 0;
 
+    /** Query for the number of vectors (columns) held by this object, as
+        requested by the numVectors argument of Factory::createVector. Each
+        is addressed with the vectorIndex argument of sumIn, copyOut, etc.
+        scatterToOverlap() and gatherFromOverlap() exchange the shared data
+        of all of them together.
+    */
+    virtual int getNumVectors() const { return( 1 ); }
+
   };//class Vector
 }//namespace fei
 
@@ -37,16 +37,16 @@ VectorReducer::VectorReducer(fei::SharedPtr<fei::Reducer> reducer,
 
   fei::SharedPtr<fei::VectorSpace> vecspace = target->getVectorSpace();
   int numEqns = vecspace->getNumIndices_SharedAndOwned();
-  std::vector<int> eqns;
+  std::vector<GlobalOrdinal> eqns;
   vecspace->getIndices_SharedAndOwned(eqns);
 
-  std::vector<int> overlap;
+  std::vector<GlobalOrdinal> overlap;
   for(int i=0; i<numEqns; ++i) {
     if (!reducer->isSlaveEqn(eqns[i])) {
       overlap.push_back(reducer->translateToReducedEqn(eqns[i]));
     }
     else {
-      std::vector<int> masters;
+      std::vector<GlobalOrdinal> masters;
       reducer->getSlaveMasterEqns(eqns[i], masters);
       for(unsigned j=0; j<masters.size(); ++j) {
         overlap.push_back(reducer->translateToReducedEqn(masters[j]));
@@ -54,7 +54,7 @@ VectorReducer::VectorReducer(fei::SharedPtr<fei::Reducer> reducer,
     }
   }
 
-  int* overlap_ptr = overlap.empty() ? NULL : &overlap[0];
+  GlobalOrdinal* overlap_ptr = overlap.empty() ? NULL : &overlap[0];
   target_core->setOverlap(overlap.size(), overlap_ptr);
 }
 
@@ -91,7 +91,7 @@ int VectorReducer::gatherFromOverlap(bool accumulate)
 
 //----------------------------------------------------------------------------
 int VectorReducer::sumIn(int numValues,
-                         const int* indices, const double* values,
+                         const GlobalOrdinal* indices, const double* values,
                          int vectorIndex)
 {
   return(reducer_->addVectorValues(numValues, indices, values, true,
@@ -100,7 +100,7 @@ int VectorReducer::sumIn(int numValues,
 
 //----------------------------------------------------------------------------
 int VectorReducer::copyIn(int numValues,
-                          const int* indices, const double* values,
+                          const GlobalOrdinal* indices, const double* values,
                           int vectorIndex)
 {
   return(reducer_->addVectorValues(numValues, indices, values, false,
@@ -109,7 +109,7 @@ int VectorReducer::copyIn(int numValues,
 
 //----------------------------------------------------------------------------
 int VectorReducer::giveToUnderlyingVector(int numValues,
-                                          const int* indices,
+                                          const GlobalOrdinal* indices,
                                           const double* values,
                                           bool sumInto,
                                           int vectorIndex)
@@ -130,7 +130,7 @@ int VectorReducer::sumInFieldData(int fieldID,
   fei::SharedPtr<fei::VectorSpace> vspace = target_->getVectorSpace();
   int fieldSize = vspace->getFieldSize(fieldID);
   int numIndices = numIDs*fieldSize;
-  std::vector<int> indices(numIndices);
+  std::vector<GlobalOrdinal> indices(numIndices);
   int err = vspace->getGlobalIndices(numIDs, IDs, idType, fieldID, &indices[0]);
   if (err != 0) {
     throw std::runtime_error("fei::VectorReducer::sumInFieldData ERROR in vspace->getGlobalIndices.");
@@ -150,7 +150,7 @@ int VectorReducer::copyInFieldData(int fieldID,
   fei::SharedPtr<fei::VectorSpace> vspace = target_->getVectorSpace();
   int fieldSize = vspace->getFieldSize(fieldID);
   int numIndices = numIDs*fieldSize;
-  std::vector<int> indices(numIndices);
+  std::vector<GlobalOrdinal> indices(numIndices);
   int err = vspace->getGlobalIndices(numIDs, IDs, idType, fieldID, &indices[0]);
   if (err != 0) {
     throw std::runtime_error("fei::VectorReducer::copyInFieldData ERROR in vspace->getGlobalIndices.");
@@ -170,7 +170,7 @@ int VectorReducer::copyInFieldDataLocalIDs(int fieldID,
   fei::SharedPtr<fei::VectorSpace> vspace = target_->getVectorSpace();
   int fieldSize = vspace->getFieldSize(fieldID);
   int numIndices = numIDs*fieldSize;
-  std::vector<int> indices(numIndices);
+  std::vector<GlobalOrdinal> indices(numIndices);
   int err = vspace->getGlobalIndicesLocalIDs(numIDs, localIDs, idType, fieldID, &indices[0]);
   if (err != 0) {
     throw std::runtime_error("fei::VectorReducer::copyInFieldData ERROR in vspace->getGlobalIndices.");
@@ -197,7 +197,7 @@ int VectorReducer::copyOutFieldData(int fieldID,
   fei::SharedPtr<fei::VectorSpace> vspace = target_->getVectorSpace();
   int fieldSize = vspace->getFieldSize(fieldID);
   int numIndices = numIDs*fieldSize;
-  std::vector<int> indices(numIndices);
+  std::vector<GlobalOrdinal> indices(numIndices);
   int err = vspace->getGlobalIndices(numIDs, IDs, idType, fieldID, &indices[0]);
   if (err != 0) {
     throw std::runtime_error("fei::VectorReducer::copyOutFieldData ERROR in vspace->getGlobalIndices.");
@@ -222,7 +222,7 @@ int VectorReducer::writeToStream(FEI_OSTREAM& ostrm,
 
 //----------------------------------------------------------------------------
 int VectorReducer::copyOut(int numValues,
-                           const int* indices,
+                           const GlobalOrdinal* indices,
                            double* values,
                            int vectorIndex) const
 {
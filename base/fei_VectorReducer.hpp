@@ -68,14 +68,14 @@ namespace fei {
     /** Sum values into the vector, adding to any
 	that may already exist at the specified indices.
     */
-    int sumIn(int numValues, const int* indices, const double* values,
-	      int vectorIndex=0);
+    int sumIn(int numValues, const GlobalOrdinal* indices,
+	      const double* values, int vectorIndex=0);
 
     /** Copy values into the vector, overwriting any that may already exist
 	at the specified indices.
     */
-    int copyIn(int numValues, const int* indices, const double* values,
-	       int vectorIndex=0);
+    int copyIn(int numValues, const GlobalOrdinal* indices,
+	       const double* values, int vectorIndex=0);
 
     /** Obtain the VectorSpace associated with this vector.
      */
@@ -140,17 +140,19 @@ namespace fei {
 		      bool matrixMarketFormat=true);
 
     int copyOut(int numValues,
-		const int* indices,
+		const GlobalOrdinal* indices,
 		double* values,
 		int vectorIndex=0) const;
 
+    int getNumVectors() const { return( target_->getNumVectors() ); }
+
   private:
     /** please ignore
      */
     int copyOut_FE(int nodeNumber, int dofOffset, double& value);
 
     int giveToUnderlyingVector(int numValues,
-			       const int* indices,
+			       const GlobalOrdinal* indices,
 			       const double* values,
 			       bool sumInto=true,
 			       int vectorIndex=0);
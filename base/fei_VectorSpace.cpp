@@ -15,6 +15,8 @@
 #include "fei_chk_mpi.hpp"
 #include <fei_CommUtils.hpp>
 #include <fei_set_shared_ids.hpp>
+#include <algorithm>
+#include <limits>
 #include "snl_fei_Utils.hpp"
 #include "fei_Record.hpp"
 #include "snl_fei_RecordCollection.hpp"
@@ -154,6 +156,7 @@ fei::VectorSpace::VectorSpace(MPI_Comm comm, const char* name)
     firstLocalOffset_(-1),
     lastLocalOffset_(-1),
     eqnNumbers_(),
+    localIndexMap_(),
     newInitData_(false),
     initCompleteAlreadyCalled_(false),
     name_(),
@@ -726,6 +729,8 @@ int fei::VectorSpace::initComplete()
     }
   }
 
+  createLocalIndexMap();
+
   newInitData_ = false;
   initCompleteAlreadyCalled_ = true;
   return(0);
@@ -737,7 +742,7 @@ int fei::VectorSpace::getGlobalIndex(int idType,
                                      int fieldID,
                                      int fieldOffset,
                                      int whichComponentOfField,
-                                     int& globalIndex)
+                                     GlobalOrdinal& globalIndex)
 {
   int idindex = fei::binarySearch(idType, idTypes_);
   if (idindex < 0) return(-1);
@@ -761,7 +766,7 @@ int fei::VectorSpace::getGlobalIndex(int idType,
 int fei::VectorSpace::getGlobalIndex(int idType,
                                      int ID,
                                      int fieldID,
-                                     int& globalIndex)
+                                     GlobalOrdinal& globalIndex)
 {
   return( getGlobalIndex(idType, ID, fieldID, 0, 0, globalIndex) );
 }
@@ -784,7 +789,7 @@ int fei::VectorSpace::getGlobalIndices(int numIDs,
                                        const int* IDs,
                                        int idType,
                                        int fieldID,
-                                       int* globalIndices)
+                                       GlobalOrdinal* globalIndices)
 {
   int idindex = fei::binarySearch(idType, idTypes_);
   if (idindex < 0) return(-1);
@@ -798,7 +803,7 @@ int fei::VectorSpace::getGlobalIndices(int numIDs,
                                                     0, 0, &eqnNumbers_[0]);
     if (fieldSize>1) {
       if (globalIndices[offset] >= 0) {
-        int eqn = globalIndices[offset];
+        GlobalOrdinal eqn = globalIndices[offset];
         for(unsigned j=1; j<fieldSize; ++j) {
           globalIndices[offset+j] = eqn+j;
         }
@@ -821,7 +826,7 @@ int fei::VectorSpace::getGlobalIndicesLocalIDs(int numIDs,
                                        const int* localIDs,
                                        int idType,
                                        int fieldID,
-                                       int* globalIndices)
+                                       GlobalOrdinal* globalIndices)
 {
   int idindex = fei::binarySearch(idType, idTypes_);
   if (idindex < 0) return(-1);
@@ -835,7 +840,7 @@ int fei::VectorSpace::getGlobalIndicesLocalIDs(int numIDs,
                                                     0, 0, &eqnNumbers_[0]);
     if (globalIndices[offset] >= 0) {
       if (fieldSize>1) {
-        int eqn = globalIndices[offset];
+        GlobalOrdinal eqn = globalIndices[offset];
         for(unsigned j=1; j<fieldSize; ++j) {
           globalIndices[offset+j] = eqn+j;
         }
@@ -882,7 +887,7 @@ int fei::VectorSpace::getGlobalIndices(int numIDs,
                                        const int* IDs,
                                        const int* idTypes,
                                        const int* fieldIDs,
-                                       int* globalIndices)
+                                       GlobalOrdinal* globalIndices)
 {
   int err;
   int offset = 0;
@@ -897,7 +902,7 @@ int fei::VectorSpace::getGlobalIndices(int numIDs,
     }
     else {
       if (fieldSize>1) {
-        int eqn = globalIndices[offset];
+        GlobalOrdinal eqn = globalIndices[offset];
         for(unsigned j=1; j<fieldSize; ++j) {
           globalIndices[offset+j] = eqn+j;
         }
@@ -924,12 +929,12 @@ void fei::VectorSpace::getGlobalBlkIndices(const fei::Pattern* pattern,
 //----------------------------------------------------------------------------
 void fei::VectorSpace::getGlobalIndices(const fei::Pattern* pattern,
                                         const fei::Record<int>*const* records,
-                                        std::vector<int>& indices)
+                                        std::vector<GlobalOrdinal>& indices)
 {
   int numRecords = pattern->getNumIDs();
   int numIndices = pattern->getNumIndices();
   indices.resize(numIndices);
-  int* indices_ptr = &indices[0];
+  GlobalOrdinal* indices_ptr = &indices[0];
 
   fei::Pattern::PatternType pType = pattern->getPatternType();
 
@@ -960,20 +965,22 @@ void fei::VectorSpace::getGlobalIndices(const fei::Pattern* pattern,
                      numIndices, indices_ptr, numIndices);
   }
   else if (pType == fei::Pattern::NO_FIELD) {
-    getGlobalBlkIndices(numRecords, records, numIndices, indices_ptr, numIndices);
+    for(int i=0; i<numRecords; ++i) {
+      indices_ptr[i] = records[i]->getNumber();
+    }
   }
 }
 
 //----------------------------------------------------------------------------
 void fei::VectorSpace::getGlobalIndicesL(const fei::Pattern* pattern,
                                         const int* records,
-                                        std::vector<int>& indices)
+                                        std::vector<GlobalOrdinal>& indices)
 {
   int numRecords = pattern->getNumIDs();
   int numIndices = pattern->getNumIndices();
   const snl_fei::RecordCollection*const* recordCollections = pattern->getRecordCollections();
   indices.resize(numIndices);
-  int* indices_ptr = &indices[0];
+  GlobalOrdinal* indices_ptr = &indices[0];
 
   fei::Pattern::PatternType pType = pattern->getPatternType();
 
@@ -1004,7 +1011,10 @@ void fei::VectorSpace::getGlobalIndicesL(const fei::Pattern* pattern,
                      numIndices, indices_ptr, numIndices);
   }
   else if (pType == fei::Pattern::NO_FIELD) {
-    getGlobalBlkIndicesL(numRecords, recordCollections, records, numIndices, indices_ptr, numIndices);
+    for(int i=0; i<numRecords; ++i) {
+      indices_ptr[i] =
+        recordCollections[i]->getRecordWithLocalID(records[i])->getNumber();
+    }
   }
 }
 
@@ -1014,11 +1024,11 @@ void fei::VectorSpace::getGlobalIndices(int numRecords,
                                         int fieldID,
                                         int fieldSize,
                                         int indicesAllocLen,
-                                        int* indices,
+                                        GlobalOrdinal* indices,
                                         int& numIndices)
 {
   numIndices = 0;
-  int* eqnPtr = &eqnNumbers_[0];
+  GlobalOrdinal* eqnPtr = &eqnNumbers_[0];
 
   int len = numRecords;
   if (len*fieldSize >= indicesAllocLen) {
@@ -1038,7 +1048,7 @@ void fei::VectorSpace::getGlobalIndices(int numRecords,
       const fei::Record<int>* record = records[i];
 
       int eqnOffset = 0;
-      int* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
+      GlobalOrdinal* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
 
       const fei::FieldMask* fieldMask = record->getFieldMask();
       int err = fieldMask->getFieldEqnOffset(fieldID, eqnOffset);
@@ -1049,7 +1059,7 @@ void fei::VectorSpace::getGlobalIndices(int numRecords,
     for(int i=0; i<len; ++i) {
       const fei::Record<int>* record = records[i];
 
-      int* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
+      GlobalOrdinal* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
 
       int eqnOffset = 0;
       if (!simpleProblem_) {
@@ -1077,11 +1087,11 @@ void fei::VectorSpace::getGlobalIndicesL(int numRecords,
                                         int fieldID,
                                         int fieldSize,
                                         int indicesAllocLen,
-                                        int* indices,
+                                        GlobalOrdinal* indices,
                                         int& numIndices)
 {
   numIndices = 0;
-  int* eqnPtr = &eqnNumbers_[0];
+  GlobalOrdinal* eqnPtr = &eqnNumbers_[0];
 
   int len = numRecords;
   if (len*fieldSize >= indicesAllocLen) {
@@ -1101,7 +1111,7 @@ void fei::VectorSpace::getGlobalIndicesL(int numRecords,
       const fei::Record<int>* record = recordCollections[i]->getRecordWithLocalID(records[i]);
 
       int eqnOffset = 0;
-      int* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
+      GlobalOrdinal* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
 
       const fei::FieldMask* fieldMask = record->getFieldMask();
       int err = fieldMask->getFieldEqnOffset(fieldID, eqnOffset);
@@ -1112,7 +1122,7 @@ void fei::VectorSpace::getGlobalIndicesL(int numRecords,
     for(int i=0; i<len; ++i) {
       const fei::Record<int>* record = recordCollections[i]->getRecordWithLocalID(records[i]);
 
-      int* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
+      GlobalOrdinal* eqnNumbers = eqnPtr+record->getOffsetIntoEqnNumbers();
 
       int eqnOffset = 0;
       if (!simpleProblem_) {
@@ -1140,18 +1150,18 @@ void fei::VectorSpace::getGlobalIndices(int numRecords,
                                         const int* fieldIDs,
                                         const int* fieldSizes,
                                         int indicesAllocLen,
-                                        int* indices,
+                                        GlobalOrdinal* indices,
                                         int& numIndices)
 {
   numIndices = 0;
   int fld_offset = 0;
-  int* eqnPtr = &eqnNumbers_[0];
+  GlobalOrdinal* eqnPtr = &eqnNumbers_[0];
 
   for(int i=0; i<numRecords; ++i) {
     const fei::Record<int>* record = records[i];
 
     const fei::FieldMask* fieldMask = record->getFieldMask();
-    int* eqnNumbers = eqnPtr + record->getOffsetIntoEqnNumbers();
+    GlobalOrdinal* eqnNumbers = eqnPtr + record->getOffsetIntoEqnNumbers();
 
     for(int nf=0; nf<numFieldsPerID[i]; ++nf) {
       int eqnOffset = 0;
@@ -1182,18 +1192,18 @@ void fei::VectorSpace::getGlobalIndicesL(int numRecords,
                                         const int* fieldIDs,
                                         const int* fieldSizes,
                                         int indicesAllocLen,
-                                        int* indices,
+                                        GlobalOrdinal* indices,
                                         int& numIndices)
 {
   numIndices = 0;
   int fld_offset = 0;
-  int* eqnPtr = &eqnNumbers_[0];
+  GlobalOrdinal* eqnPtr = &eqnNumbers_[0];
 
   for(int i=0; i<numRecords; ++i) {
     const fei::Record<int>* record = recordCollections[i]->getRecordWithLocalID(records[i]);
 
     const fei::FieldMask* fieldMask = record->getFieldMask();
-    int* eqnNumbers = eqnPtr + record->getOffsetIntoEqnNumbers();
+    GlobalOrdinal* eqnNumbers = eqnPtr + record->getOffsetIntoEqnNumbers();
 
     for(int nf=0; nf<numFieldsPerID[i]; ++nf) {
       int eqnOffset = 0;
@@ -1252,7 +1262,7 @@ void fei::VectorSpace::getGlobalBlkIndicesL(int numRecords,
 //----------------------------------------------------------------------------
 int fei::VectorSpace::getGlobalIndex(int idType,
                                      int ID,
-                                     int& globalIndex)
+                                     GlobalOrdinal& globalIndex)
 {
   int idindex = fei::binarySearch(idType, idTypes_);
   if (idindex < 0) return(-1);
@@ -1262,7 +1272,7 @@ int fei::VectorSpace::getGlobalIndex(int idType,
     ERReturn(-1);
   }
 
-  const int* eqnNums = &eqnNumbers_[0]
+  const GlobalOrdinal* eqnNums = &eqnNumbers_[0]
                      + record->getOffsetIntoEqnNumbers();
 
   if (eqnNums != NULL) { globalIndex = eqnNums[0]; return(0); }
@@ -1404,7 +1414,7 @@ void fei::VectorSpace::getFields(int idType, int ID, std::vector<int>& fieldIDs)
 }
 
 //----------------------------------------------------------------------------
-void fei::VectorSpace::getGlobalIndexOffsets(std::vector<int>& globalOffsets) const
+void fei::VectorSpace::getGlobalIndexOffsets(std::vector<GlobalOrdinal>& globalOffsets) const
 {
   globalOffsets = globalOffsets_;
 }
@@ -1416,7 +1426,7 @@ void fei::VectorSpace::getGlobalBlkIndexOffsets(std::vector<int>& globalBlkOffse
 }
 
 //----------------------------------------------------------------------------
-int fei::VectorSpace::getOwnerProcPtIndex(int globalIndex)
+int fei::VectorSpace::getOwnerProcPtIndex(GlobalOrdinal globalIndex)
 {
   if (globalIndex < 0) return(-1);
 
@@ -1540,7 +1550,7 @@ int fei::VectorSpace::getNumIndices_SharedAndOwned() const
 }
 
 //----------------------------------------------------------------------------
-int fei::VectorSpace::getIndices_SharedAndOwned(std::vector<int>& globalIndices) const
+int fei::VectorSpace::getIndices_SharedAndOwned(std::vector<GlobalOrdinal>& globalIndices) const
 {
   if (eqnNumbers_.size() == 0) {
     globalIndices.resize(0);
@@ -1548,7 +1558,7 @@ int fei::VectorSpace::getIndices_SharedAndOwned(std::vector<int>& globalIndices)
   }
 
   size_t numIndices = eqnNumbers_.size();
-  const int* indicesPtr = &eqnNumbers_[0];
+  const GlobalOrdinal* indicesPtr = &eqnNumbers_[0];
 
   globalIndices.resize(numIndices);
   for(size_t i=0; i<numIndices; ++i) {
@@ -1558,6 +1568,68 @@ int fei::VectorSpace::getIndices_SharedAndOwned(std::vector<int>& globalIndices)
   return(0);
 }
 
+//----------------------------------------------------------------------------
+void fei::VectorSpace::createLocalIndexMap()
+{
+  int numOwned = static_cast<int>(lastLocalOffset_ - firstLocalOffset_ + 1);
+  if (numOwned < 0) numOwned = 0;
+
+  localIndexMap_.resize(numOwned);
+  for(int i=0; i<numOwned; ++i) localIndexMap_[i] = firstLocalOffset_ + i;
+
+  for(size_t i=0; i<eqnNumbers_.size(); ++i) {
+    GlobalOrdinal eqn = eqnNumbers_[i];
+    if (eqn < firstLocalOffset_ || eqn > lastLocalOffset_) {
+      localIndexMap_.push_back(eqn);
+    }
+  }
+
+  std::vector<GlobalOrdinal>::iterator ghosts_begin =
+    localIndexMap_.begin()+numOwned;
+  std::sort(ghosts_begin, localIndexMap_.end());
+  localIndexMap_.erase(std::unique(ghosts_begin, localIndexMap_.end()),
+                       localIndexMap_.end());
+}
+
+//----------------------------------------------------------------------------
+int fei::VectorSpace::getLocalIndex(GlobalOrdinal globalIndex) const
+{
+  if (globalIndex >= firstLocalOffset_ && globalIndex <= lastLocalOffset_) {
+    return(static_cast<int>(globalIndex - firstLocalOffset_));
+  }
+
+  int numOwned = static_cast<int>(lastLocalOffset_ - firstLocalOffset_ + 1);
+  if (numOwned < 0) numOwned = 0;
+
+  std::vector<GlobalOrdinal>::const_iterator
+    ghosts_begin = localIndexMap_.begin()+numOwned,
+    iter = std::lower_bound(ghosts_begin, localIndexMap_.end(), globalIndex);
+  if (iter == localIndexMap_.end() || *iter != globalIndex) return(-1);
+
+  return(iter - localIndexMap_.begin());
+}
+
+//----------------------------------------------------------------------------
+int fei::VectorSpace::getGlobalIndicesFromLocal(int numIndices,
+                                                const int* localIndices,
+                                                GlobalOrdinal* globalIndices) const
+{
+  const int numLocal = localIndexMap_.size();
+  int err = 0;
+  for(int i=0; i<numIndices; ++i) {
+    int lid = localIndices[i];
+    if (lid < 0 || lid >= numLocal) {
+      globalIndices[i] = -1;
+      err = -1;
+    }
+    else {
+      globalIndices[i] = localIndexMap_[lid];
+    }
+  }
+
+  return(err);
+}
+
 //----------------------------------------------------------------------------
 int fei::VectorSpace::getNumBlkIndices_SharedAndOwned(int& numBlkIndices) const
 {
@@ -1590,7 +1662,7 @@ int fei::VectorSpace::getBlkIndices_SharedAndOwned(int lenBlkIndices,
 }
 
 //----------------------------------------------------------------------------
-int fei::VectorSpace::getGlobalNumIndices() const
+fei::GlobalOrdinal fei::VectorSpace::getGlobalNumIndices() const
 {
   if (globalOffsets_.size() < 1) return(0);
   return(globalOffsets_[globalOffsets_.size()-1]);
@@ -1604,13 +1676,14 @@ int fei::VectorSpace::getNumIndices_Owned() const
   }
 
   int localProc = fei::localProc(comm_);
-  int numIndices = globalOffsets_[localProc+1]-globalOffsets_[localProc];
+  int numIndices =
+    static_cast<int>(globalOffsets_[localProc+1]-globalOffsets_[localProc]);
 
   return(numIndices);
 }
 
 //----------------------------------------------------------------------------
-int fei::VectorSpace::getIndices_Owned(std::vector<int>& globalIndices) const
+int fei::VectorSpace::getIndices_Owned(std::vector<GlobalOrdinal>& globalIndices) const
 {
   if (!sharedRecordsSynchronized_) {
     globalIndices.clear();
@@ -1618,11 +1691,12 @@ int fei::VectorSpace::getIndices_Owned(std::vector<int>& globalIndices) const
   }
 
   int localProc = fei::localProc(comm_);
-  int numIndices = globalOffsets_[localProc+1]-globalOffsets_[localProc];
+  int numIndices =
+    static_cast<int>(globalOffsets_[localProc+1]-globalOffsets_[localProc]);
 
   globalIndices.resize(numIndices);
 
-  int firstOffset = globalOffsets_[localProc];
+  GlobalOrdinal firstOffset = globalOffsets_[localProc];
   for(int i=0; i<numIndices; ++i) {
     globalIndices[i] = firstOffset+i;
   }
@@ -1631,7 +1705,7 @@ int fei::VectorSpace::getIndices_Owned(std::vector<int>& globalIndices) const
 }
 
 //----------------------------------------------------------------------------
-int fei::VectorSpace::getIndices_Owned(int lenIndices, int* globalIndices, int& numIndices) const
+int fei::VectorSpace::getIndices_Owned(int lenIndices, GlobalOrdinal* globalIndices, int& numIndices) const
 {
   if (!sharedRecordsSynchronized_) {
     numIndices = 0;
@@ -1639,11 +1713,12 @@ int fei::VectorSpace::getIndices_Owned(int lenIndices, int* globalIndices, int&
   }
 
   int localProc = fei::localProc(comm_);
-  numIndices = globalOffsets_[localProc+1]-globalOffsets_[localProc];
+  numIndices =
+    static_cast<int>(globalOffsets_[localProc+1]-globalOffsets_[localProc]);
 
   int len = lenIndices >= numIndices ? numIndices : lenIndices;
 
-  int firstOffset = globalOffsets_[localProc];
+  GlobalOrdinal firstOffset = globalOffsets_[localProc];
   for(int i=0; i<len; ++i) {
     globalIndices[i] = firstOffset+i;
   }
@@ -1783,7 +1858,7 @@ int fei::VectorSpace::calculateGlobalIndices()
 {
   int localProc = fei::localProc(comm_);
   int numProcs = fei::numProcs(comm_);
-  std::vector<int> localOffsets(numProcs +1, 0);
+  std::vector<GlobalOrdinal> localOffsets(numProcs +1, 0);
   std::vector<int> localIDOffsets(numProcs+1, 0);
   globalOffsets_.resize(numProcs + 1, 0);
 
@@ -1808,12 +1883,23 @@ int fei::VectorSpace::calculateGlobalIndices()
 
   //Now globalOffsets_ contains numLocalDOF for proc i, in the i-th position.
   //(and similarly for globalIDOffsets_)
+  //The total number of global indices must fit in a GlobalOrdinal. Every
+  //processor has the same counts, so they all fail together.
+  long long globalNumDOF = 0;
+  for(int p=0; p<numProcs; ++p) globalNumDOF += globalOffsets_[p];
+  if (globalNumDOF > std::numeric_limits<GlobalOrdinal>::max()) {
+    fei::console_out() << "fei::VectorSpace::calculateGlobalIndices ERROR, "
+       << globalNumDOF << " global indices is more than fei::GlobalOrdinal "
+       << "can hold (see FEI_ENABLE_64BIT_GLOBAL_ORDINAL)." << FEI_ENDL;
+    ERReturn(-1);
+  }
+
   //So all we need to do is turn that data into global-offsets (i.e., the
   //starting global-offset for each processor).
-  int localOffset = 0;
+  GlobalOrdinal localOffset = 0;
   int localIDOffset = 0;
   for(int p=0; p<numProcs; ++p) {
-    numLocalDOF = globalOffsets_[p];
+    numLocalDOF = static_cast<int>(globalOffsets_[p]);
     globalOffsets_[p] = localOffset;
     localOffset += numLocalDOF;
     numLocalIDs = globalIDOffsets_[p];
@@ -2081,7 +2167,7 @@ void fei::VectorSpace::runRecords(fei::Record_Operator<int>& record_op, int reco
 int fei::VectorSpace::setLocalEqnNumbers()
 {
   int proc = fei::localProc(comm_);
-  int eqnNumber = firstLocalOffset_;
+  GlobalOrdinal eqnNumber = firstLocalOffset_;
   int idNumber = globalIDOffsets_[proc];
 
   int numProcs = fei::numProcs(comm_);
@@ -2127,7 +2213,7 @@ int fei::VectorSpace::setLocalEqnNumbers()
     std::map<int,int>::const_iterator
       it = rmap.begin(), it_end = rmap.end();
 
-    int* eqnNumPtr = eqnNumbers_.empty() ? NULL : &eqnNumbers_[0];
+    GlobalOrdinal* eqnNumPtr = eqnNumbers_.empty() ? NULL : &eqnNumbers_[0];
 
     for(; it!=it_end; ++it) {
       fei::Record<int>& thisrecord = *records->getRecordWithLocalID(it->second);
@@ -2141,7 +2227,7 @@ int fei::VectorSpace::setLocalEqnNumbers()
         thisrecord.setNumber(idNumber++);
       }
 
-      int* eqnNumbers = eqnNumPtr
+      GlobalOrdinal* eqnNumbers = eqnNumPtr
                       + thisrecord.getOffsetIntoEqnNumbers();
 
       int numDOF = mask->getNumIndices();
@@ -2167,7 +2253,7 @@ int fei::VectorSpace::setLocalEqnNumbers()
       if (numDOF > maxNumDOF) maxNumDOF = numDOF;
 
       if (owner == proc) {
-        int thiseqn = eqnNumber-numDOF;
+        GlobalOrdinal thiseqn = eqnNumber-numDOF;
         int thisrecordnumber = thisrecord.getNumber();
         if (maxNumIndices > 1) {
           CHK_ERR( ptBlkMap_->setEqn(thiseqn, thisrecordnumber, numDOF) );
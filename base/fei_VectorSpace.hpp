@@ -275,7 +275,7 @@ namespace fei {
                        int fieldID,
                        int fieldOffset,
                        int whichComponentOfField,
-                       int& globalIndex);
+                       GlobalOrdinal& globalIndex);
 
     /** Given a particular degree-of-freedom, request the corresponding global
         index. A particular degree-of-freedom is specified as a component of a
@@ -300,7 +300,7 @@ namespace fei {
     int getGlobalIndex(int idType,
                        int ID,
                        int fieldID,
-                       int& globalIndex);
+                       GlobalOrdinal& globalIndex);
 
     /** Given a particular identifier, request the corresponding global
         block-index.
@@ -339,7 +339,7 @@ namespace fei {
                          const int* IDs,
                          int idType,
                          int fieldID,
-                         int* globalIndices);
+                         GlobalOrdinal* globalIndices);
 
     /** Given a list of localIDs, fill an output-list of the global-indices that
         correspond to the first instance of the specified field at each localID.
@@ -361,7 +361,7 @@ namespace fei {
                          const int* localIDs,
                          int idType,
                          int fieldID,
-                         int* globalIndices);
+                         GlobalOrdinal* globalIndices);
 
     /** Given a list of IDs, fill an output-list of the global-block-indices
         that correspond to each ID.
@@ -405,7 +405,7 @@ namespace fei {
                          const int* IDs,
                          const int* idTypes,
                          const int* fieldIDs,                         
-                         int* globalIndices);
+                         GlobalOrdinal* globalIndices);
 
     /** Given a particular degree-of-freedom, request the corresponding global
         index. In this case, the degree-of-freedom is specified simply by an
@@ -432,7 +432,7 @@ namespace fei {
      */
     int getGlobalIndex(int idType,
                        int ID,
-                       int& globalIndex);
+                       GlobalOrdinal& globalIndex);
 
     /** Given a particular identifier, request the number of scalar degrees-of-
         freedom that are associated with that identifier.
@@ -487,7 +487,7 @@ namespace fei {
         globalOffsets[i+1] - globalOffsets[i] is the number of indices on the
         i-th processor
     */
-    void getGlobalIndexOffsets(std::vector<int>& globalOffsets) const;
+    void getGlobalIndexOffsets(std::vector<GlobalOrdinal>& globalOffsets) const;
 
     /** Request the global block-index offsets. Indices are zero-based.
 
@@ -503,7 +503,7 @@ namespace fei {
         owning processor. If the global index is not in the equation space,
         return -1.
     */
-    int getOwnerProcPtIndex(int globalIndex);
+    int getOwnerProcPtIndex(GlobalOrdinal globalIndex);
 
     /** Given a global index in the block-equation space, return the
         owning processor. If the global index is not in the equation space,
@@ -561,7 +561,32 @@ namespace fei {
         @param globalIndices On output, will contain all
         indices owned or shared by local processor.
     */
-    int getIndices_SharedAndOwned(std::vector<int>& globalIndices) const;
+    int getIndices_SharedAndOwned(
+                      std::vector<GlobalOrdinal>& globalIndices) const;
+
+    /** Obtain the local-index numbering, used for assembly with local
+        indices (e.g., fei::Matrix::sumInLocal, fei::Vector::sumInLocal).
+        The locally-owned indices are local indices
+        0 .. getNumIndices_Owned()-1, in global order, and the
+        shared-but-not-owned indices follow in ascending global order, for
+        getNumIndices_SharedAndOwned() local indices in all. The returned
+        vector holds the global index of each local index. Only available
+        after initComplete has been called.
+    */
+    const std::vector<GlobalOrdinal>& getLocalIndexMap() const;
+
+    /** Return the local index of 'globalIndex' (see getLocalIndexMap()), or
+        -1 if globalIndex isn't owned or shared by the local processor.
+    */
+    int getLocalIndex(GlobalOrdinal globalIndex) const;
+
+    /** Translate local indices to global indices (see getLocalIndexMap()).
+        Returns -1 if any of the local indices is out of range, in which
+        case the corresponding global indices are set to -1.
+    */
+    int getGlobalIndicesFromLocal(int numIndices,
+                                  const int* localIndices,
+                                  GlobalOrdinal* globalIndices) const;
 
     /** Query number of block indices on local processor, including ones that
         are locally owned as well as shared-but-not-owned. Only available after
@@ -603,8 +628,8 @@ namespace fei {
         than 'lenIndices', then globalIndices will contain
         'min(lenIndices, numIndices)' of the local processor's indices.
     */
-    int getIndices_Owned(std::vector<int>& globalIndices) const;
-    int getIndices_Owned(int lenIndices, int* globalIndices, int& numIndices) const;
+    int getIndices_Owned(std::vector<GlobalOrdinal>& globalIndices) const;
+    int getIndices_Owned(int lenIndices, GlobalOrdinal* globalIndices, int& numIndices) const;
 
     /** Query number of block indices owned by local processor.
     */
@@ -633,7 +658,7 @@ namespace fei {
 
     /** Query the number of eqn indices across all processors.
      */
-    int getGlobalNumIndices() const;
+    GlobalOrdinal getGlobalNumIndices() const;
 
     /** Query the number of block-eqn indices across all processors.
      */
@@ -649,11 +674,11 @@ namespace fei {
 
     /** Intended to be used only by other fei classes.
     */
-    std::vector<int>& getEqnNumbers();
+    std::vector<GlobalOrdinal>& getEqnNumbers();
 
     /** Intended to be used only by other fei classes.
     */
-    const std::vector<int>& getEqnNumbers() const;
+    const std::vector<GlobalOrdinal>& getEqnNumbers() const;
 
     /** Intended to be used by other implementation classes.
     */
@@ -664,11 +689,11 @@ namespace fei {
 
     void getGlobalIndices(const fei::Pattern* pattern,
                           const fei::Record<int>*const* records,
-                          std::vector<int>& indices);
+                          std::vector<GlobalOrdinal>& indices);
 
     void getGlobalIndicesL(const fei::Pattern* pattern,
                           const int* records,
-                          std::vector<int>& indices);
+                          std::vector<GlobalOrdinal>& indices);
 
     void getGlobalBlkIndices(const fei::Pattern* pattern,
                              const fei::Record<int>*const* records,
@@ -679,7 +704,7 @@ namespace fei {
                           int fieldID,
                           int fieldSize,
                           int indicesAllocLen,
-                          int* indices,
+                          GlobalOrdinal* indices,
                           int& numIndices);
 
     void getGlobalIndicesL(int numRecords,
@@ -688,7 +713,7 @@ namespace fei {
                           int fieldID,
                           int fieldSize,
                           int indicesAllocLen,
-                          int* indices,
+                          GlobalOrdinal* indices,
                           int& numIndices);
 
     void getGlobalIndices(int numRecords,
@@ -697,7 +722,7 @@ namespace fei {
                           const int* fieldIDs,
                           const int* fieldSizes,
                           int indicesAllocLen,
-                          int* indices,
+                          GlobalOrdinal* indices,
                           int& numIndices);
 
     void getGlobalIndicesL(int numRecords,
@@ -707,7 +732,7 @@ namespace fei {
                           const int* fieldIDs,
                           const int* fieldSizes,
                           int indicesAllocLen,
-                          int* indices,
+                          GlobalOrdinal* indices,
                           int& numIndices);
 
     void getGlobalBlkIndices(int numRecords,
@@ -765,6 +790,8 @@ namespace fei {
 
     int exchangeGlobalIndices();
 
+    void createLocalIndexMap();
+
     int exchangeFieldInfo(fei::comm_map* ownerPattern,
                           fei::comm_map* sharerPattern,
                           snl_fei::RecordCollection* recordCollection,
@@ -789,14 +816,17 @@ namespace fei {
 
     snl_fei::PointBlockMap* ptBlkMap_;
 
-    std::vector<int> globalOffsets_;
+    std::vector<GlobalOrdinal> globalOffsets_;
     std::vector<int> globalIDOffsets_;
 
     bool simpleProblem_;
 
-    int firstLocalOffset_, lastLocalOffset_;
+    GlobalOrdinal firstLocalOffset_, lastLocalOffset_;
+
+    std::vector<GlobalOrdinal> eqnNumbers_;
 
-    std::vector<int> eqnNumbers_;
+    //global index of each local index: owned, then shared-but-not-owned.
+    std::vector<GlobalOrdinal> localIndexMap_;
 
     bool newInitData_;
     bool initCompleteAlreadyCalled_;
@@ -806,12 +836,17 @@ namespace fei {
     bool checkSharedIDs_;
   }; // class fei::VectorSpace
 
-  inline std::vector<int>& VectorSpace::getEqnNumbers()
+  inline const std::vector<GlobalOrdinal>& VectorSpace::getLocalIndexMap() const
+    {
+      return( localIndexMap_ );
+    }
+
+  inline std::vector<GlobalOrdinal>& VectorSpace::getEqnNumbers()
     {
       return( eqnNumbers_ );
     }
 
-  inline const std::vector<int>& VectorSpace::getEqnNumbers() const
+  inline const std::vector<GlobalOrdinal>& VectorSpace::getEqnNumbers() const
     {
       return( eqnNumbers_ );
     }
@@ -59,7 +59,7 @@ namespace fei {
 
       /** Set a specified scalar value throughout the vector.
        */
-      static int setValues(T* vec, int firstLocalOffset,
+      static int setValues(T* vec, GlobalOrdinal firstLocalOffset,
 			   double scalar, bool isSolnVector=false);
 
       /** Put values into the vector.
@@ -70,9 +70,9 @@ namespace fei {
           See general comments at the top of this struct regarding the
           'isSolnVector' argument.
       */
-      static int putValuesIn(T* vec, int firstLocalOffset,
+      static int putValuesIn(T* vec, GlobalOrdinal firstLocalOffset,
 			     int numValues,
-                             const int* indices,
+                             const GlobalOrdinal* indices,
                              const double* values,
                              bool sum_into,
                              bool isSolnVector=false,
@@ -81,8 +81,9 @@ namespace fei {
       /** Copy values for the specified indices out into the user-allocated
 	  array 'values'.
       */
-      static int copyOut(T* vec, int firstLocalOffset,
-			 int numValues, const int* indices, double* values,
+      static int copyOut(T* vec, GlobalOrdinal firstLocalOffset,
+			 int numValues, const GlobalOrdinal* indices,
+			 double* values,
 			 bool isSolnVector=false,
 			 int vectorIndex=0);
 
@@ -53,7 +53,7 @@ namespace fei {
     static const char* typeName()
       { return("CSVec"); }
     
-    static int setValues(CSVec* vec, int firstLocalOffset,
+    static int setValues(CSVec* vec, GlobalOrdinal firstLocalOffset,
                          double scalar, bool isSolnVector=false)
       {
         set_values(*vec, scalar);
@@ -61,8 +61,9 @@ namespace fei {
       }
 
     static int putValuesIn(CSVec* vec,
-                     int firstLocalOffset,
-                     int numValues, const int* indices, const double* values,
+                     GlobalOrdinal firstLocalOffset,
+                     int numValues, const GlobalOrdinal* indices,
+                     const double* values,
                      bool sum_into,
                      bool isSolnVector=false,
                      int vectorIndex=0)
@@ -84,8 +85,9 @@ namespace fei {
       }
 
     static int copyOut(CSVec* vec,
-                       int firstLocalOffset,
-                       int numValues, const int* indices, double* values,
+                       GlobalOrdinal firstLocalOffset,
+                       int numValues, const GlobalOrdinal* indices,
+                       double* values,
                        bool isSolnVector=false,
                        int vectorIndex=0)
       {
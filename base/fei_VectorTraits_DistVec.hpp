@@ -0,0 +1,93 @@
+/*--------------------------------------------------------------------*/
+/*    Copyright 2005 Sandia Corporation.                              */
+/*    Under the terms of Contract DE-AC04-94AL85000, there is a       */
+/*    non-exclusive license for use of this work by or on behalf      */
+/*    of the U.S. Government.  Export of this program may require     */
+/*    a license from the United States Government.                    */
+/*--------------------------------------------------------------------*/
+
+#ifndef _fei_VectorTraits_DistVec_hpp_
+#define _fei_VectorTraits_DistVec_hpp_
+
+//This file defines vector traits for fei::DistVec vectors
+//
+
+#include <fei_VectorTraits.hpp>
+#include <fei_DistVec.hpp>
+
+namespace fei {
+
+  /** Specialization for DistVec. */
+  template<>
+  struct VectorTraits<DistVec> {
+    static const char* typeName()
+      { return("fei::DistVec"); }
+
+    static int setValues(DistVec* vec, GlobalOrdinal firstLocalOffset,
+                         double scalar, bool isSolnVector=false)
+      {
+        vec->putScalar(scalar);
+        return(0);
+      }
+
+    //incoming indices are global indices, and are always locally owned.
+    static int putValuesIn(DistVec* vec,
+                           GlobalOrdinal firstLocalOffset,
+                           int numValues,
+                           const GlobalOrdinal* indices,
+                           const double* values,
+                           bool sum_into,
+                           bool isSolnVector=false,
+                           int vectorIndex=0)
+      {
+        double* localVecValues = vec->getLocalCoefs(vectorIndex);
+        if (sum_into) {
+          for(int i=0; i<numValues; ++i) {
+            localVecValues[indices[i]-firstLocalOffset] += values[i];
+          }
+        }
+        else {
+          for(int i=0; i<numValues; ++i) {
+            localVecValues[indices[i]-firstLocalOffset] = values[i];
+          }
+        }
+        return(0);
+      }
+
+    static int copyOut(DistVec* vec,
+                       GlobalOrdinal firstLocalOffset,
+                       int numValues, const GlobalOrdinal* indices,
+                       double* values,
+                       bool isSolnVector=false,
+                       int vectorIndex=0)
+      {
+        const double* localVecValues = vec->getLocalCoefs(vectorIndex);
+        for(int i=0; i<numValues; ++i) {
+          values[i] = localVecValues[indices[i]-firstLocalOffset];
+        }
+        return(0);
+      }
+
+    static double* getLocalCoefsPtr(DistVec* vec,
+                                    bool isSolnVector=false,
+                                    int vectorIndex=0)
+      {
+        return(vec->getLocalCoefs(vectorIndex));
+      }
+
+    static int update(DistVec* vec,
+                      double a,
+                      const DistVec* x,
+                      double b)
+    {
+      return( vec->update(a, *x, b) );
+    }
+
+    static int globalAssemble(DistVec* vec)
+    { return(0); }
+
+  };//struct VectorTraits<DistVec>
+}//namespace fei
+
+#endif // _fei_VectorTraits_DistVec_hpp_
+
@@ -27,7 +27,7 @@ namespace fei {
       { return("FiniteElementData"); }
 
     /** set all vector values to specified scalar */
-    static int setValues(FiniteElementData* vec, int firstLocalOffset,
+    static int setValues(FiniteElementData* vec, GlobalOrdinal firstLocalOffset,
 			 double scalar, bool isSolnVector=false)
       {
 	return(-1);
@@ -35,8 +35,9 @@ namespace fei {
 
     /** sum-into operation for vector data */
     static int putValuesIn(FiniteElementData* vec,
-		     int firstLocalOffset,
-		     int numValues, const int* indices, const double* values,
+		     GlobalOrdinal firstLocalOffset,
+		     int numValues, const GlobalOrdinal* indices,
+		     const double* values,
                      bool sum_into,
 		     bool isSolnVector=false,
 		     int vectorIndex=0)
@@ -46,8 +47,9 @@ namespace fei {
 
     /** copy out vector data */
     static int copyOut(FiniteElementData* vec,
-		       int firstLocalOffset,
-		       int numValues, const int* indices, double* values,
+		       GlobalOrdinal firstLocalOffset,
+		       int numValues, const GlobalOrdinal* indices,
+		       double* values,
 		       bool isSolnVector=false,
 		       int vectorIndex=0)
       {
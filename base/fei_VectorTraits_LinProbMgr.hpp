@@ -12,6 +12,7 @@
 
 #include <fei_VectorTraits.hpp>
 #include <fei_LinearProblemManager.hpp>
+#include <fei_impl_utils.hpp>
 
 namespace fei {
 
@@ -27,7 +28,8 @@ namespace fei {
 
    /** Set a specified scalar value throughout the vector.
        */
-    static int setValues(fei::LinearProblemManager* vec, int firstLocalOffset,
+    static int setValues(fei::LinearProblemManager* vec,
+                         GlobalOrdinal firstLocalOffset,
                          double scalar, bool isSolnVector=false)
       {
         vec->setVectorValues(scalar, isSolnVector);
@@ -38,13 +40,17 @@ namespace fei {
           that may already exist at the specified indices.
       */
     static int putValuesIn(fei::LinearProblemManager* vec,
-		     int firstLocalOffset,
-		     int numValues, const int* indices, const double* values,
+		     GlobalOrdinal firstLocalOffset,
+		     int numValues, const GlobalOrdinal* indices,
+		     const double* values,
                      bool sum_into,
 		     bool isSolnVector=false,
 		     int vectorIndex=0)
       {
-        int err = vec->insertVectorValues(numValues, indices, values,
+        std::vector<int> work;
+        const int* eqns = fei::impl_utils::int_indices(numValues, indices,
+                                                       work);
+        int err = vec->insertVectorValues(numValues, eqns, values,
                                           sum_into, isSolnVector, vectorIndex);
 	return(err);
       }
@@ -53,12 +59,16 @@ namespace fei {
           array 'values'.
       */
     static int copyOut(fei::LinearProblemManager* vec,
-		       int firstLocalOffset,
-		       int numValues, const int* indices, double* values,
+		       GlobalOrdinal firstLocalOffset,
+		       int numValues, const GlobalOrdinal* indices,
+		       double* values,
 		       bool isSolnVector=false,
 		       int vectorIndex=0)
       {
-        int err = vec->copyOutVectorValues(numValues, indices, values,
+        std::vector<int> work;
+        const int* eqns = fei::impl_utils::int_indices(numValues, indices,
+                                                       work);
+        int err = vec->copyOutVectorValues(numValues, eqns, values,
                                            isSolnVector, vectorIndex);
         return(err);
       }
@@ -12,6 +12,7 @@
 
 #include <fei_VectorTraits.hpp>
 #include <fei_LinearSystemCore.hpp>
+#include <fei_impl_utils.hpp>
 
 namespace fei {
 
@@ -27,7 +28,7 @@ namespace fei {
 
    /** Set a specified scalar value throughout the vector.
        */
-    static int setValues(LinearSystemCore* vec, int firstLocalOffset,
+    static int setValues(LinearSystemCore* vec, GlobalOrdinal firstLocalOffset,
 			 double scalar, bool isSolnVector=false)
       {
 	if (isSolnVector) {
@@ -42,12 +43,15 @@ namespace fei {
           that may already exist at the specified indices.
       */
     static int putValuesIn(LinearSystemCore* vec,
-		     int firstLocalOffset,
-		     int numValues, const int* indices, const double* values,
+		     GlobalOrdinal firstLocalOffset,
+		     int numValues, const GlobalOrdinal* indices,
+		     const double* values,
                      bool sum_into,
 		     bool isSolnVector=false,
 		     int vectorIndex=0)
     {
+      std::vector<int> work;
+      const int* eqns = fei::impl_utils::int_indices(numValues, indices, work);
       int err = 0;
       if (isSolnVector) {
         if (sum_into) {
@@ -55,15 +59,15 @@ namespace fei {
           //the soln-vector, but not 'sumInto'.
         }
         else {
-          err = vec->putInitialGuess(indices, values, numValues);
+          err = vec->putInitialGuess(eqns, values, numValues);
         }
       }
       else {
         if (sum_into) {
-          err = vec->sumIntoRHSVector(numValues, values, indices);
+          err = vec->sumIntoRHSVector(numValues, values, eqns);
         }
         else {
-          err = vec->putIntoRHSVector(numValues, values, indices);
+          err = vec->putIntoRHSVector(numValues, values, eqns);
         }
       }
       return(err);
@@ -73,19 +77,22 @@ namespace fei {
           array 'values'.
       */
     static int copyOut(LinearSystemCore* vec,
-		       int firstLocalOffset,
-		       int numValues, const int* indices, double* values,
+		       GlobalOrdinal firstLocalOffset,
+		       int numValues, const GlobalOrdinal* indices,
+		       double* values,
 		       bool isSolnVector=false,
 		       int vectorIndex=0)
       {
+	std::vector<int> work;
+	const int* eqns = fei::impl_utils::int_indices(numValues, indices, work);
 	int err = 0;
 	if (isSolnVector) {
 	  for(int i=0; i<numValues; ++i) {
-	    if (vec->getSolnEntry(indices[i], values[i]) != 0) return(-1);
+	    if (vec->getSolnEntry(eqns[i], values[i]) != 0) return(-1);
 	  }
 	}
 	else {
-	  err = vec->getFromRHSVector(numValues, values, indices);
+	  err = vec->getFromRHSVector(numValues, values, eqns);
 	}
 
 	return(err);
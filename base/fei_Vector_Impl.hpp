@@ -61,7 +61,8 @@ namespace fei {
     Vector_Impl(fei::SharedPtr<fei::VectorSpace> vecSpace,
 	   T* vector, int numLocalEqns,
 	   bool isSolutionVector=false,
-           bool deleteVector=false);
+           bool deleteVector=false,
+           int numVectors=1);
 
     /** Destructor */
     virtual ~Vector_Impl();
@@ -98,14 +99,25 @@ namespace fei {
     /** Sum values into the vector, adding to any
 	that may already exist at the specified indices.
     */
-    int sumIn(int numValues, const int* indices, const double* values,
-	      int vectorIndex=0);
+    int sumIn(int numValues, const GlobalOrdinal* indices,
+	      const double* values, int vectorIndex=0);
 
     /** Copy values into the vector, overwriting any that may already exist
 	at the specified indices.
     */
-    int copyIn(int numValues, const int* indices, const double* values,
-	       int vectorIndex=0);
+    int copyIn(int numValues, const GlobalOrdinal* indices,
+	       const double* values, int vectorIndex=0);
+
+    /** Sum values into the vector, specifying locations by local indices.
+	Locally-owned values are passed to the underlying vector together.
+    */
+    int sumInLocal(int numValues, const int* localIndices,
+		   const double* values, int vectorIndex=0);
+
+    /** Copy values into the vector, specifying locations by local indices.
+    */
+    int copyInLocal(int numValues, const int* localIndices,
+		    const double* values, int vectorIndex=0);
 
     /** Obtain the VectorSpace associated with this vector.
      */
@@ -186,23 +198,25 @@ namespace fei {
     const T* getUnderlyingVector() const { return( vector_ ); }
 
     int copyOut(int numValues,
-		const int* indices,
+		const GlobalOrdinal* indices,
 		double* values,
 		int vectorIndex=0) const;
 
+    int getNumVectors() const { return( numVectors() ); }
+
     /** please ignore
      */
     int copyOut_FE(int nodeNumber, int dofOffset, double& value);
 
   private:
     int giveToUnderlyingVector(int numValues,
-			       const int* indices,
+			       const GlobalOrdinal* indices,
 			       const double* values,
 			       bool sumInto=true,
 			       int vectorIndex=0);
 
     int copyOutOfUnderlyingVector(int numValues,
-				  const int* indices,
+				  const GlobalOrdinal* indices,
 				  double* values,
 				  int vectorIndex=0) const;
 
@@ -230,8 +244,9 @@ template<typename T>
 fei::Vector_Impl<T>::Vector_Impl(fei::SharedPtr<fei::VectorSpace> vecSpace,
 			   T* vector, int numLocalEqns,
 			   bool isSolutionVector,
-                           bool deleteVector)
-  : Vector_core(vecSpace, numLocalEqns),
+                           bool deleteVector,
+                           int numVectors)
+  : Vector_core(vecSpace, numLocalEqns, numVectors),
     vector_(vector),
     isSolution_(isSolutionVector),
     deleteVector_(deleteVector),
@@ -257,7 +272,7 @@ fei::Vector_Impl<T>::Vector_Impl(fei::SharedPtr<fei::VectorSpace> vecSpace,
 
   std::vector<int> idTypes;
   vecSpace->getIDTypes(idTypes);
-  std::vector<int> eqns;
+  std::vector<GlobalOrdinal> eqns;
   std::vector<double> zeros;
   for(size_t i=0; i<idTypes.size(); ++i) {
     int idType = idTypes[i];
@@ -267,7 +282,7 @@ fei::Vector_Impl<T>::Vector_Impl(fei::SharedPtr<fei::VectorSpace> vecSpace,
       iter = idMap.begin(), iterEnd = idMap.end();
     for(; iter!=iterEnd; ++iter) {
       int ID = iter->first;
-      int eqn;
+      GlobalOrdinal eqn;
       vecSpace->getGlobalIndex(idType, ID, eqn);
       int ndof = vecSpace->getNumDegreesOfFreedom(idType, ID);
       eqns.resize(ndof);
@@ -373,7 +388,7 @@ int fei::Vector_Impl<T>::gatherFromOverlap(bool accumulate)
 //----------------------------------------------------------------------------
 template<typename T>
 int fei::Vector_Impl<T>::sumIn(int numValues,
-			      const int* indices, const double* values,
+			      const GlobalOrdinal* indices, const double* values,
 			      int vectorIndex)
 {
   if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
@@ -387,7 +402,7 @@ int fei::Vector_Impl<T>::sumIn(int numValues,
 //----------------------------------------------------------------------------
 template<typename T>
 int fei::Vector_Impl<T>::copyIn(int numValues,
-			       const int* indices, const double* values,
+			       const GlobalOrdinal* indices, const double* values,
 			       int vectorIndex)
 {
   if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
@@ -398,10 +413,40 @@ int fei::Vector_Impl<T>::copyIn(int numValues,
   return( giveToVector(numValues, indices, values, false, vectorIndex) );
 }
 
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Vector_Impl<T>::sumInLocal(int numValues,
+				   const int* localIndices, const double* values,
+				   int vectorIndex)
+{
+  if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
+    FEI_OSTREAM& os = *output_stream_;
+    os << dbgprefix_<<"sumInLocal(n="<<numValues<<")"<<FEI_ENDL;
+  }
+
+  return( giveToVectorLocal(numValues, localIndices, values, true,
+			    vectorIndex) );
+}
+
+//----------------------------------------------------------------------------
+template<typename T>
+int fei::Vector_Impl<T>::copyInLocal(int numValues,
+				    const int* localIndices, const double* values,
+				    int vectorIndex)
+{
+  if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
+    FEI_OSTREAM& os = *output_stream_;
+    os << dbgprefix_<<"copyInLocal(n="<<numValues<<")"<<FEI_ENDL;
+  }
+
+  return( giveToVectorLocal(numValues, localIndices, values, false,
+			    vectorIndex) );
+}
+
 //----------------------------------------------------------------------------
 template<typename T>
 int fei::Vector_Impl<T>::giveToUnderlyingVector(int numValues,
-					       const int* indices,
+					       const GlobalOrdinal* indices,
 					       const double* values,
 					       bool sumInto,
 					       int vectorIndex)
@@ -427,7 +472,7 @@ int fei::Vector_Impl<T>::giveToUnderlyingVector(int numValues,
 //----------------------------------------------------------------------------
 template<typename T>
 int fei::Vector_Impl<T>::copyOutOfUnderlyingVector(int numValues,
-						  const int* indices,
+						  const GlobalOrdinal* indices,
 						  double* values,
 						  int vectorIndex) const
 {
@@ -531,7 +576,7 @@ int fei::Vector_Impl<T>::writeToStream(FEI_OSTREAM& ostrm,
 //----------------------------------------------------------------------------
 template<typename T>
 int fei::Vector_Impl<T>::copyOut(int numValues,
-				const int* indices,
+				const GlobalOrdinal* indices,
 				double* values,
 				int vectorIndex) const
 {
@@ -27,7 +27,7 @@ Vector_Local::Vector_Local(fei::SharedPtr<fei::VectorSpace> vecSpace)
   int numCoefs = vecSpace_->getNumIndices_SharedAndOwned();
   coefs_.resize(numCoefs);
 
-  std::vector<int> indices;
+  std::vector<GlobalOrdinal> indices;
   vecSpace_->getIndices_SharedAndOwned(indices);
 
   std::sort(indices.begin(), indices.end());
@@ -71,7 +71,7 @@ Vector_Local::putScalar(double scalar)
 }
 
 int
-Vector_Local::giveToVector(int numValues, const int* indices,
+Vector_Local::giveToVector(int numValues, const GlobalOrdinal* indices,
                            const double* values,
                            bool sumInto, int vectorIndex)
 {
@@ -81,7 +81,7 @@ Vector_Local::giveToVector(int numValues, const int* indices,
   }
 
   for(int i=0; i<numValues; ++i) {
-    std::map<int,int>::iterator
+    std::map<GlobalOrdinal,int>::iterator
      iter = global_to_local_.find(indices[i]);
     if (iter == global_to_local_.end()) {
       fei::console_out() << "fei::Vector_Local ERROR, eqn "<<indices[i]<<" not found "
@@ -101,15 +101,15 @@ Vector_Local::giveToVector(int numValues, const int* indices,
 }
 
 int
-Vector_Local::sumIn(int numValues, const int* indices, const double* values,
-              int vectorIndex)
+Vector_Local::sumIn(int numValues, const GlobalOrdinal* indices,
+                    const double* values, int vectorIndex)
 {
   return( giveToVector(numValues, indices, values, true, vectorIndex) );
 }
 
 int
-Vector_Local::copyIn(int numValues, const int* indices, const double* values,
-               int vectorIndex)
+Vector_Local::copyIn(int numValues, const GlobalOrdinal* indices,
+                     const double* values, int vectorIndex)
 {
   return( giveToVector(numValues, indices, values, false, vectorIndex) );
 }
@@ -134,7 +134,7 @@ Vector_Local::assembleFieldData(int fieldID,
   int fieldSize = vecSpace_->getFieldSize(fieldID);
 
   work_indices_.resize(numIDs*fieldSize);
-  int* indicesPtr = &work_indices_[0];
+  GlobalOrdinal* indicesPtr = &work_indices_[0];
 
   CHK_ERR( vecSpace_->getGlobalIndices(numIDs, IDs, idType, fieldID,
                                         indicesPtr) );
@@ -156,7 +156,7 @@ Vector_Local::assembleFieldDataLocalIDs(int fieldID,
   int fieldSize = vecSpace_->getFieldSize(fieldID);
 
   work_indices_.resize(numIDs*fieldSize);
-  int* indicesPtr = &work_indices_[0];
+  GlobalOrdinal* indicesPtr = &work_indices_[0];
 
   CHK_ERR( vecSpace_->getGlobalIndicesLocalIDs(numIDs, localIDs, idType, fieldID,
                                         indicesPtr) );
@@ -213,13 +213,13 @@ Vector_Local::copyOutFieldData(int fieldID,
   int fieldSize = vecSpace_->getFieldSize(fieldID);
 
   work_indices_.resize(numIDs*fieldSize);
-  int* indicesPtr = &work_indices_[0];
+  GlobalOrdinal* indicesPtr = &work_indices_[0];
 
   CHK_ERR( vecSpace_->getGlobalIndices(numIDs, IDs, idType, fieldID,
                                         indicesPtr) );
 
   for(int i=0; i<(int)work_indices_.size(); ++i) {
-    std::map<int,int>::iterator
+    std::map<GlobalOrdinal,int>::iterator
       iter = global_to_local_.find(work_indices_[i]);
     if (iter == global_to_local_.end()) {
       fei::console_out() << "fei::Vector_Local::copyOut ERROR, eqn "<<work_indices_[i]<<" not found "
@@ -234,7 +234,7 @@ Vector_Local::copyOutFieldData(int fieldID,
 }
 
 int
-Vector_Local::copyOut(int numValues, const int* indices,
+Vector_Local::copyOut(int numValues, const GlobalOrdinal* indices,
                       double* values, int vectorIndex) const
 {
   if (vectorIndex != 0) {
@@ -243,7 +243,7 @@ Vector_Local::copyOut(int numValues, const int* indices,
   }
 
   for(int i=0; i<numValues; ++i) {
-    std::map<int,int>::const_iterator
+    std::map<GlobalOrdinal,int>::const_iterator
      iter = global_to_local_.find(indices[i]);
     if (iter == global_to_local_.end()) {
       fei::console_out() << "fei::Vector_Local::copyOut ERROR, eqn "<<indices[i]<<" not found "
@@ -263,6 +263,14 @@ Vector_Local::getCoefs()
   return(coefs_);
 }
 
+int
+Vector_Local::getLocalIndex(GlobalOrdinal globalIndex) const
+{
+  std::map<GlobalOrdinal,int>::const_iterator
+    iter = global_to_local_.find(globalIndex);
+  return( iter == global_to_local_.end() ? -1 : iter->second );
+}
+
 int
 Vector_Local::writeToFile(const char* filename,
                     bool matrixMarketFormat)
@@ -293,7 +301,7 @@ Vector_Local::writeToStream(FEI_OSTREAM& ostrm,
   ostrm.setf(IOS_SCIENTIFIC, IOS_FLOATFIELD);
   ostrm.precision(13);
 
-  std::map<int,int>::iterator
+  std::map<GlobalOrdinal,int>::iterator
     iter = global_to_local_.begin();
 
   for(unsigned i=0; i<coefs_.size(); ++i) {
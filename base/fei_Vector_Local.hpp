@@ -51,14 +51,14 @@ class Vector_Local : public fei::Vector {
     /** Sum values into the vector, adding to any
         that may already exist at the specified indices.
     */
-    int sumIn(int numValues, const int* indices, const double* values,
-              int vectorIndex=0);
+    int sumIn(int numValues, const GlobalOrdinal* indices,
+              const double* values, int vectorIndex=0);
 
     /** Copy values into the vector, overwriting any that may already exist
         at the specified indices.
     */
-    int copyIn(int numValues, const int* indices, const double* values,
-               int vectorIndex=0);
+    int copyIn(int numValues, const GlobalOrdinal* indices,
+               const double* values, int vectorIndex=0);
 
     /** Obtain the VectorSpace associated with this vector.
      */
@@ -114,7 +114,7 @@ class Vector_Local : public fei::Vector {
                          double* data,
                          int vectorIndex=0);
 
-    int copyOut(int numValues, const int* indices,
+    int copyOut(int numValues, const GlobalOrdinal* indices,
                 double* values, int vectorIndex=0) const;
 
     int writeToFile(const char* filename,
@@ -125,8 +125,12 @@ class Vector_Local : public fei::Vector {
 
     std::vector<double>& getCoefs();
 
+    /** Position in getCoefs() of global index 'globalIndex', or -1 if that
+        index isn't held locally. */
+    int getLocalIndex(GlobalOrdinal globalIndex) const;
+
  private:
-  int giveToVector(int numValues, const int* indices,
+  int giveToVector(int numValues, const GlobalOrdinal* indices,
                            const double* values,
                            bool sumInto, int vectorIndex);
 
@@ -148,8 +152,8 @@ class Vector_Local : public fei::Vector {
 
   fei::SharedPtr<fei::VectorSpace> vecSpace_;
   std::vector<double> coefs_;
-  std::map<int,int> global_to_local_;
-  std::vector<int> work_indices_;
+  std::map<GlobalOrdinal,int> global_to_local_;
+  std::vector<GlobalOrdinal> work_indices_;
 };//class Vector_Local
 
 }//namespace fei
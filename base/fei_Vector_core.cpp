@@ -23,15 +23,18 @@
 #include "fei_ErrMacros.hpp"
 
 fei::Vector_core::Vector_core(fei::SharedPtr<fei::VectorSpace> vecSpace,
-                              int numLocalEqns)
+                              int numLocalEqns,
+                              int numVectors)
   : eqnComm_(),
     vecSpace_(vecSpace),
     comm_(vecSpace->getCommunicator()),
     firstLocalOffset_(0),
     lastLocalOffset_(0),
     numLocal_(0),
+    numVectors_(numVectors > 1 ? numVectors : 1),
     work_indices_(),
     work_indices2_(),
+    work_values_(),
     haveFEVector_(false),
     remotelyOwnedProcs_(),
     remotelyOwned_(),
@@ -46,10 +49,10 @@ fei::Vector_core::Vector_core(fei::SharedPtr<fei::VectorSpace> vecSpace,
 {
   eqnComm_.reset(new fei::EqnComm(comm_,numLocalEqns));
 
-  const std::vector<int>& offsets = eqnComm_->getGlobalOffsets();
+  const std::vector<GlobalOrdinal>& offsets = eqnComm_->getGlobalOffsets();
   firstLocalOffset_ = offsets[fei::localProc(comm_)];
   lastLocalOffset_ = offsets[fei::localProc(comm_)+1] - 1;
-  numLocal_ = lastLocalOffset_ - firstLocalOffset_ + 1;
+  numLocal_ = static_cast<int>(lastLocalOffset_ - firstLocalOffset_ + 1);
 
   if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
     FEI_OSTREAM& os = *output_stream_;
@@ -66,7 +69,7 @@ fei::Vector_core::~Vector_core()
 }
 
 void fei::Vector_core::setOverlap(int numRemoteEqns,
-                                  const int* remoteEqns)
+                                  const GlobalOrdinal* remoteEqns)
 {
   if (numRemoteEqns == 0 && remoteEqns == NULL) {
     if (overlapAlreadySet_) return;
@@ -83,20 +86,21 @@ void fei::Vector_core::setOverlap(int numRemoteEqns,
     for(int i=0; i<numRemoteEqns; ++i) {
       int proc = eqnComm_->getOwnerProc(remoteEqns[i]);
       if (proc == local_proc) continue;
-      fei::CSVec* remoteVec = getRemotelyOwned(proc);
-      fei::add_entry(*remoteVec, remoteEqns[i], 0.0);
+      for(int v=0; v<numVectors_; ++v) {
+        fei::add_entry(*getRemotelyOwned(proc, v), remoteEqns[i], 0.0);
+      }
     }
   }
   else {
-    std::vector<int> eqns;
+    std::vector<GlobalOrdinal> eqns;
     vecSpace_->getIndices_SharedAndOwned(eqns);
 
     for(size_t i=0; i<eqns.size(); ++i) {
       int proc = eqnComm_->getOwnerProc(eqns[i]);
       if (proc == local_proc) continue;
-      fei::CSVec* remoteVec = getRemotelyOwned(proc);
-
-      fei::add_entry(*remoteVec, eqns[i], 0.0);
+      for(int v=0; v<numVectors_; ++v) {
+        fei::add_entry(*getRemotelyOwned(proc, v), eqns[i], 0.0);
+      }
     }
   }
 
@@ -119,9 +123,9 @@ int fei::Vector_core::scatterToOverlap()
 
   //first find out which procs we'll be receiving from.
   std::vector<int> recvProcs;
-  for(unsigned i=0; i<remotelyOwned_.size(); ++i) {
+  for(unsigned i=0; i<remotelyOwnedProcs_.size(); ++i) {
     if (remotelyOwnedProcs_[i] == fei::localProc(comm_)) continue;
-    if (remotelyOwned_[i]->size() == 0) continue;
+    if (remotelyOwned_[i*numVectors_]->size() == 0) continue;
 
     recvProcs.push_back(remotelyOwnedProcs_[i]);
   }
@@ -131,7 +135,7 @@ int fei::Vector_core::scatterToOverlap()
   fei::mirrorProcs(comm_, recvProcs, sendProcs);
 
   //declare arrays to send from, and corresponding sizes
-  std::vector<std::vector<int> > send_ints(sendProcs.size());
+  std::vector<std::vector<GlobalOrdinal> > send_ints(sendProcs.size());
   std::vector<std::vector<double> > send_doubles(sendProcs.size());
   std::vector<int> send_sizes(sendProcs.size());
 
@@ -167,9 +171,10 @@ int fei::Vector_core::scatterToOverlap()
     int proc = sendProcs[i];
     int size = send_sizes[i];
     send_ints[i].resize(size);
-    MPI_Irecv(&(send_ints[i][0]), size, MPI_INT, proc, tag1,
+    MPI_Irecv(&(send_ints[i][0]), size,
+              fei::mpiTraits<GlobalOrdinal>::mpi_type(), proc, tag1,
               comm_, &mpiReqs[i]);
-    send_doubles[i].resize(size);
+    send_doubles[i].resize(size*numVectors_);
   }
 
   //now send the indices that we want to receive data for.
@@ -177,19 +182,26 @@ int fei::Vector_core::scatterToOverlap()
     int proc = recvProcs[i];
     fei::CSVec* remoteVec = getRemotelyOwned(proc);
     int size = remoteVec->size();
-    int* indices = &(remoteVec->indices())[0];
-    MPI_Send(indices, size, MPI_INT, proc, tag1, comm_);
+    GlobalOrdinal* indices = &(remoteVec->indices())[0];
+    MPI_Send(indices, size, fei::mpiTraits<GlobalOrdinal>::mpi_type(),
+             proc, tag1, comm_);
   }
 
   MPI_Waitall(sendProcs.size(), &mpiReqs[0], &mpiStatuses[0]);
 
-  //now post our recvs.
+  //now post our recvs. With several vectors, the coefs for all of them
+  //arrive in one message, vector by vector.
+  std::vector<std::vector<double> > recv_doubles(numVectors_ > 1 ? recvProcs.size() : 0);
   for(unsigned i=0; i<recvProcs.size(); ++i) {
     int proc = recvProcs[i];
     fei::CSVec* remoteVec = getRemotelyOwned(proc);
     int size = remoteVec->size();
     double* coefs = &(remoteVec->coefs())[0];
-    MPI_Irecv(coefs, size, MPI_DOUBLE, proc, tag2, comm_, &mpiReqs[i]);
+    if (numVectors_ > 1) {
+      recv_doubles[i].resize(size*numVectors_);
+      coefs = &(recv_doubles[i][0]);
+    }
+    MPI_Irecv(coefs, size*numVectors_, MPI_DOUBLE, proc, tag2, comm_, &mpiReqs[i]);
   }
 
   //now pack and send the coefs that the other procs need from us.
@@ -197,39 +209,53 @@ int fei::Vector_core::scatterToOverlap()
     int proc = sendProcs[i];
 
     int num = send_sizes[i];
-    int err = copyOutOfUnderlyingVector(num, &(send_ints[i][0]),
-                                        &(send_doubles[i][0]), 0);
-    if (err != 0) {
-      FEI_COUT << "fei::Vector_core::scatterToOverlap ERROR getting data to send."<<FEI_ENDL;
-      return(err);
+    for(int v=0; v<numVectors_; ++v) {
+      int err = copyOutOfUnderlyingVector(num, &(send_ints[i][0]),
+                                          &(send_doubles[i][num*v]), v);
+      if (err != 0) {
+        FEI_COUT << "fei::Vector_core::scatterToOverlap ERROR getting data to send."<<FEI_ENDL;
+        return(err);
+      }
     }
 
-    MPI_Send(&(send_doubles[i][0]), num, MPI_DOUBLE, proc, tag2, comm_);
+    MPI_Send(&(send_doubles[i][0]), num*numVectors_, MPI_DOUBLE, proc, tag2, comm_);
   }
 
   MPI_Waitall(recvProcs.size(), &mpiReqs[0], &mpiStatuses[0]);
 
+  for(unsigned i=0; i<recv_doubles.size(); ++i) {
+    int proc = recvProcs[i];
+    for(int v=0; v<numVectors_; ++v) {
+      std::vector<double>& coefs = getRemotelyOwned(proc, v)->coefs();
+      std::copy(recv_doubles[i].begin()+coefs.size()*v,
+                recv_doubles[i].begin()+coefs.size()*(v+1), coefs.begin());
+    }
+  }
+
 #endif  //#ifndef FEI_SER
 
   return(0);
 }
 
 int fei::Vector_core::copyOut(int numValues,
-				  const int* indices,
+				  const GlobalOrdinal* indices,
 				  double* values,
 				  int vectorIndex) const
 {
+  int remoteIndex = numVectors_ > 1 ? vectorIndex : 0;
+  if (remoteIndex < 0 || remoteIndex >= numVectors_) ERReturn(-1);
+
   for(int i=0; i<numValues; ++i) {
-    int ind = indices[i];
+    GlobalOrdinal ind = indices[i];
 
-    int local = ind - firstLocalOffset_;
+    GlobalOrdinal local = ind - firstLocalOffset_;
     if (local < 0 || local >= numLocal_) {
       if (ind < 0) {
         continue;
       }
 
       int proc = eqnComm_->getOwnerProc(ind);
-      const fei::CSVec* remoteVec = getRemotelyOwned(proc);
+      const fei::CSVec* remoteVec = getRemotelyOwned(proc, remoteIndex);
 
       int insertPoint = -1;
       int idx = fei::binarySearch(ind, remoteVec->indices(), insertPoint);
@@ -252,15 +278,20 @@ int fei::Vector_core::copyOut(int numValues,
 }
 
 int fei::Vector_core::giveToVector(int numValues,
-				       const int* indices,
+				       const GlobalOrdinal* indices,
 				       const double* values,
 				       bool sumInto,
 				       int vectorIndex)
 {
+  //with a single vector, remotely-owned data has always gone to the one
+  //remote-vec regardless of vectorIndex.
+  int remoteIndex = numVectors_ > 1 ? vectorIndex : 0;
+  if (remoteIndex < 0 || remoteIndex >= numVectors_) ERReturn(-1);
+
   int prev_proc = -1;
   fei::CSVec* prev_vec = NULL;
   for(int i=0; i<numValues; ++i) {
-    int ind = indices[i];
+    GlobalOrdinal ind = indices[i];
     double val = values[i];
 
     if (ind < 0) {
@@ -270,7 +301,7 @@ int fei::Vector_core::giveToVector(int numValues,
       //ignored... so we'll continue rather than throwing.
       continue;
     }
-    int local = ind - firstLocalOffset_;
+    GlobalOrdinal local = ind - firstLocalOffset_;
     if (local < 0 || local >= numLocal_) {
       int proc = eqnComm_->getOwnerProc(ind);
       if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
@@ -280,17 +311,26 @@ int fei::Vector_core::giveToVector(int numValues,
       }
       fei::CSVec* remoteVec = prev_vec;
       if (proc != prev_proc) {
-        remoteVec = getRemotelyOwned(proc);
+        remoteVec = getRemotelyOwned(proc, remoteIndex);
         prev_vec = remoteVec;
         prev_proc = proc;
       }
 
+      size_t oldSize = remoteVec->size();
       if (sumInto) {
         fei::add_entry( *remoteVec, ind, val);
       }
       else {
         fei::put_entry( *remoteVec, ind, val);
       }
+
+      //keep the same indices in the remote-vecs of the other vectors.
+      if (numVectors_ > 1 && remoteVec->size() != oldSize) {
+        for(int v=0; v<numVectors_; ++v) {
+          if (v == remoteIndex) continue;
+          fei::add_entry(*getRemotelyOwned(proc, v), ind, 0.0);
+        }
+      }
     }
     else {
       int err = giveToUnderlyingVector(1, &ind, &val, sumInto, vectorIndex);
@@ -305,6 +345,43 @@ int fei::Vector_core::giveToVector(int numValues,
   return(0);
 }
 
+int fei::Vector_core::giveToVectorLocal(int numValues,
+                                        const int* localIndices,
+                                        const double* values,
+                                        bool sumInto,
+                                        int vectorIndex)
+{
+  const std::vector<GlobalOrdinal>& localIndexMap =
+    vecSpace_->getLocalIndexMap();
+  const int numLocalIndices = localIndexMap.size();
+
+  work_indices2_.resize(numValues);
+  work_values_.resize(numValues);
+  int numOwned = 0;
+
+  for(int i=0; i<numValues; ++i) {
+    int lid = localIndices[i];
+    if (lid < 0 || lid >= numLocalIndices) ERReturn(-1);
+
+    GlobalOrdinal ind = localIndexMap[lid];
+    if (ind >= firstLocalOffset_ && ind <= lastLocalOffset_) {
+      work_indices2_[numOwned] = ind;
+      work_values_[numOwned++] = values[i];
+    }
+    else {
+      CHK_ERR( giveToVector(1, &ind, &values[i], sumInto, vectorIndex) );
+    }
+  }
+
+  if (numOwned > 0) {
+    int err = giveToUnderlyingVector(numOwned, &work_indices2_[0],
+                                     &work_values_[0], sumInto, vectorIndex);
+    if (err != 0) ERReturn(-1);
+  }
+
+  return(0);
+}
+
 int fei::Vector_core::assembleFieldData(int fieldID,
 					    int idType,
 					    int numIDs,
@@ -318,7 +395,7 @@ int fei::Vector_core::assembleFieldData(int fieldID,
   int fieldSize = vecSpace_->getFieldSize(fieldID);
 
   work_indices_.resize(numIDs*fieldSize);
-  int* indicesPtr = &work_indices_[0];
+  GlobalOrdinal* indicesPtr = &work_indices_[0];
 
   CHK_ERR( vecSpace_->getGlobalIndices(numIDs, IDs, idType, fieldID,
 					indicesPtr) );
@@ -341,7 +418,7 @@ int fei::Vector_core::assembleFieldDataLocalIDs(int fieldID,
   int fieldSize = vecSpace_->getFieldSize(fieldID);
 
   work_indices_.resize(numIDs*fieldSize);
-  int* indicesPtr = &work_indices_[0];
+  GlobalOrdinal* indicesPtr = &work_indices_[0];
 
   CHK_ERR( vecSpace_->getGlobalIndicesLocalIDs(numIDs, localIDs, idType, fieldID,
 					indicesPtr) );
@@ -357,14 +434,20 @@ void fei::Vector_core::pack_send_buffers(const std::vector<int>& sendProcs,
                        bool resize_buffer,
                        bool zeroRemotelyOwnedAfterPacking)
 {
+  std::vector<const std::vector<double>*> coefs(numVectors_);
   for(size_t i=0; i<sendProcs.size(); ++i) {
     int proc = sendProcs[i];
+    for(int v=0; v<numVectors_; ++v) {
+      coefs[v] = &(getRemotelyOwned(proc, v)->coefs());
+    }
     fei::CSVec* remoteVec = getRemotelyOwned(proc);
     fei::impl_utils::pack_indices_coefs(remoteVec->indices(),
-                       remoteVec->coefs(), send_chars[i], resize_buffer);
+                       coefs, send_chars[i], resize_buffer);
 
     if (zeroRemotelyOwnedAfterPacking) {
-      fei::set_values(*remoteVec, 0.0);
+      for(int v=0; v<numVectors_; ++v) {
+        fei::set_values(*getRemotelyOwned(proc, v), 0.0);
+      }
     }
   }
 }
@@ -374,9 +457,9 @@ void fei::Vector_core::setCommSizes()
 #ifndef FEI_SER
   sendProcs_.clear();
   //first create the list of procs we'll be sending to.
-  for(unsigned i=0; i<remotelyOwned_.size(); ++i) {
+  for(unsigned i=0; i<remotelyOwnedProcs_.size(); ++i) {
     if (remotelyOwnedProcs_[i] == fei::localProc(comm_)) continue;
-    if (remotelyOwned_[i]->size() == 0) continue;
+    if (remotelyOwned_[i*numVectors_]->size() == 0) continue;
 
     sendProcs_.push_back(remotelyOwnedProcs_[i]);
   }
@@ -484,18 +567,21 @@ int fei::Vector_core::gatherFromOverlap(bool accumulate)
     MPI_Waitany(numRecvProcs, &mpiReqs[0], &index, &status);
   }
 
-  std::vector<int> indices;
+  std::vector<GlobalOrdinal> indices;
   std::vector<double> coefs;
   //now store the data we've received.
   for(size_t i=0; i<recvProcs_.size(); ++i) {
-    fei::impl_utils::unpack_indices_coefs(recv_chars_[i], indices, coefs);
+    fei::impl_utils::unpack_indices_coefs(recv_chars_[i], numVectors_,
+                                          indices, coefs);
     int num = indices.size();
     if (num == 0) continue;
-    int err = giveToUnderlyingVector(num, &(indices[0]),
-                                     &(coefs[0]), accumulate, 0);
-    if (err != 0) {
-    //  FEI_COUT << "fei::Vector_core::gatherFromOverlap ERROR storing recvd data" << FEI_ENDL;
-      return(err);
+    for(int v=0; v<numVectors_; ++v) {
+      int err = giveToUnderlyingVector(num, &(indices[0]),
+                                       &(coefs[num*v]), accumulate, v);
+      if (err != 0) {
+      //  FEI_COUT << "fei::Vector_core::gatherFromOverlap ERROR storing recvd data" << FEI_ENDL;
+        return(err);
+      }
     }
   }
 
@@ -521,8 +607,8 @@ int fei::Vector_core::copyOutFieldData(int fieldID,
     int nodeNumber;
     int dofOffset;
     int foffset;
-    std::vector<int>& eqnNums = vecSpace_->getEqnNumbers();
-    int* vspcEqnPtr = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
+    std::vector<GlobalOrdinal>& eqnNums = vecSpace_->getEqnNumbers();
+    GlobalOrdinal* vspcEqnPtr = eqnNums.size() > 0 ? &eqnNums[0] : NULL;
 
     int offset = 0;
     for(int i=0; i<numIDs; ++i) {
@@ -532,13 +618,13 @@ int fei::Vector_core::copyOutFieldData(int fieldID,
       }
 
       nodeNumber = node->getNumber();
-      int* eqnNumbers = vspcEqnPtr+node->getOffsetIntoEqnNumbers();
+      GlobalOrdinal* eqnNumbers = vspcEqnPtr+node->getOffsetIntoEqnNumbers();
       int err = node->getFieldMask()->getFieldEqnOffset(fieldID, foffset);
       if (err != 0) {
         offset += fieldSize;
         continue;
       }
-      dofOffset = eqnNumbers[foffset] - eqnNumbers[0];
+      dofOffset = static_cast<int>(eqnNumbers[foffset] - eqnNumbers[0]);
       for(int j=0; j<fieldSize; ++j) {
         CHK_ERR( copyOut_FE(nodeNumber, dofOffset+j, data[offset++]));
       }
@@ -546,12 +632,12 @@ int fei::Vector_core::copyOutFieldData(int fieldID,
   }
   else {
     work_indices_.resize(numIDs*fieldSize*2);
-    int* indicesPtr = &work_indices_[0];
+    GlobalOrdinal* indicesPtr = &work_indices_[0];
 
     CHK_ERR( vecSpace_->getGlobalIndices(numIDs, IDs, idType,
 					 fieldID, indicesPtr) );
 
-    CHK_ERR( copyOut(numIDs*fieldSize, indicesPtr, data) );
+    CHK_ERR( copyOut(numIDs*fieldSize, indicesPtr, data, vectorIndex) );
   }
 
   return(0);
@@ -588,7 +674,7 @@ int fei::Vector_core::writeToFile(const char* filename,
     ofref.setf(IOS_SCIENTIFIC, IOS_FLOATFIELD);
     ofref.precision(13);
 
-    for(int i=firstLocalOffset_; i<=lastLocalOffset_; ++i) {
+    for(GlobalOrdinal i=firstLocalOffset_; i<=lastLocalOffset_; ++i) {
       CHK_ERR( copyOut(1, &i, &coef) );
       if (matrixMarketFormat) {
         ofref << " " << coef << FEI_ENDL;
@@ -631,20 +717,21 @@ int fei::Vector_core::writeToStream(FEI_OSTREAM& ostrm,
       }
     }
 
-    for(size_t p=0; p<remotelyOwned_.size(); ++p) {
+    for(size_t p=0; p<remotelyOwnedProcs_.size(); ++p) {
       if (remotelyOwnedProcs_[p] > local_proc) continue;
-      for(size_t ii=0; ii<remotelyOwned_[p]->size(); ++ii) {
+      const fei::CSVec* remoteVec = remotelyOwned_[p*numVectors_];
+      for(size_t ii=0; ii<remoteVec->size(); ++ii) {
         if (matrixMarketFormat) {
-          ostrm << " " << remotelyOwned_[p]->coefs()[ii] << FEI_ENDL;
+          ostrm << " " << remoteVec->coefs()[ii] << FEI_ENDL;
         }
         else {
-          ostrm << " " << remotelyOwned_[p]->indices()[ii] << " "
-            << remotelyOwned_[p]->coefs()[ii] << FEI_ENDL;
+          ostrm << " " << remoteVec->indices()[ii] << " "
+            << remoteVec->coefs()[ii] << FEI_ENDL;
         }
       }
     }
 
-    for(int i=firstLocalOffset_; i<=lastLocalOffset_; ++i) {
+    for(GlobalOrdinal i=firstLocalOffset_; i<=lastLocalOffset_; ++i) {
       CHK_ERR( copyOut(1, &i, &coef) );
       if (matrixMarketFormat) {
 	ostrm << " " << coef << FEI_ENDL;
@@ -654,15 +741,16 @@ int fei::Vector_core::writeToStream(FEI_OSTREAM& ostrm,
       }
     }
 
-    for(size_t p=0; p<remotelyOwned_.size(); ++p) {
+    for(size_t p=0; p<remotelyOwnedProcs_.size(); ++p) {
       if (remotelyOwnedProcs_[p] < local_proc) continue;
-      for(size_t ii=0; ii<remotelyOwned_[p]->size(); ++ii) {
+      const fei::CSVec* remoteVec = remotelyOwned_[p*numVectors_];
+      for(size_t ii=0; ii<remoteVec->size(); ++ii) {
         if (matrixMarketFormat) {
-          ostrm << " " << remotelyOwned_[p]->coefs()[ii] << FEI_ENDL;
+          ostrm << " " << remoteVec->coefs()[ii] << FEI_ENDL;
         }
         else {
-          ostrm << " " << remotelyOwned_[p]->indices()[ii] << " "
-            << remotelyOwned_[p]->coefs()[ii] << FEI_ENDL;
+          ostrm << " " << remoteVec->indices()[ii] << " "
+            << remoteVec->coefs()[ii] << FEI_ENDL;
         }
       }
     }
@@ -22,8 +22,11 @@ namespace fei {
 /** Class to provide infrastructure for fei::Vector implementations. */
 class Vector_core : protected fei::Logger {
  public:
-  /** constructor */
-  Vector_core(fei::SharedPtr<fei::VectorSpace> vecSpace, int numLocalEqns);
+  /** constructor. If numVectors is greater than 1, shared data for all of
+      the vectors is held together, and each overlap exchange sends one
+      message per neighboring processor for all of the vectors. */
+  Vector_core(fei::SharedPtr<fei::VectorSpace> vecSpace, int numLocalEqns,
+              int numVectors=1);
 
   /** destructor */
   virtual ~Vector_core();
@@ -34,7 +37,7 @@ class Vector_core : protected fei::Logger {
       be correct until after the scatterToOverlap() method has been called.
   */
   int copyOut(int numValues,
-	      const int* indices,
+	      const GlobalOrdinal* indices,
 	      double* values,
 	      int vectorIndex=0) const;
 
@@ -52,18 +55,30 @@ class Vector_core : protected fei::Logger {
 
   /** Give specified data to underlying vector object. */
   int giveToVector(int numValues,
-		   const int* indices,
+		   const GlobalOrdinal* indices,
 		   const double* values,
 		   bool sumInto=true,
 		   int vectorIndex=0);
 
+  /** Give specified data to underlying vector object, with locations
+      specified by local indices of the vector-space (see
+      fei::VectorSpace::getLocalIndexMap()). Locally-owned positions are
+      passed to the underlying vector in a single call. Returns -1 if any of
+      the local indices is out of range.
+  */
+  int giveToVectorLocal(int numValues,
+			const int* localIndices,
+			const double* values,
+			bool sumInto=true,
+			int vectorIndex=0);
+
   /** Scatter locally-owned vector data to remote sharing procs. */
   virtual int scatterToOverlap();
 
   /** define the extent of the overlapping indices. If the optional arguments
     are not specified, remote eqns will be obtained from the internal
     fei::VectorSpace attribute. */
-  void setOverlap(int numRemoteEqns=0, const int* remoteEqns=NULL);
+  void setOverlap(int numRemoteEqns=0, const GlobalOrdinal* remoteEqns=NULL);
 
  protected:
   /** Assemble data specified by fieldID, idType, etc. */
@@ -97,14 +112,14 @@ class Vector_core : protected fei::Logger {
 
   /** Review this function. Is it redundant with other functions? */
   virtual int giveToUnderlyingVector(int numValues,
-				     const int* indices,
+				     const GlobalOrdinal* indices,
 				     const double* values,
 				     bool sumInto=true,
 				     int vectorIndex=0) = 0;
 
   /** Review this function. Is it redundant with other functions? */
   virtual int copyOutOfUnderlyingVector(int numValues,
-					const int* indices,
+					const GlobalOrdinal* indices,
 					double* values,
 					int vectorIndex=0) const = 0;
 
@@ -130,51 +145,53 @@ class Vector_core : protected fei::Logger {
     }
 
   /** Query for first locally-owned vector position. */
-  int firstLocalOffset() const { return( firstLocalOffset_ ); }
+  GlobalOrdinal firstLocalOffset() const { return( firstLocalOffset_ ); }
 
   /** Query for last locally-owned vector position. */
-  int lastLocalOffset() const { return( lastLocalOffset_ ); }
+  GlobalOrdinal lastLocalOffset() const { return( lastLocalOffset_ ); }
+
+  /** Query for the number of vectors held. */
+  int numVectors() const { return( numVectors_ ); }
 
   /** work_indices */
-  std::vector<int>& work_indices() { return( work_indices_ ); }
+  std::vector<GlobalOrdinal>& work_indices() { return( work_indices_ ); }
   /** work_indices2 */
-  std::vector<int>& work_indices2(){ return( work_indices2_); }
+  std::vector<GlobalOrdinal>& work_indices2(){ return( work_indices2_); }
 
   /** haveFEVector */
   bool haveFEVector() { return( haveFEVector_ ); }
   /** setFEVector */
   void setFEVector(bool flag) {haveFEVector_ = flag; }
 
-  /** remotelyOwned */
+  /** remotelyOwned. If numVectors() is greater than 1, this holds
+      numVectors() consecutive entries for each of remotelyOwnedProcs(),
+      one per vector, and they all have the same indices. */
   std::vector<CSVec*>& remotelyOwned() { return( remotelyOwned_ ); }
   const std::vector<CSVec*>& remotelyOwned() const { return( remotelyOwned_ ); }
   std::vector<int>& remotelyOwnedProcs() { return( remotelyOwnedProcs_ ); }
   const std::vector<int>& remotelyOwnedProcs() const { return( remotelyOwnedProcs_ ); }
 
-  fei::CSVec* getRemotelyOwned(int proc) {
+  fei::CSVec* getRemotelyOwned(int proc, int vectorIndex=0) {
     std::vector<int>::iterator iter = std::lower_bound(remotelyOwnedProcs_.begin(), remotelyOwnedProcs_.end(), proc);
-    fei::CSVec* return_vec = NULL;
-    size_t offset = iter - remotelyOwnedProcs_.begin();
+    size_t offset = (iter - remotelyOwnedProcs_.begin())*numVectors_;
     if (iter == remotelyOwnedProcs_.end() || *iter != proc) {
       remotelyOwnedProcs_.insert(iter, proc);
-      return_vec = new fei::CSVec;
-      remotelyOwned_.insert(remotelyOwned_.begin()+offset, return_vec);
-    }
-    else {
-      return_vec = remotelyOwned_[offset];
+      for(int v=0; v<numVectors_; ++v) {
+        remotelyOwned_.insert(remotelyOwned_.begin()+offset+v, new fei::CSVec);
+      }
     }
  
-    return return_vec;
+    return remotelyOwned_[offset+vectorIndex];
   }
 
-  const fei::CSVec* getRemotelyOwned(int proc) const {
+  const fei::CSVec* getRemotelyOwned(int proc, int vectorIndex=0) const {
     std::vector<int>::const_iterator iter = std::lower_bound(remotelyOwnedProcs_.begin(), remotelyOwnedProcs_.end(), proc);
     if (iter == remotelyOwnedProcs_.end() || *iter != proc) {
       throw std::runtime_error("failed to find remote-vec for specified processor.");
     }
 
-    size_t offset = iter - remotelyOwnedProcs_.begin();
-    return remotelyOwned_[offset];
+    size_t offset = (iter - remotelyOwnedProcs_.begin())*numVectors_;
+    return remotelyOwned_[offset+vectorIndex];
   }
 
  protected:
@@ -186,15 +203,17 @@ class Vector_core : protected fei::Logger {
                        std::vector<std::vector<char> >& send_chars,
                        bool resize_buffer,
                        bool zeroRemotelyOwnedAfterPacking);
-
   fei::SharedPtr<fei::VectorSpace> vecSpace_;
 
   MPI_Comm comm_;
 
-  int firstLocalOffset_, lastLocalOffset_, numLocal_;
+  GlobalOrdinal firstLocalOffset_, lastLocalOffset_;
+  int numLocal_;
+  int numVectors_;
 
-  std::vector<int> work_indices_;
-  std::vector<int> work_indices2_;
+  std::vector<GlobalOrdinal> work_indices_;
+  std::vector<GlobalOrdinal> work_indices2_;
+  std::vector<double> work_values_;
 
   bool haveFEVector_;
 
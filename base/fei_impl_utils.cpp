@@ -16,12 +16,14 @@
 #include <fei_Matrix.hpp>
 #include <fei_Reducer.hpp>
 
+#include <algorithm>
+
 namespace fei {
 namespace impl_utils {
 
 //----------------------------------------------------------------------------
-void find_offsets(const std::vector<int>& sources,
-                  const std::vector<int>& targets,
+void find_offsets(const std::vector<GlobalOrdinal>& sources,
+                  const std::vector<GlobalOrdinal>& targets,
                   std::vector<int>& offsets)
 {
   offsets.assign(sources.size(), -1);
@@ -29,8 +31,8 @@ void find_offsets(const std::vector<int>& sources,
   size_t ssize = sources.size(), tsize = targets.size();
   size_t si = 0, ti = 0;
 
-  const int* sourcesptr = &sources[0];
-  const int* targetsptr = &targets[0];
+  const GlobalOrdinal* sourcesptr = &sources[0];
+  const GlobalOrdinal* targetsptr = &targets[0];
 
   while(si<ssize && ti<tsize) {
     if (sourcesptr[si] == targetsptr[ti]) {
@@ -48,16 +50,53 @@ void find_offsets(const std::vector<int>& sources,
   }
 }
 
+//----------------------------------------------------------------------------
+//Packed FillableMat layout: four ints (nrows, nnz, number of index bytes,
+//unused), nnz doubles, then for each row its number (relative to the
+//previous row's), its length, and its columns (relative to the row
+//number) as encoded indices. The total is padded to a multiple of
+//sizeof(double) so that concatenated buffers keep the doubles aligned.
+static const int FillableMat_header_ints = 4;
+
+static size_t pad_to_double(size_t num_bytes)
+{
+  return ((num_bytes + sizeof(double) - 1)/sizeof(double))*sizeof(double);
+}
+
+static size_t num_index_bytes_FillableMat(const fei::FillableMat& mat)
+{
+  size_t num_bytes = 0;
+  GlobalOrdinal prevRow = 0;
+
+  fei::FillableMat::const_iterator
+    r_iter = mat.begin(),
+    r_end = mat.end();
+
+  for(; r_iter!=r_end; ++r_iter) {
+    GlobalOrdinal rowNumber = r_iter->first;
+    const std::vector<GlobalOrdinal>& rowindices = r_iter->second->indices();
+    int rowlen = rowindices.size();
+
+    num_bytes += num_bytes_encoded_indices(1, &rowNumber, prevRow);
+    num_bytes += num_bytes_encoded_indices(1, &rowlen, 0);
+    if (rowlen > 0) {
+      num_bytes += num_bytes_encoded_indices(rowlen, &rowindices[0], rowNumber);
+    }
+    prevRow = rowNumber;
+  }
+
+  return num_bytes;
+}
+
 //----------------------------------------------------------------------------
 size_t num_bytes_FillableMat(const fei::FillableMat& mat)
 {
-  int nrows = mat.getNumRows();
   int nnz = fei::count_nnz(mat);
 
-  int num_chars_int = (2 + nrows*2 + nnz)*sizeof(int);
-  int num_chars_double = nnz*sizeof(double);
+  size_t num_bytes = FillableMat_header_ints*sizeof(int) + nnz*sizeof(double)
+                   + num_index_bytes_FillableMat(mat);
 
-  return num_chars_int + num_chars_double;
+  return pad_to_double(num_bytes);
 }
 
 //----------------------------------------------------------------------------
@@ -67,38 +106,71 @@ void pack_FillableMat(const fei::FillableMat& mat,
   int nrows = mat.getNumRows();
   int nnz = fei::count_nnz(mat);
 
-  int num_chars_int = (2 + nrows*2 + nnz)*sizeof(int);
-
   int* intdata = reinterpret_cast<int*>(buffer);
-  double* doubledata = reinterpret_cast<double*>(buffer+num_chars_int);
+  double* doubledata =
+    reinterpret_cast<double*>(buffer+FillableMat_header_ints*sizeof(int));
+  char* indexdata = reinterpret_cast<char*>(doubledata+nnz);
+  char* indexdata_begin = indexdata;
 
-  int ioffset = 0;
   int doffset = 0;
-
-  intdata[ioffset++] = nrows;
-  intdata[ioffset++] = nnz;
-
-  int ioffsetcols = 2+nrows*2;
+  GlobalOrdinal prevRow = 0;
 
   fei::FillableMat::const_iterator
     r_iter = mat.begin(),
     r_end = mat.end();
 
   for(; r_iter!=r_end; ++r_iter) {
-    int rowNumber = r_iter->first;
+    GlobalOrdinal rowNumber = r_iter->first;
     const fei::CSVec* row = r_iter->second;
 
-    intdata[ioffset++] = rowNumber;
     const int rowlen = row->size();
-    intdata[ioffset++] = rowlen;
-
-    const std::vector<int>& rowindices = row->indices();
+    const std::vector<GlobalOrdinal>& rowindices = row->indices();
     const std::vector<double>& rowcoefs = row->coefs();
+
+    indexdata = encode_indices(1, &rowNumber, prevRow, indexdata);
+    indexdata = encode_indices(1, &rowlen, 0, indexdata);
+    if (rowlen > 0) {
+      indexdata = encode_indices(rowlen, &rowindices[0], rowNumber, indexdata);
+    }
+    prevRow = rowNumber;
+
     for(int i=0; i<rowlen; ++i) {
-      intdata[ioffsetcols++] = rowindices[i];
       doubledata[doffset++] = rowcoefs[i];
     }
   }
+
+  intdata[0] = nrows;
+  intdata[1] = nnz;
+  intdata[2] = indexdata - indexdata_begin;
+  intdata[3] = 0;
+}
+
+//----------------------------------------------------------------------------
+//Reads the header of a packed FillableMat, and returns the start of the
+//coefficients and the range of the encoded indices.
+static void get_FillableMat_data(const char* buffer_begin,
+                                 const char* buffer_end,
+                                 int& nrows, int& nnz,
+                                 const double*& doubledata,
+                                 const char*& index_begin,
+                                 const char*& index_end)
+{
+  const size_t header_bytes = FillableMat_header_ints*sizeof(int);
+  if ((size_t)(buffer_end - buffer_begin) < header_bytes) {
+    throw std::runtime_error("fei::impl_utils::unpack_FillableMat: buffer too short.");
+  }
+
+  const int* intdata = reinterpret_cast<const int*>(buffer_begin);
+  nrows = intdata[0];
+  nnz = intdata[1];
+  int num_index_bytes = intdata[2];
+
+  doubledata = reinterpret_cast<const double*>(buffer_begin+header_bytes);
+  index_begin = reinterpret_cast<const char*>(doubledata+nnz);
+  index_end = index_begin + num_index_bytes;
+  if (index_end > buffer_end) {
+    throw std::runtime_error("fei::impl_utils::unpack_FillableMat: buffer too short.");
+  }
 }
 
 //----------------------------------------------------------------------------
@@ -115,31 +187,36 @@ void unpack_FillableMat(const char* buffer_begin, const char* buffer_end,
     return;
   }
 
-  const int* intdata = reinterpret_cast<const int*>(buffer_begin);
-  int ioffset = 0;
-  int nrows = intdata[ioffset++];
-  int nnz = intdata[ioffset++];
-
-  int ioffsetcols = 2+nrows*2;
-
-  int num_chars_int = (2+nrows*2 + nnz)*sizeof(int);
-  const double* doubledata = reinterpret_cast<const double*>(buffer_begin+num_chars_int);
+  int nrows = 0, nnz = 0;
+  const double* doubledata = NULL;
+  const char* indexdata = NULL;
+  const char* index_end = NULL;
+  get_FillableMat_data(buffer_begin, buffer_end, nrows, nnz,
+                       doubledata, indexdata, index_end);
 
   int doffset = 0;
+  GlobalOrdinal row = 0;
+  std::vector<GlobalOrdinal> cols;
 
   for(int i=0; i<nrows; ++i) {
-    int row = intdata[ioffset++];
-    int rowlen = intdata[ioffset++];
+    int rowlen = 0;
+    indexdata = decode_indices(indexdata, index_end, 1, row, &row);
+    indexdata = decode_indices(indexdata, index_end, 1, 0, &rowlen);
+    if (rowlen < 0 || doffset+rowlen > nnz) break;
+
+    cols.resize(rowlen);
+    if (rowlen > 0) {
+      indexdata = decode_indices(indexdata, index_end, rowlen, row, &cols[0]);
+    }
 
     for(int j=0; j<rowlen; ++j) {
-      int col = intdata[ioffsetcols++];
       double coef = doubledata[doffset++];
 
       if (overwrite_entries) {
-        mat.putCoef(row, col, coef);
+        mat.putCoef(row, cols[j], coef);
       }
       else {
-        mat.sumInCoef(row, col, coef);
+        mat.sumInCoef(row, cols[j], coef);
       }
     }
   }
@@ -157,10 +234,12 @@ bool unpack_CSRMat(const char* buffer_begin, const char* buffer_end, fei::CSRMat
     return all_zeros;
   }
 
-  const int* intdata = reinterpret_cast<const int*>(buffer_begin);
-  int ioffset = 0;
-  int nrows = intdata[ioffset++];
-  int nnz = intdata[ioffset++];
+  int nrows = 0, nnz = 0;
+  const double* doubledata = NULL;
+  const char* indexdata = NULL;
+  const char* index_end = NULL;
+  get_FillableMat_data(buffer_begin, buffer_end, nrows, nnz,
+                       doubledata, indexdata, index_end);
 
   fei::SparseRowGraph& srg = mat.getGraph();
   srg.rowNumbers.resize(nrows);
@@ -169,25 +248,28 @@ bool unpack_CSRMat(const char* buffer_begin, const char* buffer_end, fei::CSRMat
   std::vector<double>& packed_coefs = mat.getPackedCoefs();
   packed_coefs.resize(nnz);
 
-  int ioffsetcols = 2+nrows*2;
-
-  int num_chars_int = (2+nrows*2 + nnz)*sizeof(int);
-  const double* doubledata = reinterpret_cast<const double*>(buffer_begin+num_chars_int);
-
   int doffset = 0;
+  GlobalOrdinal row = 0;
 
   for(int i=0; i<nrows; ++i) {
-    int row = intdata[ioffset++];
-    int rowlen = intdata[ioffset++];
+    int rowlen = 0;
+    indexdata = decode_indices(indexdata, index_end, 1, row, &row);
+    indexdata = decode_indices(indexdata, index_end, 1, 0, &rowlen);
+    if (rowlen < 0 || doffset+rowlen > nnz) {
+      throw std::runtime_error("fei::impl_utils::unpack_CSRMat: failed, sizes don't agree.");
+    }
 
     srg.rowNumbers[i] = row;
     srg.rowOffsets[i] = doffset;
 
+    if (rowlen > 0) {
+      indexdata = decode_indices(indexdata, index_end, rowlen, row,
+                                 &srg.packedColumnIndices[doffset]);
+    }
+
     for(int j=0; j<rowlen; ++j) {
-      int col = intdata[ioffsetcols++];
       double coef = doubledata[doffset];
       if (coef != 0.0) all_zeros = false;
-      srg.packedColumnIndices[doffset] = col;
       packed_coefs[doffset++] = coef;
     }
   }
@@ -195,68 +277,111 @@ bool unpack_CSRMat(const char* buffer_begin, const char* buffer_end, fei::CSRMat
   return all_zeros;
 }
 
-size_t num_bytes_indices_coefs(const std::vector<int>& indices,
+//----------------------------------------------------------------------------
+//Packed indices/coefs layout: two ints (number of indices, number of index
+//bytes), the coefs of each vector in turn, then the encoded indices,
+//padded to a multiple of sizeof(double).
+static size_t num_bytes_indices_coefs(const std::vector<GlobalOrdinal>& indices,
+                                      int numVectors)
+{
+  size_t num = indices.size();
+  size_t num_bytes = 2*sizeof(int) + num*numVectors*sizeof(double);
+  if (num > 0) {
+    num_bytes += num_bytes_encoded_indices(num, &indices[0], GlobalOrdinal(0));
+  }
+  return pad_to_double(num_bytes);
+}
+
+size_t num_bytes_indices_coefs(const std::vector<GlobalOrdinal>& indices,
                         const std::vector<double>& coefs)
 {
-  int num = indices.size();
-  int num_chars_int = (1+num)*sizeof(int);
-  int num_chars = num_chars_int + num*sizeof(double);
-  return num_chars;
+  return num_bytes_indices_coefs(indices, 1);
 }
 
-void pack_indices_coefs(const std::vector<int>& indices,
+void pack_indices_coefs(const std::vector<GlobalOrdinal>& indices,
                         const std::vector<double>& coefs,
                         std::vector<char>& buffer,
                         bool resize_buffer)
 {
-  if (indices.size() != coefs.size()) {
-    throw std::runtime_error("fei::impl_utils::pack_indices_coefs failed, sizes don't match.");
-  }
+  std::vector<const std::vector<double>*> coefptrs(1, &coefs);
+  pack_indices_coefs(indices, coefptrs, buffer, resize_buffer);
+}
+
+void unpack_indices_coefs(const std::vector<char>& buffer,
+                          std::vector<GlobalOrdinal>& indices,
+                          std::vector<double>& coefs)
+{
+  if (buffer.size() == 0) return;
 
+  unpack_indices_coefs(buffer, 1, indices, coefs);
+}
+
+void pack_indices_coefs(const std::vector<GlobalOrdinal>& indices,
+                        const std::vector<const std::vector<double>*>& coefs,
+                        std::vector<char>& buffer,
+                        bool resize_buffer)
+{
   int num = indices.size();
-  int num_chars_int = (1+num)*sizeof(int);
-  int num_chars = num_chars_int + num*sizeof(double);
+  int numVectors = coefs.size();
+  for(int v=0; v<numVectors; ++v) {
+    if ((int)coefs[v]->size() != num) {
+      throw std::runtime_error("fei::impl_utils::pack_indices_coefs failed, sizes don't match.");
+    }
+  }
+
+  size_t num_chars = num_bytes_indices_coefs(indices, numVectors);
   if (resize_buffer) {
     buffer.resize(num_chars);
   }
+  else if (buffer.size() < num_chars) {
+    throw std::runtime_error("fei::impl_utils::pack_indices_coefs failed, buffer too small.");
+  }
 
   int* intdata = reinterpret_cast<int*>(&buffer[0]);
-  double* doubledata = reinterpret_cast<double*>(&buffer[0]+num_chars_int);
+  double* doubledata = reinterpret_cast<double*>(&buffer[0]+2*sizeof(int));
+  char* indexdata = reinterpret_cast<char*>(doubledata+num*numVectors);
 
-  int ioffset = 0;
-  int doffset = 0;
-  intdata[ioffset++] = num;
-  for(int i=0; i<num; ++i) {
-    intdata[ioffset++] = indices[i];
-    doubledata[doffset++] = coefs[i];
+  for(int v=0; v<numVectors; ++v) {
+    std::copy(coefs[v]->begin(), coefs[v]->end(), doubledata+num*v);
   }
+
+  char* index_end = indexdata;
+  if (num > 0) {
+    index_end = encode_indices(num, &indices[0], GlobalOrdinal(0), indexdata);
+  }
+
+  intdata[0] = num;
+  intdata[1] = index_end - indexdata;
 }
 
 void unpack_indices_coefs(const std::vector<char>& buffer,
-                          std::vector<int>& indices,
+                          int numVectors,
+                          std::vector<GlobalOrdinal>& indices,
                           std::vector<double>& coefs)
 {
   if (buffer.size() == 0) return;
 
+  const char* buffer_end = &buffer[0]+buffer.size();
   const int* intdata = reinterpret_cast<const int*>(&buffer[0]);
-  int ioffset = 0;
-  int num = intdata[ioffset++];
-  int num_chars_int = (1+num)*sizeof(int);
-  const double* doubledata = reinterpret_cast<const double*>(&buffer[0]+num_chars_int);
+  int num = intdata[0];
+  int num_index_bytes = intdata[1];
+  const double* doubledata = reinterpret_cast<const double*>(&buffer[0]+2*sizeof(int));
+  const char* indexdata = reinterpret_cast<const char*>(doubledata+num*numVectors);
+  if (indexdata + num_index_bytes > buffer_end) {
+    throw std::runtime_error("fei::impl_utils::unpack_indices_coefs: buffer too short.");
+  }
 
+  coefs.assign(doubledata, doubledata+num*numVectors);
   indices.resize(num);
-  coefs.resize(num);
-
-  int doffset = 0;
-  for(int i=0; i<num; ++i) {
-    indices[i] = intdata[ioffset++];
-    coefs[i] = doubledata[doffset++];
+  if (num > 0) {
+    decode_indices(indexdata, indexdata+num_index_bytes, num,
+                   GlobalOrdinal(0), &indices[0]);
   }
 }
 
 //----------------------------------------------------------------------------
 void separate_BC_eqns(const fei::FillableMat& mat,
-                    std::vector<int>& bcEqns,
+                    std::vector<GlobalOrdinal>& bcEqns,
                     std::vector<double>& bcVals)
 {
   fei::FillableMat::const_iterator
@@ -264,10 +389,10 @@ void separate_BC_eqns(const fei::FillableMat& mat,
     m_end = mat.end();
 
   for(; m_iter != m_end; ++m_iter) {
-    int eqn = m_iter->first;
+    GlobalOrdinal eqn = m_iter->first;
     const fei::CSVec* row = m_iter->second;
 
-    std::vector<int>::iterator
+    std::vector<GlobalOrdinal>::iterator
       iter = std::lower_bound(bcEqns.begin(), bcEqns.end(), eqn);
     if (iter == bcEqns.end() || *iter != eqn) {
       size_t offset = iter - bcEqns.begin();
@@ -286,15 +411,342 @@ void separate_BC_eqns(const fei::FillableMat& mat,
   }
 }
 
+//----------------------------------------------------------------------------
+//Fill dense per-column tables for the local-column form of the
+//bc-elimination kernel. For local column c, bcColVals[c] holds the
+//prescribed value (0.0 if colGlobalIDs[c] is not a bc eqn) and keepCol[c]
+//holds 0.0 for bc columns and 1.0 otherwise.
+static void fill_bc_column_tables(int numCols,
+                                  const GlobalOrdinal* colGlobalIDs,
+                                  int numBCEqns,
+                                  const GlobalOrdinal* bcEqns,
+                                  const double* bcValues,
+                                  std::vector<double>& bcColVals,
+                                  std::vector<double>& keepCol)
+{
+  bcColVals.assign(numCols, 0.0);
+  keepCol.assign(numCols, 1.0);
+  if (numCols < 1 || numBCEqns < 1) return;
+
+  double* bcColValsPtr = &bcColVals[0];
+  double* keepColPtr = &keepCol[0];
+
+  for(int c=0; c<numCols; ++c) {
+    const GlobalOrdinal* bc =
+      std::lower_bound(bcEqns, bcEqns+numBCEqns, colGlobalIDs[c]);
+    if (bc != bcEqns+numBCEqns && *bc == colGlobalIDs[c]) {
+      bcColValsPtr[c] = bcValues[bc-bcEqns];
+      keepColPtr[c] = 0.0;
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+//Eliminate the bc columns from one row with local column-indices, returning
+//the amount to be summed into the rhs for that row. The loop body has no
+//branches so that compilers can vectorize it.
+template<typename ColIndex>
+static double eliminate_bc_columns(int rowLength,
+                                   const ColIndex* cols,
+                                   const double* bcColVals,
+                                   const double* keepCol,
+                                   double* rowCoefs)
+{
+  double rhsContrib = 0.0;
+  for(int j=0; j<rowLength; ++j) {
+    const int c = static_cast<int>(cols[j]);
+    rhsContrib -= rowCoefs[j]*bcColVals[c];
+    rowCoefs[j] *= keepCol[c];
+  }
+  return rhsContrib;
+}
+
+//----------------------------------------------------------------------------
+//Eliminate the bc columns from one row with global column-indices,
+//returning the amount to be summed into the rhs for that row. Global
+//columns can span any range, so each one is looked up in the sorted bcEqns
+//list rather than in a dense table. Columns outside [bcEqns[0],
+//bcEqns[numBCEqns-1]] are skipped without a search, and while the columns
+//are ascending each search starts from the previous position.
+template<typename ColIndex>
+static double eliminate_bc_global_columns(int rowLength,
+                                          const ColIndex* cols,
+                                          int numBCEqns,
+                                          const GlobalOrdinal* bcEqns,
+                                          const double* bcValues,
+                                          double* rowCoefs)
+{
+  const GlobalOrdinal* bc_end = bcEqns+numBCEqns;
+  const GlobalOrdinal firstBC = bcEqns[0];
+  const GlobalOrdinal lastBC = bcEqns[numBCEqns-1];
+  const GlobalOrdinal* bc = bcEqns;
+  GlobalOrdinal prevCol = firstBC;
+
+  double rhsContrib = 0.0;
+  for(int j=0; j<rowLength; ++j) {
+    const GlobalOrdinal col = cols[j];
+    if (col < firstBC || col > lastBC) continue;
+
+    if (col < prevCol) bc = bcEqns;
+    prevCol = col;
+
+    //col <= lastBC, so bc can't reach bc_end here.
+    bc = std::lower_bound(bc, bc_end, col);
+    if (*bc == col) {
+      rhsContrib -= rowCoefs[j]*bcValues[bc-bcEqns];
+      rowCoefs[j] = 0.0;
+    }
+  }
+  return rhsContrib;
+}
+
+//----------------------------------------------------------------------------
+template<typename ColIndex>
+static void replace_with_unit_diagonal(GlobalOrdinal row, int rowLength,
+                                       const ColIndex* cols,
+                                       const GlobalOrdinal* colGlobalIDs,
+                                       double* rowCoefs)
+{
+  for(int j=0; j<rowLength; ++j) {
+    GlobalOrdinal col = colGlobalIDs==NULL ? cols[j] : colGlobalIDs[cols[j]];
+    rowCoefs[j] = col == row ? 1.0 : 0.0;
+  }
+}
+
+//----------------------------------------------------------------------------
+//Implementation of both forms of apply_essential_bcs_csr. If colGlobalIDs
+//is NULL, colIndices holds global column-indices.
+template<typename ColIndex>
+static void apply_essential_bcs_csr_impl(int numRows,
+                                         const GlobalOrdinal* rowNumbers,
+                                         const int* rowOffsets,
+                                         const ColIndex* colIndices,
+                                         int numColGlobalIDs,
+                                         const GlobalOrdinal* colGlobalIDs,
+                                         double* coefs,
+                                         int numBCEqns,
+                                         const GlobalOrdinal* bcEqns,
+                                         const double* bcValues,
+                                         bool modifyColumns,
+                                         double* rhsContribs)
+{
+  if (numRows < 1) return;
+
+  std::fill(rhsContribs, rhsContribs+numRows, 0.0);
+
+  if (numBCEqns < 1) return;
+
+  //dense column tables are only used for local column-indices, where they
+  //are bounded by the size of the column map.
+  std::vector<double> bcColVals, keepCol;
+  const bool denseCols = colGlobalIDs != NULL && numColGlobalIDs > 0;
+  if (modifyColumns && denseCols) {
+    fill_bc_column_tables(numColGlobalIDs, colGlobalIDs,
+                          numBCEqns, bcEqns, bcValues, bcColVals, keepCol);
+  }
+
+  const GlobalOrdinal* bc_end = bcEqns+numBCEqns;
+
+  for(int i=0; i<numRows; ++i) {
+    const GlobalOrdinal row = rowNumbers[i];
+    const int offset = rowOffsets[i];
+    const int rowLength = rowOffsets[i+1] - offset;
+    if (rowLength < 1) continue;
+
+    const GlobalOrdinal* bc = std::lower_bound(bcEqns, bc_end, row);
+    if (bc != bc_end && *bc == row) {
+      replace_with_unit_diagonal(row, rowLength, colIndices+offset,
+                                 colGlobalIDs, coefs+offset);
+      continue;
+    }
+
+    if (!modifyColumns) continue;
+
+    if (denseCols) {
+      rhsContribs[i] = eliminate_bc_columns(rowLength, colIndices+offset,
+                                            &bcColVals[0], &keepCol[0],
+                                            coefs+offset);
+    }
+    else if (colGlobalIDs == NULL) {
+      rhsContribs[i] = eliminate_bc_global_columns(rowLength,
+                                                   colIndices+offset,
+                                                   numBCEqns, bcEqns,
+                                                   bcValues, coefs+offset);
+    }
+  }
+}
+
+//----------------------------------------------------------------------------
+void apply_essential_bcs_csr(int numRows,
+                             const GlobalOrdinal* rowNumbers,
+                             const int* rowOffsets,
+                             const GlobalOrdinal* colIndices,
+                             double* coefs,
+                             int numBCEqns,
+                             const GlobalOrdinal* bcEqns,
+                             const double* bcValues,
+                             bool modifyColumns,
+                             double* rhsContribs)
+{
+  apply_essential_bcs_csr_impl(numRows, rowNumbers, rowOffsets, colIndices,
+                               0, NULL, coefs, numBCEqns, bcEqns, bcValues,
+                               modifyColumns, rhsContribs);
+}
+
+//----------------------------------------------------------------------------
+void apply_essential_bcs_csr(int numRows,
+                             const GlobalOrdinal* rowNumbers,
+                             const int* rowOffsets,
+                             const int* colIndices,
+                             int numColGlobalIDs,
+                             const GlobalOrdinal* colGlobalIDs,
+                             double* coefs,
+                             int numBCEqns,
+                             const GlobalOrdinal* bcEqns,
+                             const double* bcValues,
+                             bool modifyColumns,
+                             double* rhsContribs)
+{
+  apply_essential_bcs_csr_impl(numRows, rowNumbers, rowOffsets, colIndices,
+                               numColGlobalIDs, colGlobalIDs, coefs,
+                               numBCEqns, bcEqns, bcValues,
+                               modifyColumns, rhsContribs);
+}
+
+//----------------------------------------------------------------------------
+template<typename Scalar>
+static void csr_matvec_impl(int numRows,
+                            const int* rowBegin,
+                            const int* rowEnd,
+                            const int* colIndices,
+                            const Scalar* coefs,
+                            const double* x,
+                            bool sumInto,
+                            double* y)
+{
+  //products are formed and summed in double whatever the storage type.
+  for(int i=0; i<numRows; ++i) {
+    const int end = rowEnd[i];
+    int k = rowBegin[i];
+
+    double sum0 = 0.0, sum1 = 0.0, sum2 = 0.0, sum3 = 0.0;
+    for(; k+3<end; k+=4) {
+      sum0 += coefs[k  ]*x[colIndices[k  ]];
+      sum1 += coefs[k+1]*x[colIndices[k+1]];
+      sum2 += coefs[k+2]*x[colIndices[k+2]];
+      sum3 += coefs[k+3]*x[colIndices[k+3]];
+    }
+    for(; k<end; ++k) {
+      sum0 += coefs[k]*x[colIndices[k]];
+    }
+
+    const double sum = (sum0+sum1) + (sum2+sum3);
+    if (sumInto) y[i] += sum;
+    else y[i] = sum;
+  }
+}
+
+//----------------------------------------------------------------------------
+void csr_matvec(int numRows,
+                const int* rowBegin,
+                const int* rowEnd,
+                const int* colIndices,
+                const double* coefs,
+                const double* x,
+                bool sumInto,
+                double* y)
+{
+  csr_matvec_impl(numRows, rowBegin, rowEnd, colIndices, coefs, x, sumInto, y);
+}
+
+//----------------------------------------------------------------------------
+void csr_matvec(int numRows,
+                const int* rowBegin,
+                const int* rowEnd,
+                const int* colIndices,
+                const float* coefs,
+                const double* x,
+                bool sumInto,
+                double* y)
+{
+  csr_matvec_impl(numRows, rowBegin, rowEnd, colIndices, coefs, x, sumInto, y);
+}
+
+//----------------------------------------------------------------------------
+int find_row_offsets(int rowLen,
+                     const int* rowCols,
+                     int numCols,
+                     const int* cols,
+                     const int* sortOrder,
+                     int* offsets)
+{
+  const int* rowEnd = rowCols+rowLen;
+  const int* pos = rowCols;
+
+  for(int j=0; j<numCols; ++j) {
+    int col = cols[sortOrder[j]];
+
+    //pos is not advanced past a match, so repeated columns are found too.
+    pos = std::lower_bound(pos, rowEnd, col);
+    if (pos == rowEnd || *pos != col) return(-1);
+
+    offsets[sortOrder[j]] = pos - rowCols;
+  }
+
+  return(0);
+}
+
+//----------------------------------------------------------------------------
+void apply_essential_bcs(fei::FillableMat& mat,
+                         int numBCEqns,
+                         const GlobalOrdinal* bcEqns,
+                         const double* bcValues,
+                         bool modifyColumns,
+                         std::vector<GlobalOrdinal>& rhsRows,
+                         std::vector<double>& rhsCoefs)
+{
+  if (numBCEqns < 1 || mat.getNumRows() == 0) return;
+
+  fei::FillableMat::iterator
+    m_iter = mat.begin(),
+    m_end = mat.end();
+
+  const GlobalOrdinal* bc_end = bcEqns+numBCEqns;
+
+  for(m_iter = mat.begin(); m_iter != m_end; ++m_iter) {
+    const GlobalOrdinal row = m_iter->first;
+    std::vector<GlobalOrdinal>& cols = m_iter->second->indices();
+    std::vector<double>& coefs = m_iter->second->coefs();
+    const int rowLength = cols.size();
+    if (rowLength < 1) continue;
+
+    const GlobalOrdinal* bc = std::lower_bound(bcEqns, bc_end, row);
+    if (bc != bc_end && *bc == row) {
+      replace_with_unit_diagonal(row, rowLength, &cols[0], NULL, &coefs[0]);
+      continue;
+    }
+
+    if (modifyColumns) {
+      double rhsContrib = eliminate_bc_global_columns(rowLength, &cols[0],
+                                                      numBCEqns, bcEqns,
+                                                      bcValues, &coefs[0]);
+      if (rhsContrib != 0.0) {
+        rhsRows.push_back(row);
+        rhsCoefs.push_back(rhsContrib);
+      }
+    }
+  }
+}
+
 //----------------------------------------------------------------------------
 void create_col_to_row_map(const fei::FillableMat& mat,
-                           std::multimap<int,int>& crmap)
+                           std::multimap<GlobalOrdinal,GlobalOrdinal>& crmap)
 {
   crmap.clear();
 
   if (mat.getNumRows() == 0) return;
 
-  std::vector<int> rowNumbers;
+  std::vector<GlobalOrdinal> rowNumbers;
   fei::get_row_numbers(mat, rowNumbers);
 
   fei::FillableMat::const_iterator
@@ -302,13 +754,13 @@ void create_col_to_row_map(const fei::FillableMat& mat,
     m_end = mat.end();
 
   for(; m_iter != m_end; ++m_iter) {
-    int rowNum = m_iter->first;
+    GlobalOrdinal rowNum = m_iter->first;
     const fei::CSVec* rowvec = m_iter->second;
 
-    const std::vector<int>& rowindices = rowvec->indices();
+    const std::vector<GlobalOrdinal>& rowindices = rowvec->indices();
 
     for(size_t i=0; i<rowindices.size(); ++i) {
-      int colNum = rowindices[i];
+      GlobalOrdinal colNum = rowindices[i];
 
       crmap.insert(std::make_pair(colNum, rowNum));
     }
@@ -320,15 +772,15 @@ int remove_couplings(fei::FillableMat& mat)
 {
   int levelsOfCoupling = 0;
 
-  std::vector<int> rowNumbers;
+  std::vector<GlobalOrdinal> rowNumbers;
   fei::get_row_numbers(mat, rowNumbers);
 
   bool finished = false;
   while(!finished) {
-    std::multimap<int,int> crmap;
+    std::multimap<GlobalOrdinal,GlobalOrdinal> crmap;
     create_col_to_row_map(mat, crmap);
 
-    typedef std::multimap<int,int>::iterator MM_Iter;
+    typedef std::multimap<GlobalOrdinal,GlobalOrdinal>::iterator MM_Iter;
 
     fei::FillableMat::iterator
       m_iter = mat.begin(),
@@ -336,7 +788,7 @@ int remove_couplings(fei::FillableMat& mat)
 
     bool foundCoupling = false;
     for(; m_iter != m_end; ++m_iter) {
-      int rownum = m_iter->first;
+      GlobalOrdinal rownum = m_iter->first;
       fei::CSVec* mrow = m_iter->second;
 
       //now find which rows contain 'rownum' as a column-index:
@@ -344,7 +796,7 @@ int remove_couplings(fei::FillableMat& mat)
 
       //loop over the rows which contain 'rownum' as a column-index:
       for(MM_Iter cri = mmi.first; cri != mmi.second; ++cri) {
-        int cri_row = cri->second;
+        GlobalOrdinal cri_row = cri->second;
 
         fei::CSVec* frow = mat.create_or_getRow(cri_row);
 
@@ -352,7 +804,7 @@ int remove_couplings(fei::FillableMat& mat)
 
         remove_entry(*frow, rownum);
 
-        std::vector<int>& indices = mrow->indices();
+        std::vector<GlobalOrdinal>& indices = mrow->indices();
         std::vector<double>& coefs = mrow->coefs();
 
         size_t rowlen = mrow->size();
@@ -360,7 +812,7 @@ int remove_couplings(fei::FillableMat& mat)
           coefs[ii] *= coef;
         }
 
-        int* indPtr = indices.empty() ? NULL : &indices[0];
+        GlobalOrdinal* indPtr = indices.empty() ? NULL : &indices[0];
         double* coefPtr = coefs.empty() ? NULL : &coefs[0];
         add_entries(*frow, rowlen, indPtr, coefPtr);
         foundCoupling = true;
@@ -437,10 +889,10 @@ void global_union(MPI_Comm comm,
   globalUnionVec.indices().clear();
   globalUnionVec.coefs().clear();
 
-  const std::vector<int>& localindices = localVec.indices();
+  const std::vector<GlobalOrdinal>& localindices = localVec.indices();
   const std::vector<double>& localcoefs = localVec.coefs();
 
-  std::vector<int> localintdata;
+  std::vector<GlobalOrdinal> localintdata;
   if (localindices.size() > 0) {
     localintdata.assign(&localindices[0], &localindices[0]+localindices.size());
   }
@@ -454,7 +906,7 @@ void global_union(MPI_Comm comm,
   //other processor.
 
   std::vector<int> recvintdatalengths;
-  std::vector<int> recvintdata;
+  std::vector<GlobalOrdinal> recvintdata;
   int err = fei::Allgatherv(comm, localintdata, recvintdatalengths, recvintdata);
   if (err != 0) {
     throw std::runtime_error("snl_fei::globalUnion csvec: Allgatherv-int failed.");
@@ -475,7 +927,7 @@ void global_union(MPI_Comm comm,
 
   unsigned len = recvintdata.size();
   if (len > 0) {
-    int* recvintPtr = &recvintdata[0];
+    GlobalOrdinal* recvintPtr = &recvintdata[0];
     double* recvdoublePtr = &recvdoubledata[0];
 
     for(unsigned i=0; i<len; ++i) {
@@ -489,12 +941,12 @@ void translate_to_reduced_eqns(const fei::Reducer& reducer, fei::CSRMat& mat)
 {
   fei::SparseRowGraph& srg = mat.getGraph();
 
-  std::vector<int>& rowNumbers = srg.rowNumbers;
+  std::vector<GlobalOrdinal>& rowNumbers = srg.rowNumbers;
   for(size_t i=0; i<rowNumbers.size(); ++i) {
     rowNumbers[i] = reducer.translateToReducedEqn(rowNumbers[i]);
   }
 
-  std::vector<int>& colIndices = srg.packedColumnIndices;
+  std::vector<GlobalOrdinal>& colIndices = srg.packedColumnIndices;
   for(size_t i=0; i<colIndices.size(); ++i) {
     colIndices[i] = reducer.translateToReducedEqn(colIndices[i]);
   }
@@ -503,7 +955,7 @@ void translate_to_reduced_eqns(const fei::Reducer& reducer, fei::CSRMat& mat)
 //----------------------------------------------------------------------------
 void translate_to_reduced_eqns(const fei::Reducer& reducer, fei::CSVec& vec)
 {
-  std::vector<int>& indices = vec.indices();
+  std::vector<GlobalOrdinal>& indices = vec.indices();
   for(size_t i=0; i<indices.size(); ++i) {
     indices[i] = reducer.translateToReducedEqn(indices[i]);
   }
@@ -512,15 +964,17 @@ void translate_to_reduced_eqns(const fei::Reducer& reducer, fei::CSVec& vec)
 //----------------------------------------------------------------------------
 void add_to_graph(const fei::CSRMat& inmat, fei::Graph& graph)
 {
-  const std::vector<int>& rowNumbers = inmat.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& rowNumbers = inmat.getGraph().rowNumbers;
   const std::vector<int>& rowOffsets = inmat.getGraph().rowOffsets;
-  const std::vector<int>& pckColInds = inmat.getGraph().packedColumnIndices;
+  const std::vector<GlobalOrdinal>& pckColInds =
+    inmat.getGraph().packedColumnIndices;
 
   for(size_t i=0; i<rowNumbers.size(); ++i) {
-    int row = rowNumbers[i];
+    GlobalOrdinal row = rowNumbers[i];
     int offset = rowOffsets[i];
     int rowlen = rowOffsets[i+1]-offset;
-    const int* indices = pckColInds.empty() ? NULL : &pckColInds[offset];
+    const GlobalOrdinal* indices =
+      pckColInds.empty() ? NULL : &pckColInds[offset];
 
     if (graph.addIndices(row, rowlen, indices) != 0) {
       throw std::runtime_error("fei::impl_utils::add_to_graph ERROR in graph.addIndices.");
@@ -531,16 +985,17 @@ void add_to_graph(const fei::CSRMat& inmat, fei::Graph& graph)
 //----------------------------------------------------------------------------
 void add_to_matrix(const fei::CSRMat& inmat, bool sum_into, fei::Matrix& matrix)
 {
-  const std::vector<int>& rowNumbers = inmat.getGraph().rowNumbers;
+  const std::vector<GlobalOrdinal>& rowNumbers = inmat.getGraph().rowNumbers;
   const std::vector<int>& rowOffsets = inmat.getGraph().rowOffsets;
-  const std::vector<int>& pckColInds = inmat.getGraph().packedColumnIndices;
+  const std::vector<GlobalOrdinal>& pckColInds =
+    inmat.getGraph().packedColumnIndices;
   const std::vector<double>& pckCoefs = inmat.getPackedCoefs();
 
   for(size_t i=0; i<rowNumbers.size(); ++i) {
-    int row = rowNumbers[i];
+    GlobalOrdinal row = rowNumbers[i];
     int offset = rowOffsets[i];
     int rowlen = rowOffsets[i+1]-offset;
-    const int* indices = &pckColInds[offset];
+    const GlobalOrdinal* indices = &pckColInds[offset];
     const double* coefs = &pckCoefs[offset];
 
     if (sum_into) {
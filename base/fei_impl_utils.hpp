@@ -18,6 +18,8 @@
 #include <string>
 #include <vector>
 #include <map>
+#include <limits>
+#include <stdexcept>
 
 
 /** The fei namespace contains public functions, classes and interfaces.
@@ -36,17 +38,186 @@ namespace impl_utils {
 
    For efficiency, it is assumed that both sources and targets are sorted.
 */
-void find_offsets(const std::vector<int>& sources,
-                  const std::vector<int>& targets,
+void find_offsets(const std::vector<GlobalOrdinal>& sources,
+                  const std::vector<GlobalOrdinal>& targets,
                   std::vector<int>& offsets);
 
+/** Narrow a global index to int, for interfaces that are limited to int
+    indices (LinearSystemCore, FiniteElementData, Epetra, Aztec). Throws
+    std::runtime_error if the value doesn't fit.
+*/
+template<typename Index>
+int int_index(Index index)
+{
+  if (index > std::numeric_limits<int>::max() ||
+      index < std::numeric_limits<int>::min()) {
+    throw std::runtime_error("fei::impl_utils::int_index: global index too large for an int-only interface (see FEI_ENABLE_64BIT_GLOBAL_ORDINAL).");
+  }
+  return static_cast<int>(index);
+}
+
+/** Narrow a list of global indices to int, copying them into work (see
+    int_index). Returns a pointer to the int indices, or NULL if num is 0.
+*/
+template<typename Index>
+const int* int_indices(int num, const Index* indices, std::vector<int>& work)
+{
+  work.resize(num);
+  for(int i=0; i<num; ++i) {
+    work[i] = int_index(indices[i]);
+  }
+  return num > 0 ? &work[0] : NULL;
+}
+
+/** Overload for indices that are already int, which are returned as-is. */
+inline const int* int_indices(int num, const int* indices,
+                              std::vector<int>& work)
+{
+  return indices;
+}
+
+/** Narrow a vector of global indices to int (see int_index). Unlike
+    int_indices, ints is always filled, for int-only interfaces that take a
+    std::vector<int>.
+*/
+template<typename Index>
+void copy_int_indices(const std::vector<Index>& indices,
+                      std::vector<int>& ints)
+{
+  ints.resize(indices.size());
+  for(size_t i=0; i<indices.size(); ++i) {
+    ints[i] = int_index(indices[i]);
+  }
+}
+
+/** Widen a list of int indices (from an int-only interface) to
+    fei::GlobalOrdinal, copying them into work. Returns a pointer to the
+    widened indices, or NULL if num is 0.
+*/
+template<typename Index>
+const GlobalOrdinal* global_indices(int num, const Index* indices,
+                                    std::vector<GlobalOrdinal>& work)
+{
+  work.assign(indices, indices+num);
+  return num > 0 ? &work[0] : NULL;
+}
+
+/** Overload for indices that are already fei::GlobalOrdinal, which are
+    returned as-is. */
+inline const GlobalOrdinal* global_indices(int num,
+                                           const GlobalOrdinal* indices,
+                                           std::vector<GlobalOrdinal>& work)
+{
+  return indices;
+}
+
+/** Map a signed difference onto an unsigned value, so that differences of
+    small magnitude (of either sign) have small encodings. */
+inline unsigned long long zigzag_encode(long long diff)
+{
+  return diff < 0 ? (static_cast<unsigned long long>(-(diff+1)) << 1) | 1
+                  : static_cast<unsigned long long>(diff) << 1;
+}
+
+/** Inverse of zigzag_encode. */
+inline long long zigzag_decode(unsigned long long value)
+{
+  return (value & 1) ? -static_cast<long long>(value >> 1) - 1
+                     : static_cast<long long>(value >> 1);
+}
+
+/** Number of bytes that encode_indices will write for the same arguments.
+
+  Global indices are packed for communication as the difference of each
+  from the previous one (of the first from 'base'), zig-zag mapped and
+  written 7 bits per byte. Sorted or clustered indices, such as the
+  columns of a matrix row encoded relative to the row number, take one or
+  two bytes each regardless of the width of GlobalOrdinal, so a 64-bit
+  index type doesn't double the size of messages. The encoding itself is
+  64-bit: buffers written with int indices can be decoded into 64-bit
+  indices and vice versa, as long as the values fit.
+*/
+template<typename Index>
+size_t num_bytes_encoded_indices(size_t num, const Index* indices,
+                                 Index base)
+{
+  size_t num_bytes = 0;
+  long long prev = base;
+  for(size_t i=0; i<num; ++i) {
+    unsigned long long value =
+      zigzag_encode(static_cast<long long>(indices[i]) - prev);
+    do {
+      ++num_bytes;
+      value >>= 7;
+    } while(value != 0);
+    prev = indices[i];
+  }
+  return num_bytes;
+}
+
+/** Encode num indices into buffer, as described for
+    num_bytes_encoded_indices. Returns the end of the encoded data. */
+template<typename Index>
+char* encode_indices(size_t num, const Index* indices,
+                     Index base, char* buffer)
+{
+  long long prev = base;
+  for(size_t i=0; i<num; ++i) {
+    unsigned long long value =
+      zigzag_encode(static_cast<long long>(indices[i]) - prev);
+    while(value >= 0x80) {
+      *buffer++ = static_cast<char>((value & 0x7f) | 0x80);
+      value >>= 7;
+    }
+    *buffer++ = static_cast<char>(value);
+    prev = indices[i];
+  }
+  return buffer;
+}
+
+/** Decode num indices written by encode_indices with the same base.
+    Returns the end of the decoded data. Throws std::runtime_error if the
+    data runs past buffer_end, or if a value doesn't fit in the index type.
+*/
+template<typename Index>
+const char* decode_indices(const char* buffer, const char* buffer_end,
+                           size_t num, Index base,
+                           Index* indices)
+{
+  long long prev = base;
+  for(size_t i=0; i<num; ++i) {
+    unsigned long long value = 0;
+    int shift = 0;
+    unsigned char byte = 0x80;
+    while(byte & 0x80) {
+      if (buffer == buffer_end || shift > 63) {
+        throw std::runtime_error("fei::impl_utils::decode_indices: corrupt or truncated buffer.");
+      }
+      byte = static_cast<unsigned char>(*buffer++);
+      value |= static_cast<unsigned long long>(byte & 0x7f) << shift;
+      shift += 7;
+    }
+
+    long long index = prev + zigzag_decode(value);
+    indices[i] = static_cast<Index>(index);
+    if (static_cast<long long>(indices[i]) != index) {
+      throw std::runtime_error("fei::impl_utils::decode_indices: index too large for the index type.");
+    }
+    prev = index;
+  }
+  return buffer;
+}
+
+/** Size of the buffer that pack_FillableMat will write. Only depends on
+    the matrix's structure, not its coefficient values. */
 size_t num_bytes_FillableMat(const fei::FillableMat& mat);
 
 void pack_FillableMat(const fei::FillableMat& mat, char* buffer);
 
 /** unpack a pair of std::vector objects into an fei::FillableMat object.
     The std::vector objects are assumed to have been produced by the
-    function pack_FillableMat(...).
+    function pack_FillableMat(...). Row and column numbers are packed with
+    encode_indices.
 */
 void unpack_FillableMat(const char* data_begin, const char* data_end,
                         fei::FillableMat& mat,
@@ -56,24 +227,149 @@ void unpack_FillableMat(const char* data_begin, const char* data_end,
 /** return-value is true if the unpacked matrix contains nothing but zeros...*/
 bool unpack_CSRMat(const char* buffer_begin, const char* buffer_end, fei::CSRMat& mat);
 
-size_t num_bytes_indices_coefs(const std::vector<int>& indices,
+/** Size of the buffer that pack_indices_coefs will write. Indices are packed
+    with encode_indices, so this depends on their values. */
+size_t num_bytes_indices_coefs(const std::vector<GlobalOrdinal>& indices,
                         const std::vector<double>& coefs);
 
-void pack_indices_coefs(const std::vector<int>& indices,
+void pack_indices_coefs(const std::vector<GlobalOrdinal>& indices,
                         const std::vector<double>& coefs,
                         std::vector<char>& buffer,
                         bool resize_buffer=true);
 
 void unpack_indices_coefs(const std::vector<char>& buffer,
-                          std::vector<int>& indices,
+                          std::vector<GlobalOrdinal>& indices,
+                          std::vector<double>& coefs);
+
+/** Pack indices once, followed by one set of coefs per vector. coefs[v] must
+    have the same length as indices. With a single vector the buffer layout
+    is the same as that of pack_indices_coefs above. If resize_buffer is
+    false, buffer must already be large enough (std::runtime_error is
+    thrown otherwise). */
+void pack_indices_coefs(const std::vector<GlobalOrdinal>& indices,
+                        const std::vector<const std::vector<double>*>& coefs,
+                        std::vector<char>& buffer,
+                        bool resize_buffer=true);
+
+/** Unpack a buffer produced by the multiple-vector pack_indices_coefs.
+    On exit, coefs holds numVectors*indices.size() values, vector by vector.
+*/
+void unpack_indices_coefs(const std::vector<char>& buffer,
+                          int numVectors,
+                          std::vector<GlobalOrdinal>& indices,
                           std::vector<double>& coefs);
 
 void separate_BC_eqns(const fei::FillableMat& mat,
-                    std::vector<int>& bcEqns,
+                    std::vector<GlobalOrdinal>& bcEqns,
                     std::vector<double>& bcVals);
 
+/** Symmetric elimination of essential (Dirichlet) boundary-conditions,
+  performed in one streaming pass directly on compressed-row storage.
+
+  Rows whose row-number appears in bcEqns are replaced by a unit diagonal
+  (the diagonal is only set if it is present in the row's structure). If
+  modifyColumns is true, entries in columns that appear in bcEqns are zeroed
+  in all other rows, and rhsContribs[i] receives -sum(A[i,bc]*bcValue) for
+  row i. rhsContribs (length numRows) is always overwritten, and is zero for
+  the bc rows themselves.
+
+  In this form the column-indices in colIndices are global equation
+  numbers.
+
+  bcEqns must be sorted.
+*/
+void apply_essential_bcs_csr(int numRows,
+                             const GlobalOrdinal* rowNumbers,
+                             const int* rowOffsets,
+                             const GlobalOrdinal* colIndices,
+                             double* coefs,
+                             int numBCEqns,
+                             const GlobalOrdinal* bcEqns,
+                             const double* bcValues,
+                             bool modifyColumns,
+                             double* rhsContribs);
+
+/** Same as above, for local storage: the column-indices in colIndices are
+  local offsets into colGlobalIDs (which has length numColGlobalIDs), as
+  with Epetra_CrsMatrix or fei::DistCSRMatrix.
+*/
+void apply_essential_bcs_csr(int numRows,
+                             const GlobalOrdinal* rowNumbers,
+                             const int* rowOffsets,
+                             const int* colIndices,
+                             int numColGlobalIDs,
+                             const GlobalOrdinal* colGlobalIDs,
+                             double* coefs,
+                             int numBCEqns,
+                             const GlobalOrdinal* bcEqns,
+                             const double* bcValues,
+                             bool modifyColumns,
+                             double* rhsContribs);
+
+/** Sparse matrix-vector product on compressed-row storage:
+  y[i] = sum(coefs[k]*x[colIndices[k]]) for k in [rowBegin[i], rowEnd[i]),
+  or, if sumInto is true, y[i] += that sum.
+
+  The column-indices must be local offsets into x. Passing separate
+  row-begin/end arrays lets a caller run over part of each row (e.g.,
+  rowBegin = rowOffsets and rowEnd = rowOffsets+1 for a whole-row product).
+  The inner loop uses four independent accumulators so that the compiler
+  can pipeline and vectorize it; results may therefore differ from a
+  strictly sequential sum in the last bits.
+*/
+void csr_matvec(int numRows,
+                const int* rowBegin,
+                const int* rowEnd,
+                const int* colIndices,
+                const double* coefs,
+                const double* x,
+                bool sumInto,
+                double* y);
+
+/** Same as above, for single-precision coefficients. Each coefficient is
+  promoted to double before it is multiplied, so only the storage of the
+  matrix is in single precision.
+*/
+void csr_matvec(int numRows,
+                const int* rowBegin,
+                const int* rowEnd,
+                const int* colIndices,
+                const float* coefs,
+                const double* x,
+                bool sumInto,
+                double* y);
+
+/** Find the positions of the columns cols[0..numCols-1] in one row of a
+  compressed-row matrix, whose column-indices rowCols[0..rowLen-1] are
+  sorted. sortOrder lists the positions in cols in ascending order of
+  column (with cols[sortOrder[j]] <= cols[sortOrder[j+1]]), so that a set of
+  columns sorted once can be located in several rows with a single forward
+  walk per row. On return offsets[j] is the position of cols[j] in rowCols.
+
+  Returns 0 if all columns were found, otherwise -1 (offsets are then
+  incomplete).
+*/
+int find_row_offsets(int rowLen,
+                     const int* rowCols,
+                     int numCols,
+                     const int* cols,
+                     const int* sortOrder,
+                     int* offsets);
+
+/** Same operation as apply_essential_bcs_csr, applied to the rows of a
+  fei::FillableMat. Nonzero rhs contributions are appended to rhsRows and
+  rhsCoefs.
+*/
+void apply_essential_bcs(fei::FillableMat& mat,
+                         int numBCEqns,
+                         const GlobalOrdinal* bcEqns,
+                         const double* bcValues,
+                         bool modifyColumns,
+                         std::vector<GlobalOrdinal>& rhsRows,
+                         std::vector<double>& rhsCoefs);
+
 void create_col_to_row_map(const fei::FillableMat& mat,
-                           std::multimap<int,int>& crmap);
+                           std::multimap<GlobalOrdinal,GlobalOrdinal>& crmap);
 
 int remove_couplings(fei::FillableMat& mat);
 
@@ -128,5 +128,20 @@
 
 #include "fei_version.h"
 
+namespace fei {
+  /** Type of global equation numbers (indices into the global linear
+      system), used for the global indices held by VectorSpace, MatrixGraph,
+      SparseRowGraph, CSVec etc. Local indices, IDs and field-IDs remain int.
+      64-bit global indices are selected at configure time
+      (FEI_ENABLE_64BIT_GLOBAL_ORDINAL), which defines
+      HAVE_FEI_64BIT_GLOBAL_ORDINAL.
+  */
+#ifdef HAVE_FEI_64BIT_GLOBAL_ORDINAL
+  typedef long long GlobalOrdinal;
+#else
+  typedef int GlobalOrdinal;
+#endif
+}//namespace fei
+
 #endif // _fei_macros_hpp_
 
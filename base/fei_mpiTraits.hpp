@@ -61,11 +61,12 @@ namespace fei {
       static MPI_Datatype mpi_type() {return(MPI_LONG);};
     };
 
-#ifdef EIGHT_BYTE_GLOBAL_ID
+#if defined(EIGHT_BYTE_GLOBAL_ID) || defined(HAVE_FEI_64BIT_GLOBAL_ORDINAL)
   /** Simple trait struct for querying the mpi-data-type of
-   an intrinsic type. */
+   an intrinsic type. (long long is the type of GlobalID and of
+   fei::GlobalOrdinal in their 64-bit configurations.) */
   template<>
-    struct mpiTraits<GlobalID> {
+    struct mpiTraits<long long> {
       /** mpi type query */
       static MPI_Datatype mpi_type() {return(MPI_LONG_LONG);};
     };
@@ -35,9 +35,9 @@ FEI_OSTREAM& operator<<(FEI_OSTREAM& os, fei::FillableMat& mat)
     iter = mat.begin(), iter_end = mat.end();
 
   for(; iter!=iter_end; ++iter) {
-    int row = iter->first;
+    fei::GlobalOrdinal row = iter->first;
     const fei::CSVec* v = iter->second;
-    const std::vector<int>& v_ind = v->indices();
+    const std::vector<fei::GlobalOrdinal>& v_ind = v->indices();
     const std::vector<double>& v_coef = v->coefs();
     os << row << ": ";
     for(size_t i=0; i<v_ind.size(); ++i) {
@@ -66,13 +66,14 @@ FEI_OSTREAM& operator<<(FEI_OSTREAM& os, fei::CSRMat& mat)
 {
   os << "num rows: " << mat.getNumRows() << FEI_ENDL;
 
-  const std::vector<int>& rows = mat.getGraph().rowNumbers;
+  const std::vector<fei::GlobalOrdinal>& rows = mat.getGraph().rowNumbers;
   const int* rowoffs = &(mat.getGraph().rowOffsets[0]);
-  const std::vector<int>& cols = mat.getGraph().packedColumnIndices;
+  const std::vector<fei::GlobalOrdinal>& cols =
+    mat.getGraph().packedColumnIndices;
   const double* coefs = &(mat.getPackedCoefs()[0]);
 
   for(size_t i=0; i<rows.size(); ++i) {
-    int row = rows[i];
+    fei::GlobalOrdinal row = rows[i];
 
     os << row << ": ";
     for(int j=rowoffs[i]; j<rowoffs[i+1]; ++j) {
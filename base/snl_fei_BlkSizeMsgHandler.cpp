@@ -20,6 +20,7 @@
 #include <fei_Graph.hpp>
 #include <snl_fei_Constraint.hpp>
 #include <fei_TemplateUtils.hpp>
+#include <fei_impl_utils.hpp>
 
 #include <fei_EqnBuffer.hpp>
 #include <fei_EqnCommMgr.hpp>
@@ -167,10 +168,12 @@ int snl_fei::BlkSizeMsgHandler::getSendMessage(int destProc,
       iter = cols->begin(),
       iter_end = cols->end();
 
+    //the messages are ints, so point-eqns are narrowed (with a check).
     int offset = 0;
     for(; iter != iter_end; ++iter) {
-      CHK_ERR( ptBlkMap_->getBlkEqnInfo(*iter,
-                                        message[offset], message[offset+1]) );
+      fei::GlobalOrdinal ptEqn = -1;
+      CHK_ERR( ptBlkMap_->getBlkEqnInfo(*iter, ptEqn, message[offset+1]) );
+      message[offset] = fei::impl_utils::int_index(ptEqn);
       offset += 2;
     }
 
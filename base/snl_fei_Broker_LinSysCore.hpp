@@ -23,6 +23,7 @@
 #include <fei_MatrixReducer.hpp>
 #include <fei_VectorReducer.hpp>
 #include <fei_Reducer.hpp>
+#include <fei_impl_utils.hpp>
 #include <snl_fei_LinearSystem_General.hpp>
 
 #undef fei_file
@@ -158,7 +159,13 @@ namespace snl_fei {
           fei::SharedPtr<fei::VectorSpace> vecSpace = 
             matrixGraph_->getRowSpace();
 
-          vecSpace->getGlobalIndexOffsets(globalOffsets);
+          //LinearSystemCore only takes int eqn-numbers.
+          std::vector<fei::GlobalOrdinal> ptOffsets;
+          vecSpace->getGlobalIndexOffsets(ptOffsets);
+          globalOffsets.resize(ptOffsets.size());
+          for(size_t i=0; i<ptOffsets.size(); ++i) {
+            globalOffsets[i] = fei::impl_utils::int_index(ptOffsets[i]);
+          }
           vecSpace->getGlobalBlkIndexOffsets(globalBlkOffsets);
 
           numLocalEqns_ = globalOffsets[local_proc+1]-globalOffsets[local_proc];
@@ -191,11 +198,16 @@ namespace snl_fei {
         fei::SharedPtr<fei::SparseRowGraph> localSRGraph =
           matrixGraph_->createGraph(blockMatrix_);
 
-        std::vector<int>& rowNumbers = localSRGraph->rowNumbers;
+        std::vector<fei::GlobalOrdinal>& rowNumbers =
+          localSRGraph->rowNumbers;
         int numLocalRows = rowNumbers.size();
         int* rowOffsets = &(localSRGraph->rowOffsets[0]);
         int numLocalNonzeros = localSRGraph->packedColumnIndices.size();
-        int* nonzeros = &(localSRGraph->packedColumnIndices[0]);
+        std::vector<int> intNonzeros;
+        int* nonzeros = const_cast<int*>(fei::impl_utils::int_indices(
+                          numLocalNonzeros,
+                          &(localSRGraph->packedColumnIndices[0]),
+                          intNonzeros));
 
         int numGlobalNonzeros = 0;
         fei::GlobalSum(comm, numLocalNonzeros, numGlobalNonzeros);
@@ -209,7 +221,8 @@ namespace snl_fei {
           colPtrs[i] = &(nonzeros[rowOffsets[i]]);
           rowLengthsPtr[i] = rowOffsets[i+1]-rowOffsets[i];
           if (blockMatrix_ == true) {
-            ptRowsPerBlkRow[i] = lookup_->getBlkEqnSize(rowNumbers[i]);
+            ptRowsPerBlkRow[i] =
+              lookup_->getBlkEqnSize(fei::impl_utils::int_index(rowNumbers[i]));
           }
         }
 
@@ -67,11 +67,11 @@ namespace snl_fei {
 
     /** get equation-number of constraint. (only valid if lagrange-multiplier)
     */
-    int getEqnNumber() const { return( eqnNumber_ ); }
+    fei::GlobalOrdinal getEqnNumber() const { return( eqnNumber_ ); }
 
     /** set equation-number of constraint. (only valid if lagrange-multiplier)
     */
-    void setEqnNumber(int eqn) { eqnNumber_ = eqn; }
+    void setEqnNumber(fei::GlobalOrdinal eqn) { eqnNumber_ = eqn; }
 
     /** get block-equation number of constraint. (only valid if
      lagrange-multiplier */
@@ -140,7 +140,7 @@ namespace snl_fei {
     snl_fei::RecordCollection* recordCollection_;
     bool isPenalty_;
 
-    int eqnNumber_;
+    fei::GlobalOrdinal eqnNumber_;
     int blkEqnNumber_;
 
     int slave_;
@@ -49,21 +49,24 @@ snl_fei::LinearSystem_FEData::~LinearSystem_FEData()
 }
 
 //----------------------------------------------------------------------------
-bool snl_fei::LinearSystem_FEData::eqnIsEssentialBC(int globalEqnIndex) const
+bool snl_fei::LinearSystem_FEData::eqnIsEssentialBC(
+                                      fei::GlobalOrdinal globalEqnIndex) const
 {
   fei::console_out() << "LinearSystem_FEData::eqnIsEssentialBC NOT IMPLEMENTED!!"<<FEI_ENDL;
   return(false);
 }
 
 //----------------------------------------------------------------------------
-void snl_fei::LinearSystem_FEData::getEssentialBCs(std::vector<int>& bcEqns,
-                                              std::vector<double>& bcVals) const
+void snl_fei::LinearSystem_FEData::getEssentialBCs(
+                                     std::vector<fei::GlobalOrdinal>& bcEqns,
+                                     std::vector<double>& bcVals) const
 {
   fei::console_out() << "LinearSystem_FEData::getEssentialBC_Eqns NOT IMPLEMENTED!!"<<FEI_ENDL;
 }
 
 //----------------------------------------------------------------------------
-void snl_fei::LinearSystem_FEData::getConstrainedEqns(std::vector<int>& crEqns) const
+void snl_fei::LinearSystem_FEData::getConstrainedEqns(
+                                std::vector<fei::GlobalOrdinal>& crEqns) const
 {
   matrixGraph_->getConstrainedIndices(crEqns);
 }
@@ -111,7 +114,7 @@ int snl_fei::LinearSystem_FEData::setBCValuesOnVector(fei::Vector* vector)
 //----------------------------------------------------------------------------
 int snl_fei::LinearSystem_FEData::implementBCs(bool applyBCs)
 {
-  std::vector<int> essEqns;
+  std::vector<fei::GlobalOrdinal> essEqns;
   std::vector<double> essGamma;
 
   fei::SharedPtr<fei::FillableMat> localBCeqns(new fei::FillableMat);
@@ -134,17 +137,15 @@ int snl_fei::LinearSystem_FEData::implementBCs(bool applyBCs)
 
   fei::impl_utils::separate_BC_eqns( *(bcEqns.getMatrix()), essEqns, essGamma);
 
+  //FiniteElementData deals in int node-numbers and eqns.
   int len = essEqns.size();
-  essEqns.resize(len*3);
-  int* nodeNumbers = &essEqns[0]+len;
-  int* dof_ids = nodeNumbers+len;
+  std::vector<int> nodeNumbers(len), dof_ids(len);
 
   if (len > 0) {
-    int* essEqnsPtr = &essEqns[0];
     double* gammaPtr = &essGamma[0];
 
     for(int i=0; i<len; ++i) {
-      int eqn = essEqnsPtr[i];
+      int eqn = fei::impl_utils::int_index(essEqns[i]);
       nodeNumbers[i] = lookup_->getAssociatedNodeNumber(eqn);
       int fieldID = lookup_->getAssociatedFieldID(eqn);
       int base_eqn = lookup_->getEqnNumber(nodeNumbers[i], fieldID);
@@ -152,7 +153,8 @@ int snl_fei::LinearSystem_FEData::implementBCs(bool applyBCs)
     }
 
     if (applyBCs) {
-      CHK_ERR( feData_->setDirichletBCs(len, nodeNumbers, dof_ids, gammaPtr) );
+      CHK_ERR( feData_->setDirichletBCs(len, &nodeNumbers[0], &dof_ids[0],
+                                        gammaPtr) );
     }
   }
 
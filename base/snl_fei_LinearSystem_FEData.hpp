@@ -87,14 +87,14 @@ namespace snl_fei {
       { lookup_ = lookup; }
 
     /** Query whether specified eqn has prescribed BC value. */
-    bool eqnIsEssentialBC(int globalEqnIndex) const;
+    bool eqnIsEssentialBC(fei::GlobalOrdinal globalEqnIndex) const;
 
     /** Retrieve BC eqn indices. */
-    void getEssentialBCs(std::vector<int>& bcEqns,
+    void getEssentialBCs(std::vector<fei::GlobalOrdinal>& bcEqns,
                          std::vector<double>& bcVals) const;
 
     /** Retrieve constrained eqn indices */
-    void getConstrainedEqns(std::vector<int>& crEqns) const;
+    void getConstrainedEqns(std::vector<fei::GlobalOrdinal>& crEqns) const;
 
   private:
     int implementBCs(bool applyBCs);
@@ -17,6 +17,7 @@
 #include <fei_VectorSpace.hpp>
 #include <fei_MatrixGraph.hpp>
 #include <fei_SparseRowGraph.hpp>
+#include <fei_CSRMat.hpp>
 #include <snl_fei_Constraint.hpp>
 #include <fei_Record.hpp>
 #include <fei_utils.hpp>
@@ -37,14 +38,18 @@ snl_fei::LinearSystem_General::LinearSystem_General(fei::SharedPtr<fei::MatrixGr
   : fei::LinearSystem(matrixGraph),
     comm_(matrixGraph->getRowSpace()->getCommunicator()),
     essBCvalues_(NULL),
+    essBCindex_(),
+    allEssBCindex_(),
     resolveConflictRequested_(false),
     bcs_trump_slaves_(false),
     explicitBCenforcement_(false),
     BCenforcement_no_column_mod_(false),
+    BCenforcement_direct_(false),
     localProc_(0),
     numProcs_(1),
     name_(),
     named_loadcomplete_counter_(),
+    penaltyScatter_(),
     iwork_(),
     dwork_(),
     dbgprefix_("LinSysG: ")
@@ -54,7 +59,7 @@ snl_fei::LinearSystem_General::LinearSystem_General(fei::SharedPtr<fei::MatrixGr
 
   fei::SharedPtr<fei::VectorSpace> vecSpace = matrixGraph->getRowSpace();
 
-  std::vector<int> offsets;
+  std::vector<fei::GlobalOrdinal> offsets;
   vecSpace->getGlobalIndexOffsets(offsets);
 
   firstLocalOffset_ = offsets[localProc_];
@@ -69,6 +74,15 @@ snl_fei::LinearSystem_General::~LinearSystem_General()
   delete essBCvalues_;
 }
 
+//----------------------------------------------------------------------------
+void snl_fei::LinearSystem_General::setMatrix(fei::SharedPtr<fei::Matrix>& matrix)
+{
+  fei::LinearSystem::setMatrix(matrix);
+
+  //cached positions are only valid for the matrix they were obtained from.
+  penaltyScatter_.clear();
+}
+
 //----------------------------------------------------------------------------
 int snl_fei::LinearSystem_General::parameters(int numParams,
 				   const char* const* paramStrings)
@@ -103,6 +117,11 @@ int snl_fei::LinearSystem_General::parameters(int numParams,
     BCenforcement_no_column_mod_ = true;
   }
 
+  param = snl_fei::getParam("BC_ENFORCEMENT_DIRECT",numParams,paramStrings);
+  if (param != NULL){
+    BCenforcement_direct_ = true;
+  }
+
   param = snl_fei::getParamValue("FEI_OUTPUT_LEVEL",numParams,paramStrings);
   if (param != NULL) {
     setOutputLevel(fei::utils::string_to_output_level(param));
@@ -328,44 +347,31 @@ int snl_fei::LinearSystem_General::setBCValuesOnVector(fei::Vector* vector)
     return(0);
   }
 
-  CHK_ERR( vector->copyIn(essBCvalues_->size(),
-			  &(essBCvalues_->indices())[0],
-			  &(essBCvalues_->coefs())[0]) );
+  CHK_ERR( giveToEachVector(*vector, essBCvalues_->size(),
+                             &(essBCvalues_->indices())[0],
+                             &(essBCvalues_->coefs())[0], false) );
 
   return(0);
 }
 
 //----------------------------------------------------------------------------
-bool snl_fei::LinearSystem_General::eqnIsEssentialBC(int globalEqnIndex) const
+bool snl_fei::LinearSystem_General::eqnIsEssentialBC(
+                                      fei::GlobalOrdinal globalEqnIndex) const
 {
-  if (essBCvalues_ == NULL) return(false);
-
-  std::vector<int>& indices = essBCvalues_->indices();
-  int offset = fei::binarySearch(globalEqnIndex, indices);
-  return( offset < 0 ? false : true);
+  return( essBCindex_.contains(globalEqnIndex) );
 }
 
 //----------------------------------------------------------------------------
-void snl_fei::LinearSystem_General::getEssentialBCs(std::vector<int>& bcEqns,
-                                             std::vector<double>& bcVals) const
+void snl_fei::LinearSystem_General::getEssentialBCs(
+                                     std::vector<fei::GlobalOrdinal>& bcEqns,
+                                     std::vector<double>& bcVals) const
 {
-  bcEqns.clear();
-  bcVals.clear();
-  if (essBCvalues_ == NULL) return;
-
-  int num = essBCvalues_->size();
-  bcEqns.resize(num);
-  bcVals.resize(num);
-  int* essbcs = &(essBCvalues_->indices())[0];
-  double* vals = &(essBCvalues_->coefs())[0];
-  for(int i=0; i<num; ++i) {
-    bcEqns[i] = essbcs[i];
-    bcVals[i] = vals[i];
-  }
+  essBCindex_.getBCEqns(bcEqns, bcVals);
 }
 
 //----------------------------------------------------------------------------
-void snl_fei::LinearSystem_General::getConstrainedEqns(std::vector<int>& crEqns) const
+void snl_fei::LinearSystem_General::getConstrainedEqns(
+                                std::vector<fei::GlobalOrdinal>& crEqns) const
 {
   matrixGraph_->getConstrainedIndices(crEqns);
 }
@@ -409,13 +415,13 @@ int extractDirichletBCs(fei::DirichletBCManager* bcManager,
 
   if (resolveConflictRequested) {
     fei::SharedPtr<fei::FillableMat> mat = bcEqns->getMatrix();
-    std::vector<int> bcEqnNumbers;
+    std::vector<fei::GlobalOrdinal> bcEqnNumbers;
     fei::get_row_numbers(*mat, bcEqnNumbers);
     CHK_ERR( snl_fei::resolveConflictingCRs(*matrixGraph, bcEqns_mat,
                                             bcEqnNumbers) );
   }
 
-  std::vector<int> essEqns;
+  std::vector<fei::GlobalOrdinal> essEqns;
   std::vector<double> values;
 
   std::map<int,fei::FillableMat*>& remotes = bcEqns->getRemotelyOwnedMatrices();
@@ -431,11 +437,11 @@ int extractDirichletBCs(fei::DirichletBCManager* bcManager,
   fei::impl_utils::separate_BC_eqns( *(bcEqns->getMatrix()), essEqns, values);
 
   if (essEqns.size() > 0) {
-    int* essEqnsPtr = &essEqns[0];
+    fei::GlobalOrdinal* essEqnsPtr = &essEqns[0];
     double* valuesPtr = &values[0];
 
     for(unsigned i=0; i<essEqns.size(); ++i) {
-      int eqn = essEqnsPtr[i];
+      fei::GlobalOrdinal eqn = essEqnsPtr[i];
       double value = valuesPtr[i];
       fei::put_entry(*essBCvalues, eqn, value);
     }
@@ -457,9 +463,15 @@ int snl_fei::LinearSystem_General::implementBCs(bool applyBCs)
                        essBCvalues_,  resolveConflictRequested_,
                       bcs_trump_slaves_) );
 
+  //essBCindex_ is only ever derived from essBCvalues_, here.
+  int numEssBCs = essBCvalues_->size();
+  essBCindex_.assign(firstLocalOffset_, lastLocalOffset_, numEssBCs,
+                     numEssBCs>0 ? &(essBCvalues_->indices())[0] : NULL,
+                     numEssBCs>0 ? &(essBCvalues_->coefs())[0] : NULL);
+
   if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
     FEI_OSTREAM& os = *output_stream_;
-    std::vector<int>& indices = essBCvalues_->indices();
+    std::vector<fei::GlobalOrdinal>& indices = essBCvalues_->indices();
     std::vector<double>& coefs= essBCvalues_->coefs();
     for(size_t i=0; i<essBCvalues_->size(); ++i) {
       os << "essBCeqns["<<i<<"]: "<<indices[i]<<", "<<coefs[i]<<FEI_ENDL;
@@ -486,6 +498,14 @@ int snl_fei::LinearSystem_General::implementBCs(bool applyBCs)
     }
   }
 
+  if (BCenforcement_direct_) {
+    //A non-zero return-code means the matrix doesn't provide direct access
+    //to its storage, and nothing has been modified yet.
+    if (enforceEssentialBC_storage(allEssBCs) == 0) {
+      return(0);
+    }
+  }
+
   if (essBCvalues_->size() > 0) {
     enforceEssentialBC_step_1(*essBCvalues_);
   }
@@ -546,17 +566,23 @@ int snl_fei::LinearSystem_General::enforceEssentialBC_LinSysCore()
     fei::CSRMat csrmat(*inner);
     fei::SparseRowGraph& srg = csrmat.getGraph();
 
+    //LinearSystemCore only takes int eqn-numbers.
+    std::vector<int> intEqns, intColIndices;
     int numEqns = csrmat.getNumRows();
-    int* eqns = &(srg.rowNumbers[0]);
+    int* eqns = const_cast<int*>(fei::impl_utils::int_indices(numEqns,
+                                     &(srg.rowNumbers[0]), intEqns));
+    int* colInds = const_cast<int*>(fei::impl_utils::int_indices(
+                    srg.packedColumnIndices.size(),
+                    &(srg.packedColumnIndices[0]), intColIndices));
     int* rowOffsets = &(srg.rowOffsets[0]);
 
     for(int i=0; i<numEqns; ++i) {
-      colIndices[i] = &(srg.packedColumnIndices[rowOffsets[i]]);
+      colIndices[i] = colInds + rowOffsets[i];
       coefs[i] = &(csrmat.getPackedCoefs()[rowOffsets[i]]);
       colIndLengths[i] = rowOffsets[i+1] - rowOffsets[i];
     }
 
-    int** colInds = &colIndices[0];
+    int** rowColInds = &colIndices[0];
     int* colIndLens = &colIndLengths[0];
     double** BCcoefs = &coefs[0];
 
@@ -565,7 +591,7 @@ int snl_fei::LinearSystem_General::enforceEssentialBC_LinSysCore()
       for(int i=0; i<numEqns; ++i) {
         os << "remBCeqn: " << eqns[i] << ", inds/coefs: ";
         for(int j=0; j<colIndLens[i]; ++j) {
-          os << "("<<colInds[i][j]<<","<<BCcoefs[i][j]<<") ";
+          os << "("<<rowColInds[i][j]<<","<<BCcoefs[i][j]<<") ";
         }
         os << FEI_ENDL;
       }
@@ -573,7 +599,7 @@ int snl_fei::LinearSystem_General::enforceEssentialBC_LinSysCore()
 
     int errcode = lscmatrix->getMatrix()->enforceRemoteEssBCs(numEqns,
 							      eqns,
-							      colInds,
+							      rowColInds,
 							      colIndLens,
 							      BCcoefs);
     if (errcode != 0) {
@@ -583,7 +609,9 @@ int snl_fei::LinearSystem_General::enforceEssentialBC_LinSysCore()
 
   int numEqns = essBCvalues_->size();
   if (numEqns > 0) {
-    int* eqns = &(essBCvalues_->indices())[0];
+    std::vector<int> intEqns;
+    int* eqns = const_cast<int*>(fei::impl_utils::int_indices(numEqns,
+                                 &(essBCvalues_->indices())[0], intEqns));
     double* bccoefs = &(essBCvalues_->coefs())[0];
     std::vector<double> ones(numEqns, 1.0);
 
@@ -594,6 +622,67 @@ int snl_fei::LinearSystem_General::enforceEssentialBC_LinSysCore()
   return(0);
 }
 
+//----------------------------------------------------------------------------
+int snl_fei::LinearSystem_General::enforceEssentialBC_storage(fei::CSVec& allEssBCs)
+{
+  //This performs the same operations as enforceEssentialBC_step_1 and
+  //enforceEssentialBC_step_2 below, but does it in one pass over the
+  //matrix's own storage instead of copying each row out and back in.
+
+  //bc eqns are in the reduced space if slave-constraints are present, and
+  //the matrix would be a MatrixReducer anyway.
+  if (matrixGraph_->getReducer().get() != NULL) {
+    return(-1);
+  }
+
+  fei::CSVec& bcs = BCenforcement_no_column_mod_ ? *essBCvalues_ : allEssBCs;
+  int numBCeqns = bcs.size();
+  if (numBCeqns < 1) {
+    return(0);
+  }
+
+  std::vector<fei::GlobalOrdinal> rhsRows;
+  std::vector<double> rhsCoefs;
+  int err = matrix_->eliminateEssentialBCs(numBCeqns, &(bcs.indices())[0],
+                                           &(bcs.coefs())[0],
+                                           !BCenforcement_no_column_mod_,
+                                           rhsRows, rhsCoefs);
+  if (err != 0) {
+    return(err);
+  }
+
+  //put gamma/alpha on the rhs for the locally-owned ess-BC equations.
+  std::vector<fei::GlobalOrdinal>& essEqns = essBCvalues_->indices();
+  std::vector<double>& essCoefs = essBCvalues_->coefs();
+  iwork_.clear();
+  dwork_.clear();
+  for(size_t i=0; i<essEqns.size(); ++i) {
+    if (essEqns[i] < firstLocalOffset_ || essEqns[i] > lastLocalOffset_) {
+      continue;
+    }
+    iwork_.push_back(essEqns[i]);
+    dwork_.push_back(essCoefs[i]);
+  }
+
+  if (!iwork_.empty()) {
+    CHK_ERR( giveToEachVector(*rhs_, iwork_.size(), &iwork_[0], &dwork_[0],
+                              false) );
+  }
+
+  if (!rhsRows.empty()) {
+    CHK_ERR( giveToEachVector(*rhs_, rhsRows.size(), &rhsRows[0],
+                              &rhsCoefs[0], true) );
+  }
+
+  if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
+    FEI_OSTREAM& os = *output_stream_;
+    os << dbgprefix_<<"enforceEssentialBC_storage, local bc rows: "
+       << iwork_.size() << ", modified rhs rows: "<<rhsRows.size()<<FEI_ENDL;
+  }
+
+  return(0);
+}
+
 //----------------------------------------------------------------------------
 void snl_fei::LinearSystem_General::enforceEssentialBC_step_1(fei::CSVec& essBCs)
 {
@@ -616,18 +705,18 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_1(fei::CSVec& essBCs
   //This function performs step 1.
 
   int numEqns = essBCs.size();
-  int* eqns = &(essBCs.indices())[0];
+  fei::GlobalOrdinal* eqns = &(essBCs.indices())[0];
   double* bcCoefs = &(essBCs.coefs())[0];
 
   std::vector<double> coefs;
-  std::vector<int> indices;
+  std::vector<fei::GlobalOrdinal> indices;
 
   fei::SharedPtr<fei::Reducer> reducer = matrixGraph_->getReducer();
   bool haveSlaves = reducer.get()!=NULL;
 
   try {
   for(int i=0; i<numEqns; i++) {
-    int eqn = eqns[i];
+    fei::GlobalOrdinal eqn = eqns[i];
 
     //if slave-constraints are present, the incoming bc-eqns are in
     //the reduced equation space. so we actually have to translate them back
@@ -644,7 +733,7 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_1(fei::CSVec& essBCs
 
     //put gamma/alpha on the rhs for this ess-BC equation.
     double bcValue = bcCoefs[i];
-    int err = rhs_->copyIn(1, &eqn, &bcValue);
+    int err = giveToEachVector(*rhs_, 1, &eqn, &bcValue, false);
     if (err != 0) {
       FEI_OSTRINGSTREAM osstr;
       osstr <<"snl_fei::LinearSystem_General::enforceEssentialBC_step_1 ERROR: "
@@ -658,7 +747,7 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_1(fei::CSVec& essBCs
     }
 
     int rowLen = indices.size();
-    int* indPtr = &indices[0];
+    fei::GlobalOrdinal* indPtr = &indices[0];
 
     //first, put zeros in the row and 1.0 on the diagonal...
     for(int j=0; j<rowLen; j++) {
@@ -711,7 +800,7 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_2(fei::CSVec& essBCs
     return;
   }
 
-  int* bcEqns = &(essBCs.indices())[0];
+  fei::GlobalOrdinal* bcEqns = &(essBCs.indices())[0];
   double* bcCoefs = &(essBCs.coefs())[0];
 
   fei::SharedPtr<fei::Reducer> reducer = matrixGraph_->getReducer();
@@ -722,50 +811,26 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_2(fei::CSVec& essBCs
     }
   }
 
-  int firstBCeqn = bcEqns[0];
-  int lastBCeqn = bcEqns[numBCeqns-1];
-
-  std::vector<double> coefs;
-  std::vector<int> indices;
+  fei::GlobalOrdinal firstBCeqn = bcEqns[0];
+  fei::GlobalOrdinal lastBCeqn = bcEqns[numBCeqns-1];
 
-  int insertPoint;
+  //bit-test membership for the locally-owned eqns, so that bc rows can be
+  //skipped and bc columns found without searching bcEqns. The index (and
+  //its bitset) is a member that is only refilled here, not rebuilt.
+  allEssBCindex_.setLocalRange(firstLocalOffset_, lastLocalOffset_);
+  for(int i=0; i<numBCeqns; ++i) {
+    allEssBCindex_.insert(bcEqns[i], bcCoefs[i]);
+  }
 
-  int nextBCeqnOffset = 0;
-  int nextBCeqn = bcEqns[nextBCeqnOffset];
+  std::vector<double> coefs;
+  std::vector<fei::GlobalOrdinal> indices;
 
-  for(int i=firstLocalOffset_; i<=lastLocalOffset_; ++i) {
+  for(fei::GlobalOrdinal i=firstLocalOffset_; i<=lastLocalOffset_; ++i) {
     if (haveSlaves) {
       if (reducer->isSlaveEqn(i)) continue;
     }
 
-    bool should_continue = false;
-    if (i >= nextBCeqn) {
-      if (i == nextBCeqn) {
-	++nextBCeqnOffset;
-	if (nextBCeqnOffset < numBCeqns) {
-	  nextBCeqn = bcEqns[nextBCeqnOffset];
-	}
-	else {
-	  nextBCeqn = lastLocalOffset_+1;
-	}
-
-	should_continue = true;
-      }
-      else {
-	while(nextBCeqn <= i) {
-	  if (nextBCeqn == i) should_continue = true;
-	  ++nextBCeqnOffset;
-	  if (nextBCeqnOffset < numBCeqns) {
-	    nextBCeqn = bcEqns[nextBCeqnOffset];
-	  }
-	  else {
-	    nextBCeqn = lastLocalOffset_+1;
-	  }
-	}
-      }
-    }
-
-    if (should_continue) continue;
+    if (allEssBCindex_.contains(i)) continue;
 
     int err = getMatrixRow(matrix_.get(), i, coefs, indices);
     if (err != 0 || indices.size() < 1) {
@@ -773,7 +838,7 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_2(fei::CSVec& essBCs
     }
 
     int numIndices = indices.size();
-    int* indicesPtr = &indices[0];
+    fei::GlobalOrdinal* indicesPtr = &indices[0];
     double* coefsPtr = &coefs[0];
     bool modifiedCoef = false;
 
@@ -784,18 +849,15 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_2(fei::CSVec& essBCs
     }
 
     double value = 0.0;
-    int offset = 0;
 
     for(int j=0; j<numIndices; ++j) {
-      int idx = indicesPtr[j];
-      offset = fei::binarySearch(idx, bcEqns, numBCeqns,
-				     insertPoint);
-      if (offset > -1) {
-	value -= bcCoefs[offset]*coefsPtr[j];
-
-	coefsPtr[j] = 0.0;
-	modifiedCoef = true;
-      }
+      double bcValue = 0.0;
+      if (allEssBCindex_.getValue(indicesPtr[j], bcValue) != 0) continue;
+
+      value -= bcValue*coefsPtr[j];
+
+      coefsPtr[j] = 0.0;
+      modifiedCoef = true;
     }
 
     if (modifiedCoef) {
@@ -810,7 +872,7 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_2(fei::CSVec& essBCs
 
     const double fei_eps = 1.e-49;
     if (std::abs(value) > fei_eps) {
-      rhs_->sumIn(1, &i, &value);
+      giveToEachVector(*rhs_, 1, &i, &value, true);
 
       if (output_level_ >= fei::FULL_LOGS && output_stream_ != 0) {
 	FEI_OSTREAM& os = *output_stream_;
@@ -821,9 +883,10 @@ void snl_fei::LinearSystem_General::enforceEssentialBC_step_2(fei::CSVec& essBCs
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::LinearSystem_General::getMatrixRow(fei::Matrix* matrix, int row,
-						std::vector<double>& coefs,
-						std::vector<int>& indices)
+int snl_fei::LinearSystem_General::getMatrixRow(fei::Matrix* matrix,
+                                     fei::GlobalOrdinal row,
+                                     std::vector<double>& coefs,
+                                     std::vector<fei::GlobalOrdinal>& indices)
 {
   int len = 0;
   int err = matrix->getRowLength(row, len);
@@ -845,6 +908,25 @@ int snl_fei::LinearSystem_General::getMatrixRow(fei::Matrix* matrix, int row,
   return(0);
 }
 
+//----------------------------------------------------------------------------
+int snl_fei::LinearSystem_General::giveToEachVector(fei::Vector& vector,
+                                           int numValues,
+                                           const fei::GlobalOrdinal* indices,
+                                                    const double* values,
+                                                    bool sumInto)
+{
+  for(int v=0; v<vector.getNumVectors(); ++v) {
+    if (sumInto) {
+      CHK_ERR( vector.sumIn(numValues, indices, values, v) );
+    }
+    else {
+      CHK_ERR( vector.copyIn(numValues, indices, values, v) );
+    }
+  }
+
+  return(0);
+}
+
 //----------------------------------------------------------------------------
 int snl_fei::LinearSystem_General::loadLagrangeConstraint(int constraintID,
 							  const double *weights,
@@ -865,25 +947,22 @@ int snl_fei::LinearSystem_General::loadLagrangeConstraint(int constraintID,
 
   //Let's attach the weights to the constraint-record now.
   std::vector<double>& cr_weights = cr->getMasterWeights();
-  cr_weights.resize(iwork_.size());
-  for(unsigned i=0; i<iwork_.size(); ++i) {
-    cr_weights.push_back(weights[i]);
-  }
+  cr_weights.assign(weights, weights+iwork_.size());
 
   fei::SharedPtr<fei::VectorSpace> vecSpace = matrixGraph_->getRowSpace();
 
-  int crEqn = -1;
+  fei::GlobalOrdinal crEqn = -1;
   CHK_ERR( vecSpace->getGlobalIndex(cr->getIDType(),
 				     cr->getConstraintID(),
 				     crEqn) );
 
   //now add the row contribution to the matrix and rhs
   int numIndices = iwork_.size();
-  int* indicesPtr = &(iwork_[0]);
+  fei::GlobalOrdinal* indicesPtr = &(iwork_[0]);
 
   CHK_ERR( matrix_->sumIn(1, &crEqn, numIndices, indicesPtr, &weights) );
 
-  CHK_ERR( rhs_->sumIn(1, &crEqn, &rhsValue) );
+  CHK_ERR( giveToEachVector(*rhs_, 1, &crEqn, &rhsValue, true) );
 
   //now add the column contributions to the matrix
   for(int k=0; k<numIndices; ++k) {
@@ -894,6 +973,76 @@ int snl_fei::LinearSystem_General::loadLagrangeConstraint(int constraintID,
   return(0);
 }
 
+//----------------------------------------------------------------------------
+int snl_fei::LinearSystem_General::loadLagrangeConstraints(int numConstraints,
+                                                const int* constraintIDs,
+                                                const int* weightOffsets,
+                                                const double* weights,
+                                                const double* rhsValues)
+{
+  if (output_level_ >= fei::BRIEF_LOGS && output_stream_ != NULL) {
+    FEI_OSTREAM& os = *output_stream_;
+    os << "loadLagrangeConstraints numConstraints: "<<numConstraints<<FEI_ENDL;
+  }
+
+  if (numConstraints < 1) return(0);
+
+  fei::SharedPtr<fei::VectorSpace> vecSpace = matrixGraph_->getRowSpace();
+
+  //Each constraint contributes a row (the weights) and the transpose of
+  //that row. Rather than summing those into the matrix one at a time, gather
+  //them here so that each distinct row is summed in once. Rows come out in
+  //sorted order, so rows owned by the same remote processor are contiguous.
+  fei::FillableMat crContribs;
+  std::vector<fei::GlobalOrdinal> crEqns(numConstraints);
+
+  for(int i=0; i<numConstraints; ++i) {
+    Constraint<fei::Record<int>*>* cr =
+      matrixGraph_->getLagrangeConstraint(constraintIDs[i]);
+    if (cr == NULL) {
+      return(-1);
+    }
+
+    CHK_ERR( matrixGraph_->getConstraintConnectivityIndices(cr, iwork_) );
+
+    int numIndices = iwork_.size();
+    if (weightOffsets[i+1]-weightOffsets[i] != numIndices) {
+      ERReturn(-1);
+    }
+
+    const double* crWeights = weights+weightOffsets[i];
+    cr->getMasterWeights().assign(crWeights, crWeights+numIndices);
+
+    fei::GlobalOrdinal crEqn = -1;
+    CHK_ERR( vecSpace->getGlobalIndex(cr->getIDType(),
+                                      cr->getConstraintID(),
+                                      crEqn) );
+    crEqns[i] = crEqn;
+
+    if (numIndices < 1) continue;
+
+    crContribs.sumInRow(crEqn, &iwork_[0], crWeights, numIndices);
+
+    for(int k=0; k<numIndices; ++k) {
+      crContribs.sumInCoef(iwork_[k], crEqn, crWeights[k]);
+    }
+  }
+
+  try {
+    fei::CSRMat csrContribs(crContribs);
+    fei::impl_utils::add_to_matrix(csrContribs, true, *matrix_);
+  }
+  catch(std::runtime_error& exc) {
+    fei::console_out() << exc.what() << FEI_ENDL;
+    ERReturn(-1);
+  }
+
+  CHK_ERR( giveToEachVector(*rhs_, numConstraints, &crEqns[0], rhsValues,
+                            true) );
+
+  return(0);
+}
+
 //----------------------------------------------------------------------------
 int snl_fei::LinearSystem_General::loadPenaltyConstraint(int constraintID,
 							 const double *weights,
@@ -913,25 +1062,81 @@ int snl_fei::LinearSystem_General::loadPenaltyConstraint(int constraintID,
 
   CHK_ERR( matrixGraph_->getConstraintConnectivityIndices(cr, iwork_) );
 
-  fei::SharedPtr<fei::VectorSpace> vecSpace = matrixGraph_->getRowSpace();
-
   int numIndices = iwork_.size();
-  int* indicesPtr = &(iwork_[0]);
+  if (numIndices < 1) {
+    return(0);
+  }
 
-  //now add the contributions to the matrix and rhs
-  std::vector<double> coefs(numIndices);
-  double* coefPtr = &coefs[0];
-  for(int i=0; i<numIndices; ++i) {
-    for(int j=0; j<numIndices; ++j) {
-      coefPtr[j] = weights[i]*weights[j]*penaltyValue;
+  fei::GlobalOrdinal* indicesPtr = &(iwork_[0]);
+
+  //now add the contributions to the matrix and rhs.
+  //If the matrix exposes its storage, the positions of the weight
+  //outer-product are looked up once per constraint and the coefficients
+  //are then summed directly into the matrix on each load.
+  const std::vector<int>& scatter = getPenaltyScatter(constraintID, iwork_);
+
+  if (!scatter.empty()) {
+    double* matCoefs = matrix_->getBeginPointer();
+    const int* scatterPtr = &scatter[0];
+    for(int i=0; i<numIndices; ++i) {
+      double wi = weights[i]*penaltyValue;
+      for(int j=0; j<numIndices; ++j) {
+        matCoefs[*scatterPtr++] += wi*weights[j];
+      }
     }
-    CHK_ERR( matrix_->sumIn(1, &(indicesPtr[i]), numIndices, indicesPtr,
-			    &coefPtr) );
+    matrix_->markCoefsChanged();
+  }
+  else {
+    std::vector<double> coefs(numIndices);
+    double* coefPtr = &coefs[0];
+    for(int i=0; i<numIndices; ++i) {
+      for(int j=0; j<numIndices; ++j) {
+        coefPtr[j] = weights[i]*weights[j]*penaltyValue;
+      }
+      CHK_ERR( matrix_->sumIn(1, &(indicesPtr[i]), numIndices, indicesPtr,
+                              &coefPtr) );
+    }
+  }
 
-    double rhsCoef = weights[i]*penaltyValue*rhsValue;
-    CHK_ERR( rhs_->sumIn(1, &(indicesPtr[i]), &rhsCoef) );
+  dwork_.resize(numIndices);
+  for(int i=0; i<numIndices; ++i) {
+    dwork_[i] = weights[i]*penaltyValue*rhsValue;
   }
+  CHK_ERR( giveToEachVector(*rhs_, numIndices, indicesPtr, &dwork_[0], true) );
 
   return(0);
 }
 
+//----------------------------------------------------------------------------
+const std::vector<int>&
+snl_fei::LinearSystem_General::getPenaltyScatter(int constraintID,
+                          const std::vector<fei::GlobalOrdinal>& indices)
+{
+  std::map<int,PenaltyScatter>::iterator
+    iter = penaltyScatter_.lower_bound(constraintID);
+  if (iter == penaltyScatter_.end() || iter->first != constraintID) {
+    iter = penaltyScatter_.insert(iter, std::make_pair(constraintID,
+                                                       PenaltyScatter()));
+  }
+  else if (iter->second.indices == indices) {
+    return(iter->second.offsets);
+  }
+
+  //the constraint is new, or its indices changed since the positions were
+  //looked up.
+  iter->second.indices = indices;
+  std::vector<int>& scatter = iter->second.offsets;
+
+  //an empty scatter (e.g., if the constraint touches shared rows, or the
+  //matrix doesn't expose its storage) means use sumIn for this constraint.
+  int numIndices = indices.size();
+  scatter.resize(numIndices*numIndices);
+  int err = matrix_->getCoefOffsets(numIndices, &indices[0],
+                                    numIndices, &indices[0], &scatter[0]);
+  if (err != 0 || matrix_->getBeginPointer() == NULL) {
+    scatter.clear();
+  }
+
+  return(scatter);
+}
+
@@ -12,6 +12,7 @@
 #include <fei_macros.hpp>
 #include <fei_mpi.h>
 #include <fei_CSVec.hpp>
+#include <fei_BCEqnIndex.hpp>
 #include <fei_LinearSystem.hpp>
 #include <fei_Matrix.hpp>
 #include <fei_Vector.hpp>
@@ -33,6 +34,10 @@ namespace snl_fei {
     /** denstructor */
     virtual ~LinearSystem_General();
 
+    /** Set the matrix for this linear system. Storage positions cached for
+        penalty constraints are discarded. */
+    void setMatrix(fei::SharedPtr<fei::Matrix>& matrix);
+
     /** Essential (dirichlet) boundary-condition function.
     */
     int loadEssentialBCs(int numIDs,
@@ -56,6 +61,15 @@ namespace snl_fei {
 			       const double *weights,
 			       double rhsValue);
 
+    /** implementation of loadLagrangeConstraints. All contributions are
+        accumulated locally and then summed into the matrix one row at a
+        time, rather than one row and one column per constrained index. */
+    int loadLagrangeConstraints(int numConstraints,
+                                const int* constraintIDs,
+                                const int* weightOffsets,
+                                const double* weights,
+                                const double* rhsValues);
+
     /** load penalty constraint coefficients */
     int loadPenaltyConstraint(int constraintID,
 			      const double *weights,
@@ -72,7 +86,10 @@ namespace snl_fei {
 	"debugOutput 'path'" where 'path' is the path to the location where
 	debug-log files will be produced.<br>
 	"name 'string'" where 'string' is an identifier that will be used in
-	debug-log file-names.
+	debug-log file-names.<br>
+	"BC_ENFORCEMENT_DIRECT" requests that essential BCs be eliminated in a
+	single pass over the matrix storage (see
+	fei::Matrix::eliminateEssentialBCs) when the matrix supports it.
     */
     int parameters(int numParams,
 		   const char* const* paramStrings);
@@ -84,14 +101,14 @@ namespace snl_fei {
     int setBCValuesOnVector(fei::Vector* vector);
 
     /** query whether specified eqn index has prescribed BC value */
-    bool eqnIsEssentialBC(int globalEqnIndex) const;
+    bool eqnIsEssentialBC(fei::GlobalOrdinal globalEqnIndex) const;
 
     /** Retrieve eqn-indices and values for BC equations */
-    void getEssentialBCs(std::vector<int>& bcEqns,
+    void getEssentialBCs(std::vector<fei::GlobalOrdinal>& bcEqns,
                          std::vector<double>& bcVals) const;
 
     /** Retrieve eqn-indices for constraints */
-    void getConstrainedEqns(std::vector<int>& crEqns) const;
+    void getConstrainedEqns(std::vector<fei::GlobalOrdinal>& crEqns) const;
 
   private:
     void setName(const char* name);
@@ -102,34 +119,63 @@ namespace snl_fei {
 
     int enforceEssentialBC_LinSysCore();
 
+    int enforceEssentialBC_storage(fei::CSVec& allEssBCs);
+
     void enforceEssentialBC_step_1(fei::CSVec& essBCs);
 
     void enforceEssentialBC_step_2(fei::CSVec& essBCs);
 
-    int getMatrixRow(fei::Matrix* matrix, int row,
+    const std::vector<int>& getPenaltyScatter(int constraintID,
+                          const std::vector<fei::GlobalOrdinal>& indices);
+
+    int getMatrixRow(fei::Matrix* matrix, fei::GlobalOrdinal row,
 		     std::vector<double>& coefs,
-		     std::vector<int>& indices);
+		     std::vector<fei::GlobalOrdinal>& indices);
+
+    /** Sum (or copy) values into each of the vectors held by 'vector', for
+        bc and constraint contributions that apply to every rhs. */
+    int giveToEachVector(fei::Vector& vector, int numValues,
+                         const fei::GlobalOrdinal* indices,
+                         const double* values,
+                         bool sumInto);
 
     MPI_Comm comm_;
 
     fei::CSVec* essBCvalues_;
     fei::CSVec* allEssBCs_;
 
+    //membership index for the eqns of essBCvalues_, rebuilt from it in
+    //implementBCs.
+    fei::BCEqnIndex essBCindex_;
+
+    //membership index for all bc eqns (the global union, in the unreduced
+    //space), refilled in place by enforceEssentialBC_step_2.
+    fei::BCEqnIndex allEssBCindex_;
+
     bool resolveConflictRequested_;
     bool bcs_trump_slaves_;
     bool explicitBCenforcement_;
     bool BCenforcement_no_column_mod_;
+    bool BCenforcement_direct_;
 
     int localProc_;
     int numProcs_;
 
-    int firstLocalOffset_;
-    int lastLocalOffset_;
+    fei::GlobalOrdinal firstLocalOffset_;
+    fei::GlobalOrdinal lastLocalOffset_;
 
     std::string name_;
     std::map<std::string, unsigned> named_loadcomplete_counter_;
 
-    std::vector<int> iwork_;
+    //per penalty constraint, the indices and the storage positions of its
+    //weight outer-product in matrix_.
+    struct PenaltyScatter {
+      std::vector<fei::GlobalOrdinal> indices;
+      std::vector<int> offsets;
+    };
+    std::map<int,PenaltyScatter> penaltyScatter_;
+
+    std::vector<fei::GlobalOrdinal> iwork_;
     std::vector<double> dwork_;
     std::string dbgprefix_;
   };//class LinearSystem_General
@@ -19,20 +19,20 @@ template<typename VAL_TYPE>
 class MapContig {
  public:
   /** constructor */
-  MapContig(int firstKey, int lastKey);
+  MapContig(fei::GlobalOrdinal firstKey, fei::GlobalOrdinal lastKey);
   /** constructor */
   MapContig(const MapContig<VAL_TYPE>& src);
   /** destructor */
   virtual ~MapContig();
 
   /** alias for key_type */
-  typedef int key_type;
+  typedef fei::GlobalOrdinal key_type;
 
   /** alias for mapped_type */
   typedef VAL_TYPE mapped_type;
 
   /** alias for value_type */
-  typedef typename std::pair<int,VAL_TYPE> value_type;
+  typedef typename std::pair<key_type,VAL_TYPE> value_type;
 
   /** iterator class */
   class iterator {
@@ -55,8 +55,8 @@ class MapContig {
     {
       if (!mapPtr_) return(*this);
       int len = mapPtr_->len_;
-      int* keysPtr = mapPtr_->keysPtr_;
-      int first = mapPtr_->first_;
+      key_type* keysPtr = mapPtr_->keysPtr_;
+      key_type first = mapPtr_->first_;
       if (offset_ < len) {
         ++offset_;
         while(offset_ < len) {
@@ -115,10 +115,10 @@ class MapContig {
   iterator insert(iterator& pos, value_type val);
 
   /** find */
-  iterator find(int key);
+  iterator find(key_type key);
 
   /** lower_bound */
-  iterator lower_bound(int key);
+  iterator lower_bound(key_type key);
 
   /** size */
   int size() const;
@@ -126,17 +126,18 @@ class MapContig {
  private:
   friend class iterator;
 
-  std::vector<int> keys_;
-  int* keysPtr_;
+  std::vector<key_type> keys_;
+  key_type* keysPtr_;
   iterator m_end_;
   std::vector<VAL_TYPE> values_;
   VAL_TYPE* valuesPtr_;
-  int first_;
+  key_type first_;
   int len_;
 }; //class MapContig
 
 template<typename VAL_TYPE>
-MapContig<VAL_TYPE>::MapContig(int firstKey, int lastKey)
+MapContig<VAL_TYPE>::MapContig(fei::GlobalOrdinal firstKey,
+                               fei::GlobalOrdinal lastKey)
   : keys_(lastKey-firstKey+1),
     m_end_(),
     values_(lastKey-firstKey+1),
@@ -186,14 +187,15 @@ template<typename VAL_TYPE>
 inline std::pair<typename MapContig<VAL_TYPE>::iterator,bool>
  MapContig<VAL_TYPE>::insert(typename MapContig<VAL_TYPE>::value_type val)
 {
-  int localkey = val.first - first_;
+  key_type localkey = val.first - first_;
   if (localkey < 0 || localkey >= len_) {
     return( std::pair<iterator,bool>(m_end_, false) );
   }
 
   valuesPtr_[localkey] = val.second;
 
-  return( std::pair<iterator,bool>(iterator(localkey, this),true));
+  iterator iter(static_cast<int>(localkey), this);
+  return( std::pair<iterator,bool>(iter, true) );
 }
 
 template<typename VAL_TYPE>
@@ -203,10 +205,11 @@ inline typename MapContig<VAL_TYPE>::iterator
 {
   int offset = pos.offset_;
   if (offset < 0 || offset >=len_ || pos == m_end_) {
-    offset = val.first - first_;
-    if (offset < 0 || offset >= len_) {
+    key_type localkey = val.first - first_;
+    if (localkey < 0 || localkey >= len_) {
       return(m_end_);
     }
+    offset = static_cast<int>(localkey);
   }
 
   valuesPtr_[offset] = val.second;
@@ -215,25 +218,25 @@ inline typename MapContig<VAL_TYPE>::iterator
 }
 
 template<typename VAL_TYPE>
-inline typename MapContig<VAL_TYPE>::iterator MapContig<VAL_TYPE>::find(int key)
+inline typename MapContig<VAL_TYPE>::iterator MapContig<VAL_TYPE>::find(key_type key)
 {
-  int localkey = key - first_;
+  key_type localkey = key - first_;
   if (localkey < 0 || localkey >= len_) {
     return( m_end_ );
   }
 
-  return(iterator(localkey, this));
+  return(iterator(static_cast<int>(localkey), this));
 }
 
 template<typename VAL_TYPE>
-inline typename MapContig<VAL_TYPE>::iterator MapContig<VAL_TYPE>::lower_bound(int key)
+inline typename MapContig<VAL_TYPE>::iterator MapContig<VAL_TYPE>::lower_bound(key_type key)
 {
-  int localkey = key - first_;
+  key_type localkey = key - first_;
   if (localkey < 0 || localkey >= len_) {
     return( m_end_ );
   }
 
-  return(iterator(localkey, this));
+  return(iterator(static_cast<int>(localkey), this));
 }
 
 template<typename VAL_TYPE>
@@ -21,8 +21,8 @@ snl_fei::PointBlockMap::PointBlockMap()
     maxSize_(0),
     ptEqualBlk_(false)
 {
-  ptEqns_ = new std::map<int,int>;
-  blkEqns_ = new std::map<int,std::pair<int,int> >;
+  ptEqns_ = new std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>;
+  blkEqns_ = new std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >;
 }
 
 //----------------------------------------------------------------------------
@@ -39,20 +39,22 @@ void snl_fei::PointBlockMap::setPtEqualBlk()
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::setEqn(int ptEqn, int blkEqn)
+int snl_fei::PointBlockMap::setEqn(fei::GlobalOrdinal ptEqn,
+                                   fei::GlobalOrdinal blkEqn)
 {
   return( setEqn(ptEqn, blkEqn, 1) );
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::setEqn(int ptEqn, int blkEqn, int blkSize)
+int snl_fei::PointBlockMap::setEqn(fei::GlobalOrdinal ptEqn,
+                                   fei::GlobalOrdinal blkEqn, int blkSize)
 {
   if (ptEqualBlk_ == true) {
     if (ptEqn != blkEqn) return(-1);
     else return(0);
   }
 
-  ptEqns_->insert(std::pair<int,int>(ptEqn, blkEqn));
+  ptEqns_->insert(std::make_pair(ptEqn, blkEqn));
 
   //check whether blkEqn is already stored in blkEqns_.
   //if it is not, then insert it along with the pair ptEqn,blkSize.
@@ -60,14 +62,14 @@ int snl_fei::PointBlockMap::setEqn(int ptEqn, int blkEqn, int blkSize)
   //the incoming ptEqn, and replace if so.
   //We want to have blkEqn mapped to the lower ptEqn.
 
-  std::pair<int, int> newpair;
-  std::map<int,std::pair<int,int> >::iterator
+  std::pair<fei::GlobalOrdinal,int> newpair;
+  std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >::iterator
     b_iter = blkEqns_->find(blkEqn);
 
   if (b_iter == blkEqns_->end()) {
     newpair.first = ptEqn;
     newpair.second = blkSize;
-    blkEqns_->insert(std::pair<int,std::pair<int,int> >(blkEqn, newpair));
+    blkEqns_->insert(std::make_pair(blkEqn, newpair));
   }
   else {
     newpair = (*b_iter).second;
@@ -82,12 +84,12 @@ int snl_fei::PointBlockMap::setEqn(int ptEqn, int blkEqn, int blkSize)
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::setBlkEqnSize(int blkEqn, int size)
+int snl_fei::PointBlockMap::setBlkEqnSize(fei::GlobalOrdinal blkEqn, int size)
 {
   if (ptEqualBlk_ == true) return(0);
 
-  std::pair<int,int> newpair;
-  std::map<int,std::pair<int,int> >::iterator
+  std::pair<fei::GlobalOrdinal,int> newpair;
+  std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >::iterator
     b_iter = blkEqns_->find(blkEqn);
   if (b_iter == blkEqns_->end()) {
     return(-1);
@@ -103,11 +105,11 @@ int snl_fei::PointBlockMap::setBlkEqnSize(int blkEqn, int size)
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::getBlkEqnSize(int blkEqn)
+int snl_fei::PointBlockMap::getBlkEqnSize(fei::GlobalOrdinal blkEqn)
 {
   if (ptEqualBlk_ == true) return(1);
 
-  std::map<int,std::pair<int,int> >::iterator
+  std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >::iterator
     b_iter = blkEqns_->find(blkEqn);
 
   if (b_iter != blkEqns_->end()) {
@@ -118,24 +120,27 @@ int snl_fei::PointBlockMap::getBlkEqnSize(int blkEqn)
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::eqnToBlkEqn(int eqn) const
+fei::GlobalOrdinal
+snl_fei::PointBlockMap::eqnToBlkEqn(fei::GlobalOrdinal eqn) const
 {
   if (ptEqualBlk_ == true) return(eqn);
 
-  int blkEqn = -1;
-  std::map<int,int>::iterator p_iter = ptEqns_->find(eqn);
+  fei::GlobalOrdinal blkEqn = -1;
+  std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>::iterator
+    p_iter = ptEqns_->find(eqn);
   if (p_iter != ptEqns_->end()) blkEqn = (*p_iter).second;
 
   return(blkEqn);
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::blkEqnToPtEqn(int blkEqn) const
+fei::GlobalOrdinal
+snl_fei::PointBlockMap::blkEqnToPtEqn(fei::GlobalOrdinal blkEqn) const
 {
   if (ptEqualBlk_ == true) return(blkEqn);
 
   
-  std::map<int,std::pair<int,int> >::iterator
+  std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >::iterator
     b_iter = blkEqns_->find(blkEqn);
   if (b_iter == blkEqns_->end()) {
     return(-1);
@@ -145,7 +150,9 @@ int snl_fei::PointBlockMap::blkEqnToPtEqn(int blkEqn) const
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::getBlkEqnInfo(int blkEqn, int& ptEqn, int& blkSize)
+int snl_fei::PointBlockMap::getBlkEqnInfo(fei::GlobalOrdinal blkEqn,
+                                          fei::GlobalOrdinal& ptEqn,
+                                          int& blkSize)
 {
   if (ptEqualBlk_ == true) {
     ptEqn = blkEqn;
@@ -153,7 +160,7 @@ int snl_fei::PointBlockMap::getBlkEqnInfo(int blkEqn, int& ptEqn, int& blkSize)
     return(0);
   }
 
-  std::map<int,std::pair<int,int> >::iterator
+  std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >::iterator
     b_iter = blkEqns_->find(blkEqn);
   if (b_iter == blkEqns_->end()) {
     return(-1);
@@ -166,8 +173,8 @@ int snl_fei::PointBlockMap::getBlkEqnInfo(int blkEqn, int& ptEqn, int& blkSize)
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::getPtEqnInfo(int ptEqn,
-					 int& blkEqn,
+int snl_fei::PointBlockMap::getPtEqnInfo(fei::GlobalOrdinal ptEqn,
+					 fei::GlobalOrdinal& blkEqn,
 					 int& blkOffset)
 {
   if (ptEqualBlk_ == true) {
@@ -176,7 +183,7 @@ int snl_fei::PointBlockMap::getPtEqnInfo(int ptEqn,
     return(0);
   }
 
-  std::map<int,int>::iterator
+  std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>::iterator
     p_iter = ptEqns_->find(ptEqn);
   if (p_iter == ptEqns_->end()) {
     return(-1);
@@ -184,18 +191,19 @@ int snl_fei::PointBlockMap::getPtEqnInfo(int ptEqn,
 
   blkEqn = (*p_iter).second;
 
-  std::map<int,std::pair<int,int> >::iterator
+  std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >::iterator
     b_iter = blkEqns_->find(blkEqn);
 
-  std::pair<int,int> bpair = (*b_iter).second;
+  std::pair<fei::GlobalOrdinal,int> bpair = (*b_iter).second;
 
-  blkOffset = ptEqn - bpair.first;
+  blkOffset = static_cast<int>(ptEqn - bpair.first);
 
   return(0);
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::PointBlockMap::getBlkEqnOffset(int blkEqn, int eqn)
+int snl_fei::PointBlockMap::getBlkEqnOffset(fei::GlobalOrdinal blkEqn,
+                                            fei::GlobalOrdinal eqn)
 {
   if (ptEqualBlk_ == true) return(0);
 
@@ -207,11 +215,11 @@ int snl_fei::PointBlockMap::getBlkEqnOffset(int blkEqn, int eqn)
 }
 
 //----------------------------------------------------------------------------
-bool snl_fei::PointBlockMap::isExactlyBlkEqn(int ptEqn)
+bool snl_fei::PointBlockMap::isExactlyBlkEqn(fei::GlobalOrdinal ptEqn)
 {
   if (ptEqualBlk_==true) return(true);
 
-  std::map<int,int>::iterator
+  std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>::iterator
     p_iter = ptEqns_->find(ptEqn);
   if (p_iter == ptEqns_->end()) {
     return(false);
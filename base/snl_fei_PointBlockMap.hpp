@@ -44,7 +44,7 @@ namespace snl_fei {
        This function returns an error if 'setPtEqualBlk' has been called and
        ptEqn != blkEqn.
    */
-   int setEqn(int ptEqn, int blkEqn);
+   int setEqn(fei::GlobalOrdinal ptEqn, fei::GlobalOrdinal blkEqn);
 
    /** Establish the mapping blkEqn => ptEqn. I.e., insert ptEqn and blkEqn 
        into internal structures, and establish a correspondence between them,
@@ -52,16 +52,16 @@ namespace snl_fei {
        This function returns an error if 'setPtEqualBlk' has been called and
        ptEqn != blkEqn.
    */
-   int setEqn(int ptEqn, int blkEqn, int blkSize);
+   int setEqn(fei::GlobalOrdinal ptEqn, fei::GlobalOrdinal blkEqn, int blkSize);
 
    /** Store the specified size corresponding to the specified block-equation.
     Note that blkEqn must already have appeared in a call to 'setEqn', in order
    to establish it in a mapping. Otherwise, an error (-1) is returned.
    */
-   int setBlkEqnSize(int blkEqn, int size);
+   int setBlkEqnSize(fei::GlobalOrdinal blkEqn, int size);
 
    /** Given a blkEqn, return the corresponding size. */
-   int getBlkEqnSize(int blkEqn);
+   int getBlkEqnSize(fei::GlobalOrdinal blkEqn);
 
    /** Query the maximum block-equation size
     */
@@ -76,50 +76,52 @@ namespace snl_fei {
        returned.
        A return-value of -1 always indicates a not-found or not-valid error.
    */
-   int eqnToBlkEqn(int eqn) const;
+   fei::GlobalOrdinal eqnToBlkEqn(fei::GlobalOrdinal eqn) const;
 
    /** Given a block-equation, return the corresponding point-equation (the
        first of the point-equations that correspond to that block-equation).
        If blkEqn does not correspond to a point-equation, then -1 is
        returned.
    */
-   int blkEqnToPtEqn(int blkEqn) const;
+   fei::GlobalOrdinal blkEqnToPtEqn(fei::GlobalOrdinal blkEqn) const;
 
    /** Given a block-equation, query for the corresponding point-equation (the
        first of the corresponding point-equations) and the block-size, or
        number of corresponding point-equations.
        @return -1 if block-equation not found, 0 if no error
    */
-   int getBlkEqnInfo(int blkEqn, int& ptEqn, int& blkSize);
+   int getBlkEqnInfo(fei::GlobalOrdinal blkEqn, fei::GlobalOrdinal& ptEqn,
+                     int& blkSize);
 
    /** Given a point-equation, query for the corresponding block-equation and
        the offset of this point-equation into the block-equation.
        @return -1 if point-equation not found, 0 if no error
    */
-   int getPtEqnInfo(int ptEqn, int& blkEqn, int& blkOffset);
+   int getPtEqnInfo(fei::GlobalOrdinal ptEqn, fei::GlobalOrdinal& blkEqn,
+                    int& blkOffset);
 
    /** Given a blkEqn/ptEqn pair, return the offset of the ptEqn into the
        blkEqn. Example: if blkEqn 23 corresponds to ptEqn 69, and the arguments
        to this function are blkEqn==23 and ptEqn==71, then the return value is
        2, which is the offset of ptEqn==71 into blkEqn==23.
    */
-   int getBlkEqnOffset(int blkEqn, int ptEqn);
+   int getBlkEqnOffset(fei::GlobalOrdinal blkEqn, fei::GlobalOrdinal ptEqn);
 
    /** Query whether specified point-equation is the first equation within
        a block-equation
    */
-   bool isExactlyBlkEqn(int ptEqn);
+   bool isExactlyBlkEqn(fei::GlobalOrdinal ptEqn);
 
    /** Return database of point-equations
     */
-   std::map<int,int>* getPtEqns()
+   std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>* getPtEqns()
      {
        return( ptEqns_ );
      }
 
    /** Return database of block-equations
     */
-   std::map<int,std::pair<int,int> >* getBlkEqns()
+   std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >* getBlkEqns()
      {
        return( blkEqns_ );
      }
@@ -130,9 +132,10 @@ namespace snl_fei {
 
    PointBlockMap& operator=(const PointBlockMap& src);
 
-   std::map<int,int>* ptEqns_; //ptEqns_ maps point-equations to block-equations
+   //ptEqns_ maps point-equations to block-equations
+   std::map<fei::GlobalOrdinal,fei::GlobalOrdinal>* ptEqns_;
 
-   std::map<int,std::pair<int,int> >* blkEqns_;
+   std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >* blkEqns_;
    //blkEqns_ maps block-equations to point-equations and block-sizes
    //(the point-equation stored is the first or smallest point-equation that is
    //associated with the block-equation)
@@ -26,11 +26,14 @@ namespace snl_fei {
   take advantage of data that contains significant chunks of contiguous indices.
 */
 template<typename MAP_TYPE, typename SET_TYPE>
-class RaggedTable : public fei::IndexTable {
+class RaggedTable : public fei::IndexTable<typename SET_TYPE::key_type> {
  public:
+  /** alias for the type of the rows and indices */
+  typedef typename SET_TYPE::key_type index_type;
+
   /** Constructor */
-  RaggedTable(int firstKey,
-	      int lastKey);
+  RaggedTable(index_type firstKey,
+	      index_type lastKey);
 
   /** Copy constructor */
   RaggedTable(const RaggedTable<MAP_TYPE,SET_TYPE>& src);
@@ -45,18 +48,18 @@ class RaggedTable : public fei::IndexTable {
 
   /** add entries to the diagonal of the table */
   void addDiagonals(int numIndices,
-		    const int* indices);
+		    const index_type* indices);
 
   /** add a list of indices to a specified row */
-  void addIndices(int row,
+  void addIndices(index_type row,
                   int numIndices,
-                  const int* indices);
+                  const index_type* indices);
 
   /** add a list of indices to several specified rows */
   void addIndices(int numRows,
-                  const int* rows,
+                  const index_type* rows,
                   int numIndices,
-                  const int* indices);
+                  const index_type* indices);
 
   /** obtain internal map attribute */
   MAP_TYPE& getMap();
@@ -65,7 +68,7 @@ class RaggedTable : public fei::IndexTable {
   const MAP_TYPE& getMap() const;
 
   /** obtain specified row from internal map attribute */
-  SET_TYPE* getRow(int row);
+  SET_TYPE* getRow(index_type row);
 
   /** let 'iterator' be an alias for MAP_TYPE's iterator
   */
@@ -87,8 +90,8 @@ class RaggedTable : public fei::IndexTable {
 }; //class RaggedTable
 
 template<typename MAP_TYPE, typename SET_TYPE>
-inline RaggedTable<MAP_TYPE,SET_TYPE>::RaggedTable(int firstKey,
-                                          int lastKey)
+inline RaggedTable<MAP_TYPE,SET_TYPE>::RaggedTable(index_type firstKey,
+                                                  index_type lastKey)
   : map_(),
   poolAllocatorSet_(),
   dummy()
@@ -114,9 +117,9 @@ RaggedTable<MAP_TYPE,SET_TYPE>::~RaggedTable()
 }
 
 template<typename MAP_TYPE, typename SET_TYPE>
-inline void RaggedTable<MAP_TYPE,SET_TYPE>::addIndices(int row,
+inline void RaggedTable<MAP_TYPE,SET_TYPE>::addIndices(index_type row,
                                               int numIndices,
-                                              const int* indices)
+                                              const index_type* indices)
 {
   iterator m_end = map_.end();
   iterator m_iter = MapTraits<MAP_TYPE>::lower_bound(map_, row);
@@ -145,16 +148,16 @@ inline void RaggedTable<MAP_TYPE,SET_TYPE>::addIndices(int row,
 
 template<typename MAP_TYPE, typename SET_TYPE>
 inline void RaggedTable<MAP_TYPE,SET_TYPE>::addIndices(int numRows,
-                             const int* rows,
+                             const index_type* rows,
                              int numIndices,
-                             const int* indices)
+                             const index_type* indices)
 {
   iterator m_end = map_.end();
   iterator m_iter;
   SET_TYPE* mapped_indices = NULL;
 
   for(int i=0; i<numRows; ++i) {
-    int row = rows[i];
+    index_type row = rows[i];
     m_iter = MapTraits<MAP_TYPE>::lower_bound(map_, row);
 
     bool found_row = false;
@@ -193,7 +196,7 @@ inline const MAP_TYPE& RaggedTable<MAP_TYPE,SET_TYPE>::getMap() const
 
 template<typename MAP_TYPE, typename SET_TYPE>
 inline typename RaggedTable<MAP_TYPE,SET_TYPE>::row_type*
-RaggedTable<MAP_TYPE,SET_TYPE>::getRow(int row)
+RaggedTable<MAP_TYPE,SET_TYPE>::getRow(index_type row)
 {
   iterator m_end = map_.end();
   iterator m_iter = map_.find(row);
@@ -216,10 +219,10 @@ RaggedTable<MAP_TYPE,SET_TYPE>::end()
 
 template<typename MAP_TYPE, typename SET_TYPE>
 inline void RaggedTable<MAP_TYPE,SET_TYPE>::addDiagonals(int numIndices,
-                                                const int* indices)
+                                                const index_type* indices)
 {
   for(int i=0; i<numIndices; ++i) {
-    int ind = indices[i];
+    index_type ind = indices[i];
     addIndices(ind, 1, &ind);
   }
 }
@@ -11,13 +11,18 @@
 
 namespace snl_fei {
 
-/** specialization for MapContig<fei::ctg_set<int>*> */
-RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::RaggedTable(int firstKey, int lastKey)
+/** specialization for MapContig<fei::ctg_set<fei::GlobalOrdinal>*> */
+typedef RaggedTable<MapContig<fei::ctg_set<fei::GlobalOrdinal>*>,
+                    fei::ctg_set<fei::GlobalOrdinal> >
+  ContigTable;
+
+ContigTable::RaggedTable(fei::GlobalOrdinal firstKey,
+                         fei::GlobalOrdinal lastKey)
   : map_(firstKey, lastKey),
     poolAllocatorSet_(),
     dummy()
 {
-  int len = lastKey-firstKey+1;
+  int len = static_cast<int>(lastKey-firstKey+1);
   if (len > 0) {
     map_type::value_type val;
     for(int i=0; i<len; ++i) {
@@ -30,15 +35,15 @@ RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::RaggedTable(int f
   }
 }
 
-RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::RaggedTable(const RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >& src)
+ContigTable::RaggedTable(const ContigTable& src)
  : map_(src.map_),
    poolAllocatorSet_()
 {
 }
 
-void RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::addIndices(int row,
+void ContigTable::addIndices(fei::GlobalOrdinal row,
                              int numIndices,
-                             const int* indices)
+                             const fei::GlobalOrdinal* indices)
 {
   iterator m_end = map_.end();
   iterator m_iter = map_.lower_bound(row);
@@ -54,17 +59,16 @@ void RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::addIndices(i
   }
 }
 
-void
-RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::addIndices(int numRows,
-                             const int* rows,
+void ContigTable::addIndices(int numRows,
+                             const fei::GlobalOrdinal* rows,
                              int numIndices,
-                             const int* indices)
+                             const fei::GlobalOrdinal* indices)
 {
   iterator m_end = map_.end();
   map_type::mapped_type mapped_indices = NULL;
 
   for(int i=0; i<numRows; ++i) {
-    int row = rows[i];
+    fei::GlobalOrdinal row = rows[i];
     iterator m_iter = map_.lower_bound(row);
 
     mapped_indices = (*m_iter).second;
@@ -78,11 +82,11 @@ RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::addIndices(int nu
   }
 }
 
-void RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >::addDiagonals(int numIndices,
-                                                         const int* indices)
+void ContigTable::addDiagonals(int numIndices,
+                               const fei::GlobalOrdinal* indices)
 {
   for(int i=0; i<numIndices; ++i) {
-    int ind = indices[i];
+    fei::GlobalOrdinal ind = indices[i];
     addIndices(ind, 1, &ind);
   }
 }
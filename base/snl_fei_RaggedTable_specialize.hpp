@@ -16,17 +16,18 @@
 
 namespace snl_fei {
 
-/** specialization for MapContig<fei::ctg_set<int> > */
+/** specialization for MapContig<fei::ctg_set<fei::GlobalOrdinal> > */
 template<>
-class RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >
-  : public fei::IndexTable {
+class RaggedTable<MapContig<fei::ctg_set<fei::GlobalOrdinal>*>,
+                  fei::ctg_set<fei::GlobalOrdinal> >
+  : public fei::IndexTable<fei::GlobalOrdinal> {
 public:
-  RaggedTable(int firstKey, int lastKey);
+  RaggedTable(fei::GlobalOrdinal firstKey, fei::GlobalOrdinal lastKey);
 
-  RaggedTable(const RaggedTable<MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >& src);
+  RaggedTable(const RaggedTable& src);
 
-  typedef MapContig<fei::ctg_set<int>*> map_type;
-  typedef fei::ctg_set<int> row_type;
+  typedef MapContig<fei::ctg_set<fei::GlobalOrdinal>*> map_type;
+  typedef fei::ctg_set<fei::GlobalOrdinal> row_type;
   typedef map_type::iterator iterator;
 
   virtual ~RaggedTable()
@@ -40,20 +41,20 @@ public:
   }
 
   void addDiagonals(int numIndices,
-                    const int* indices);
+                    const fei::GlobalOrdinal* indices);
 
-  void addIndices(int row,
+  void addIndices(fei::GlobalOrdinal row,
                   int numIndices,
-                  const int* indices);
+                  const fei::GlobalOrdinal* indices);
 
   void addIndices(int numRows,
-                  const int* rows,
+                  const fei::GlobalOrdinal* rows,
                   int numIndices,
-                  const int* indices);
+                  const fei::GlobalOrdinal* indices);
 
   map_type& getMap() { return( map_ ); }
 
-  row_type* getRow(int row)
+  row_type* getRow(fei::GlobalOrdinal row)
   {
     iterator m_end = map_.end();
     iterator m_iter = map_.find(row);
@@ -68,7 +69,7 @@ public:
   map_type map_;
   fei_Pool_alloc<row_type> poolAllocatorSet_;
   row_type dummy;
-};//RaggedTable<MapContig<fei::ctg_set<int>*> >
+};//RaggedTable<MapContig<fei::ctg_set<fei::GlobalOrdinal>*> >
 
 }//namespace snl_fei
 #endif
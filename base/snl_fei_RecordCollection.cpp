@@ -286,12 +286,13 @@ int snl_fei::RecordCollection::getGlobalBlkIndex(int ID, int& globalBlkIndex)
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::RecordCollection::getGlobalIndex(int ID,
-                                              int fieldID,
-                                              int fieldSize,
-                                              int fieldOffset,
-                                              int whichComponentOfField,
-                                              const int* eqnNumbers)
+fei::GlobalOrdinal
+snl_fei::RecordCollection::getGlobalIndex(int ID,
+                                          int fieldID,
+                                          int fieldSize,
+                                          int fieldOffset,
+                                          int whichComponentOfField,
+                                          const fei::GlobalOrdinal* eqnNumbers)
 {
   fei::Record<int>* record = getRecordWithID(ID);
   if (record == NULL) {
@@ -305,7 +306,8 @@ int snl_fei::RecordCollection::getGlobalIndex(int ID,
     return -1;
   }
 
-  const int* eqnNums = eqnNumbers + record->getOffsetIntoEqnNumbers();
+  const fei::GlobalOrdinal* eqnNums =
+    eqnNumbers + record->getOffsetIntoEqnNumbers();
   if (eqnNums == NULL) {
     FEI_OSTRINGSTREAM osstr;
     osstr << "snl_fei::RecordCollection::getGlobalIndex ERROR: null pointer,"
@@ -313,7 +315,7 @@ int snl_fei::RecordCollection::getGlobalIndex(int ID,
     throw std::runtime_error(osstr.str());
   }
 
-  int globalIndex = -1;
+  fei::GlobalOrdinal globalIndex = -1;
   if (fieldOffset > 0) {
     globalIndex = eqnNums[offset + fieldOffset*fieldSize + whichComponentOfField];
   }
@@ -325,12 +327,13 @@ int snl_fei::RecordCollection::getGlobalIndex(int ID,
 }
 
 //----------------------------------------------------------------------------
-int snl_fei::RecordCollection::getGlobalIndexLocalID(int localID,
+fei::GlobalOrdinal
+snl_fei::RecordCollection::getGlobalIndexLocalID(int localID,
                                               int fieldID,
                                               int fieldSize,
                                               int fieldOffset,
                                               int whichComponentOfField,
-                                              const int* eqnNumbers)
+                                              const fei::GlobalOrdinal* eqnNumbers)
 {
   fei::Record<int>* record = getRecordWithLocalID(localID);
   if (record == NULL) {
@@ -347,7 +350,8 @@ int snl_fei::RecordCollection::getGlobalIndexLocalID(int localID,
     return -1;
   }
 
-  const int* eqnNums = eqnNumbers + record->getOffsetIntoEqnNumbers();
+  const fei::GlobalOrdinal* eqnNums =
+    eqnNumbers + record->getOffsetIntoEqnNumbers();
   if (eqnNums == NULL) {
     FEI_OSTRINGSTREAM osstr;
     osstr << "snl_fei::RecordCollection::getGlobalIndex ERROR: null pointer,"
@@ -355,7 +359,7 @@ int snl_fei::RecordCollection::getGlobalIndexLocalID(int localID,
     throw std::runtime_error(osstr.str());
   }
 
-  int globalIndex = -1;
+  fei::GlobalOrdinal globalIndex = -1;
   if (fieldOffset > 0) {
     globalIndex = eqnNums[offset + fieldOffset*fieldSize + whichComponentOfField];
   }
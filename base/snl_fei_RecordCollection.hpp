@@ -109,20 +109,20 @@ namespace snl_fei {
     }
 
     /** Get global equation index for specified ID */
-    int getGlobalIndex(int ID,
+    fei::GlobalOrdinal getGlobalIndex(int ID,
         int fieldID,
         int fieldSize,
         int fieldOffset,
         int whichComponentOfField,
-        const int* eqnNumbers);
+        const fei::GlobalOrdinal* eqnNumbers);
 
     /** Get global equation index for specified local ID */
-    int getGlobalIndexLocalID(int localID,
+    fei::GlobalOrdinal getGlobalIndexLocalID(int localID,
         int fieldID,
         int fieldSize,
         int fieldOffset,
         int whichComponentOfField,
-        const int* eqnNumbers);
+        const fei::GlobalOrdinal* eqnNumbers);
 
     /** Get global block-equation index for specified ID */
     int getGlobalBlkIndex(int ID, int& globalBlkIndex);
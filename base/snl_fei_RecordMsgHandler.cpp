@@ -14,6 +14,8 @@
 #include "fei_FieldMask.hpp"
 #include "fei_TemplateUtils.hpp"
 
+#include <cstring>
+
 #undef fei_file
 #define fei_file "snl_fei_RecordMsgHandler.cpp"
 #include "fei_ErrMacros.hpp"
@@ -22,7 +24,7 @@ snl_fei::RecordMsgHandler::RecordMsgHandler(int localProc,
 					    RecordCollection* recordCollection,
 					    snl_fei::PointBlockMap& ptBlkMap,
 					    std::vector<fei::FieldMask*>& fieldMasks,
-					    std::vector<int>& eqnNumbers)
+					    std::vector<fei::GlobalOrdinal>& eqnNumbers)
   :sendPattern_(NULL),
    recvPattern_(NULL),
    recordCollection_(recordCollection),
@@ -270,6 +272,11 @@ int snl_fei::RecordMsgHandler::mergeMaskIDs(int srcProc, std::vector<int>& msg)
   return(0);
 }
 
+//In eqn-number messages a record's first eqn-number is sent in full, taking
+//eqn_ints ints, and the others as int offsets from it. So a 64-bit
+//GlobalOrdinal adds one int per record rather than doubling the message.
+static const int eqn_ints = sizeof(fei::GlobalOrdinal)/sizeof(int);
+
 int snl_fei::RecordMsgHandler::eqnNumbersMsgLength(int destProc)
 {
   fei::comm_map::row_type* ids = sendPattern_->getRow(destProc);
@@ -287,7 +294,8 @@ int snl_fei::RecordMsgHandler::eqnNumbersMsgLength(int destProc)
       ERReturn(-1);
     }
 
-    len += rec->getFieldMask()->getNumIndices();
+    int numEqns = rec->getFieldMask()->getNumIndices();
+    if (numEqns > 0) len += numEqns + eqn_ints - 1;
   }
 
   return(len);
@@ -299,7 +307,7 @@ int snl_fei::RecordMsgHandler::packEqnNumbersMsg(int destProc,
   fei::comm_map::row_type* ids = sendPattern_->getRow(destProc);
   int len = ids->size()*3;
   msg.resize(len);
-  const int* eqnNumPtr = &eqnNumbers_[0];
+  const fei::GlobalOrdinal* eqnNumPtr = &eqnNumbers_[0];
 
   fei::comm_map::row_type::const_iterator
     id_iter = ids->begin(),
@@ -318,9 +326,15 @@ int snl_fei::RecordMsgHandler::packEqnNumbersMsg(int destProc,
     msg[offset++] = rec->getNumber();
     msg[offset++] = len;
 
-    const int* eqnNumbers = eqnNumPtr+rec->getOffsetIntoEqnNumbers();
-    for(int i=0; i<len; ++i) {
-      msg.push_back(eqnNumbers[i]);
+    if (len < 1) continue;
+
+    const fei::GlobalOrdinal* eqnNumbers =
+      eqnNumPtr+rec->getOffsetIntoEqnNumbers();
+    int first[eqn_ints];
+    std::memcpy(first, eqnNumbers, sizeof(fei::GlobalOrdinal));
+    msg.insert(msg.end(), first, first+eqn_ints);
+    for(int i=1; i<len; ++i) {
+      msg.push_back(static_cast<int>(eqnNumbers[i] - eqnNumbers[0]));
     }
   }
 
@@ -332,7 +346,7 @@ int snl_fei::RecordMsgHandler::storeEqnNumbers(int srcProc, std::vector<int>& ms
   int numIDs = recvPattern_->getRow(srcProc)->size();
   int offset = numIDs*3;
   int* msgPtr = &msg[0];
-  int* eqnNumPtr = &eqnNumbers_[0];
+  fei::GlobalOrdinal* eqnNumPtr = &eqnNumbers_[0];
   for(int i=0; i<numIDs; ++i) {
     int ID = msgPtr[i*3];
     int recNumber = msgPtr[i*3+1];
@@ -343,9 +357,14 @@ int snl_fei::RecordMsgHandler::storeEqnNumbers(int srcProc, std::vector<int>& ms
     }
 
     rec->setNumber(recNumber);
-    int* eqnNumbers = eqnNumPtr+rec->getOffsetIntoEqnNumbers();
+    if (numEqns < 1) continue;
+
+    fei::GlobalOrdinal* eqnNumbers = eqnNumPtr+rec->getOffsetIntoEqnNumbers();
+    fei::GlobalOrdinal firstEqn = 0;
+    std::memcpy(&firstEqn, msgPtr+offset, sizeof(fei::GlobalOrdinal));
+    offset += eqn_ints;
     for(int eq=0; eq<numEqns; ++eq) {
-      eqnNumbers[eq] = msgPtr[offset++];
+      eqnNumbers[eq] = eq==0 ? firstEqn : firstEqn + msgPtr[offset++];
       ptBlkMap_.setEqn(eqnNumbers[eq], recNumber, numEqns);
     }
   }
@@ -26,7 +26,7 @@ namespace snl_fei {
 		     RecordCollection* recordCollection,
 		     snl_fei::PointBlockMap& ptBlkMap,
 		     std::vector<fei::FieldMask*>& fieldMasks,
-		     std::vector<int>& eqnNumbers);
+		     std::vector<fei::GlobalOrdinal>& eqnNumbers);
 
     /** destructor */
     virtual ~RecordMsgHandler();
@@ -90,7 +90,7 @@ namespace snl_fei {
     std::vector<int> sendProcs_;
     std::vector<int> recvProcs_;
 
-    std::vector<int>& eqnNumbers_;
+    std::vector<fei::GlobalOrdinal>& eqnNumbers_;
 
     int localProc_;
   };//class RecordMsgHandler
@@ -15,11 +15,11 @@
 
 namespace snl_fei {
 
-/** specialization for fei::ctg_set<int> */
-template<>
-struct SetTraits<fei::ctg_set<int> > {
+/** specialization for fei::ctg_set<T> */
+template<typename T>
+struct SetTraits<fei::ctg_set<T> > {
   /** insert item in specified set */
-  static void insert(fei::ctg_set<int>* set_obj, int item)
+  static void insert(fei::ctg_set<T>* set_obj, T item)
   { set_obj->insert2(item); }
 };
 
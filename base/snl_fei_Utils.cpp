@@ -368,7 +368,7 @@ int snl_fei::mergeStringLists(char**& strings,
 //----------------------------------------------------------------------------
 int snl_fei::resolveConflictingCRs(fei::MatrixGraph& matrixGraph,
 				   fei::Matrix& bcEqns,
-                                   const std::vector<int>& bcEqnNumbers)
+                          const std::vector<fei::GlobalOrdinal>& bcEqnNumbers)
 {
   int numLagrangeConstraints = matrixGraph.getLocalNumLagrangeConstraints();
   if (numLagrangeConstraints < 1) {
@@ -376,7 +376,7 @@ int snl_fei::resolveConflictingCRs(fei::MatrixGraph& matrixGraph,
   }
 
   double coefs[3];
-  int indices[3];
+  fei::GlobalOrdinal indices[3];
   indices[0] = 0;
   indices[1] = 1;
   indices[2] = 2;
@@ -385,11 +385,11 @@ int snl_fei::resolveConflictingCRs(fei::MatrixGraph& matrixGraph,
   coefs[2] = 1.0;
 
   double* coefPtr = &(coefs[0]);
-  int* indicesPtr = &(indices[0]);
+  fei::GlobalOrdinal* indicesPtr = &(indices[0]);
 
   double fei_eps = 1.e-49;
 
-  std::vector<int> cr_indices;
+  std::vector<fei::GlobalOrdinal> cr_indices;
   std::map<int,Constraint<fei::Record<int>*>*>& lagrangeConstraints =
     matrixGraph.getLagrangeConstraints();
 
@@ -406,13 +406,13 @@ int snl_fei::resolveConflictingCRs(fei::MatrixGraph& matrixGraph,
     double* weightsPtr = &weights[0];
 
     int len = cr_indices.size();
-    int* cr_indPtr = &(cr_indices[0]);
+    fei::GlobalOrdinal* cr_indPtr = &(cr_indices[0]);
     for(int j=0; j<len; ++j) {
       if (std::abs(weightsPtr[j] + 1.0) > fei_eps) continue;
 
-      int eqn = cr_indPtr[j];
+      fei::GlobalOrdinal eqn = cr_indPtr[j];
       if (fei::binarySearch(eqn, bcEqnNumbers) > -1) {
-	int cr_eqn = cr->getEqnNumber();
+	fei::GlobalOrdinal cr_eqn = cr->getEqnNumber();
 
 	CHK_ERR( bcEqns.copyIn(1, &cr_eqn, 3, indicesPtr,
 			       (double**)(&coefPtr)) );
@@ -430,25 +430,25 @@ int snl_fei::gatherRemoteEssBCs(fei::CSVec& essBCs,
 				fei::Matrix& matrix)
 {
   std::vector<int>& rrowOffs = remoteGraph->rowOffsets;
-  std::vector<int>& rcols = remoteGraph->packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& rcols = remoteGraph->packedColumnIndices;
 
   int numEssEqns = essBCs.size();
   if (numEssEqns > 0) {
-    int* essEqns = &(essBCs.indices()[0]);
+    fei::GlobalOrdinal* essEqns = &(essBCs.indices()[0]);
     double* coefs = &(essBCs.coefs()[0]);
 
     if (rrowOffs.size() > 0 && rcols.size() > 0) {
 
       int* rowOffsPtr = &(rrowOffs[0]);
-      int* rcolsPtr = &(rcols[0]);
+      fei::GlobalOrdinal* rcolsPtr = &(rcols[0]);
 
       for(int j=0; j<numEssEqns; ++j) {
 
-        int eqn = essEqns[j];
+        fei::GlobalOrdinal eqn = essEqns[j];
 
         for(unsigned i=0; i<rrowOffs.size()-1; ++i) {
           int len = rowOffsPtr[i+1]-rowOffsPtr[i];
-          int* colsPtr = &(rcolsPtr[rowOffsPtr[i]]);
+          fei::GlobalOrdinal* colsPtr = &(rcolsPtr[rowOffsPtr[i]]);
 
           if (fei::binarySearch(eqn, colsPtr, len) > -1) {
             double coef = coefs[j];
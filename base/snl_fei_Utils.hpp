@@ -219,7 +219,7 @@ namespace snl_fei {
   */
   int resolveConflictingCRs(fei::MatrixGraph& matrixGraph,
 			    fei::Matrix& bcEqns,
-                            const std::vector<int>& bcEqnNumbers);
+                            const std::vector<fei::GlobalOrdinal>& bcEqnNumbers);
 
   /** Do appropriate communications to gather column-portions of remotely-held
       essential BCs onto local processor.
@@ -94,7 +94,10 @@ namespace fei_trilinos {
     tmp_array_len_(0),
     dtmp_array_(0),
     dtmp_array_len_(0),
-    azTransformed_(false)
+    azTransformed_(false),
+    patternStarts_(1, 0),
+    patternNumRows_(),
+    patternOffsets_()
   {
     if (N_update_ > 0) {
       rowLengths_ = new int[N_update_];
@@ -124,7 +127,10 @@ namespace fei_trilinos {
     tmp_array_len_(0),
     dtmp_array_(0),
     dtmp_array_len_(0),
-    azTransformed_(src.azTransformed_)
+    azTransformed_(src.azTransformed_),
+    patternStarts_(src.patternStarts_),
+    patternNumRows_(src.patternNumRows_),
+    patternOffsets_(src.patternOffsets_)
   {
     expand_array(tmp_array_, tmp_array_len_, src.tmp_array_len_);
     expand_array(dtmp_array_, dtmp_array_len_, src.dtmp_array_len_);
@@ -492,38 +498,31 @@ namespace fei_trilinos {
   {
     if (numRows == 0 || numCols == 0) return(0);
 
-    if (!isFilled_) {
-      int err = 0;
+    //if the matrix is filled, first compute max-row-length, since each row's
+    //column-indices will be copied into tmp_array_ in transformed form.
+    int maxRowLen = 0;
+    if (isFilled_) {
       for(int i=0; i<numRows; ++i) {
-        err = sumIntoRow(rows[i], numCols, coefs[i], colInd);
-        if (err != 0) return(err);
-      }
-
-      return(0);
-    }
-
-    //Now for the harder (but more important) case where isFilled_ == true.
+        int row = rows[i];
+        int localRow;
+        if (!amap_->inUpdate(row, localRow)) {
+          fei::console_out() << "AztecDMSR_Matrix::sumIntoRow: ERROR row " << row
+            << " not in local update set [" << amap_->getUpdate()[0] << " ... "
+            << amap_->getUpdate()[N_update_-1] << "]." << FEI_ENDL;
+          return(-1);
+        }
 
-    //first compute max-row-length:
-    int maxRowLen = 0;
-    for(int i=0; i<numRows; ++i) {
-      int row = rows[i];
-      int localRow;
-      if (!amap_->inUpdate(row, localRow)) {
-        fei::console_out() << "AztecDMSR_Matrix::sumIntoRow: ERROR row " << row
-          << " not in local update set [" << amap_->getUpdate()[0] << " ... "
-          << amap_->getUpdate()[N_update_-1] << "]." << FEI_ENDL;
-        return(-1);
+        int rowlen = bindx[localRow+1]-bindx[localRow];
+        if (maxRowLen < rowlen) maxRowLen = rowlen;
       }
-
-      int rowlen = bindx[localRow+1]-bindx[localRow];
-      if (maxRowLen < rowlen) maxRowLen = rowlen;
     }
 
     if (maxRowLen+2*numCols > tmp_array_len_) {
       expand_array(tmp_array_, tmp_array_len_, maxRowLen+2*numCols);
     }
 
+    //the incoming column-indices are sorted once here, and then merged
+    //against each of the rows in turn.
     int* incols = &tmp_array_[maxRowLen];
     int* indirect = incols+numCols;
 
@@ -534,6 +533,66 @@ namespace fei_trilinos {
 
     fei::insertion_sort_with_companions<int>(numCols, incols, indirect);
 
+    if (!isFilled_) {
+      for(int i=0; i<numRows; ++i) {
+        int row = rows[i];
+        int localRow;
+        if (!amap_->inUpdate(row, localRow)) {
+          fei::console_out() << "AztecDMSR_Matrix::sumIntoRow: ERROR row " << row
+            << " not in local update set." << FEI_ENDL;
+          return(-1);
+        }
+
+        int jStart = bindx[localRow];
+        int* colInds = &(bindx[jStart]);
+        double* rowCoefs = &(val[jStart]);
+        int offDiagRowLen = rowLengths_[localRow];
+        int offDiagRowAllocLen = ADMSR_LOCAL_ROW_ALLOC_LEN(localRow) - 1;
+
+        const double* coefs_i = coefs[i];
+
+        //since incols is sorted, each column's position in the row is at or
+        //beyond the previous column's, so the search range shrinks as we go.
+        int rowOffset = 0;
+        for(int jj=0; jj<numCols; ++jj) {
+          int col = incols[jj];
+          double coef = coefs_i[indirect[jj]];
+
+          if (col == row) {
+            val[localRow] += coef;
+            continue;
+          }
+
+          int insertPoint = -1;
+          int index = fei::binarySearch<int>(col, colInds+rowOffset,
+                                             offDiagRowLen-rowOffset,
+                                             insertPoint);
+          if (index >= 0) {
+            rowOffset += index;
+            rowCoefs[rowOffset] += coef;
+            continue;
+          }
+
+          rowOffset += insertPoint;
+          int tmp = offDiagRowLen;
+          int err = insert(col, rowOffset, colInds,
+              tmp, offDiagRowAllocLen);
+          err += insert(coef, rowOffset, rowCoefs,
+              offDiagRowLen, offDiagRowAllocLen);
+          if (err != 0) {
+            fei::console_out() << "AztecDMSR_Matrix::sumIntoRow ERROR: failed to add "
+              << "value for index " << col << " to row " << row << FEI_ENDL;
+            return(-1);
+          }
+          rowLengths_[localRow]++;
+        }
+      }
+
+      return(0);
+    }
+
+    //Now for the harder (but more important) case where isFilled_ == true.
+
     int row, localRow;
 
     for(int i=0; i<numRows; ++i) {
@@ -720,6 +779,105 @@ namespace fei_trilinos {
     return(0);
   }
 
+  //==============================================================================
+  int AztecDMSR_Matrix::getCoefOffsets(int numRows, const int* rows,
+      int numCols, const int* cols,
+      int* offsets)
+  {
+    if (!isFilled_) {
+      fei::console_out() << "AztecDMSR_Matrix::getCoefOffsets ERROR, matrix "
+        << "not filled." << FEI_ENDL;
+      return(-1);
+    }
+
+    for(int i=0; i<numRows; ++i) {
+      int row = rows[i];
+      int localRow;
+      if (!amap_->inUpdate(row, localRow)) {
+        fei::console_out() << "AztecDMSR_Matrix::getCoefOffsets: ERROR row "
+          << row << " not in local update set." << FEI_ENDL;
+        return(-1);
+      }
+
+      int jStart = bindx[localRow];
+      int rowLen = bindx[localRow+1]-jStart;
+      if (rowLen > tmp_array_len_) {
+        expand_array(tmp_array_, tmp_array_len_, rowLen);
+      }
+
+      for(int jj=0; jj<rowLen; ++jj) {
+        tmp_array_[jj] = amap_->getTransformedEqn(bindx[jStart+jj]);
+      }
+
+      int* rowOffsets = offsets + i*numCols;
+      for(int j=0; j<numCols; ++j) {
+        if (cols[j] == row) {
+          rowOffsets[j] = localRow;
+          continue;
+        }
+
+        int index = fei::binarySearch<int>(cols[j], tmp_array_, rowLen);
+        if (index < 0) {
+          fei::console_out() << "AztecDMSR_Matrix::getCoefOffsets, ERROR, col "
+            << cols[j] << " not found in row " << row << FEI_ENDL;
+          return(-1);
+        }
+
+        rowOffsets[j] = jStart+index;
+      }
+    }
+
+    return(0);
+  }
+
+  //==============================================================================
+  int AztecDMSR_Matrix::registerElementPattern(int numRows, const int* rows,
+      int numCols, const int* cols)
+  {
+    int start = patternOffsets_.size();
+    patternOffsets_.resize(start + numRows*numCols);
+
+    int err = numRows*numCols < 1 ? 0 :
+      getCoefOffsets(numRows, rows, numCols, cols, &patternOffsets_[start]);
+    if (err != 0) {
+      patternOffsets_.resize(start);
+      return(-1);
+    }
+
+    patternStarts_.push_back(patternOffsets_.size());
+    patternNumRows_.push_back(numRows);
+    return(patternNumRows_.size()-1);
+  }
+
+  //==============================================================================
+  int AztecDMSR_Matrix::sumIntoRow(int patternHandle,
+      const double* const* coefs)
+  {
+    if (patternHandle < 0 || patternHandle >= (int)patternNumRows_.size()) {
+      fei::console_out() << "AztecDMSR_Matrix::sumIntoRow ERROR, invalid "
+        << "pattern handle " << patternHandle << FEI_ENDL;
+      return(-1);
+    }
+
+    int numRows = patternNumRows_[patternHandle];
+    int start = patternStarts_[patternHandle];
+    int len = patternStarts_[patternHandle+1] - start;
+    if (len < 1) return(0);
+
+    int numCols = len/numRows;
+    const int* offsets = &patternOffsets_[start];
+
+    for(int i=0; i<numRows; ++i) {
+      const double* coefs_i = coefs[i];
+      for(int j=0; j<numCols; ++j) {
+        val[offsets[j]] += coefs_i[j];
+      }
+      offsets += numCols;
+    }
+
+    return(0);
+  }
+
   //==============================================================================
   int AztecDMSR_Matrix::addScaledMatrix(double scalar,
       const AztecDMSR_Matrix& source)
@@ -848,6 +1006,10 @@ namespace fei_trilinos {
 
     AZ_set_MSR(Amat_, bindx, val,amap_->data_org, 0, NULL, AZ_LOCAL);
 
+    patternStarts_.assign(1, 0);
+    patternNumRows_.clear();
+    patternOffsets_.clear();
+
     setAllocated(true);
     return;
   }
@@ -998,6 +1160,10 @@ namespace fei_trilinos {
     isFilled_ = source.isFilled_;
     azTransformed_ = source.azTransformed_;
 
+    patternStarts_.assign(1, 0);
+    patternNumRows_.clear();
+    patternOffsets_.clear();
+
     arraysAllocated_ = true;
     setAllocated(true);
   }
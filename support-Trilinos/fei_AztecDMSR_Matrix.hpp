@@ -72,6 +72,8 @@
 #include "fei_fstream.hpp"
 #include "fei_sstream.hpp"
 
+#include <vector>
+
 namespace fei_trilinos {
 
 class Aztec_LSVector;
@@ -119,6 +121,32 @@ class AztecDMSR_Matrix {
     int sumIntoRow(int row, int len, const double *coefs, 
                            const int *colInd);
 
+    /** Compute the positions in the coefficient array (getBeginPointer())
+        of the entries (rows[i],cols[j]), stored row-major in 'offsets'
+        which must have length numRows*numCols. The matrix must be filled.
+        Returns -1 if a row isn't local or a column isn't in a row's
+        structure.
+    */
+    int getCoefOffsets(int numRows, const int* rows,
+                       int numCols, const int* cols,
+                       int* offsets);
+
+    /** Precompute the coefficient positions for an element's rows and
+        columns, so that repeated contributions for that element can be
+        summed in by sumIntoRow(patternHandle, coefs) without searching any
+        rows. The matrix must be filled. Returns a handle >= 0, or -1 if
+        getCoefOffsets fails. Handles are discarded by allocate() and
+        copyStructure().
+    */
+    int registerElementPattern(int numRows, const int* rows,
+                               int numCols, const int* cols);
+
+    /** Sum a numRows-by-numCols block of coefficients into the positions
+        given by a handle from registerElementPattern. coefs[i][j] goes with
+        rows[i] and cols[j] of the registered pattern.
+    */
+    int sumIntoRow(int patternHandle, const double* const* coefs);
+
     int addScaledMatrix(double scalar, const AztecDMSR_Matrix& source);
 
     void scale(double scalar);
@@ -216,6 +244,13 @@ class AztecDMSR_Matrix {
     int dtmp_array_len_;
 
     bool azTransformed_;
+
+    //coefficient offsets of registered element patterns. Pattern p has
+    //patternNumRows_[p] rows, and its offsets are in
+    //patternOffsets_[patternStarts_[p] .. patternStarts_[p+1]-1].
+    std::vector<int> patternStarts_;
+    std::vector<int> patternNumRows_;
+    std::vector<int> patternOffsets_;
 };
 
 }//namespace fei_trilinos
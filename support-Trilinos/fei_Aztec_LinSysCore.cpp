@@ -50,6 +50,7 @@
 #include <string.h>
 #include <stdio.h>
 #include <stdexcept>
+#include <algorithm>
 
 #include "fei_defs.h"
 #include "fei_Data.hpp"
@@ -115,6 +116,9 @@ Aztec_LinSysCore::Aztec_LinSysCore(MPI_Comm comm)
    matrixLoaded_(false),
    rhsLoaded_(false),
    needNewPreconditioner_(false),
+   cacheElemOffsets_(false),
+   elemPatterns_(),
+   elemPatternKey_(),
    tooLateToChooseBlock_(false),
    blockMatrix_(false),
    blkMap_(),
@@ -305,6 +309,11 @@ int Aztec_LinSysCore::parameters(int numParams, const char*const * params) {
     BCenforcement_no_column_mod_ = false;
   }
 
+  param = snl_fei::getParam("AZ_ELEM_OFFSET_CACHE",numParams,params);
+  if (param != NULL){
+    cacheElemOffsets_ = true;
+  }
+
    param = snl_fei::getParamValue("numLevels", numParams, params);
    if (param != NULL){
       sscanf(param,"%d", &numLevels_);
@@ -580,6 +589,7 @@ int Aztec_LinSysCore::allocateMatrix(int** ptColIndices,
   // so now we know all the row lengths, and can configure our matrix.
 
   A_ptr_->allocate(row_lengths, ptColIndices);
+  elemPatterns_.clear();
 
   delete [] row_lengths;
 
@@ -936,6 +946,32 @@ int Aztec_LinSysCore::getBlockSize(int blkInd) {
    }
 }
 
+//==============================================================================
+int Aztec_LinSysCore::getElemPatternHandle(int numPtRows, const int* ptRows,
+                                           int numPtCols,
+                                           const int* ptColIndices)
+{
+  elemPatternKey_.resize(numPtRows+numPtCols+1);
+  elemPatternKey_[0] = numPtRows;
+  std::copy(ptRows, ptRows+numPtRows, elemPatternKey_.begin()+1);
+  std::copy(ptColIndices, ptColIndices+numPtCols,
+            elemPatternKey_.begin()+1+numPtRows);
+
+  std::map<std::vector<int>,int>::iterator
+    iter = elemPatterns_.lower_bound(elemPatternKey_);
+  if (iter != elemPatterns_.end() && iter->first == elemPatternKey_) {
+    return(iter->second);
+  }
+
+  int handle = A_ptr_->registerElementPattern(numPtRows, ptRows,
+                                              numPtCols, ptColIndices);
+  if (handle >= 0) {
+    elemPatterns_.insert(iter, std::make_pair(elemPatternKey_, handle));
+  }
+
+  return(handle);
+}
+
 //==============================================================================
 int Aztec_LinSysCore::sumIntoPointRow(int numPtRows, const int* ptRows,
                                        int numPtCols, const int* ptColIndices,
@@ -961,8 +997,14 @@ int Aztec_LinSysCore::sumIntoPointRow(int numPtRows, const int* ptRows,
       }
     }
     else {
-      int err = A_ptr_->sumIntoRow(numPtRows, ptRows, numPtCols, ptColIndices,
-                                   values);
+      int handle = -1;
+      if (cacheElemOffsets_ && A_ptr_->isFilled()) {
+        handle = getElemPatternHandle(numPtRows, ptRows,
+                                      numPtCols, ptColIndices);
+      }
+
+      int err = handle >= 0 ? A_ptr_->sumIntoRow(handle, values) :
+        A_ptr_->sumIntoRow(numPtRows, ptRows, numPtCols, ptColIndices, values);
       if (err != 0) {
         FEI_OSTRINGSTREAM osstr;
         osstr << "Aztec_LinSysCore::sumIntoPointRow ERROR calling A_ptr->sumIntoRow";
@@ -1951,6 +1993,7 @@ int Aztec_LinSysCore::copyInMatrix(double scalar, const Data& data) {
 
       AztecDMSR_Matrix* source = (AztecDMSR_Matrix*)data.getDataPtr();
       A_ptr_->copyStructure(*source);
+      elemPatterns_.clear();
 
       MSRmatPlusScaledMat(A_ptr_, scalar, source);
 
@@ -52,6 +52,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include <az_aztec.h>
 #include <fei_AztecDMSR_Matrix.hpp>
@@ -326,6 +327,9 @@ class Aztec_LinSysCore: public LinearSystemCore {
    int sumPointIntoBlockRow(int blkRow, int rowOffset,
 			    int blkCol, int colOffset, double value);
 
+   int getElemPatternHandle(int numPtRows, const int* ptRows,
+                            int numPtCols, const int* ptColIndices);
+
    int setMatrixType(const char* name);
    int selectSolver(const char* name);
    int selectPreconditioner(const char* name);
@@ -396,6 +400,16 @@ class Aztec_LinSysCore: public LinearSystemCore {
    bool rhsLoaded_;
    bool needNewPreconditioner_;
 
+   //If the "AZ_ELEM_OFFSET_CACHE" parameter is given, then once the matrix
+   //is filled the coefficient offsets for each distinct set of rows and
+   //columns passed to sumIntoSystemMatrix are registered with A_ptr_, and
+   //the handles are kept here keyed by those rows and columns. This costs
+   //an int per coefficient of every distinct pattern, so it is only
+   //worthwhile if the same element contributions are assembled repeatedly.
+   bool cacheElemOffsets_;
+   std::map<std::vector<int>,int> elemPatterns_;
+   std::vector<int> elemPatternKey_;
+
    bool tooLateToChooseBlock_;
    bool blockMatrix_;
    fei::SharedPtr<Aztec_BlockMap> blkMap_;
@@ -47,6 +47,7 @@
 
 #include <fei_VectorReducer.hpp>
 #include <fei_MatrixReducer.hpp>
+#include <fei_impl_utils.hpp>
 
 Factory_Aztec::Factory_Aztec(MPI_Comm comm)
   : fei::Factory(comm),
@@ -106,7 +107,8 @@ Factory_Aztec::createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
   std::vector<int> indices;
   int err = 0, localSize = 0;
   if (reducer_.get() != NULL) {
-    indices = reducer_->getLocalReducedEqns();
+    fei::impl_utils::copy_int_indices(reducer_->getLocalReducedEqns(),
+                                      indices);
     localSize = indices.size();
   }
   else {
@@ -117,7 +119,9 @@ Factory_Aztec::createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
     }
     else {
       localSize = vecSpace->getNumIndices_Owned();
-      err = vecSpace->getIndices_Owned(indices);
+      std::vector<fei::GlobalOrdinal> eqns;
+      err = vecSpace->getIndices_Owned(eqns);
+      fei::impl_utils::copy_int_indices(eqns, indices);
     }
   }
   if (err != 0) {
@@ -170,13 +174,16 @@ Factory_Aztec::createVector(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
   int err = 0, localSize;
   fei::SharedPtr<fei::VectorSpace> vecSpace = matrixGraph->getRowSpace();
   if (reducer_.get() != NULL) {
-    indices = reducer_->getLocalReducedEqns();
+    fei::impl_utils::copy_int_indices(reducer_->getLocalReducedEqns(),
+                                      indices);
     localSize = indices.size();
   }
   else {
     localSize = vecSpace->getNumIndices_Owned();
     indices.resize(localSize);
-    err = vecSpace->getIndices_Owned(indices);
+    std::vector<fei::GlobalOrdinal> eqns;
+    err = vecSpace->getIndices_Owned(eqns);
+    fei::impl_utils::copy_int_indices(eqns, indices);
   }
   if (err != 0) {
     throw std::runtime_error("error in vecSpace->getIndices_Owned");
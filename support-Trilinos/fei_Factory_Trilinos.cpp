@@ -49,6 +49,7 @@
 #include <fei_MatrixReducer.hpp>
 #include <fei_Matrix_Local.hpp>
 #include <fei_Vector_Local.hpp>
+#include <fei_impl_utils.hpp>
 
 #ifdef HAVE_FEI_AZTECOO
 #include <fei_Solver_AztecOO.hpp>
@@ -159,7 +160,8 @@ Factory_Trilinos::wrapVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
 
   vecptr.reset(new fei::Vector_Impl<Epetra_MultiVector>(vecSpace,
                                                        multiVec.get(),
-                                     multiVec->Map().NumMyPoints(), false));
+                                     multiVec->Map().NumMyPoints(), false,
+                                     false, multiVec->NumVectors()));
   return(vecptr);
 }
 
@@ -176,7 +178,8 @@ Factory_Trilinos::wrapVector(fei::SharedPtr<fei::MatrixGraph> matGraph,
 
   vecptr.reset(new fei::Vector_Impl<Epetra_MultiVector>(matGraph->getRowSpace(),
                                                        multiVec.get(),
-                                        multiVec->Map().NumMyPoints(), false));
+                                        multiVec->Map().NumMyPoints(), false,
+                                        false, multiVec->NumVectors()));
   return(vecptr);
 }
 
@@ -197,7 +200,8 @@ Factory_Trilinos::createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
   std::vector<int> indices;
   int err = 0, localSize;
   if (reducer_.get() != NULL) {
-    indices = reducer_->getLocalReducedEqns();
+    fei::impl_utils::copy_int_indices(reducer_->getLocalReducedEqns(),
+                                      indices);
     localSize = indices.size();
   }
   else {
@@ -209,7 +213,9 @@ Factory_Trilinos::createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
     else {
       localSize = vecSpace->getNumIndices_Owned();
       indices.resize(localSize);
-      err = vecSpace->getIndices_Owned(indices);
+      std::vector<fei::GlobalOrdinal> eqns;
+      err = vecSpace->getIndices_Owned(eqns);
+      fei::impl_utils::copy_int_indices(eqns, indices);
     }
   }
   if (err != 0) {
@@ -227,7 +233,7 @@ Factory_Trilinos::createVector(fei::SharedPtr<fei::VectorSpace> vecSpace,
 
       tmpvec.reset(new fei::Vector_Impl<Epetra_MultiVector>(vecSpace,
                                               emvec, localSize,
-                                        isSolutionVector, true));
+                                        isSolutionVector, true, numVectors));
     }
     catch(std::runtime_error& exc) {
       fei::console_out() << "Factory_Trilinos::createVector: caught exception '"
@@ -290,13 +296,16 @@ Factory_Trilinos::createVector(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
   int err = 0, localSize;
   fei::SharedPtr<fei::VectorSpace> vecSpace = matrixGraph->getRowSpace();
   if (reducer_.get() != NULL) {
-    indices = reducer_->getLocalReducedEqns();
+    fei::impl_utils::copy_int_indices(reducer_->getLocalReducedEqns(),
+                                      indices);
     localSize = indices.size();
   }
   else {
     localSize = vecSpace->getNumIndices_Owned();
     indices.resize(localSize);
-    err = vecSpace->getIndices_Owned(indices);
+    std::vector<fei::GlobalOrdinal> eqns;
+    err = vecSpace->getIndices_Owned(eqns);
+    fei::impl_utils::copy_int_indices(eqns, indices);
   }
   if (err != 0) {
     throw std::runtime_error("error in vecSpace->getIndices_Owned");
@@ -312,7 +321,8 @@ Factory_Trilinos::createVector(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
       Epetra_MultiVector* emvec = new Epetra_MultiVector(emap, numVectors);
 
       tmpvec.reset(new fei::Vector_Impl<Epetra_MultiVector>(matrixGraph->getRowSpace(), emvec,
-                                                  localSize, isSolutionVector, true));
+                                                  localSize, isSolutionVector, true,
+                                                  numVectors));
     }
     catch(std::runtime_error& exc) {
       fei::console_out() << "Factory_Trilinos::createVector: caught exception '"
@@ -43,6 +43,7 @@
 
 #include <fei_trilinos_macros.hpp>
 #include <fei_SparseRowGraph.hpp>
+#include <fei_impl_utils.hpp>
 
 #ifdef HAVE_FEI_EPETRA
 
@@ -108,8 +109,14 @@ void LinProbMgr_EpetraBasic
     fei_srgraph_ = matrixGraph;
   }
 
+  //Epetra takes int global indices.
+  std::vector<int> rowNumbers, colIndices;
+  fei::impl_utils::copy_int_indices(fei_srgraph_->rowNumbers, rowNumbers);
+  fei::impl_utils::copy_int_indices(fei_srgraph_->packedColumnIndices,
+                                    colIndices);
+
   if (epetra_rowmap_.get() == NULL) {
-    setRowDistribution(matrixGraph->rowNumbers);
+    setRowDistribution(rowNumbers);
   }
 
   if ((int)fei_srgraph_->rowNumbers.size() != epetra_rowmap_->NumMyElements()) {
@@ -118,7 +125,6 @@ void LinProbMgr_EpetraBasic
 
   //We'll create and populate a Epetra_CrsGraph object.
 
-  std::vector<int>& rowNumbers = fei_srgraph_->rowNumbers;
   std::vector<int>& rowOffsets = fei_srgraph_->rowOffsets;
 
   //First create an array of num-indices-per-row.
@@ -137,7 +143,6 @@ void LinProbMgr_EpetraBasic
 
   //Now put in all the column-indices
 
-  std::vector<int>& colIndices = fei_srgraph_->packedColumnIndices;
   for(i=0; i<rowNumbers.size(); ++i) {
     int offset = rowOffsets[i];
     err = crsgraph_->InsertGlobalIndices(rowNumbers[i], numIndicesPerRow[i],
@@ -57,6 +57,7 @@
 #include <fei_VectorTraits_Aztec.hpp>
 #include <fei_Include_Trilinos.hpp>
 #include <fei_Vector_Impl.hpp>
+#include <fei_impl_utils.hpp>
 
 namespace fei {
   /** Declare an AztecDMSR_Matrix specialization of the
@@ -81,34 +82,50 @@ namespace fei {
       return(0);
     }
 
-    static int getRowLength(AztecDMSR_Matrix* mat, int row, int& length)
+    static int getRowLength(AztecDMSR_Matrix* mat,
+                            GlobalOrdinal row, int& length)
       {
-        length = mat->rowLength(row);
+        length = mat->rowLength(fei::impl_utils::int_index(row));
         if (length < 0) return(-1);
         return( 0 );
       }
 
     static int copyOutRow(AztecDMSR_Matrix* mat,
-                      int row, int len, double* coefs, int* indices)
+                      GlobalOrdinal row, int len, double* coefs,
+                      GlobalOrdinal* indices)
       {
-        int dummy;
-        mat->getRow(row, dummy, coefs, indices);
+        int rowLen = mat->rowLength(fei::impl_utils::int_index(row));
+        if (rowLen < 0) return(-1);
+        std::vector<int> cols(rowLen);
+        std::vector<double> rowCoefs(rowLen);
+        if (rowLen > 0) {
+          mat->getRow(fei::impl_utils::int_index(row), rowLen,
+                      &rowCoefs[0], &cols[0]);
+        }
+        if (len > rowLen) len = rowLen;
+        std::copy(rowCoefs.begin(), rowCoefs.begin()+len, coefs);
+        std::copy(cols.begin(), cols.begin()+len, indices);
         return(0);
       }
 
     static int putValuesIn(AztecDMSR_Matrix* mat,
-                     int numRows, const int* rows,
-                     int numCols, const int* cols,
+                     int numRows, const GlobalOrdinal* rows,
+                     int numCols, const GlobalOrdinal* cols,
                      const double* const* values,
                            bool sum_into)
       {
+        std::vector<int> rowWork, colWork;
+        const int* eqnRows =
+          fei::impl_utils::int_indices(numRows, rows, rowWork);
+        const int* eqnCols =
+          fei::impl_utils::int_indices(numCols, cols, colWork);
         int err = 0;
         if (sum_into) {
-          err = mat->sumIntoRow(numRows, rows, numCols, cols, coefs);
+          err = mat->sumIntoRow(numRows, eqnRows, numCols, eqnCols, values);
         }
         else {
           for(int i=0; i<numRows; ++i) {
-            err = mat->putRow(rows[i], numCols, values[i], cols);
+            err = mat->putRow(eqnRows[i], numCols, values[i], eqnCols);
             if (err != 0) {
               return(err);
             }
@@ -57,6 +57,8 @@
 #include <fei_VectorTraits_Epetra.hpp>
 #include <fei_Include_Trilinos.hpp>
 #include <fei_Vector_Impl.hpp>
+#include <fei_impl_utils.hpp>
+#include <fei_ArrayUtils.hpp>
 
 namespace fei {
   /** Declare an Epetra_CrsMatrix specialization of the
@@ -75,12 +77,13 @@ namespace fei {
         return (*mat)[0];
       }
 
-    static int getOffset(Epetra_CrsMatrix* A, int row, int col)
+    static int getOffset(Epetra_CrsMatrix* A,
+                         GlobalOrdinal row, GlobalOrdinal col)
       {
         const Epetra_Map& erowmap = A->RowMap();
         const Epetra_Map& ecolmap = A->ColMap();
-        int local_row = erowmap.LID(row);
-        int local_col = ecolmap.LID(col);
+        int local_row = erowmap.LID(fei::impl_utils::int_index(row));
+        int local_col = ecolmap.LID(fei::impl_utils::int_index(col));
     
         int* rowOffsets;
         int* colIndices;
@@ -110,56 +113,124 @@ namespace fei {
       return(0);
     }
 
-    static int getRowLength(Epetra_CrsMatrix* mat, int row, int& length)
+    static int getRowLength(Epetra_CrsMatrix* mat,
+                            GlobalOrdinal row, int& length)
       {
-        length = mat->NumGlobalEntries(row);
+        length = mat->NumGlobalEntries(fei::impl_utils::int_index(row));
         if (length < 0) return(-1);
         return( 0 );
       }
 
     static int copyOutRow(Epetra_CrsMatrix* mat,
-                      int row, int len, double* coefs, int* indices)
+                      GlobalOrdinal row, int len, double* coefs,
+                      GlobalOrdinal* indices)
       {
         int dummy;
-        return(mat->ExtractGlobalRowCopy(row, len, dummy, coefs, indices));
+        std::vector<int> cols(len);
+        int err = mat->ExtractGlobalRowCopy(fei::impl_utils::int_index(row),
+                                            len, dummy, coefs,
+                                            len > 0 ? &cols[0] : NULL);
+        std::copy(cols.begin(), cols.end(), indices);
+        return(err);
       }
 
     static int putValuesIn(Epetra_CrsMatrix* mat,
-                     int numRows, const int* rows,
-                     int numCols, const int* cols,
+                     int numRows, const GlobalOrdinal* rows,
+                     int numCols, const GlobalOrdinal* cols,
                      const double* const* values,
                            bool sum_into)
       {
         //!!! STATIC DATA NOT THREAD-SAFE !!!!!
         static std::vector<int> idx;
-        idx.resize(numRows+numCols);
+        idx.resize(numRows+4*numCols);
         int* idx_row = &idx[0];
         int* idx_col = idx_row+numRows;
         for(int i=0; i<numRows; ++i) {
-          idx_row[i] = mat->RowMap().LID(rows[i]);
+          idx_row[i] = mat->RowMap().LID(fei::impl_utils::int_index(rows[i]));
         }
         for(int i=0; i<numCols; ++i) {
-          idx_col[i] = mat->ColMap().LID(cols[i]);
+          idx_col[i] = mat->ColMap().LID(fei::impl_utils::int_index(cols[i]));
         }
-        if (sum_into) {
-          for(int i=0; i<numRows; ++i) {
-            int err = mat->SumIntoMyValues(idx_row[i], numCols,
-                                               (double*)values[i],
-                                               idx_col);
-            if (err != 0) {
-              return(err);
-            }
+
+        //Once the matrix is filled with optimized storage, its column-indices
+        //are sorted local indices in contiguous arrays. The incoming columns
+        //are sorted once and each row is then located with a forward walk,
+        //and the coefficients are summed in directly.
+        int* rowOffsets = NULL;
+        int* colIndices = NULL;
+        double* coefs = NULL;
+        bool direct = numCols > 0 && mat->Filled() &&
+          mat->ExtractCrsDataPointers(rowOffsets, colIndices, coefs) == 0;
+
+        int* sorted_col = idx_col+numCols;
+        int* sortOrder = sorted_col+numCols;
+        int* offsets = sortOrder+numCols;
+        if (direct) {
+          for(int j=0; j<numCols; ++j) {
+            sorted_col[j] = idx_col[j];
+            sortOrder[j] = j;
           }
+          fei::insertion_sort_with_companions<int>(numCols, sorted_col,
+                                                   sortOrder);
         }
-        else {
-          for(int i=0; i<numRows; ++i) {
-            int err = mat->ReplaceMyValues(idx_row[i], numCols,
-                                               (double*)values[i],
-                                               idx_col);
-            if (err != 0) {
-              return(err);
+
+        for(int i=0; i<numRows; ++i) {
+          int local_row = idx_row[i];
+          if (direct && local_row >= 0) {
+            int rowBegin = rowOffsets[local_row];
+            int err = fei::impl_utils::find_row_offsets(
+                                           rowOffsets[local_row+1]-rowBegin,
+                                           colIndices+rowBegin,
+                                           numCols, idx_col, sortOrder,
+                                           offsets);
+            if (err == 0) {
+              double* rowCoefs = coefs+rowBegin;
+              const double* values_i = values[i];
+              if (sum_into) {
+                for(int j=0; j<numCols; ++j) rowCoefs[offsets[j]] += values_i[j];
+              }
+              else {
+                for(int j=0; j<numCols; ++j) rowCoefs[offsets[j]] = values_i[j];
+              }
+              continue;
             }
           }
+
+          //not filled yet, or a position isn't in the row's structure; let
+          //Epetra handle (and report) it.
+          int err = sum_into ?
+            mat->SumIntoMyValues(local_row, numCols, (double*)values[i], idx_col)
+            : mat->ReplaceMyValues(local_row, numCols, (double*)values[i], idx_col);
+          if (err != 0) {
+            return(err);
+          }
+        }
+        return(0);
+      }
+
+    static int getLocalColumn(Epetra_CrsMatrix* mat,
+                              GlobalOrdinal col, int& localCol)
+      {
+        if (!mat->HaveColMap()) return(-1);
+        localCol = mat->ColMap().LID(fei::impl_utils::int_index(col));
+        return(0);
+      }
+
+    static int putValuesInLocal(Epetra_CrsMatrix* mat,
+                                int numRows, const int* localRows,
+                                int numCols, const int* localCols,
+                                const double* const* values,
+                                bool sum_into)
+      {
+        int* cols = const_cast<int*>(localCols);
+        for(int i=0; i<numRows; ++i) {
+          double* vals = const_cast<double*>(values[i]);
+          int err = sum_into ?
+            mat->SumIntoMyValues(localRows[i], numCols, vals, cols)
+            : mat->ReplaceMyValues(localRows[i], numCols, vals, cols);
+          if (err != 0) {
+            return(err);
+          }
         }
         return(0);
       }
@@ -201,6 +272,98 @@ namespace fei {
       return( mat->Multiply(false, *ex, *ey) );
     }
 
+    static int eliminateEssentialBCs(Epetra_CrsMatrix* mat,
+                                     int numBCEqns,
+                                     const GlobalOrdinal* bcEqns,
+                                     const double* bcValues,
+                                     bool modifyColumns,
+                                     std::vector<GlobalOrdinal>& rhsRows,
+                                     std::vector<double>& rhsCoefs)
+    {
+      //the raw CSR arrays are only available once the matrix has a
+      //column-map and optimized storage.
+      int* rowOffsets = NULL;
+      int* colIndices = NULL;
+      double* coefs = NULL;
+      if (!mat->Filled() ||
+          mat->ExtractCrsDataPointers(rowOffsets, colIndices, coefs) != 0) {
+        return(-1);
+      }
+
+      int numRows = mat->NumMyRows();
+      if (numRows < 1) return(0);
+
+      const Epetra_Map& rowmap = mat->RowMap();
+      const Epetra_Map& colmap = mat->ColMap();
+
+      std::vector<double> rhsContribs(numRows);
+      std::vector<GlobalOrdinal> rowWork, colWork;
+      int numCols = colmap.NumMyElements();
+      fei::impl_utils::apply_essential_bcs_csr(numRows,
+                        fei::impl_utils::global_indices(numRows,
+                                          rowmap.MyGlobalElements(), rowWork),
+                                               rowOffsets, colIndices,
+                                               numCols,
+                        fei::impl_utils::global_indices(numCols,
+                                          colmap.MyGlobalElements(), colWork),
+                                               coefs,
+                                               numBCEqns, bcEqns, bcValues,
+                                               modifyColumns,
+                                               &rhsContribs[0]);
+
+      for(int i=0; i<numRows; ++i) {
+        if (rhsContribs[i] != 0.0) {
+          rhsRows.push_back(rowmap.GID(i));
+          rhsCoefs.push_back(rhsContribs[i]);
+        }
+      }
+
+      return(0);
+    }
+
+    static int getCoefOffsets(Epetra_CrsMatrix* mat,
+                              int numRows, const GlobalOrdinal* rows,
+                              int numCols, const GlobalOrdinal* cols,
+                              int* offsets)
+    {
+      int* rowOffsets = NULL;
+      int* colIndices = NULL;
+      double* coefs = NULL;
+      if (!mat->Filled() ||
+          mat->ExtractCrsDataPointers(rowOffsets, colIndices, coefs) != 0) {
+        return(-1);
+      }
+
+      const Epetra_Map& rowmap = mat->RowMap();
+      const Epetra_Map& colmap = mat->ColMap();
+
+      for(int i=0; i<numRows; ++i) {
+        int local_row = rowmap.LID(fei::impl_utils::int_index(rows[i]));
+        if (local_row < 0) return(-1);
+
+        int rowBegin = rowOffsets[local_row];
+        int rowEnd = rowOffsets[local_row+1];
+
+        for(int j=0; j<numCols; ++j) {
+          int local_col = colmap.LID(fei::impl_utils::int_index(cols[j]));
+          if (local_col < 0) return(-1);
+
+          int offset = -1;
+          for(int k=rowBegin; k<rowEnd; ++k) {
+            if (colIndices[k] == local_col) {
+              offset = k;
+              break;
+            }
+          }
+          if (offset < 0) return(-1);
+
+          offsets[i*numCols+j] = offset;
+        }
+      }
+
+      return(0);
+    }
+
   };//struct MatrixTraits<Epetra_CrsMatrix>
 }//namespace fei
 
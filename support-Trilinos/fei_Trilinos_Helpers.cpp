@@ -52,6 +52,7 @@
 
 #include <fei_Trilinos_Helpers.hpp>
 #include <fei_ParameterSet.hpp>
+#include <fei_impl_utils.hpp>
 #include <fei_Vector_Impl.hpp>
 #include <fei_VectorReducer.hpp>
 #include <fei_Matrix_Impl.hpp>
@@ -135,14 +136,19 @@ create_Epetra_CrsGraph(const fei::SharedPtr<fei::MatrixGraph>& matgraph,
     throw std::runtime_error("create_Epetra_CrsGraph ERROR in fei::MatrixGraph::createGraph");
   }
 
-  int numLocallyOwnedRows = localSRGraph->rowNumbers.size();
-  int* rowNumbers = numLocallyOwnedRows>0 ? &(localSRGraph->rowNumbers[0]) : NULL;
+  //Epetra takes int global indices.
+  std::vector<int> local_eqns, colIndices;
+  fei::impl_utils::copy_int_indices(localSRGraph->rowNumbers, local_eqns);
+  fei::impl_utils::copy_int_indices(localSRGraph->packedColumnIndices,
+                                    colIndices);
+
+  int numLocallyOwnedRows = local_eqns.size();
+  int* rowNumbers = numLocallyOwnedRows>0 ? &local_eqns[0] : NULL;
   int* rowOffsets = &(localSRGraph->rowOffsets[0]);
-  int* packedColumnIndices = numLocallyOwnedRows>0 ? &(localSRGraph->packedColumnIndices[0]) : NULL;
+  int* packedColumnIndices = colIndices.empty() ? NULL : &colIndices[0];
 
   fei::SharedPtr<fei::VectorSpace> vecspace = matgraph->getRowSpace();
   MPI_Comm comm = vecspace->getCommunicator();
-  std::vector<int>& local_eqns = localSRGraph->rowNumbers;
 
   Epetra_BlockMap emap = blockEntries ?
     create_Epetra_BlockMap(vecspace) : create_Epetra_Map(comm, local_eqns);
@@ -291,7 +297,9 @@ create_from_LPM_EpetraBasic(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
   fei::SharedPtr<fei::SparseRowGraph> sharedsrg(srgraph);
   int localSize;
   if (reducer.get() != NULL) {
-    std::vector<int>& reduced_eqns = reducer->getLocalReducedEqns();
+    std::vector<int> reduced_eqns;
+    fei::impl_utils::copy_int_indices(reducer->getLocalReducedEqns(),
+                                      reduced_eqns);
     lpm_epetrabasic->setRowDistribution(reduced_eqns);
     lpm_epetrabasic->setMatrixGraph(sharedsrg);
     localSize = reduced_eqns.size();
@@ -309,7 +317,9 @@ create_from_LPM_EpetraBasic(fei::SharedPtr<fei::MatrixGraph> matrixGraph,
     else {
       localSize = vecSpace->getNumIndices_Owned();
       indices.resize(localSize);
-      err = vecSpace->getIndices_Owned(indices);
+      std::vector<fei::GlobalOrdinal> eqns;
+      err = vecSpace->getIndices_Owned(eqns);
+      fei::impl_utils::copy_int_indices(eqns, indices);
     }
     if (err != 0) {
       throw std::runtime_error("Factory_Trilinos: createMatrix: error in vecSpace->getIndices_Owned");
@@ -65,7 +65,7 @@ namespace fei {
     static const char* typeName()
       { return("fei::Aztec_LSVector"); }
 
-    static int setValues(Aztec_LSVector* vec, int firstLocalOffset,
+    static int setValues(Aztec_LSVector* vec, GlobalOrdinal firstLocalOffset,
                          double scalar, bool isSolnVector=false)
       {
         return( vec->put(scalar) );
@@ -73,9 +73,9 @@ namespace fei {
 
     //note that incoming indices are point-entry indices, not block-indices.
     static int putValuesIn(Aztec_LSVector* vec,
-                           int firstLocalOffset,
+                           GlobalOrdinal firstLocalOffset,
                            int numValues,
-                           const int* indices,
+                           const GlobalOrdinal* indices,
                            const double* values,
                            bool sum_into,
                            bool isSolnVector=false,
@@ -97,8 +97,9 @@ namespace fei {
 
     //note that incoming indices are point-entry indices, not block-indices.
     static int copyOut(Aztec_LSVector* vec,
-                       int firstLocalOffset,
-                       int numValues, const int* indices, double* values,
+                       GlobalOrdinal firstLocalOffset,
+                       int numValues, const GlobalOrdinal* indices,
+                       double* values,
                        bool isSolnVector=false,
                        int vectorIndex=0)
       {
@@ -65,7 +65,8 @@ namespace fei {
     static const char* typeName()
       { return("Epetra_MultiVector"); }
 
-    static int setValues(Epetra_MultiVector* vec, int firstLocalOffset,
+    static int setValues(Epetra_MultiVector* vec,
+                         GlobalOrdinal firstLocalOffset,
                          double scalar, bool isSolnVector=false)
       {
         return( vec->PutScalar(scalar) );
@@ -73,9 +74,9 @@ namespace fei {
 
     //note that incoming indices are point-entry indices, not block-indices.
     static int putValuesIn(Epetra_MultiVector* vec,
-                           int firstLocalOffset,
+                           GlobalOrdinal firstLocalOffset,
                            int numValues,
-                           const int* indices,
+                           const GlobalOrdinal* indices,
                            const double* values,
                            bool sum_into,
                            bool isSolnVector=false,
@@ -97,8 +98,9 @@ namespace fei {
 
     //note that incoming indices are point-entry indices, not block-indices.
     static int copyOut(Epetra_MultiVector* vec,
-                       int firstLocalOffset,
-                       int numValues, const int* indices, double* values,
+                       GlobalOrdinal firstLocalOffset,
+                       int numValues, const GlobalOrdinal* indices,
+                       double* values,
                        bool isSolnVector=false,
                        int vectorIndex=0)
       {
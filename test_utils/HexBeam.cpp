@@ -717,7 +717,7 @@ int load_elem_data(fei::MatrixGraph* matrixGraph,
   CHK_ERR( hexcube.getElemLoadVector(firstLocalElem, elemVec) );
 
   bool block_matrix = mat->usingBlockEntryStorage();
-  std::vector<int> indices(len);
+  std::vector<fei::GlobalOrdinal> indices(len);
 
   if (block_matrix) {
     mat->getMatrixGraph()->setIndicesMode(fei::MatrixGraph::POINT_ENTRY_GRAPH);
@@ -754,20 +754,25 @@ int load_constraints(fei::LinearSystem* linSys, HexBeam& hexcube,
   int numNodesPerCR = hexcube.getNumNodesPerCR();
 
   int fieldSize = hexcube.numDofPerNode();
-  double* weights = new double[fieldSize*numNodesPerCR];
+  int numWeights = fieldSize*numNodesPerCR;
 
-  int i;
-  for(i=0; i<fieldSize*numNodesPerCR; ++i) weights[i] = 0.0;
-  weights[0] = -1.0;
-  weights[fieldSize] = 1.0;
-  double rhsValue = 0.0;
+  std::vector<int> crIDs(numCRs);
+  std::vector<int> weightOffsets(numCRs+1);
+  std::vector<double> weights(numCRs*numWeights, 0.0);
+  std::vector<double> rhsValues(numCRs, 0.0);
 
+  int i;
   for(i=0; i<numCRs; ++i) {
-    CHK_ERR( linSys->loadLagrangeConstraint(firstLocalCRID+i,
-					    weights, rhsValue) );
+    crIDs[i] = firstLocalCRID+i;
+    weightOffsets[i] = i*numWeights;
+    weights[i*numWeights] = -1.0;
+    weights[i*numWeights+fieldSize] = 1.0;
   }
+  weightOffsets[numCRs] = numCRs*numWeights;
 
-  delete [] weights;
+  CHK_ERR( linSys->loadLagrangeConstraints(numCRs, &crIDs[0],
+                                           &weightOffsets[0], &weights[0],
+                                           &rhsValues[0]) );
 
   return(0);
 }
@@ -894,8 +894,9 @@ int load_elem_data_putrhs(FEI* fei, PoissonData& poissonData)
 
   fei->loadComplete();
 
+  std::vector<GlobalID> rhsIDs(rhs.indices().begin(), rhs.indices().end());
   fei->putIntoRHS(0, *fieldID, rhs.size(),
-                  &(rhs.indices()[0]), &(rhs.coefs()[0]));
+                  &rhsIDs[0], &(rhs.coefs()[0]));
 
   return(0);
 }
@@ -1020,8 +1021,8 @@ int load_elem_data(fei::MatrixGraph* matrixGraph,
 
   int numIndices = matrixGraph->getConnectivityNumIndices(elemBlockID);
 
-  std::vector<int> indicesArray(numIndices);
-  int* indicesPtr = &indicesArray[0];
+  std::vector<fei::GlobalOrdinal> indicesArray(numIndices);
+  fei::GlobalOrdinal* indicesPtr = &indicesArray[0];
 
   for(int elem=0; elem<numLocalElements; elem++) {
     double** elemStiffness = poissonData.getElemStiffness(elemIDs[elem]);
@@ -485,17 +485,17 @@ int copy_feiMatrix_to_FillableMat(fei::Matrix& feimat, fei::FillableMat& fmat)
   MPI_Comm comm = rowspace->getCommunicator();
   int localProc = fei::localProc(comm);
 
-  std::vector<int> globalOffsets;
+  std::vector<fei::GlobalOrdinal> globalOffsets;
   rowspace->getGlobalIndexOffsets(globalOffsets);
   int numLocalRows = globalOffsets[localProc+1]-globalOffsets[localProc];
-  int firstLocalRow = globalOffsets[localProc];
+  fei::GlobalOrdinal firstLocalRow = globalOffsets[localProc];
 
   for(int i=0; i<numLocalRows; ++i) {
-    int row = firstLocalRow+i;
+    fei::GlobalOrdinal row = firstLocalRow+i;
     int rowLen;
     feimat.getRowLength(row, rowLen);
 
-    std::vector<int> colindices(rowLen);
+    std::vector<fei::GlobalOrdinal> colindices(rowLen);
     std::vector<double> coefs(rowLen);
 
     feimat.copyOutRow(row, rowLen, &coefs[0], &colindices[0]);
@@ -302,7 +302,7 @@ int snl_fei_tester::loadElemBlocks()
 
     int numIndices = matrixGraph_->getConnectivityNumIndices(eb.blockID_);
 
-    std::vector<int> indices(numIndices);
+    std::vector<fei::GlobalOrdinal> indices(numIndices);
 
     for(int j=0; j<eb.numElements_; ++j) {
       int checkNum;
@@ -683,7 +683,7 @@ int snl_fei_tester::save_multiplier_soln(DataReader& data, fei::Vector* vec,
 
     outfile << localCRStart++ << " " << 1 << FEI_ENDL;
     for(int j=0; j<1; ++j) {
-      int globalIndex = -1;
+      fei::GlobalOrdinal globalIndex = -1;
       CHK_ERR( vecSpace_->getGlobalIndex(idType, ID, globalIndex) );
 
       CHK_ERR( vec->copyOut(1, &globalIndex, &solnData[0]) );
@@ -60,7 +60,7 @@ int test_Algebraic::serialtest1()
 
   CHK_ERR( vspace->initComplete() );
 
-  int index = -1;
+  fei::GlobalOrdinal index = -1;
   CHK_ERR( vspace->getGlobalIndex(idType, rowNumbers[3], index) );
 
   if (index != 3) {
@@ -73,7 +73,7 @@ int test_Algebraic::serialtest1()
     ERReturn(-1);
   }
 
-  std::vector<int> globalOffsets;
+  std::vector<fei::GlobalOrdinal> globalOffsets;
 
   vspace->getGlobalIndexOffsets(globalOffsets);
 
@@ -108,7 +108,8 @@ int test_Algebraic::serialtest1()
   int mnumRows = localgraph->rowNumbers.size();
   int* mrowOffsets = &(localgraph->rowOffsets[0]);
   int mnumNonzeros = localgraph->packedColumnIndices.size();
-  int* mpackedColumnIndices = &(localgraph->packedColumnIndices[0]);
+  fei::GlobalOrdinal* mpackedColumnIndices =
+    &(localgraph->packedColumnIndices[0]);
 
   if (mnumRows != numRows) {
     ERReturn(-1);
@@ -148,7 +149,7 @@ int test_Algebraic::serialtest2()
 
   CHK_ERR( vspace->initComplete() );
 
-  int index = -1;
+  fei::GlobalOrdinal index = -1;
   CHK_ERR( vspace->getGlobalIndex(idType, rowNumbers[3], index) );
 
   if (index != 3) {
@@ -161,7 +162,7 @@ int test_Algebraic::serialtest2()
     ERReturn(-1);
   }
 
-  std::vector<int> globalOffsets;
+  std::vector<fei::GlobalOrdinal> globalOffsets;
 
   vspace->getGlobalIndexOffsets(globalOffsets);
 
@@ -198,7 +199,8 @@ int test_Algebraic::serialtest2()
   int mnumRows = localgraph->rowNumbers.size();
   int* mrowOffsets = &(localgraph->rowOffsets[0]);
   int mnumNonzeros = localgraph->packedColumnIndices.size();
-  int* mpackedColumnIndices = &(localgraph->packedColumnIndices[0]);
+  fei::GlobalOrdinal* mpackedColumnIndices =
+    &(localgraph->packedColumnIndices[0]);
 
   if (mnumRows != numRows) {
     ERReturn(-1);
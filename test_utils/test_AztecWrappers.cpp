@@ -199,6 +199,90 @@ int test_AztecWrappers::test1()
 
 int test_AztecWrappers::test2()
 {
+  //check getCoefOffsets and summing through a registered element pattern
+  //against the searching sumIntoRow, on a filled tridiagonal matrix.
+#ifdef HAVE_FEI_AZTECOO
+  int localSize = 3, globalSize = localSize*numProcs_;
+  int localOffset = localSize*localProc_;
+  int i, j;
+
+  std::vector<int> update(localSize);
+  for(i=0; i<localSize; i++) update[i] = localOffset+i;
+
+  fei::SharedPtr<fei_trilinos::Aztec_Map> map(
+    new fei_trilinos::Aztec_Map(globalSize, localSize, &update[0], localOffset, comm_));
+
+  std::vector<std::vector<int> > colIndices(localSize);
+  std::vector<std::vector<double> > values(localSize);
+  std::vector<int> rowLengths(localSize);
+  for(i=0; i<localSize; i++) {
+    int row = i+localOffset;
+    for(int col=row-1; col<=row+1; ++col) {
+      if (col < 0 || col >= globalSize) continue;
+      colIndices[i].push_back(col);
+      values[i].push_back((double)(row*globalSize+col));
+    }
+    rowLengths[i] = colIndices[i].size() - 1;
+  }
+
+  fei_trilinos::AztecDMSR_Matrix searchA(map), patternA(map);
+  searchA.allocate(&rowLengths[0]);
+  patternA.allocate(&rowLengths[0]);
+  CHK_ERR( fill_DMSR(searchA, localOffset, colIndices, values, false) );
+  CHK_ERR( fill_DMSR(patternA, localOffset, colIndices, values, false) );
+  searchA.fillComplete();
+  patternA.fillComplete();
+
+  //an element coupling the last two local rows, with rows and columns in
+  //decreasing order.
+  int rows[2] = {localOffset+2, localOffset+1};
+  int cols[2] = {localOffset+2, localOffset+1};
+  int offsets[4];
+  CHK_ERR( patternA.getCoefOffsets(2, rows, 2, cols, offsets) );
+
+  const double* coefs = patternA.getBeginPointer();
+  for(i=0; i<2; ++i) {
+    for(j=0; j<2; ++j) {
+      double correct = (double)(rows[i]*globalSize+cols[j]);
+      if (coefs[offsets[i*2+j]] != correct) ERReturn(-1);
+    }
+  }
+
+  //localOffset isn't in the structure of the last local row.
+  int badCol = localOffset;
+  if (patternA.getCoefOffsets(1, rows, 1, &badCol, offsets) != -1) {
+    ERReturn(-1);
+  }
+  if (patternA.registerElementPattern(1, rows, 1, &badCol) != -1) {
+    ERReturn(-1);
+  }
+
+  int handle = patternA.registerElementPattern(2, rows, 2, cols);
+  if (handle < 0) ERReturn(-1);
+
+  double row0[2] = {1.0, -2.0};
+  double row1[2] = {-3.0, 4.0};
+  double* elemcoefs[2] = {row0, row1};
+  for(int rep=0; rep<2; ++rep) {
+    CHK_ERR( searchA.sumIntoRow(2, rows, 2, cols, elemcoefs) );
+    CHK_ERR( patternA.sumIntoRow(handle, elemcoefs) );
+  }
+
+  for(i=0; i<localSize; ++i) {
+    int row = localOffset+i;
+    for(j=0; j<2; ++j) {
+      if (row != rows[j]) continue;
+      for(int k=0; k<(int)colIndices[i].size(); ++k) {
+        for(int c=0; c<2; ++c) {
+          if (colIndices[i][k] == cols[c]) values[i][k] += 2.0*elemcoefs[j][c];
+        }
+      }
+    }
+  }
+
+  CHK_ERR( compare_DMSR_contents(searchA, localOffset, colIndices, values) );
+  CHK_ERR( compare_DMSR_contents(patternA, localOffset, colIndices, values) );
+#endif
   return(0);
 }
 
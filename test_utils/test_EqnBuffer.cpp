@@ -12,6 +12,7 @@
 #include <cmath>
 #include <fei_CSVec.hpp>
 #include <fei_EqnBuffer.hpp>
+#include <fei_impl_utils.hpp>
 
 #undef fei_file
 #define fei_file "test_EqnBuffer.cpp"
@@ -114,7 +115,7 @@ int test_EqnBuffer::test1()
 	CHK_ERR( eqns.getCoefAndRemoveIndex( eqnNumbers[rowIndex], eqnNumbers[i],
 					     coef) );
 
-	std::vector<int>& indicesRef = rows[i]->indices();
+	std::vector<fei::GlobalOrdinal>& indicesRef = rows[i]->indices();
 	std::vector<double>& coefsRef = rows[i]->coefs();
 
 	int len = indicesRef.size();
@@ -124,10 +125,10 @@ int test_EqnBuffer::test1()
 	double* tempCoefsPtr = &tempCoefs[0];
 	int* tempIndicesPtr = &tempIndices[0];
 	double* coefsPtr = &coefsRef[0];
-	int* indicesPtr = &indicesRef[0];
+	fei::GlobalOrdinal* indicesPtr = &indicesRef[0];
 
 	for(int j=0; j<len; ++j) {
-	  tempIndicesPtr[j] = indicesPtr[j];
+	  tempIndicesPtr[j] = fei::impl_utils::int_index(indicesPtr[j]);
 	  tempCoefsPtr[j] = coef*coefsPtr[j];
 	}
 
@@ -17,6 +17,8 @@
 #include <fei_EqnBuffer.hpp>
 #include <fei_EqnCommMgr.hpp>
 
+#include <cmath>
+
 #undef fei_file
 #define fei_file "test_EqnCommMgr.cpp"
 #include <fei_ErrMacros.hpp>
@@ -137,10 +139,334 @@ int test_EqnCommMgr::test2()
 
 int test_EqnCommMgr::test3()
 {
+  FEI_COUT << "testing EqnCommMgr packed exchange...";
+
+  int numProcs = fei::numProcs(comm_);
+  int localProc = fei::localProc(comm_);
+
+  int numLocalEqns = 5;
+  int firstLocalEqn = localProc*numLocalEqns;
+
+  EqnCommMgr eqnCommMgr(comm_);
+  eqnCommMgr.setNumRHSs(1);
+
+  //each proc contributes to every equation owned by each other proc, with
+  //columns for the owned equation and the first locally-owned equation.
+  int p;
+  for(p=0; p<numProcs; p++) {
+    if (p == localProc) continue;
+
+    for(int i=0; i<numLocalEqns; i++) {
+      int eqn = p*numLocalEqns + i;
+      int indices[2] = {eqn, firstLocalEqn};
+      eqnCommMgr.addRemoteIndices(eqn, p, indices, 2);
+    }
+  }
+
+  CHK_ERR( eqnCommMgr.exchangeIndices() );
+
+  EqnCommMgr* unpacked = eqnCommMgr.deepCopy();
+  eqnCommMgr.setPackedExchange(true);
+
+  //add each contribution twice, so that accumulation gets exercised.
+  for(int pass=0; pass<2; ++pass) {
+    for(p=0; p<numProcs; p++) {
+      if (p == localProc) continue;
+
+      for(int i=0; i<numLocalEqns; i++) {
+        int eqn = p*numLocalEqns + i;
+        int indices[2] = {firstLocalEqn, eqn};
+        double coefs[2] = {1.0*(localProc+1), 0.5*eqn};
+
+        CHK_ERR( eqnCommMgr.addRemoteEqn(eqn, p, coefs, indices, 2) );
+        CHK_ERR( eqnCommMgr.addRemoteRHS(eqn, p, 0, 1.0) );
+        CHK_ERR( unpacked->addRemoteEqn(eqn, p, coefs, indices, 2) );
+        CHK_ERR( unpacked->addRemoteRHS(eqn, p, 0, 1.0) );
+      }
+    }
+  }
+
+  CHK_ERR( eqnCommMgr.exchangeEqns() );
+  CHK_ERR( unpacked->exchangeEqns() );
+
+  if (eqnCommMgr.newCoefData() != unpacked->newCoefData() ||
+      eqnCommMgr.newRHSData() != unpacked->newRHSData()) {
+    ERReturn(-1);
+  }
+
+  //the packed receive buffers, summed over the sending procs, must match the
+  //equations unpacked by the regular exchange.
+  std::vector<int>& recvEqnNumbers = unpacked->localEqnNumbers();
+  std::vector<fei::CSVec*>& recvEqns = unpacked->localEqns();
+  std::vector<std::vector<double>*>& recvRHSs = *(unpacked->localRHSsPtr());
+
+  std::vector<double> coefSums(recvEqns.size()*numProcs*numLocalEqns, 0.0);
+  std::vector<double> rhsSums(recvEqns.size(), 0.0);
+
+  for(size_t i=0; i<eqnCommMgr.getNumSharingProcs(); ++i) {
+    int numEqns = 0, numRHSs = 0;
+    const int* eqnNumbers = NULL;
+    const int* eqnLengths = NULL;
+    const int* indices = NULL;
+    const double* coefs = NULL;
+    const double* rhsCoefs = NULL;
+    CHK_ERR( eqnCommMgr.getPackedRecvEqns(i, numEqns, eqnNumbers, eqnLengths,
+                                          indices, coefs, numRHSs, rhsCoefs) );
+    if (numRHSs != 1) ERReturn(-1);
+
+    int offset = 0;
+    for(int j=0; j<numEqns; ++j) {
+      int loc = fei::binarySearch(eqnNumbers[j], recvEqnNumbers);
+      if (loc < 0) ERReturn(-1);
+
+      for(int k=0; k<eqnLengths[j]; ++k) {
+        coefSums[loc*numProcs*numLocalEqns + indices[offset+k]] +=
+          coefs[offset+k];
+      }
+      rhsSums[loc] += rhsCoefs[j];
+      offset += eqnLengths[j];
+    }
+  }
+
+  for(size_t i=0; i<recvEqns.size(); ++i) {
+    std::vector<fei::GlobalOrdinal>& indices = recvEqns[i]->indices();
+    std::vector<double>& coefs = recvEqns[i]->coefs();
+    for(size_t k=0; k<indices.size(); ++k) {
+      double sum = coefSums[i*numProcs*numLocalEqns + indices[k]];
+      if (std::abs(sum - coefs[k]) > 1.e-12) ERReturn(-1);
+    }
+
+    if (std::abs(rhsSums[i] - (*(recvRHSs[i]))[0]) > 1.e-12) ERReturn(-1);
+  }
+
+  //after resetCoefs, a second exchange must carry only the new contributions.
+  eqnCommMgr.resetCoefs();
+  for(p=0; p<numProcs; p++) {
+    if (p == localProc) continue;
+    int eqn = p*numLocalEqns;
+    double coef = 3.0;
+    CHK_ERR( eqnCommMgr.addRemoteEqn(eqn, p, &coef, &eqn, 1) );
+  }
+
+  CHK_ERR( eqnCommMgr.exchangeEqns() );
+
+  for(size_t i=0; i<eqnCommMgr.getNumSharingProcs(); ++i) {
+    int numEqns = 0, numRHSs = 0;
+    const int* eqnNumbers = NULL;
+    const int* eqnLengths = NULL;
+    const int* indices = NULL;
+    const double* coefs = NULL;
+    const double* rhsCoefs = NULL;
+    CHK_ERR( eqnCommMgr.getPackedRecvEqns(i, numEqns, eqnNumbers, eqnLengths,
+                                          indices, coefs, numRHSs, rhsCoefs) );
+
+    int offset = 0;
+    for(int j=0; j<numEqns; ++j) {
+      for(int k=0; k<eqnLengths[j]; ++k) {
+        double expected =
+          (eqnNumbers[j] == firstLocalEqn && indices[offset+k] == firstLocalEqn)
+          ? 3.0 : 0.0;
+        if (std::abs(coefs[offset+k] - expected) > 1.e-12) ERReturn(-1);
+      }
+      offset += eqnLengths[j];
+    }
+  }
+
+  delete unpacked;
+
+  FEI_COUT << FEI_ENDL;
+  return(0);
+}
+
+//compare the equations received by 'mgr' with those received by 'ref'.
+//If 'mgr' is in packed mode, its receive buffers are summed over the
+//sending procs first.
+static int compareRecvEqns(EqnCommMgr& mgr, EqnCommMgr& ref)
+{
+  std::vector<int>& refEqnNumbers = ref.localEqnNumbers();
+  std::vector<fei::CSVec*>& refEqns = ref.localEqns();
+  std::vector<std::vector<double>*>& refRHSs = *(ref.localRHSsPtr());
+
+  if (mgr.newCoefData() != ref.newCoefData() ||
+      mgr.newRHSData() != ref.newRHSData()) {
+    ERReturn(-1);
+  }
+
+  if (!mgr.packedExchange()) {
+    std::vector<int>& eqnNumbers = mgr.localEqnNumbers();
+    std::vector<fei::CSVec*>& eqns = mgr.localEqns();
+    std::vector<std::vector<double>*>& rhss = *(mgr.localRHSsPtr());
+    if (eqnNumbers != refEqnNumbers) ERReturn(-1);
+
+    for(size_t i=0; i<eqns.size(); ++i) {
+      if (eqns[i]->indices() != refEqns[i]->indices()) ERReturn(-1);
+      for(size_t k=0; k<eqns[i]->size(); ++k) {
+        double diff = eqns[i]->coefs()[k] - refEqns[i]->coefs()[k];
+        if (std::abs(diff) > 1.e-12) ERReturn(-1);
+      }
+      if (std::abs((*(rhss[i]))[0] - (*(refRHSs[i]))[0]) > 1.e-12) {
+        ERReturn(-1);
+      }
+    }
+    return(0);
+  }
+
+  std::vector<fei::CSVec> sums(refEqns.size());
+  std::vector<double> rhsSums(refEqns.size(), 0.0);
+
+  for(size_t i=0; i<mgr.getNumSharingProcs(); ++i) {
+    int numEqns = 0, numRHSs = 0;
+    const int* eqnNumbers = NULL;
+    const int* eqnLengths = NULL;
+    const int* indices = NULL;
+    const double* coefs = NULL;
+    const double* rhsCoefs = NULL;
+    CHK_ERR( mgr.getPackedRecvEqns(i, numEqns, eqnNumbers, eqnLengths,
+                                   indices, coefs, numRHSs, rhsCoefs) );
+
+    int offset = 0;
+    for(int j=0; j<numEqns; ++j) {
+      int loc = fei::binarySearch(eqnNumbers[j], refEqnNumbers);
+      if (loc < 0) ERReturn(-1);
+
+      for(int k=0; k<eqnLengths[j]; ++k) {
+        fei::add_entry(sums[loc], indices[offset+k], coefs[offset+k]);
+      }
+      rhsSums[loc] += rhsCoefs[j*numRHSs];
+      offset += eqnLengths[j];
+    }
+  }
+
+  for(size_t i=0; i<refEqns.size(); ++i) {
+    std::vector<fei::GlobalOrdinal>& indices = refEqns[i]->indices();
+    std::vector<double>& coefs = refEqns[i]->coefs();
+    if (sums[i].indices() != indices) ERReturn(-1);
+    for(size_t k=0; k<indices.size(); ++k) {
+      if (std::abs(sums[i].coefs()[k] - coefs[k]) > 1.e-12) ERReturn(-1);
+    }
+
+    if (std::abs(rhsSums[i] - (*(refRHSs[i]))[0]) > 1.e-12) ERReturn(-1);
+  }
+
   return(0);
 }
 
 int test_EqnCommMgr::test4()
 {
+  FEI_COUT << "testing EqnCommMgr frozen-pattern exchange...";
+
+  int numProcs = fei::numProcs(comm_);
+  int localProc = fei::localProc(comm_);
+
+  //each proc owns 6 eqns, and initially contributes to the first 5 of the
+  //eqns owned by every other proc.
+  int numLocalEqns = 6;
+  int firstLocalEqn = localProc*numLocalEqns;
+
+  EqnCommMgr ref(comm_);
+  ref.setNumRHSs(1);
+
+  int p;
+  for(p=0; p<numProcs; p++) {
+    if (p == localProc) continue;
+
+    for(int i=0; i<numLocalEqns-1; i++) {
+      int eqn = p*numLocalEqns + i;
+      int indices[2] = {eqn, firstLocalEqn};
+      ref.addRemoteIndices(eqn, p, indices, 2);
+    }
+  }
+
+  CHK_ERR( ref.exchangeIndices() );
+
+  EqnCommMgr* frozen = ref.deepCopy();
+  frozen->setFreezePattern(true);
+
+  EqnCommMgr* frozenPacked = ref.deepCopy();
+  frozenPacked->setFreezePattern(true);
+  frozenPacked->setPackedExchange(true);
+
+  EqnCommMgr* mgrs[3] = {&ref, frozen, frozenPacked};
+
+  for(int step=0; step<5; ++step) {
+    for(int m=0; m<3; ++m) {
+      mgrs[m]->resetCoefs();
+    }
+
+    for(p=0; p<numProcs; p++) {
+      if (p == localProc) continue;
+
+      for(int i=0; i<numLocalEqns-1; i++) {
+        int eqn = p*numLocalEqns + i;
+        int indices[2] = {firstLocalEqn, eqn};
+        double coefs[2] = {1.0*(localProc+step+1), 0.25*eqn*(step+1)};
+        for(int m=0; m<3; ++m) {
+          CHK_ERR( mgrs[m]->addRemoteEqn(eqn, p, coefs, indices, 2) );
+          CHK_ERR( mgrs[m]->addRemoteRHS(eqn, p, 0, 1.0*step) );
+        }
+      }
+
+      //at step 2, a new column appears in an existing remote eqn, and at
+      //step 3 a new remote eqn appears. The frozen pattern must be dropped
+      //and re-established. The reference gets a fresh exchangeIndices.
+      if (step == 2) {
+        int eqn = p*numLocalEqns;
+        int col = firstLocalEqn+1;
+        double coef = 7.0;
+        for(int m=0; m<3; ++m) {
+          CHK_ERR( mgrs[m]->addRemoteEqn(eqn, p, &coef, &col, 1) );
+        }
+      }
+      if (step == 3) {
+        int eqn = p*numLocalEqns + numLocalEqns-1;
+        double coef = 5.0;
+        ref.addRemoteIndices(eqn, p, &eqn, 1);
+        for(int m=0; m<3; ++m) {
+          CHK_ERR( mgrs[m]->addRemoteEqn(eqn, p, &coef, &eqn, 1) );
+        }
+      }
+    }
+
+    if (step == 2 || step == 3) {
+      CHK_ERR( ref.exchangeIndices() );
+    }
+
+    for(int m=0; m<3; ++m) {
+      CHK_ERR( mgrs[m]->exchangeEqns() );
+    }
+
+    CHK_ERR( compareRecvEqns(*frozen, ref) );
+    CHK_ERR( compareRecvEqns(*frozenPacked, ref) );
+  }
+
+  //solution values for the eqns we contributed to come back from the owners.
+  std::vector<int>& recvEqnNumbers = ref.localEqnNumbers();
+  std::vector<double> solnValues(recvEqnNumbers.size());
+  for(size_t i=0; i<solnValues.size(); ++i) {
+    solnValues[i] = 10.0*recvEqnNumbers[i];
+  }
+
+  for(int m=0; m<3; ++m) {
+    if (!solnValues.empty()) {
+      mgrs[m]->addSolnValues(&recvEqnNumbers[0], &solnValues[0],
+                             solnValues.size());
+    }
+    for(int rep=0; rep<2; ++rep) {
+      mgrs[m]->exchangeSoln();
+    }
+
+    std::vector<int>& sendEqnNumbers = mgrs[m]->sendEqnNumbersPtr();
+    double* sendEqnSoln = mgrs[m]->sendEqnSolnPtr();
+    for(size_t i=0; i<sendEqnNumbers.size(); ++i) {
+      if (std::abs(sendEqnSoln[i] - 10.0*sendEqnNumbers[i]) > 1.e-12) {
+        ERReturn(-1);
+      }
+    }
+  }
+
+  delete frozen;
+  delete frozenPacked;
+
+  FEI_COUT << FEI_ENDL;
   return(0);
 }
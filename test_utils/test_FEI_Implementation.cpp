@@ -412,12 +412,238 @@ int test_FEI_Implementation::test2()
   return(0);
 }
 
+/** FEData which records what arrives through the element-matrix entry points
+    of the FiniteElementData interface. */
+class RecordingFEData : public FEData {
+ public:
+  RecordingFEData(MPI_Comm comm)
+    : FEData(comm), inPlaceCoefs(NULL), batchCoefs(NULL), denseCoefs() {}
+
+  int setElemMatrixInPlace(int elemBlockID, int elemID, int numNodes,
+                           const int* nodeNumbers, const int* numDofPerNode,
+                           const int* dof_ids, int elemFormat,
+                           const double* const* coefs)
+  {
+    inPlaceCoefs = coefs;
+    return( FiniteElementData::setElemMatrixInPlace(elemBlockID, elemID,
+                                                    numNodes, nodeNumbers,
+                                                    numDofPerNode, dof_ids,
+                                                    elemFormat, coefs) );
+  }
+
+  int setElemMatrices(int elemBlockID, int numElems, const int* elemIDs,
+                      int numNodes, const int* nodeNumbers,
+                      const int* numDofPerNode, const int* dof_ids,
+                      int elemFormat, const double* coefs)
+  {
+    batchCoefs = coefs;
+    return( FiniteElementData::setElemMatrices(elemBlockID, numElems, elemIDs,
+                                               numNodes, nodeNumbers,
+                                               numDofPerNode, dof_ids,
+                                               elemFormat, coefs) );
+  }
+
+  int setElemMatrix(int elemBlockID, int elemID, int numNodes,
+                    const int* nodeNumbers, const int* dofPerNode,
+                    const int* dof_ids, const double *const * coefs)
+  {
+    int n = 0;
+    for(int i=0; i<numNodes; ++i) n += dofPerNode[i];
+    denseCoefs.resize(0);
+    for(int i=0; i<n; ++i) {
+      for(int j=0; j<n; ++j) denseCoefs.push_back(coefs[i][j]);
+    }
+    return( FEData::setElemMatrix(elemBlockID, elemID, numNodes, nodeNumbers,
+                                  dofPerNode, dof_ids, coefs) );
+  }
+
+  const double* const* inPlaceCoefs;
+  const double* batchCoefs;
+  std::vector<double> denseCoefs;
+};
+
 int test_FEI_Implementation::test3()
 {
+  //check that element-stiffnesses are handed on to FiniteElementData without
+  //being copied, and that the default dense expansion of a packed symmetric
+  //table is correct.
+  if (numProcs_ > 1) return(0);
+
+  RecordingFEData* recorder = new RecordingFEData(comm_);
+  fei::SharedPtr<FiniteElementData> fedata(recorder);
+  fei::SharedPtr<LibraryWrapper> wrapper(new LibraryWrapper(fedata));
+  fei::SharedPtr<FEI_Implementation>
+    fei(new FEI_Implementation(wrapper, comm_, 0));
+
+  int fieldID = 0, fieldSize = 1;
+  CHK_ERR( fei->initFields(1, &fieldSize, &fieldID) );
+
+  int numFieldsPerNode[2] = {1, 1};
+  int* nodalFieldIDs[2] = {&fieldID, &fieldID};
+  CHK_ERR( fei->initElemBlock(0, 2, 2, numFieldsPerNode, nodalFieldIDs,
+                              0, NULL, 0) );
+
+  GlobalID elemIDs[2] = {0, 1};
+  GlobalID conn[4] = {0, 1, 1, 2};
+  CHK_ERR( fei->initElem(0, elemIDs[0], &conn[0]) );
+  CHK_ERR( fei->initElem(0, elemIDs[1], &conn[2]) );
+  CHK_ERR( fei->initComplete() );
+
+  //upper triangle, stored by rows: [1 2; . 3]
+  double row0[2] = {1.0, 2.0};
+  double row1[1] = {3.0};
+  double* upper[2] = {row0, row1};
+  double load[2] = {1.0, 1.0};
+
+  CHK_ERR( fei->sumInElem(0, elemIDs[0], &conn[0], upper, load,
+                          FEI_UPPER_SYMM_ROW) );
+
+  if (recorder->inPlaceCoefs != upper) {
+    ERReturn(-1);
+  }
+
+  double correct[4] = {1.0, 2.0, 2.0, 3.0};
+  if (recorder->denseCoefs.size() != 4) ERReturn(-1);
+  for(int i=0; i<4; ++i) {
+    if (recorder->denseCoefs[i] != correct[i]) ERReturn(-1);
+  }
+
+  //two lower triangles, stored by rows back to back: [4 .; 5 6], [7 .; 8 9]
+  double packed[6] = {4.0, 5.0, 6.0, 7.0, 8.0, 9.0};
+  double loads[4] = {1.0, 1.0, 1.0, 1.0};
+  CHK_ERR( fei->sumInElemBlockMatrix(0, 2, elemIDs, conn, packed, loads,
+                                     FEI_LOWER_SYMM_ROW) );
+
+  if (recorder->batchCoefs != packed) {
+    ERReturn(-1);
+  }
+
+  //the second element's table was the last one expanded
+  double correct2[4] = {7.0, 8.0, 8.0, 9.0};
+  if (recorder->denseCoefs.size() != 4) ERReturn(-1);
+  for(int i=0; i<4; ++i) {
+    if (recorder->denseCoefs[i] != correct2[i]) ERReturn(-1);
+  }
+
   return(0);
 }
 
 int test_FEI_Implementation::test4()
 {
+  //check that sumInElemBlockMatrix through LinSysCoreFilter assembles the
+  //same matrix and rhs as per-element sumInElem, including contributions to
+  //shared nodes that are owned by another processor.
+#ifdef HAVE_FEI_AZTECOO
+  const int numLocalElems = 5;
+  int firstElem = localProc_*numLocalElems;
+  int fieldID = 0, fieldSize = 1;
+
+  std::vector<GlobalID> elemIDs(numLocalElems);
+  std::vector<GlobalID> conn(2*numLocalElems);
+  std::vector<double> stiff(4*numLocalElems);
+  std::vector<double> loads(2*numLocalElems);
+  for(int i=0; i<numLocalElems; ++i) {
+    int e = firstElem + i;
+    elemIDs[i] = e;
+    conn[2*i] = e;
+    conn[2*i+1] = e+1;
+    //non-symmetric, so that a transposed table would be detected.
+    stiff[4*i] = 2.0+e;  stiff[4*i+1] = -1.0;
+    stiff[4*i+2] = -0.5; stiff[4*i+3] = 1.0+0.1*e;
+    loads[2*i] = 1.0+e;  loads[2*i+1] = 0.5;
+  }
+
+  std::vector<GlobalID> sharedNodes;
+  std::vector<int> sharingProcs;
+  if (localProc_ > 0) {
+    sharedNodes.push_back(firstElem);
+    sharingProcs.push_back(localProc_-1);
+  }
+  if (localProc_ < numProcs_-1) {
+    sharedNodes.push_back(firstElem+numLocalElems);
+    sharingProcs.push_back(localProc_+1);
+  }
+  std::vector<int> numProcsPerNode(sharedNodes.size(), 1);
+  std::vector<int*> sharingProcs2D(sharedNodes.size());
+  for(unsigned i=0; i<sharedNodes.size(); ++i) {
+    sharingProcs2D[i] = &sharingProcs[i];
+  }
+
+  fei::SharedPtr<LinearSystemCore> linSys[2];
+  fei::SharedPtr<FEI_Implementation> feis[2];
+  for(int k=0; k<2; ++k) {
+    linSys[k].reset(new fei_trilinos::Aztec_LinSysCore(comm_));
+    fei::SharedPtr<LibraryWrapper> wrapper(new LibraryWrapper(linSys[k]));
+    feis[k].reset(new FEI_Implementation(wrapper, comm_, 0));
+    FEI_Implementation* fei = feis[k].get();
+
+    CHK_ERR( fei->initFields(1, &fieldSize, &fieldID) );
+
+    int numFieldsPerNode[2] = {1, 1};
+    int* nodalFieldIDs[2] = {&fieldID, &fieldID};
+    CHK_ERR( fei->initElemBlock(0, numLocalElems, 2, numFieldsPerNode,
+                                nodalFieldIDs, 0, NULL, 0) );
+
+    for(int i=0; i<numLocalElems; ++i) {
+      CHK_ERR( fei->initElem(0, elemIDs[i], &conn[2*i]) );
+    }
+
+    if (sharedNodes.size() > 0) {
+      CHK_ERR( fei->initSharedNodes(sharedNodes.size(), &sharedNodes[0],
+                                    &numProcsPerNode[0], &sharingProcs2D[0]) );
+    }
+
+    CHK_ERR( fei->initComplete() );
+
+    if (k == 0) {
+      for(int i=0; i<numLocalElems; ++i) {
+        double* stiffRows[2] = {&stiff[4*i], &stiff[4*i+2]};
+        CHK_ERR( fei->sumInElem(0, elemIDs[i], &conn[2*i], stiffRows,
+                                &loads[2*i], FEI_DENSE_ROW) );
+      }
+    }
+    else {
+      CHK_ERR( fei->sumInElemBlockMatrix(0, numLocalElems, &elemIDs[0],
+                                         &conn[0], &stiff[0], &loads[0],
+                                         FEI_DENSE_ROW) );
+    }
+
+    CHK_ERR( fei->loadComplete() );
+  }
+
+  //compare the locally-owned rows. Rows that aren't locally-owned are
+  //rejected by both linear-system-cores.
+  int numCompared = 0;
+  for(GlobalID node=firstElem; node<=firstElem+numLocalElems; ++node) {
+    int numEqns = 0, eqn = -1, len0 = -1, len1 = -1;
+    CHK_ERR( feis[0]->getEqnNumbers(node, FEI_NODE, fieldID, numEqns, &eqn) );
+    if (linSys[0]->getMatrixRowLength(eqn, len0) != 0) {
+      if (linSys[1]->getMatrixRowLength(eqn, len1) == 0) ERReturn(-1);
+      continue;
+    }
+    CHK_ERR( linSys[1]->getMatrixRowLength(eqn, len1) );
+    if (len0 != len1 || len0 < 1) ERReturn(-1);
+
+    std::vector<double> coefs0(len0), coefs1(len0);
+    std::vector<int> cols0(len0), cols1(len0);
+    int rowLength = 0;
+    CHK_ERR( linSys[0]->getMatrixRow(eqn, &coefs0[0], &cols0[0], len0, rowLength) );
+    CHK_ERR( linSys[1]->getMatrixRow(eqn, &coefs1[0], &cols1[0], len1, rowLength) );
+    for(int j=0; j<len0; ++j) {
+      if (cols0[j] != cols1[j]) ERReturn(-1);
+      double diff = coefs0[j] - coefs1[j];
+      if (diff > 1.e-14 || diff < -1.e-14) ERReturn(-1);
+    }
+
+    double rhs0 = 0.0, rhs1 = 0.0;
+    CHK_ERR( linSys[0]->getFromRHSVector(1, &rhs0, &eqn) );
+    CHK_ERR( linSys[1]->getFromRHSVector(1, &rhs1, &eqn) );
+    double diff = rhs0 - rhs1;
+    if (diff > 1.e-14 || diff < -1.e-14) ERReturn(-1);
+    ++numCompared;
+  }
+
+  if (numCompared < 1) ERReturn(-1);
+#endif
   return(0);
 }
@@ -14,12 +14,15 @@
 #include <test_utils/test_Matrix.hpp>
 #include <test_utils/test_VectorSpace.hpp>
 #include <test_utils/test_MatrixGraph.hpp>
+#include <test_utils/HexBeam.hpp>
 #include <fei_MatrixGraph_Impl2.hpp>
 #include <fei_Factory.hpp>
 #include <fei_defs.h>
 #include <snl_fei_Factory.hpp>
 #include <fei_Vector_Impl.hpp>
 #include <fei_Matrix_Impl.hpp>
+#include <fei_utils.hpp>
+#include <fei_impl_utils.hpp>
 
 #ifdef HAVE_FEI_AZTECOO
 #include <fei_Aztec_LinSysCore.hpp>
@@ -295,6 +298,8 @@ int test_Matrix::runtests()
 
   matrix_test1(mat);
 
+  CHK_ERR( test4() );
+
   if (localProc_==0) FEI_COUT << FEI_ENDL;
 
 #ifdef HAVE_FEI_AZTECOO
@@ -373,7 +378,7 @@ void test_Matrix::matrix_test1(fei::SharedPtr<fei::Matrix> mat)
     throw std::runtime_error("mat reports different num rows than vector-space eqns");
   }
 
-  std::vector<int> global_offsets;
+  std::vector<fei::GlobalOrdinal> global_offsets;
   rspace->getGlobalIndexOffsets(global_offsets);
 
   int my_num_rows = mat->getLocalNumRows();
@@ -431,7 +436,7 @@ int test_Matrix::serialtest1()
 
   fei::SharedPtr<fei::Matrix> matrixT(new fei::Matrix_Impl<fei::FillableMat>(ssmatT, matgraph, localsize));
 
-  std::vector<int> indices(numIDs);
+  std::vector<fei::GlobalOrdinal> indices(numIDs);
   CHK_ERR( matgraph->getConnectivityIndices(0, 0, numIDs, &indices[0], numIDs) );
 
   std::vector<double> data1(numIDs*numIDs);
@@ -492,7 +497,7 @@ int test_Matrix::serialtest2()
 
   fei::Matrix* matrixT = new fei::Matrix_Impl<fei::FillableMat>(ssmatT, matgraph, localsize);
 
-  std::vector<int> indices(numIDs);
+  std::vector<fei::GlobalOrdinal> indices(numIDs);
   CHK_ERR( matgraph->getConnectivityIndices(0, 0, numIDs, &indices[0], numIDs) );
 
   std::vector<double> data1(numIDs*numIDs);
@@ -582,7 +587,7 @@ int test_Matrix::serialtest3()
     ERReturn(-1);
   }
 
-  std::vector<int> indices(numIDs);
+  std::vector<fei::GlobalOrdinal> indices(numIDs);
   CHK_ERR( matgraph->getConnectivityIndices(0, 0, numIDs,
 					   &indices[0], numIDs) );
 
@@ -660,8 +665,8 @@ int test_Matrix::test3()
   int blockID=0;
   int numIndices = matrixGraphPtr->getConnectivityNumIndices(blockID);
 
-  std::vector<int> indicesArray(numIndices);
-  int* indicesPtr = &indicesArray[0];
+  std::vector<fei::GlobalOrdinal> indicesArray(numIndices);
+  fei::GlobalOrdinal* indicesPtr = &indicesArray[0];
 
   int checkNumIndices = 0;
   CHK_ERR( matrixGraphPtr->getConnectivityIndices(blockID, 0,
@@ -690,8 +695,125 @@ int test_Matrix::test3()
   return(0);
 }
 
+#ifdef HAVE_FEI_EPETRA
+double time_elem_assembly(fei::Matrix& A, HexBeam& hexcube,
+                          const double* const* elemMat2D, int numPasses)
+{
+  int blockID = 0;
+  int firstLocalElem = hexcube.firstLocalElem();
+  int numLocalElems = hexcube.numLocalElems();
+
+  double start_time = fei::utils::cpu_time();
+  for(int pass=0; pass<numPasses; ++pass) {
+    for(int i=0; i<numLocalElems; ++i) {
+      A.sumIn(blockID, firstLocalElem+i, elemMat2D, FEI_DENSE_ROW);
+    }
+  }
+  return( fei::utils::cpu_time() - start_time );
+}
+
+double time_epetra_assembly(Epetra_CrsMatrix& A, fei::MatrixGraph& mgraph,
+                            HexBeam& hexcube, const double* const* elemMat2D,
+                            int numPasses)
+{
+  int blockID = 0;
+  int firstLocalElem = hexcube.firstLocalElem();
+  int numLocalElems = hexcube.numLocalElems();
+  int len = mgraph.getConnectivityNumIndices(blockID);
+  std::vector<fei::GlobalOrdinal> eqns(len);
+  std::vector<int> indices(len);
+
+  double start_time = fei::utils::cpu_time();
+  for(int pass=0; pass<numPasses; ++pass) {
+    for(int i=0; i<numLocalElems; ++i) {
+      int numIndices = 0;
+      mgraph.getConnectivityIndices(blockID, firstLocalElem+i, len,
+                                    &eqns[0], numIndices);
+      //Epetra takes int global indices.
+      fei::impl_utils::copy_int_indices(eqns, indices);
+      for(int r=0; r<len; ++r) {
+        if (A.RowMap().MyGID(indices[r])) {
+          A.SumIntoGlobalValues(indices[r], len, (double*)elemMat2D[r],
+                                &indices[0]);
+        }
+      }
+    }
+  }
+  return( fei::utils::cpu_time() - start_time );
+}
+#endif
+
 int test_Matrix::test4()
 {
+#ifdef HAVE_FEI_EPETRA
+  //Element assembly into a filled Epetra_CrsMatrix: fei::Matrix::sumIn (which
+  //writes into the raw CSR arrays) vs. Epetra_CrsMatrix::SumIntoGlobalValues.
+  HexBeam hexcube(10, 20, 3, HexBeam::OneD, numProcs_, localProc_);
+
+  fei::SharedPtr<fei::Factory> factory(new Factory_Trilinos(comm_));
+
+  fei::SharedPtr<fei::VectorSpace> vspace =
+    factory->createVectorSpace(comm_, NULL);
+  int fieldID = 0, fieldSize = hexcube.numDofPerNode(), idType = 0;
+  vspace->defineFields(1, &fieldID, &fieldSize);
+  vspace->defineIDTypes(1, &idType);
+
+  fei::SharedPtr<fei::VectorSpace> dummy;
+  fei::SharedPtr<fei::MatrixGraph> mgraph =
+    factory->createMatrixGraph(vspace, dummy, NULL);
+
+  CHK_ERR( HexBeam_Functions::init_elem_connectivities(mgraph.get(), hexcube) );
+  CHK_ERR( mgraph->initComplete() );
+
+  fei::SharedPtr<fei::Matrix> A = factory->createMatrix(mgraph);
+  fei::Matrix_Impl<Epetra_CrsMatrix>* eA =
+    dynamic_cast<fei::Matrix_Impl<Epetra_CrsMatrix>*>(A.get());
+  if (eA == NULL) {
+    return(0);
+  }
+
+  int len = hexcube.numNodesPerElem()*fieldSize;
+  std::vector<double> elemMat(len*len);
+  std::vector<const double*> elemMat2D(len);
+  for(int j=0; j<len; ++j) elemMat2D[j] = &elemMat[j*len];
+  CHK_ERR( hexcube.getElemStiffnessMatrix(hexcube.firstLocalElem(),
+                                          &elemMat[0]) );
+
+  //the first assembly fills the matrix and optimizes its storage.
+  time_elem_assembly(*A, hexcube, &elemMat2D[0], 1);
+  CHK_ERR( A->gatherFromOverlap() );
+  CHK_ERR( A->globalAssemble() );
+
+  Epetra_CrsMatrix* emat = eA->getMatrix().get();
+  int numPasses = 5;
+
+  CHK_ERR( A->putScalar(0.0) );
+  double fei_time = time_elem_assembly(*A, hexcube, &elemMat2D[0], numPasses);
+
+  std::vector<double> fei_coefs((*emat)[0], (*emat)[0]+emat->NumMyNonzeros());
+
+  CHK_ERR( A->putScalar(0.0) );
+  double epetra_time = time_epetra_assembly(*emat, *mgraph, hexcube,
+                                            &elemMat2D[0], numPasses);
+
+  for(int k=0; k<emat->NumMyNonzeros(); ++k) {
+    double coef = (*emat)[0][k];
+    if (std::abs(coef - fei_coefs[k]) > 1.e-10*(std::abs(coef)+1.0)) {
+      FEI_COUT << "test_Matrix::test4: fei::Matrix::sumIn results differ "
+               << "from Epetra_CrsMatrix::SumIntoGlobalValues."<<FEI_ENDL;
+      ERReturn(-1);
+    }
+  }
+
+  if (localProc_ == 0) {
+    FEI_COUT << "  assembly of " << numPasses << "x" << hexcube.numLocalElems()
+             << " elements into a filled Epetra_CrsMatrix:" << FEI_ENDL
+             << "    fei::Matrix::sumIn: " << fei_time << " seconds" << FEI_ENDL
+             << "    Epetra_CrsMatrix::SumIntoGlobalValues: " << epetra_time
+             << " seconds" << FEI_ENDL;
+  }
+#endif
+
   return(0);
 }
 
@@ -255,7 +255,7 @@ int test_MatrixGraph::test1()
 
   CHK_ERR( matrixGraphPtr->initComplete() );
 
-  std::vector<int> globalIndexOffsets;
+  std::vector<fei::GlobalOrdinal> globalIndexOffsets;
 
   vectorSpace.getGlobalIndexOffsets(globalIndexOffsets);
 
@@ -288,7 +288,7 @@ int test_MatrixGraph::test1()
     ERReturn(-1);
   }
 
-  std::vector<int>& nonzeros = localgraph->packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& nonzeros = localgraph->packedColumnIndices;
 
   int offset = 0;
   for(int i=0; i<numLocalRows; ++i) {
@@ -369,7 +369,7 @@ int test_MatrixGraph::test3()
 
   CHK_ERR( matrixGraphPtr->initComplete() );
 
-  std::vector<int> globalIndexOffsets;
+  std::vector<fei::GlobalOrdinal> globalIndexOffsets;
 
   vectorSpace.getGlobalIndexOffsets(globalIndexOffsets);
 
@@ -405,7 +405,7 @@ int test_MatrixGraph::test3()
     ERReturn(-1);
   }
 
-  std::vector<int>& nonzeros = localgraph->packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& nonzeros = localgraph->packedColumnIndices;
 
   std::vector<int> rowindices;
   int offset = 0;
@@ -463,7 +463,7 @@ int test_MatrixGraph::test4()
 
   CHK_ERR( matrixGraphPtr->initComplete() );
 
-  std::vector<int> globalIndexOffsets;
+  std::vector<fei::GlobalOrdinal> globalIndexOffsets;
 
   vectorSpace.getGlobalIndexOffsets(globalIndexOffsets);
 
@@ -496,7 +496,7 @@ int test_MatrixGraph::test4()
     ERReturn(-1);
   }
 
-  std::vector<int>& nonzeros = localgraph->packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& nonzeros = localgraph->packedColumnIndices;
 
   int offset = 0;
   for(int i=0; i<numLocalRows; ++i) {
@@ -586,7 +586,7 @@ int test_MatrixGraph::test5()
   fei::SharedPtr<fei::VectorSpace> reducedSolnSpacePtr =
     matrixGraphPtr->getRowSpace();
 
-  std::vector<int> globalIndexOffsets;
+  std::vector<fei::GlobalOrdinal> globalIndexOffsets;
 
   reducedSolnSpacePtr->getGlobalIndexOffsets(globalIndexOffsets);
 
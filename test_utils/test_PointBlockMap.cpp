@@ -58,7 +58,8 @@ int test_PointBlockMap::test1()
     ERReturn(-1);
   }
 
-  int blkSize, ptEqn;
+  int blkSize;
+  fei::GlobalOrdinal ptEqn;
   CHK_ERR( pbMap.getBlkEqnInfo(1, ptEqn, blkSize) );
   if (ptEqn != 3) {
     ERReturn(-1);
@@ -67,7 +68,7 @@ int test_PointBlockMap::test1()
     ERReturn(-1);
   }
 
-  int blkEqn = pbMap.eqnToBlkEqn(4);
+  fei::GlobalOrdinal blkEqn = pbMap.eqnToBlkEqn(4);
   if (blkEqn != 1) {
     ERReturn(-1);
   }
@@ -113,9 +114,11 @@ int test_PointBlockMap::test2()
   CHK_ERR( pbMap.setBlkEqnSize(1, 2) );
   CHK_ERR( pbMap.setBlkEqnSize(2, 1) );
 
-  std::map<int,std::pair<int,int> >* blkEqns = pbMap.getBlkEqns();
+  typedef std::map<fei::GlobalOrdinal,std::pair<fei::GlobalOrdinal,int> >
+    blkeqn_map;
+  blkeqn_map* blkEqns = pbMap.getBlkEqns();
 
-  std::map<int,std::pair<int,int> >::const_iterator
+  blkeqn_map::const_iterator
     iter = blkEqns->begin(),
     iter_end = blkEqns->end();
 
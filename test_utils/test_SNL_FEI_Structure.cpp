@@ -13,6 +13,7 @@
 #include <test_utils/test_SNL_FEI_Structure.hpp>
 
 #include <SNL_FEI_Structure.hpp>
+#include <fei_BlockDescriptor.hpp>
 
 #include <test_utils/testData.hpp>
 
@@ -121,6 +122,22 @@ int test_SNL_FEI_Structure::test1()
   CHK_ERR( structure.getMatrixStructure(&colIndPtrs[0],
 					rowLengths) );
 
+  //the packed structure served without copying must match the copy.
+  std::vector<int*> packedColIndPtrs;
+  std::vector<int> packedRowLengths;
+  CHK_ERR( structure.getMatrixStructure(packedColIndPtrs, packedRowLengths) );
+
+  if (packedRowLengths != rowLengths) {
+    ERReturn(-1);
+  }
+
+  for(size_t j=0; j<rowLengths.size(); ++j) {
+    for(int k=0; k<rowLengths[j]; ++k) {
+      if (packedColIndPtrs[j][k] != colIndPtrs[j][k]) ERReturn(-1);
+      if (k > 0 && colIndPtrs[j][k] <= colIndPtrs[j][k-1]) ERReturn(-1);
+    }
+  }
+
   delete testdata;
 
   return(0);
@@ -221,10 +238,138 @@ int test_SNL_FEI_Structure::test2()
 
 int test_SNL_FEI_Structure::test3()
 {
+  //Check that scatter-indices served from the per-block cache are the same
+  //as those computed from the node descriptors.
+  testData* testdata = new testData(localProc_, numProcs_);
+
+  SNL_FEI_Structure structure(comm_);
+  SNL_FEI_Structure cachedStructure(comm_);
+  SNL_FEI_Structure* structs[2] = {&structure, &cachedStructure};
+
+  int numNodesPerElem = testdata->ids.size();
+  std::vector<int> numFieldsPerNode(numNodesPerElem, 1);
+  std::vector<int*>nodalFieldIDs(numNodesPerElem, &(testdata->fieldIDs[0]));
+
+  std::vector<int*> sharingProcs2D(testdata->sharedIDs.size());
+  int i, offset = 0;
+  for(i=0; i<(int)testdata->numSharingProcsPerID.size(); ++i) {
+    sharingProcs2D[i] = &(testdata->sharingProcs[offset]);
+    offset += testdata->numSharingProcsPerID[i];
+  }
+
+  for(int s=0; s<2; ++s) {
+    CHK_ERR( structs[s]->initFields(testdata->fieldIDs.size(),
+                                    &(testdata->fieldSizes[0]),
+                                    &(testdata->fieldIDs[0])) );
+
+    CHK_ERR( structs[s]->initElemBlock(0, //blockID
+                                       1, //numElements
+                                       numNodesPerElem,
+                                       &numFieldsPerNode[0],
+                                       &nodalFieldIDs[0],
+                                       0, //numElemDofFieldsPerElement
+                                       NULL, //elemDofFieldIDs
+                                       0)); //interleaveStrategy
+
+    CHK_ERR( structs[s]->initElem(0, //blockID
+                                  0, //elemID
+                                  &(testdata->ids[0])) );
+
+    if (testdata->sharedIDs.size() > 0) {
+      CHK_ERR( structs[s]->initSharedNodes(testdata->sharedIDs.size(),
+        testdata->sharedIDs.size() ? &(testdata->sharedIDs[0]) : 0,
+        testdata->numSharingProcsPerID.size() ? &(testdata->numSharingProcsPerID[0]) : 0,
+        &sharingProcs2D[0]) );
+    }
+  }
+
+  CHK_ERR( cachedStructure.setScatterIndexCaching(0, true) );
+
+  CHK_ERR( structure.initComplete() );
+  CHK_ERR( cachedStructure.initComplete() );
+
+  if (structure.getScatterIndexCacheMemory(0) != 0) {
+    ERReturn(-1);
+  }
+
+  if (cachedStructure.getScatterIndexCacheMemory(0) == 0) {
+    ERReturn(-1);
+  }
+
+  BlockDescriptor* block = NULL;
+  CHK_ERR( structure.getBlockDescriptor(0, block) );
+  int numEqns = block->getNumEqnsPerElement();
+  int numBlkEqns = block->getNumBlkEqnsPerElement();
+
+  std::vector<int> indices(numEqns), blkIndices(numBlkEqns), blkSizes(numBlkEqns);
+  std::vector<int> cIndices(numEqns), cBlkIndices(numBlkEqns), cBlkSizes(numBlkEqns);
+
+  structure.getScatterIndices_ID(0, 0, 0, &indices[0],
+                                 &blkIndices[0], &blkSizes[0]);
+  cachedStructure.getScatterIndices_ID(0, 0, 0, &cIndices[0],
+                                       &cBlkIndices[0], &cBlkSizes[0]);
+
+  if (indices != cIndices || blkIndices != cBlkIndices ||
+      blkSizes != cBlkSizes) {
+    ERReturn(-1);
+  }
+
+  cachedStructure.getScatterIndices_ID(0, 0, 0, &cIndices[0]);
+  if (indices != cIndices) {
+    ERReturn(-1);
+  }
+
+  delete testdata;
+
   return(0);
 }
 
 int test_SNL_FEI_Structure::test4()
 {
+  //Check the NodeDatabase's sorted nodeID index when IDs are initialized
+  //out of order and repeatedly (as they are by element connectivities), and
+  //NodeDescriptor's field lists when they outgrow the inline storage.
+  std::map<int,int> fieldDB;
+  NodeDatabase nodeDB(&fieldDB, NULL);
+
+  int numIDs = 3000;
+  for(int pass=0; pass<3; ++pass) {
+    for(int i=0; i<numIDs; ++i) {
+      GlobalID id = (GlobalID)((i*7919)%numIDs)*2;
+      CHK_ERR( nodeDB.initNodeID(id) );
+    }
+  }
+
+  if (nodeDB.getNumNodeDescriptors() != numIDs) ERReturn(-1);
+
+  const std::vector<GlobalID>& nodeIDs = nodeDB.getNodeIDs();
+  for(int i=0; i<numIDs; ++i) {
+    if (nodeIDs[i] != (GlobalID)i*2) ERReturn(-1);
+
+    const NodeDescriptor* node = NULL;
+    nodeDB.getNodeAtIndex(i, node);
+    if (node == NULL || node->getGlobalNodeID() != nodeIDs[i]) ERReturn(-1);
+
+    if (nodeDB.getIndexOfID(nodeIDs[i]) != i) ERReturn(-1);
+    if (nodeDB.getIndexOfID(nodeIDs[i]+1) != -1) ERReturn(-1);
+  }
+
+  NodeDescriptor* node = NULL;
+  CHK_ERR( nodeDB.getNodeWithID(10, node) );
+
+  int numFields = 8;
+  for(int f=numFields-1; f>=0; --f) {
+    node->addField(f*3);
+    node->addField(f*3);
+    node->setFieldEqnNumber(f*3, 100+f);
+  }
+
+  if (node->getNumFields() != numFields) ERReturn(-1);
+  for(int f=0; f<numFields; ++f) {
+    if (node->getFieldIDList()[f] != f*3) ERReturn(-1);
+    int eqn = -1;
+    if (!node->getFieldEqnNumber(f*3, eqn) || eqn != 100+f) ERReturn(-1);
+  }
+
   return(0);
 }
@@ -85,7 +85,7 @@ void test_Vector::vector_test1(fei::SharedPtr<fei::Vector> fei_vec)
 
   fei::SharedPtr<fei::VectorSpace> vspace = fei_vec->getVectorSpace();
 
-  std::vector<int> global_offsets;
+  std::vector<fei::GlobalOrdinal> global_offsets;
   vspace->getGlobalIndexOffsets(global_offsets);
 
   int i, my_first_offset = global_offsets[localProc_];
@@ -94,7 +94,7 @@ void test_Vector::vector_test1(fei::SharedPtr<fei::Vector> fei_vec)
 
   std::vector<double> coefs(num_local_indices, 1.0);
   std::vector<double> check_coefs(num_local_indices);
-  std::vector<int> indices(num_local_indices);
+  std::vector<fei::GlobalOrdinal> indices(num_local_indices);
   for(i=0; i<num_local_indices; ++i) {
     indices[i] = my_first_offset + i;
   }
@@ -71,7 +71,7 @@ int test_VectorSpace::test0()
 
   CHK_ERR( vspace.initComplete() );
 
-  std::vector<int> globalIndexOffsets;
+  std::vector<fei::GlobalOrdinal> globalIndexOffsets;
 
   vspace.getGlobalIndexOffsets(globalIndexOffsets);
 
@@ -106,7 +106,7 @@ int test_VectorSpace::test1()
 
   fei::VectorSpace& vectorSpace = *vectorSpacePtr;
 
-  std::vector<int> globalOffsets;
+  std::vector<fei::GlobalOrdinal> globalOffsets;
 
   vectorSpace.getGlobalIndexOffsets(globalOffsets);
 
@@ -133,11 +133,11 @@ int test_VectorSpace::test1()
   }
 
   int len = ids.size();
-  int globalIndex = 0;
+  fei::GlobalOrdinal globalIndex = 0;
   CHK_ERR( vectorSpace.getGlobalIndex(idTypes[0], ids[0], fieldIDs[0],
 				    0, 0, globalIndex) );
 
-  int correctIndex = globalOffsets[localProc_];
+  fei::GlobalOrdinal correctIndex = globalOffsets[localProc_];
   int correctBlkIndex = globalBlkOffsets[localProc_];
   if (localProc_ != 0) correctIndex -= 2*numDOFsPerID;
   if (localProc_ != 0) correctBlkIndex -= 2;
@@ -210,7 +210,8 @@ int test_VectorSpace::test1()
     ERReturn(-1);
   }
 
-  std::vector<int> globalIndices(ids.size()*numDOFsPerID);
+  std::vector<fei::GlobalOrdinal> globalIndices(ids.size()*numDOFsPerID);
+  std::vector<int> globalBlkIndices(ids.size());
 
   CHK_ERR( vectorSpace.getGlobalIndices(ids.size(),
 					&(ids[0]),
@@ -228,7 +229,7 @@ int test_VectorSpace::test1()
   CHK_ERR( vectorSpace.getGlobalBlkIndices(ids.size(),
 					   &ids[0],
 					   idTypes[0],
-					   &globalIndices[0] ));
+					   &globalBlkIndices[0] ));
 
   CHK_ERR( vectorSpace.getGlobalIndices(ids.size(),
 					&ids[0],
@@ -337,8 +338,8 @@ int test_VectorSpace::test3()
 
   CHK_ERR( copy->initComplete() );
 
-  std::vector<int> globalOffsets;
-  std::vector<int> globalOffsetsCopy;
+  std::vector<fei::GlobalOrdinal> globalOffsets;
+  std::vector<fei::GlobalOrdinal> globalOffsetsCopy;
 
   vectorSpacePtr->getGlobalIndexOffsets(globalOffsets);
 
@@ -15,6 +15,16 @@
 #include <snl_fei_RaggedTable.hpp>
 #include <snl_fei_RaggedTable_specialize.hpp>
 #include <test_utils/HexBeam.hpp>
+#include <fei_impl_utils.hpp>
+#include <fei_ArrayUtils.hpp>
+#include <fei_Reducer.hpp>
+#include <fei_VectorSpace.hpp>
+#include <fei_MatrixGraph_Impl2.hpp>
+#include <fei_Matrix_Local.hpp>
+#include <fei_Matrix_LocalBlock.hpp>
+#include <fei_Vector_Local.hpp>
+
+#include <cmath>
 
 #undef fei_file
 #define fei_file "test_benchmarks.cpp"
@@ -42,6 +52,7 @@ double time_raggedtable_insert(int len)
   int numIndices = hexcube.numNodesPerElem();
 
   int* indices = new int[numIndices];
+  std::vector<typename MAP_TYPE::key_type> keys(numIndices);
 
   int first = hexcube.firstLocalElem();
 
@@ -49,8 +60,9 @@ double time_raggedtable_insert(int len)
     int elem = first+n;
 
     hexcube.getElemConnectivity(elem, indices);
+    std::copy(indices, indices+numIndices, keys.begin());
 
-    table.addIndices(numIndices, indices, numIndices, indices);
+    table.addIndices(numIndices, &keys[0], numIndices, &keys[0]);
   }
 
   delete [] indices;
@@ -207,7 +219,9 @@ int test_benchmarks::test1()
 
 
   testname = add_macro_values("snl_fei::MapContig<fei::ctg_set>");
-  value = benchmark_raggedtable<snl_fei::MapContig<fei::ctg_set<int>*>,fei::ctg_set<int> >();
+  value = benchmark_raggedtable<
+    snl_fei::MapContig<fei::ctg_set<fei::GlobalOrdinal>*>,
+    fei::ctg_set<fei::GlobalOrdinal> >();
   try {
     goldvalue = fei_test_utils::get_file_benchmark("./fei_utest_timings.txt",
 					    testname.c_str());
@@ -473,23 +487,510 @@ int test_benchmarks::test3()
   return(0);
 }
 
+//Build the graph of trilinear hex elements (a 27-point stencil) on an
+//n x n x n grid of nodes, one scalar per node, in compressed-row form.
+void build_hex_stencil_csr(int n,
+                           std::vector<fei::GlobalOrdinal>& rowNumbers,
+                           std::vector<int>& rowOffsets,
+                           std::vector<fei::GlobalOrdinal>& colIndices,
+                           std::vector<double>& coefs)
+{
+  int numRows = n*n*n;
+  rowNumbers.resize(numRows);
+  rowOffsets.assign(1, 0);
+  colIndices.clear();
+
+  for(int k=0; k<n; ++k) {
+    for(int j=0; j<n; ++j) {
+      for(int i=0; i<n; ++i) {
+        int row = (k*n+j)*n+i;
+        rowNumbers[row] = row;
+        for(int kk=k-1; kk<=k+1; ++kk) {
+          if (kk < 0 || kk >= n) continue;
+          for(int jj=j-1; jj<=j+1; ++jj) {
+            if (jj < 0 || jj >= n) continue;
+            for(int ii=i-1; ii<=i+1; ++ii) {
+              if (ii < 0 || ii >= n) continue;
+              colIndices.push_back((kk*n+jj)*n+ii);
+            }
+          }
+        }
+        rowOffsets.push_back(colIndices.size());
+      }
+    }
+  }
+
+  coefs.resize(colIndices.size());
+  for(int r=0; r<numRows; ++r) {
+    for(int jj=rowOffsets[r]; jj<rowOffsets[r+1]; ++jj) {
+      coefs[jj] = colIndices[jj] == r ? 26.0 : -1.0;
+    }
+  }
+}
+
+//Enforce bcs the way the row-by-row path in snl_fei::LinearSystem_General
+//does: copy each row out, binary-search every column in the bc list, copy
+//the row back. (Without the virtual-call overhead of the fei::Matrix
+//interface, so this understates the cost of the real thing.)
+void enforce_bcs_row_by_row(int numRows,
+                            const fei::GlobalOrdinal* rowNumbers,
+                            const int* rowOffsets,
+                            const fei::GlobalOrdinal* colIndices,
+                            double* coefs,
+                            int numBCs, const fei::GlobalOrdinal* bcEqns,
+                            const double* bcVals,
+                            std::vector<double>& rhs)
+{
+  std::vector<fei::GlobalOrdinal> indices;
+  std::vector<double> rowcoefs;
+
+  for(int i=0; i<numRows; ++i) {
+    fei::GlobalOrdinal row = rowNumbers[i];
+    int len = rowOffsets[i+1]-rowOffsets[i];
+    indices.assign(colIndices+rowOffsets[i], colIndices+rowOffsets[i+1]);
+    rowcoefs.assign(coefs+rowOffsets[i], coefs+rowOffsets[i+1]);
+
+    if (fei::binarySearch(row, bcEqns, numBCs) >= 0) {
+      for(int j=0; j<len; ++j) {
+        rowcoefs[j] = indices[j] == row ? 1.0 : 0.0;
+      }
+    }
+    else {
+      double value = 0.0;
+      for(int j=0; j<len; ++j) {
+        int offset = fei::binarySearch(indices[j], bcEqns, numBCs);
+        if (offset > -1) {
+          value -= bcVals[offset]*rowcoefs[j];
+          rowcoefs[j] = 0.0;
+        }
+      }
+      rhs[i] += value;
+    }
+
+    std::copy(rowcoefs.begin(), rowcoefs.end(), coefs+rowOffsets[i]);
+  }
+}
+
 int test_benchmarks::test4()
 {
+  FEI_COUT << FEI_ENDL
+    << "Essential-BC elimination on a 27-point stencil matrix: row-by-row"<<FEI_ENDL
+    << "(copy-out/binary-search/copy-in) vs. single-pass CSR kernel"<<FEI_ENDL
+    << "(fei::impl_utils::apply_essential_bcs_csr). Times in seconds."
+    << FEI_ENDL << FEI_ENDL;
+
+  int n = 40;
+  std::vector<fei::GlobalOrdinal> rowNumbers, colIndices;
+  std::vector<int> rowOffsets;
+  std::vector<double> coefs0;
+  build_hex_stencil_csr(n, rowNumbers, rowOffsets, colIndices, coefs0);
+  int numRows = rowNumbers.size();
+
+  FEI_COUT << "  numRows: " << numRows << ", nnz: " << coefs0.size()
+           << FEI_ENDL << FEI_ENDL;
+
+  FEI_COUT.width(12);
+  FEI_COUT << "bc fraction";
+  FEI_COUT.width(14);
+  FEI_COUT << "row-by-row";
+  FEI_COUT.width(14);
+  FEI_COUT << "csr kernel";
+  FEI_COUT.width(10);
+  FEI_COUT << "ratio" << FEI_ENDL;
+
+  const int percents[] = {1, 10, 30};
+  for(int p=0; p<3; ++p) {
+    //spread the bc eqns evenly through the matrix
+    std::vector<fei::GlobalOrdinal> bcEqns;
+    std::vector<double> bcVals;
+    int stride = 100/percents[p];
+    for(int r=0; r<numRows; r+=stride) {
+      bcEqns.push_back(r);
+      bcVals.push_back(1.0);
+    }
+    int numBCs = bcEqns.size();
+
+    std::vector<double> coefs(coefs0);
+    std::vector<double> rhs(numRows, 0.0);
+    double start_time = fei::utils::cpu_time();
+    enforce_bcs_row_by_row(numRows, &rowNumbers[0], &rowOffsets[0],
+                           &colIndices[0], &coefs[0],
+                           numBCs, &bcEqns[0], &bcVals[0], rhs);
+    double rowwise_time = fei::utils::cpu_time() - start_time;
+
+    std::vector<double> coefs2(coefs0);
+    std::vector<double> rhs2(numRows, 0.0);
+    start_time = fei::utils::cpu_time();
+    fei::impl_utils::apply_essential_bcs_csr(numRows, &rowNumbers[0],
+                                             &rowOffsets[0], &colIndices[0],
+                                             &coefs2[0],
+                                             numBCs, &bcEqns[0], &bcVals[0],
+                                             true, &rhs2[0]);
+    double kernel_time = fei::utils::cpu_time() - start_time;
+
+    if (coefs != coefs2 || rhs != rhs2) {
+      FEI_COUT << "bc-elimination kernel results differ from row-by-row results."
+               << FEI_ENDL;
+      return(-1);
+    }
+
+    FEI_COUT.setf(IOS_FIXED, IOS_FLOATFIELD);
+    FEI_COUT.precision(4);
+    FEI_COUT.width(11);
+    FEI_COUT << percents[p] << "%";
+    FEI_COUT.width(14);
+    FEI_COUT << rowwise_time;
+    FEI_COUT.width(14);
+    FEI_COUT << kernel_time;
+    FEI_COUT.precision(1);
+    FEI_COUT.width(10);
+    FEI_COUT << (kernel_time > 0.0 ? rowwise_time/kernel_time : 0.0) << FEI_ENDL;
+  }
+
+  FEI_COUT << FEI_ENDL;
+
   return(0);
 }
 
+//Translate every non-slave column index of the matrix to the reduced
+//space, the way fei::Reducer::addMatrixValues does for each entry.
+double time_reduced_eqn_translation(
+                           const fei::Reducer& reducer,
+                           const std::vector<fei::GlobalOrdinal>& colIndices,
+                           int numPasses,
+                           long& checksum)
+{
+  double start_time = fei::utils::cpu_time();
+
+  for(int pass=0; pass<numPasses; ++pass) {
+    for(size_t j=0; j<colIndices.size(); ++j) {
+      fei::GlobalOrdinal col = colIndices[j];
+      if (reducer.isSlaveEqn(col)) continue;
+      checksum += reducer.translateToReducedEqn(col);
+    }
+  }
+
+  return(fei::utils::cpu_time() - start_time);
+}
+
 int test_benchmarks::test5()
 {
+  FEI_COUT << FEI_ENDL
+    << "Unreduced-to-reduced eqn translation (fei::Reducer::isSlaveEqn +"<<FEI_ENDL
+    << "translateToReducedEqn) for each column entry of a 27-point stencil"<<FEI_ENDL
+    << "matrix: binary search of the slave list vs. dense translation table."
+    << FEI_ENDL << FEI_ENDL;
+
+  int n = 30;
+  std::vector<fei::GlobalOrdinal> rowNumbers, colIndices;
+  std::vector<int> rowOffsets;
+  std::vector<double> coefs;
+  build_hex_stencil_csr(n, rowNumbers, rowOffsets, colIndices, coefs);
+  int numRows = rowNumbers.size();
+
+  //every 20th eqn is a slave of the eqn before it.
+  fei::SharedPtr<fei::FillableMat> D(new fei::FillableMat);
+  for(int r=1; r<numRows; r+=20) {
+    D->putCoef(r, r-1, 1.0);
+  }
+  fei::SharedPtr<fei::CSVec> g;
+
+  //Without local eqns the reducer has no translation table, so every
+  //translation is a binary search, as before the table was introduced.
+  fei::Reducer searchReducer(D, g, comm_);
+
+  fei::Reducer tableReducer(D, g, comm_);
+  tableReducer.setLocalUnreducedEqns(rowNumbers);
+
+  int numPasses = 10;
+  long checksum1 = 0, checksum2 = 0;
+  double search_time = time_reduced_eqn_translation(searchReducer, colIndices,
+                                                    numPasses, checksum1);
+  double table_time = time_reduced_eqn_translation(tableReducer, colIndices,
+                                                   numPasses, checksum2);
+
+  if (checksum1 != checksum2) {
+    FEI_COUT << "reduced eqn translation results differ."<<FEI_ENDL;
+    return(-1);
+  }
+
+  double numEntries = (double)colIndices.size()*numPasses;
+
+  FEI_COUT << "  numRows: " << numRows << ", numSlaves: " << D->getNumRows()
+           << ", entries translated: " << colIndices.size()*numPasses
+           << FEI_ENDL;
+  FEI_COUT.setf(IOS_FIXED, IOS_FLOATFIELD);
+  FEI_COUT.precision(2);
+  FEI_COUT << "  binary search: " << 1.e+9*search_time/numEntries
+           << " ns/entry" << FEI_ENDL;
+  FEI_COUT << "  table lookup:  " << 1.e+9*table_time/numEntries
+           << " ns/entry" << FEI_ENDL << FEI_ENDL;
+
   return(0);
 }
 
+//y = A*x with one accumulator per row, the way the CSR matvecs were
+//written before fei::impl_utils::csr_matvec.
+void csr_matvec_reference(int numRows,
+                          const int* rowOffsets,
+                          const int* colIndices,
+                          const double* coefs,
+                          const double* x,
+                          double* y)
+{
+  for(int i=0; i<numRows; ++i) {
+    double sum = 0.0;
+    for(int k=rowOffsets[i]; k<rowOffsets[i+1]; ++k) {
+      sum += coefs[k]*x[colIndices[k]];
+    }
+    y[i] = sum;
+  }
+}
+
+void print_matvec_rate(const char* name, double seconds, int numPasses,
+                       double flopsPerPass, double bytesPerPass)
+{
+  double gflops = 1.e-9*flopsPerPass*numPasses/seconds;
+  double gbytes = 1.e-9*bytesPerPass*numPasses/seconds;
+
+  FEI_COUT.setf(IOS_FIXED, IOS_FLOATFIELD);
+  FEI_COUT.precision(3);
+  FEI_COUT.width(30);
+  FEI_COUT << name;
+  FEI_COUT.width(12);
+  FEI_COUT << gflops;
+  FEI_COUT.width(12);
+  FEI_COUT << gbytes << FEI_ENDL;
+}
+
 int test_benchmarks::test6()
 {
+  FEI_COUT << FEI_ENDL
+    << "Sparse matrix-vector product on a HexBeam stiffness matrix (3 dof"<<FEI_ENDL
+    << "per node): reference one-accumulator CSR loop vs."<<FEI_ENDL
+    << "fei::impl_utils::csr_matvec vs. fei::Matrix_Local::multiply."<<FEI_ENDL
+    << "Bandwidth counts each matrix entry, row offset and vector entry once."
+    << FEI_ENDL << FEI_ENDL;
+
+  HexBeam hexcube(10, 100, 3, HexBeam::OneD, 1, 0);
+
+  fei::SharedPtr<fei::VectorSpace> vspace(new fei::VectorSpace(comm_));
+  int fieldID = 0, fieldSize = hexcube.numDofPerNode(), idType = 0;
+  vspace->defineFields(1, &fieldID, &fieldSize);
+  vspace->defineIDTypes(1, &idType);
+
+  fei::SharedPtr<fei::VectorSpace> dummy;
+  fei::SharedPtr<fei::MatrixGraph>
+    mgraph(new fei::MatrixGraph_Impl2(vspace, dummy));
+
+  CHK_ERR( HexBeam_Functions::init_elem_connectivities(mgraph.get(), hexcube) );
+  CHK_ERR( mgraph->initComplete() );
+
+  fei::SharedPtr<fei::Matrix> A =
+    fei::Matrix_Local::create_Matrix_Local(mgraph, false);
+  fei::SharedPtr<fei::Vector> x(new fei::Vector_Local(vspace));
+  fei::SharedPtr<fei::Vector> y(new fei::Vector_Local(vspace));
+
+  CHK_ERR( HexBeam_Functions::load_elem_data(mgraph.get(), A.get(),
+                                             y.get(), hexcube) );
+
+  fei::Matrix_Local* lA = dynamic_cast<fei::Matrix_Local*>(A.get());
+  const std::vector<int>& rowOffsets = lA->getRowOffsets();
+  //a single process owns every row, so the global column indices are also
+  //the local ones.
+  const std::vector<fei::GlobalOrdinal>& globalCols = lA->getColumnIndices();
+  std::vector<int> colWork;
+  const int* colIndices =
+    fei::impl_utils::int_indices(globalCols.size(), &globalCols[0], colWork);
+  const std::vector<double>& coefs = lA->getCoefs();
+  int numRows = lA->getLocalNumRows();
+
+  std::vector<double>& xcoefs =
+    dynamic_cast<fei::Vector_Local*>(x.get())->getCoefs();
+  std::vector<double>& ycoefs =
+    dynamic_cast<fei::Vector_Local*>(y.get())->getCoefs();
+  if ((int)xcoefs.size() != numRows) {
+    ERReturn(-1);
+  }
+  for(int i=0; i<numRows; ++i) xcoefs[i] = 1.0 + 0.001*(i%100);
+
+  double nnz = coefs.size();
+  double flopsPerPass = 2.0*nnz;
+  double bytesPerPass = nnz*(sizeof(double)+sizeof(int))
+                      + (numRows+1)*sizeof(int) + 2.0*numRows*sizeof(double);
+
+  FEI_COUT << "  numRows: " << numRows << ", nnz: " << coefs.size()
+           << FEI_ENDL << FEI_ENDL;
+  FEI_COUT.width(30);
+  FEI_COUT << "";
+  FEI_COUT.width(12);
+  FEI_COUT << "GFLOP/s";
+  FEI_COUT.width(12);
+  FEI_COUT << "GB/s" << FEI_ENDL;
+
+  std::vector<double> yref(numRows);
+  int numPasses = 50;
+
+  double start_time = fei::utils::cpu_time();
+  for(int pass=0; pass<numPasses; ++pass) {
+    csr_matvec_reference(numRows, &rowOffsets[0], &colIndices[0], &coefs[0],
+                         &xcoefs[0], &yref[0]);
+  }
+  double ref_time = fei::utils::cpu_time() - start_time;
+
+  std::vector<double> ykernel(numRows);
+  start_time = fei::utils::cpu_time();
+  for(int pass=0; pass<numPasses; ++pass) {
+    fei::impl_utils::csr_matvec(numRows, &rowOffsets[0], &rowOffsets[1],
+                                &colIndices[0], &coefs[0], &xcoefs[0],
+                                false, &ykernel[0]);
+  }
+  double kernel_time = fei::utils::cpu_time() - start_time;
+
+  //the first multiply sets up the column translation, so leave it out of
+  //the steady-state timing.
+  CHK_ERR( A->multiply(x.get(), y.get()) );
+
+  start_time = fei::utils::cpu_time();
+  for(int pass=0; pass<numPasses; ++pass) {
+    CHK_ERR( A->multiply(x.get(), y.get()) );
+  }
+  double matrix_time = fei::utils::cpu_time() - start_time;
+
+  for(int i=0; i<numRows; ++i) {
+    double tol = 1.e-12*(std::abs(yref[i]) + 1.0);
+    if (std::abs(ykernel[i] - yref[i]) > tol ||
+        std::abs(ycoefs[i] - yref[i]) > tol) {
+      FEI_COUT << "matvec results differ from reference results."<<FEI_ENDL;
+      return(-1);
+    }
+  }
+
+  print_matvec_rate("reference loop", ref_time, numPasses,
+                    flopsPerPass, bytesPerPass);
+  print_matvec_rate("impl_utils::csr_matvec", kernel_time, numPasses,
+                    flopsPerPass, bytesPerPass);
+  print_matvec_rate("Matrix_Local::multiply", matrix_time, numPasses,
+                    flopsPerPass, bytesPerPass);
+  FEI_COUT << FEI_ENDL;
+
   return(0);
 }
 
+double time_elem_assembly(fei::Matrix& A, HexBeam& hexcube,
+                          const double* const* elemMat2D)
+{
+  int blockID = 0;
+  int firstLocalElem = hexcube.firstLocalElem();
+  int numLocalElems = hexcube.numLocalElems();
+
+  double start_time = fei::utils::cpu_time();
+  for(int i=0; i<numLocalElems; ++i) {
+    A.sumIn(blockID, firstLocalElem+i, elemMat2D, FEI_DENSE_ROW);
+  }
+  return( fei::utils::cpu_time() - start_time );
+}
+
+double time_multiply(fei::Matrix& A, fei::Vector& x, fei::Vector& y,
+                     int numPasses)
+{
+  //the first multiply sets up the column translation.
+  A.multiply(&x, &y);
+
+  double start_time = fei::utils::cpu_time();
+  for(int pass=0; pass<numPasses; ++pass) {
+    A.multiply(&x, &y);
+  }
+  return( fei::utils::cpu_time() - start_time );
+}
+
 int test_benchmarks::test7()
 {
+  FEI_COUT << FEI_ENDL
+    << "Element assembly and matrix-vector product on a HexBeam stiffness"<<FEI_ENDL
+    << "matrix (3 dof per node): point-entry fei::Matrix_Local vs."<<FEI_ENDL
+    << "node-blocked fei::Matrix_LocalBlock." << FEI_ENDL << FEI_ENDL;
+
+  HexBeam hexcube(10, 100, 3, HexBeam::OneD, 1, 0);
+
+  fei::SharedPtr<fei::VectorSpace> vspace(new fei::VectorSpace(comm_));
+  int fieldID = 0, fieldSize = hexcube.numDofPerNode(), idType = 0;
+  vspace->defineFields(1, &fieldID, &fieldSize);
+  vspace->defineIDTypes(1, &idType);
+
+  fei::SharedPtr<fei::VectorSpace> dummy;
+  fei::SharedPtr<fei::MatrixGraph>
+    mgraph(new fei::MatrixGraph_Impl2(vspace, dummy));
+
+  CHK_ERR( HexBeam_Functions::init_elem_connectivities(mgraph.get(), hexcube) );
+  CHK_ERR( mgraph->initComplete() );
+
+  fei::SharedPtr<fei::Matrix> A =
+    fei::Matrix_Local::create_Matrix_Local(mgraph, false);
+  fei::SharedPtr<fei::Matrix> B =
+    fei::Matrix_LocalBlock::create_Matrix_LocalBlock(mgraph);
+
+  int len = hexcube.numNodesPerElem()*fieldSize;
+  std::vector<double> elemMat(len*len);
+  std::vector<const double*> elemMat2D(len);
+  for(int j=0; j<len; ++j) elemMat2D[j] = &elemMat[j*len];
+  CHK_ERR( hexcube.getElemStiffnessMatrix(hexcube.firstLocalElem(),
+                                          &elemMat[0]) );
+
+  double point_asm_time = time_elem_assembly(*A, hexcube, &elemMat2D[0]);
+  double block_asm_time = time_elem_assembly(*B, hexcube, &elemMat2D[0]);
+
+  fei::Matrix_Local* lA = dynamic_cast<fei::Matrix_Local*>(A.get());
+  fei::Matrix_LocalBlock* lB = dynamic_cast<fei::Matrix_LocalBlock*>(B.get());
+  int numRows = lA->getLocalNumRows();
+  int numBlkRows = lB->getBlkGraph().rowNumbers.size();
+  int nnz = lA->getCoefs().size();
+  int numBlks = lB->getBlkGraph().packedColumnIndices.size();
+
+  fei::Vector_Local x(vspace), yA(vspace), yB(vspace);
+  std::vector<double>& xcoefs = x.getCoefs();
+  for(size_t i=0; i<xcoefs.size(); ++i) xcoefs[i] = 1.0 + 0.001*(i%100);
+
+  int numPasses = 50;
+  double point_mv_time = time_multiply(*A, x, yA, numPasses);
+  double block_mv_time = time_multiply(*B, x, yB, numPasses);
+
+  std::vector<double>& ycoefsA = yA.getCoefs();
+  std::vector<double>& ycoefsB = yB.getCoefs();
+  for(size_t i=0; i<ycoefsA.size(); ++i) {
+    double tol = 1.e-12*(std::abs(ycoefsA[i]) + 1.0);
+    if (std::abs(ycoefsA[i] - ycoefsB[i]) > tol) {
+      FEI_COUT << "block matvec results differ from point results."<<FEI_ENDL;
+      return(-1);
+    }
+  }
+
+  double flopsPerPass = 2.0*nnz;
+  double pointBytes = 1.0*nnz*(sizeof(double)+sizeof(int))
+                    + (numRows+1)*sizeof(int) + 2.0*numRows*sizeof(double);
+  double blockBytes = 1.0*nnz*sizeof(double) + numBlks*sizeof(int)
+                    + (numBlkRows+1)*sizeof(int) + 2.0*numRows*sizeof(double);
+
+  FEI_COUT << "  numRows: " << numRows << ", nnz: " << nnz
+           << ", block-rows: " << numBlkRows << ", blocks: " << numBlks
+           << FEI_ENDL
+           << "  column-indices stored, point: " << nnz
+           << ", block: " << numBlks << FEI_ENDL
+           << "  assembly seconds, point: " << point_asm_time
+           << ", block: " << block_asm_time << FEI_ENDL << FEI_ENDL;
+
+  FEI_COUT.width(30);
+  FEI_COUT << "";
+  FEI_COUT.width(12);
+  FEI_COUT << "GFLOP/s";
+  FEI_COUT.width(12);
+  FEI_COUT << "GB/s" << FEI_ENDL;
+  print_matvec_rate("Matrix_Local::multiply", point_mv_time, numPasses,
+                    flopsPerPass, pointBytes);
+  print_matvec_rate("Matrix_LocalBlock::multiply", block_mv_time, numPasses,
+                    flopsPerPass, blockBytes);
+  FEI_COUT << FEI_ENDL;
+
   return(0);
 }
 
@@ -111,7 +111,7 @@ void test_Vector_1(fei::Vector& vec, Teuchos::FancyOStream& out, bool& success)
   int thisProc = fei::localProc(vspc->getCommunicator());
   size_t num_owned = thisProc==0 ? 4 : 2;
   num_owned *= 2;//field-size is 2
-  std::vector<int> indices;
+  std::vector<fei::GlobalOrdinal> indices;
   vspc->getIndices_Owned(indices);
   TEUCHOS_TEST_EQUALITY(indices.size(), num_owned, out, success);
 
@@ -83,7 +83,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSVec)
     throw std::runtime_error("CSRMat y=Ax test 1 failed.");
   }
 
-  std::vector<int>& y_ind = y.indices();
+  std::vector<fei::GlobalOrdinal>& y_ind = y.indices();
   std::vector<double>& y_coef = y.coefs();
 
   if (y_ind[1] != 1) {
@@ -104,7 +104,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSVec)
     throw std::runtime_error("CSRMat y=A^Tx test 1 failed.");
   }
 
-  std::vector<int>& y_ind2 = y.indices();
+  std::vector<fei::GlobalOrdinal>& y_ind2 = y.indices();
   std::vector<double>& y_coef2 = y.coefs();
 
   if (y_ind2[1] != 1) {
@@ -144,7 +144,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSRMat)
     throw std::runtime_error("CSRMAT C=AB test 1 failed.");
   }
 
-  std::vector<int>& cols = C.getGraph().packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& cols = C.getGraph().packedColumnIndices;
   std::vector<double>& coefs = C.getPackedCoefs();
 
   if (cols.size() != 5) {
@@ -197,7 +197,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSRMat)
     throw std::runtime_error("CSRMAT C=AB test 7 failed.");
   }
 
-  std::vector<int>& cols2 = C2.getGraph().packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& cols2 = C2.getGraph().packedColumnIndices;
   std::vector<double>& coefs2 = C2.getPackedCoefs();
 
   if (cols2.size() != 7) {
@@ -232,7 +232,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSRMat)
     throw std::runtime_error("CSRMAT C=A^TB test 1 failed.");
   }
 
-  std::vector<int>& tcols = C.getGraph().packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& tcols = C.getGraph().packedColumnIndices;
   std::vector<double>& tcoefs = C.getPackedCoefs();
 
   if (tcols.size() != 7) {
@@ -277,7 +277,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSRMat_sparse)
     throw std::runtime_error("CSRMAT C=AB test s1 failed.");
   }
 
-  std::vector<int>& cols = C.getGraph().packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& cols = C.getGraph().packedColumnIndices;
   std::vector<double>& coefs = C.getPackedCoefs();
 
   if (cols.size() != 2) {
@@ -302,7 +302,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSRMat_sparse)
     throw std::runtime_error("CSRMAT C=AB test s2.1 failed.");
   }
 
-  std::vector<int>& cols2 = C.getGraph().packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& cols2 = C.getGraph().packedColumnIndices;
   std::vector<double>& coefs2 = C.getPackedCoefs();
 
   if (cols2.size() != 2) {
@@ -340,7 +340,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSRMat_sparse)
     throw std::runtime_error("CSRMAT C=A^TB test s7 failed.");
   }
 
-  std::vector<int>& cols3 = C2.getGraph().packedColumnIndices;
+  std::vector<fei::GlobalOrdinal>& cols3 = C2.getGraph().packedColumnIndices;
   std::vector<double>& coefs3 = C2.getPackedCoefs();
 
   if (cols3.size() != 2) {
@@ -368,7 +368,7 @@ TEUCHOS_UNIT_TEST(CSRMatCSVec, multiply_CSRMat_CSRMat_sparse)
 
 TEUCHOS_UNIT_TEST(CSRMatCSVec, csvec_add_entry)
 {
-  std::vector<int> ind(3);
+  std::vector<fei::GlobalOrdinal> ind(3);
   std::vector<double> coef(3);
 
   ind[0] = 2; ind[1] = 5; ind[2] = 8;
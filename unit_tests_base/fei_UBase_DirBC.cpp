@@ -5,6 +5,7 @@
 #include <fei_iostream.hpp>
 #include <fei_DirichletBCRecord.hpp>
 #include <fei_DirichletBCManager.hpp>
+#include <fei_BCEqnIndex.hpp>
 
 #include <fei_MatrixGraph_Impl2.hpp>
 #include <fei_Matrix_Impl.hpp>
@@ -188,3 +189,107 @@ TEUCHOS_UNIT_TEST(DirBC, DirBCManager_finalizeBCEqns)
   TEUCHOS_TEST_EQUALITY(feimat->getGlobalNumRows(), (int)ids.size(), out, success);
 }
 
+TEUCHOS_UNIT_TEST(DirBC, BCEqnIndex)
+{
+  fei::BCEqnIndex bcindex;
+  bcindex.setLocalRange(10, 109);
+
+  //local eqns out of order, with one repeated, plus two remote eqns.
+  bcindex.insert(50, 5.0);
+  bcindex.insert(12, 1.2);
+  bcindex.insert(200, 20.0);
+  bcindex.insert(109, 10.9);
+  bcindex.insert(3, 0.3);
+  bcindex.insert(12, 1.25);
+
+  TEUCHOS_TEST_EQUALITY(bcindex.size(), (size_t)5, out, success);
+
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(12), true, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(109), true, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(3), true, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(200), true, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(10), false, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(13), false, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(110), false, out, success);
+
+  double value = 0.0;
+  TEUCHOS_TEST_EQUALITY(bcindex.getValue(12, value), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(value, 1.25, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.getValue(13, value), -1, out, success);
+
+  std::vector<fei::GlobalOrdinal> eqns;
+  std::vector<double> vals;
+  bcindex.getBCEqns(eqns, vals);
+
+  TEUCHOS_TEST_EQUALITY(eqns.size(), (size_t)5, out, success);
+  TEUCHOS_TEST_EQUALITY(eqns[0], 3, out, success);
+  TEUCHOS_TEST_EQUALITY(eqns[1], 12, out, success);
+  TEUCHOS_TEST_EQUALITY(eqns[4], 200, out, success);
+  TEUCHOS_TEST_EQUALITY(vals[1], 1.25, out, success);
+  TEUCHOS_TEST_EQUALITY(vals[2], 5.0, out, success);
+
+  bcindex.clear();
+  TEUCHOS_TEST_EQUALITY(bcindex.size(), (size_t)0, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(12), false, out, success);
+
+  //remote eqns in decreasing order, each inserted twice.
+  for(int i=0; i<2; ++i) {
+    for(int eqn=500; eqn>200; eqn -= 3) bcindex.insert(eqn, eqn+0.5*i);
+  }
+  TEUCHOS_TEST_EQUALITY(bcindex.size(), (size_t)100, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(203), true, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(204), false, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.getValue(500, value), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(value, 500.5, out, success);
+
+  fei::GlobalOrdinal assignEqns[4] = {3, 12, 50, 200};
+  double assignVals[4] = {0.3, 1.2, 5.0, 20.0};
+  bcindex.assign(10, 109, 4, assignEqns, assignVals);
+  TEUCHOS_TEST_EQUALITY(bcindex.size(), (size_t)4, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(50), true, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(3), true, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(500), false, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.contains(51), false, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex.getValue(200, value), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(value, 20.0, out, success);
+
+  //local eqns in increasing order, then out-of-order ones spanning several
+  //words of the bitset, some of which replace existing values.
+  bcindex.setLocalRange(0, 999);
+  for(int eqn=0; eqn<1000; eqn += 7) bcindex.insert(eqn, eqn);
+  for(int eqn=995; eqn>=0; eqn -= 5) bcindex.insert(eqn, -eqn);
+  bcindex.insert(1003, 3.0);
+
+  size_t numExpected = 1;
+  for(int eqn=0; eqn<1000; ++eqn) {
+    bool isBC = eqn%7 == 0 || eqn%5 == 0;
+    if (isBC) ++numExpected;
+    TEUCHOS_TEST_EQUALITY(bcindex.contains(eqn), isBC, out, success);
+    if (!isBC) continue;
+    TEUCHOS_TEST_EQUALITY(bcindex.getValue(eqn, value), 0, out, success);
+    TEUCHOS_TEST_EQUALITY(value, (eqn%5 == 0 ? -eqn : eqn), out, success);
+  }
+  TEUCHOS_TEST_EQUALITY(bcindex.size(), numExpected, out, success);
+
+  bcindex.getBCEqns(eqns, vals);
+  TEUCHOS_TEST_EQUALITY(eqns.size(), numExpected, out, success);
+  TEUCHOS_TEST_EQUALITY(eqns[1], 5, out, success);
+  TEUCHOS_TEST_EQUALITY(vals[2], 7.0, out, success);
+  TEUCHOS_TEST_EQUALITY(eqns.back(), 1003, out, success);
+
+  //the local eqns themselves aren't stored, only their values.
+  std::vector<fei::GlobalOrdinal> localEqns;
+  std::vector<double> localVals;
+  for(int eqn=0; eqn<1000; eqn += 2) {
+    localEqns.push_back(eqn);
+    localVals.push_back(eqn);
+  }
+  fei::BCEqnIndex bcindex2;
+  bcindex2.assign(0, 999, localEqns.size(), &localEqns[0], &localVals[0]);
+  TEUCHOS_TEST_EQUALITY(bcindex2.getValue(998, value), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(value, 998.0, out, success);
+  TEUCHOS_TEST_EQUALITY(bcindex2.getMemoryUsage() <
+                        localEqns.size()*(sizeof(fei::GlobalOrdinal)+sizeof(double)),
+                        true, out, success);
+}
+
@@ -0,0 +1,161 @@
+
+#include <Teuchos_ConfigDefs.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <fei_mpi.h>
+#include <fei_CommUtils.hpp>
+#include <fei_Factory_DistCSR.hpp>
+#include <fei_FEI_Impl.hpp>
+#include <fei_LinearSystem.hpp>
+#include <fei_defs.h>
+
+#include "fei_UBase_Laplace1D.hpp"
+
+#include <vector>
+
+namespace {
+
+//Initialize fei for the line of 2-node elements that init_Laplace1D
+//describes: numLocalElems per processor, element e connecting nodes e and
+//e+1, one scalar field.
+int init_FEI_Laplace1D(FEI& fei, int numLocalElems)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+  int numProcs = fei::numProcs(comm);
+
+  int fieldID = 0, fieldSize = 1;
+  int rc = fei.initFields(1, &fieldSize, &fieldID);
+  if (rc != 0) return(rc);
+
+  int numFieldsPerNode[2] = {1, 1};
+  int fieldIDs[1] = {fieldID};
+  const int* nodalFieldIDs[2] = {fieldIDs, fieldIDs};
+  rc = fei.initElemBlock(0, numLocalElems, 2, numFieldsPerNode,
+                         nodalFieldIDs, 0, NULL, 0);
+  if (rc != 0) return(rc);
+
+  int firstElem = localProc*numLocalElems;
+  for(int e=firstElem; e<firstElem+numLocalElems; ++e) {
+    GlobalID conn[2] = {e, e+1};
+    rc = fei.initElem(0, e, conn);
+    if (rc != 0) return(rc);
+  }
+
+  //the first node is shared with the previous processor, the last one with
+  //the next processor.
+  std::vector<GlobalID> sharedNodes;
+  std::vector<int> sharingProcs;
+  if (localProc > 0) {
+    sharedNodes.push_back(firstElem);
+    sharingProcs.push_back(localProc-1);
+  }
+  if (localProc < numProcs-1) {
+    sharedNodes.push_back(firstElem+numLocalElems);
+    sharingProcs.push_back(localProc+1);
+  }
+
+  if (!sharedNodes.empty()) {
+    std::vector<int> numProcsPerNode(sharedNodes.size(), 1);
+    std::vector<const int*> sharingProcs2D(sharedNodes.size());
+    for(size_t i=0; i<sharedNodes.size(); ++i) {
+      sharingProcs2D[i] = &sharingProcs[i];
+    }
+    rc = fei.initSharedNodes(sharedNodes.size(), &sharedNodes[0],
+                             &numProcsPerNode[0], &sharingProcs2D[0]);
+    if (rc != 0) return(rc);
+  }
+
+  return( fei.initComplete() );
+}
+
+//non-symmetric stiffness and load for element e, so that row- and
+//column-major layouts can't be confused.
+void elem_data_Laplace1D(int e, double* stiff, double* load)
+{
+  stiff[0] = 2.0 + e;  stiff[1] = -1.0;
+  stiff[2] = -0.5;     stiff[3] = 1.0 + 0.1*e;
+  load[0] = 1.0 + e;   load[1] = 0.5;
+}
+
+}//namespace <anonymous>
+
+TEUCHOS_UNIT_TEST(FEI_Impl, sumInElemBlockMatrix)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 5;
+  int firstElem = localProc*numLocalElems;
+
+  fei::FEI_Impl fei_elem(&factory, comm);
+  fei::FEI_Impl fei_row(&factory, comm);
+  fei::FEI_Impl fei_col(&factory, comm);
+  TEUCHOS_TEST_EQUALITY(init_FEI_Laplace1D(fei_elem, numLocalElems), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(init_FEI_Laplace1D(fei_row, numLocalElems), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(init_FEI_Laplace1D(fei_col, numLocalElems), 0, out, success);
+
+  std::vector<GlobalID> elemIDs(numLocalElems);
+  std::vector<GlobalID> conn(2*numLocalElems);
+  std::vector<double> rowStiff(4*numLocalElems);
+  std::vector<double> colStiff(4*numLocalElems);
+  std::vector<double> loads(2*numLocalElems);
+
+  for(int i=0; i<numLocalElems; ++i) {
+    int e = firstElem + i;
+    elemIDs[i] = e;
+    conn[2*i] = e;
+    conn[2*i+1] = e+1;
+
+    double* stiff = &rowStiff[4*i];
+    elem_data_Laplace1D(e, stiff, &loads[2*i]);
+    for(int r=0; r<2; ++r) {
+      for(int c=0; c<2; ++c) colStiff[4*i+c*2+r] = stiff[r*2+c];
+    }
+
+    const double* stiffRows[2] = {stiff, stiff+2};
+    TEUCHOS_TEST_EQUALITY(fei_elem.sumInElem(0, e, &conn[2*i], stiffRows,
+                                             &loads[2*i], FEI_DENSE_ROW),
+                          0, out, success);
+  }
+
+  //row-major tables in two batches, column-major tables in one.
+  int numFirst = numLocalElems/2;
+  TEUCHOS_TEST_EQUALITY(fei_row.sumInElemBlockMatrix(0, numFirst, &elemIDs[0],
+                                                     &conn[0], &rowStiff[0],
+                                                     &loads[0], FEI_DENSE_ROW),
+                        0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei_row.sumInElemBlockMatrix(0, numLocalElems-numFirst,
+                                                     &elemIDs[numFirst],
+                                                     &conn[2*numFirst],
+                                                     &rowStiff[4*numFirst],
+                                                     &loads[2*numFirst],
+                                                     FEI_DENSE_ROW),
+                        0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei_col.sumInElemBlockMatrix(0, numLocalElems,
+                                                     &elemIDs[0], &conn[0],
+                                                     &colStiff[0], &loads[0],
+                                                     FEI_DENSE_COL),
+                        0, out, success);
+
+  //packed symmetric tables aren't supported here.
+  TEUCHOS_TEST_INEQUALITY(fei_col.sumInElemBlockMatrix(0, numLocalElems,
+                                                       &elemIDs[0], &conn[0],
+                                                       &rowStiff[0], NULL,
+                                                       FEI_UPPER_SYMM_ROW),
+                          0, out, success);
+
+  TEUCHOS_TEST_EQUALITY(fei_elem.loadComplete(), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei_row.loadComplete(), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei_col.loadComplete(), 0, out, success);
+
+  TEUCHOS_TEST_EQUALITY(same_matrix_and_rhs(*fei_elem.getLinearSystem(),
+                                            *fei_row.getLinearSystem(),
+                                            1.e-14), true, out, success);
+  TEUCHOS_TEST_EQUALITY(same_matrix_and_rhs(*fei_elem.getLinearSystem(),
+                                            *fei_col.getLinearSystem(),
+                                            1.e-14), true, out, success);
+}
+
@@ -0,0 +1,324 @@
+
+#include <Teuchos_ConfigDefs.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <fei_mpi.h>
+#include <fei_CommUtils.hpp>
+#include <fei_Factory_DistCSR.hpp>
+#include <fei_VectorSpace.hpp>
+#include <fei_MatrixGraph.hpp>
+#include <fei_Matrix.hpp>
+#include <fei_Vector.hpp>
+#include <fei_Matrix_Local.hpp>
+
+#include "fei_UBase_Laplace1D.hpp"
+
+#include <vector>
+#include <cmath>
+
+TEUCHOS_UNIT_TEST(Factory_DistCSR, Laplace1D)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+  int numProcs = fei::numProcs(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 4;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  TEUCHOS_TEST_EQUALITY(init_Laplace1D(factory, numLocalElems, mgraph), 0,
+                        out, success);
+  fei::SharedPtr<fei::VectorSpace> vspace = mgraph->getRowSpace();
+  int fieldID = 0, idType = 0;
+  int firstElem = localProc*numLocalElems;
+
+  //no bcs, so A is the unmodified stiffness matrix.
+  fei::SharedPtr<fei::LinearSystem> linsys =
+    factory.createLinearSystem(mgraph);
+  assemble_Laplace1D(factory, mgraph, linsys, std::vector<double>(1, 0.0),
+                     numLocalElems, 1.0, false);
+  fei::SharedPtr<fei::Matrix> A = linsys->getMatrix();
+  fei::SharedPtr<fei::Vector> x = linsys->getSolutionVector();
+  fei::SharedPtr<fei::Vector> y = factory.createVector(mgraph);
+
+  //x = node-ID, so A*x is zero except at the two ends of the line.
+  int numLocalNodes = numLocalElems+1;
+  std::vector<int> nodeIDs(numLocalNodes);
+  std::vector<double> xvals(numLocalNodes);
+  for(int i=0; i<numLocalNodes; ++i) {
+    nodeIDs[i] = firstElem+i;
+    xvals[i] = firstElem+i;
+  }
+  x->copyInFieldData(fieldID, idType, numLocalNodes, &nodeIDs[0], &xvals[0]);
+  x->gatherFromOverlap(false);
+
+  TEUCHOS_TEST_EQUALITY(A->multiply(x.get(), y.get()), 0, out, success);
+
+  y->scatterToOverlap();
+  std::vector<double> yvals(numLocalNodes, -99.0);
+  y->copyOutFieldData(fieldID, idType, numLocalNodes, &nodeIDs[0], &yvals[0]);
+
+  const int lastNode = numProcs*numLocalElems;
+  for(int i=0; i<numLocalNodes; ++i) {
+    double expected = 0.0;
+    if (nodeIDs[i] == 0) expected = -1.0;
+    if (nodeIDs[i] == lastNode) expected = 1.0;
+    TEUCHOS_TEST_EQUALITY(std::abs(yvals[i] - expected) < 1.e-12, true, out, success);
+  }
+
+  //each owned row has its diagonal plus one or two neighbors.
+  std::vector<fei::GlobalOrdinal> ownedEqns;
+  vspace->getIndices_Owned(ownedEqns);
+  for(size_t i=0; i<ownedEqns.size(); ++i) {
+    int rowLength = 0;
+    A->getRowLength(ownedEqns[i], rowLength);
+    bool lengthOk = rowLength == 2 || rowLength == 3;
+    TEUCHOS_TEST_EQUALITY(lengthOk, true, out, success);
+  }
+}
+
+TEUCHOS_UNIT_TEST(Factory_DistCSR, Laplace1D_local_indices)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 4;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  TEUCHOS_TEST_EQUALITY(init_Laplace1D(factory, numLocalElems, mgraph), 0,
+                        out, success);
+  fei::SharedPtr<fei::VectorSpace> vspace = mgraph->getRowSpace();
+  int blockID = 0;
+  int firstElem = localProc*numLocalElems;
+
+  //owned indices first, in order, then the shared-but-not-owned ones.
+  const std::vector<fei::GlobalOrdinal>& localIndexMap =
+    vspace->getLocalIndexMap();
+  std::vector<fei::GlobalOrdinal> ownedEqns;
+  vspace->getIndices_Owned(ownedEqns);
+  int numOwned = ownedEqns.size();
+  TEUCHOS_TEST_EQUALITY((int)localIndexMap.size(),
+                        vspace->getNumIndices_SharedAndOwned(), out, success);
+  for(size_t i=0; i<localIndexMap.size(); ++i) {
+    if ((int)i < numOwned) {
+      TEUCHOS_TEST_EQUALITY(localIndexMap[i], ownedEqns[i], out, success);
+    }
+    TEUCHOS_TEST_EQUALITY(vspace->getLocalIndex(localIndexMap[i]), (int)i,
+                          out, success);
+  }
+
+  //the reference system is assembled with global indices, and the same
+  //contributions are then summed in with local indices.
+  const double stiffness = 2.0, load = 1.0;
+  fei::SharedPtr<fei::LinearSystem> linsys =
+    factory.createLinearSystem(mgraph);
+  assemble_Laplace1D(factory, mgraph, linsys, std::vector<double>(1, load),
+                     numLocalElems, stiffness, false);
+  fei::SharedPtr<fei::Matrix> A = linsys->getMatrix();
+  fei::SharedPtr<fei::Vector> b = linsys->getRHS();
+
+  fei::SharedPtr<fei::Matrix> Alocal = factory.createMatrix(mgraph);
+  fei::SharedPtr<fei::Vector> blocal = factory.createVector(mgraph);
+  fei::SharedPtr<fei::Matrix> L =
+    fei::Matrix_Local::create_Matrix_Local(mgraph, false);
+  fei::SharedPtr<fei::Matrix> Llocal =
+    fei::Matrix_Local::create_Matrix_Local(mgraph, false);
+
+  double row0[2] = {stiffness, -stiffness};
+  double row1[2] = {-stiffness, stiffness};
+  const double* elemMat[2] = {row0, row1};
+  double elemVec[2] = {0.5*load, 0.5*load};
+  for(int e=firstElem; e<firstElem+numLocalElems; ++e) {
+    fei::GlobalOrdinal eqns[2];
+    int lids[2], numIndices = 0;
+    mgraph->getConnectivityIndices(blockID, e, 2, eqns, numIndices);
+    TEUCHOS_TEST_EQUALITY(mgraph->getConnectivityLocalIndices(blockID, e, 2,
+                                                   lids, numIndices),
+                          0, out, success);
+    TEUCHOS_TEST_EQUALITY(numIndices, 2, out, success);
+    TEUCHOS_TEST_EQUALITY(localIndexMap[lids[0]], eqns[0], out, success);
+    TEUCHOS_TEST_EQUALITY(localIndexMap[lids[1]], eqns[1], out, success);
+
+    Alocal->sumInLocal(2, lids, 2, lids, elemMat);
+    L->sumIn(2, eqns, 2, eqns, elemMat);
+    Llocal->sumInLocal(2, lids, 2, lids, elemMat);
+    blocal->sumInLocal(2, lids, elemVec);
+  }
+
+  Alocal->gatherFromOverlap();
+  blocal->gatherFromOverlap();
+
+  for(int i=0; i<numOwned; ++i) {
+    int len = 0, lenLocal = 0;
+    A->getRowLength(ownedEqns[i], len);
+    Alocal->getRowLength(ownedEqns[i], lenLocal);
+    TEUCHOS_TEST_EQUALITY(len, lenLocal, out, success);
+
+    std::vector<fei::GlobalOrdinal> cols(len), colsLocal(len);
+    std::vector<double> coefs(len), coefsLocal(len);
+    A->copyOutRow(ownedEqns[i], len, &coefs[0], &cols[0]);
+    Alocal->copyOutRow(ownedEqns[i], len, &coefsLocal[0], &colsLocal[0]);
+    for(int j=0; j<len; ++j) {
+      TEUCHOS_TEST_EQUALITY(cols[j], colsLocal[j], out, success);
+      TEUCHOS_TEST_EQUALITY(coefs[j], coefsLocal[j], out, success);
+    }
+  }
+
+  //Matrix_Local also holds the shared rows.
+  for(size_t i=0; i<localIndexMap.size(); ++i) {
+    int len = 0, lenLocal = 0;
+    L->getRowLength(localIndexMap[i], len);
+    Llocal->getRowLength(localIndexMap[i], lenLocal);
+    TEUCHOS_TEST_EQUALITY(len, lenLocal, out, success);
+
+    std::vector<fei::GlobalOrdinal> cols(len), colsLocal(len);
+    std::vector<double> coefs(len), coefsLocal(len);
+    L->copyOutRow(localIndexMap[i], len, &coefs[0], &cols[0]);
+    Llocal->copyOutRow(localIndexMap[i], len, &coefsLocal[0], &colsLocal[0]);
+    for(int j=0; j<len; ++j) {
+      TEUCHOS_TEST_EQUALITY(cols[j], colsLocal[j], out, success);
+      TEUCHOS_TEST_EQUALITY(coefs[j], coefsLocal[j], out, success);
+    }
+  }
+
+  std::vector<double> bvals(numOwned), blocalvals(numOwned);
+  b->copyOut(numOwned, &ownedEqns[0], &bvals[0]);
+  blocal->copyOut(numOwned, &ownedEqns[0], &blocalvals[0]);
+  for(int i=0; i<numOwned; ++i) {
+    TEUCHOS_TEST_EQUALITY(bvals[i], blocalvals[i], out, success);
+  }
+
+  //copyInLocal overwrites the owned values.
+  std::vector<int> ownedLids(numOwned);
+  std::vector<double> newvals(numOwned);
+  for(int i=0; i<numOwned; ++i) {
+    ownedLids[i] = i;
+    newvals[i] = 3.0*i;
+  }
+  blocal->copyInLocal(numOwned, &ownedLids[0], &newvals[0]);
+  blocal->copyOut(numOwned, &ownedEqns[0], &blocalvals[0]);
+  for(int i=0; i<numOwned; ++i) {
+    TEUCHOS_TEST_EQUALITY(blocalvals[i], newvals[i], out, success);
+  }
+
+  //copyInLocal overwrites matrix entries too.
+  if (numOwned > 0) {
+    int lid = 0;
+    double diag = 5.0;
+    const double* diagPtr = &diag;
+    Alocal->copyInLocal(1, &lid, 1, &lid, &diagPtr);
+    Llocal->copyInLocal(1, &lid, 1, &lid, &diagPtr);
+
+    fei::Matrix* mats[2] = {Alocal.get(), Llocal.get()};
+    for(int m=0; m<2; ++m) {
+      int len = 0;
+      mats[m]->getRowLength(ownedEqns[0], len);
+      std::vector<fei::GlobalOrdinal> cols(len);
+      std::vector<double> coefs(len);
+      mats[m]->copyOutRow(ownedEqns[0], len, &coefs[0], &cols[0]);
+      for(int j=0; j<len; ++j) {
+        if (cols[j] == ownedEqns[0]) {
+          TEUCHOS_TEST_EQUALITY(coefs[j], 5.0, out, success);
+        }
+      }
+    }
+  }
+
+  int badLid = localIndexMap.size();
+  double val = 1.0;
+  const double* valPtr = &val;
+  TEUCHOS_TEST_INEQUALITY(blocal->sumInLocal(1, &badLid, &val), 0, out, success);
+  if (numOwned > 0) {
+    int lid = 0;
+    TEUCHOS_TEST_INEQUALITY(Alocal->sumInLocal(1, &lid, 1, &badLid, &valPtr),
+                            0, out, success);
+  }
+  TEUCHOS_TEST_EQUALITY(vspace->getLocalIndex(-1), -1, out, success);
+}
+
+TEUCHOS_UNIT_TEST(Factory_DistCSR, Laplace1D_direct_bc_enforcement)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 4;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  TEUCHOS_TEST_EQUALITY(init_Laplace1D(factory, numLocalElems, mgraph), 0,
+                        out, success);
+  std::vector<fei::GlobalOrdinal> ownedEqns;
+  mgraph->getRowSpace()->getIndices_Owned(ownedEqns);
+  int numOwned = ownedEqns.size();
+
+  //BC_ENFORCEMENT_DIRECT eliminates the bcs in the matrix storage, and must
+  //give the same matrix and rhs as the row-by-row elimination, with and
+  //without column modification.
+  const double stiffness = 2.0;
+  std::vector<double> load(1, 1.0);
+  const char* directParam = "BC_ENFORCEMENT_DIRECT";
+  const char* noColModParam = "BC_ENFORCEMENT_NO_COLUMN_MOD";
+
+  for(int colmod=0; colmod<2; ++colmod) {
+    fei::SharedPtr<fei::LinearSystem> linsys =
+      factory.createLinearSystem(mgraph);
+    fei::SharedPtr<fei::LinearSystem> dlinsys =
+      factory.createLinearSystem(mgraph);
+    dlinsys->parameters(1, &directParam);
+    if (colmod == 1) {
+      linsys->parameters(1, &noColModParam);
+      dlinsys->parameters(1, &noColModParam);
+    }
+
+    assemble_Laplace1D(factory, mgraph, linsys, load, numLocalElems, stiffness);
+    assemble_Laplace1D(factory, mgraph, dlinsys, load, numLocalElems, stiffness);
+
+    fei::SharedPtr<fei::Matrix> A = linsys->getMatrix();
+    fei::SharedPtr<fei::Matrix> dA = dlinsys->getMatrix();
+    for(int i=0; i<numOwned; ++i) {
+      int len = 0, dlen = 0;
+      A->getRowLength(ownedEqns[i], len);
+      dA->getRowLength(ownedEqns[i], dlen);
+      TEUCHOS_TEST_EQUALITY(len, dlen, out, success);
+      if (len < 1 || len != dlen) continue;
+
+      std::vector<fei::GlobalOrdinal> cols(len), dcols(len);
+      std::vector<double> coefs(len), dcoefs(len);
+      A->copyOutRow(ownedEqns[i], len, &coefs[0], &cols[0]);
+      dA->copyOutRow(ownedEqns[i], len, &dcoefs[0], &dcols[0]);
+      for(int j=0; j<len; ++j) {
+        TEUCHOS_TEST_EQUALITY(cols[j], dcols[j], out, success);
+        TEUCHOS_TEST_EQUALITY(std::abs(coefs[j] - dcoefs[j]) < 1.e-14,
+                              true, out, success);
+      }
+    }
+
+    std::vector<double> bvals(numOwned), dbvals(numOwned);
+    if (numOwned > 0) {
+      linsys->getRHS()->copyOut(numOwned, &ownedEqns[0], &bvals[0]);
+      dlinsys->getRHS()->copyOut(numOwned, &ownedEqns[0], &dbvals[0]);
+    }
+    for(int i=0; i<numOwned; ++i) {
+      TEUCHOS_TEST_EQUALITY(std::abs(bvals[i] - dbvals[i]) < 1.e-14,
+                            true, out, success);
+    }
+
+    //the bc rows were replaced by identity rows with the bc value on the rhs.
+    for(int i=0; i<numOwned; ++i) {
+      if (!dlinsys->eqnIsEssentialBC(ownedEqns[i])) continue;
+      double diag = 0.0;
+      int len = 0;
+      dA->getRowLength(ownedEqns[i], len);
+      std::vector<fei::GlobalOrdinal> cols(len);
+      std::vector<double> coefs(len);
+      dA->copyOutRow(ownedEqns[i], len, &coefs[0], &cols[0]);
+      for(int j=0; j<len; ++j) {
+        if (cols[j] == ownedEqns[i]) diag = coefs[j];
+        else TEUCHOS_TEST_EQUALITY(coefs[j], 0.0, out, success);
+      }
+      TEUCHOS_TEST_EQUALITY(diag, 1.0, out, success);
+      TEUCHOS_TEST_EQUALITY(dbvals[i] == 0.0 || dbvals[i] == 1.0, true,
+                            out, success);
+    }
+  }
+}
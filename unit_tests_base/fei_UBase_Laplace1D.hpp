@@ -0,0 +1,151 @@
+#ifndef _fei_UBase_Laplace1D_hpp_
+#define _fei_UBase_Laplace1D_hpp_
+
+#include <fei_mpi.h>
+#include <fei_CommUtils.hpp>
+#include <fei_Factory.hpp>
+#include <fei_VectorSpace.hpp>
+#include <fei_MatrixGraph.hpp>
+#include <fei_Matrix.hpp>
+#include <fei_Vector.hpp>
+#include <fei_LinearSystem.hpp>
+
+#include <vector>
+#include <cmath>
+
+namespace {
+
+//Set up the matrix-graph of a line of 2-node elements, numLocalElems per
+//processor. Element e connects nodes e and e+1, so each processor shares a
+//node with its neighbors. There is one scalar field (fieldID 0, idType 0)
+//and one element-block (blockID 0). If callInitComplete is false, the caller
+//may initialize more (e.g. constraints) and must call initComplete itself.
+//Returns the initComplete error-code.
+int init_Laplace1D(fei::Factory& factory,
+                   int numLocalElems,
+                   fei::SharedPtr<fei::MatrixGraph>& mgraph,
+                   bool callInitComplete=true)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+
+  fei::SharedPtr<fei::VectorSpace> vspace =
+    factory.createVectorSpace(comm, "Laplace1D_VecSpc");
+  fei::SharedPtr<fei::VectorSpace> nullvspace;
+  mgraph = factory.createMatrixGraph(vspace, nullvspace, "Laplace1D_MGrph");
+
+  int fieldID = 0, fieldSize = 1, idType = 0, blockID = 0;
+  vspace->defineFields(1, &fieldID, &fieldSize);
+  vspace->defineIDTypes(1, &idType);
+
+  int patternID = mgraph->definePattern(2, idType, fieldID);
+  mgraph->initConnectivityBlock(blockID, numLocalElems, patternID);
+
+  int firstElem = localProc*numLocalElems;
+  for(int e=firstElem; e<firstElem+numLocalElems; ++e) {
+    int nodes[2] = {e, e+1};
+    mgraph->initConnectivity(blockID, e, nodes);
+  }
+
+  return( callInitComplete ? mgraph->initComplete() : 0 );
+}
+
+//Assemble the 1D Laplace system on a graph from init_Laplace1D, with element
+//stiffness 'stiffness' and a uniform element load of 'load[v]' in rhs vector
+//v. If loadBCs is true, u = 0 is prescribed at the first node and u = 1 at
+//the last.
+void assemble_Laplace1D(fei::Factory& factory,
+                        fei::SharedPtr<fei::MatrixGraph> mgraph,
+                        fei::SharedPtr<fei::LinearSystem> linsys,
+                        const std::vector<double>& load,
+                        int numLocalElems,
+                        double stiffness=1.0,
+                        bool loadBCs=true)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+  int numProcs = fei::numProcs(comm);
+  int fieldID = 0, idType = 0, blockID = 0;
+  int numVectors = load.size();
+
+  fei::SharedPtr<fei::Matrix> A = factory.createMatrix(mgraph);
+  fei::SharedPtr<fei::Vector> x = factory.createVector(mgraph, true, numVectors);
+  fei::SharedPtr<fei::Vector> b = factory.createVector(mgraph, numVectors);
+  linsys->setMatrix(A);
+  linsys->setSolutionVector(x);
+  linsys->setRHS(b);
+
+  double row0[2] = {stiffness, -stiffness};
+  double row1[2] = {-stiffness, stiffness};
+  const double* elemMat[2] = {row0, row1};
+  int firstElem = localProc*numLocalElems;
+  for(int e=firstElem; e<firstElem+numLocalElems; ++e) {
+    A->sumIn(blockID, e, elemMat);
+
+    int nodes[2] = {e, e+1};
+    for(int v=0; v<numVectors; ++v) {
+      double elemLoad[2] = {0.5*load[v], 0.5*load[v]};
+      b->sumInFieldData(fieldID, idType, 2, nodes, elemLoad, v);
+    }
+  }
+
+  const int lastNode = numProcs*numLocalElems;
+  int offset = 0;
+  if (loadBCs && localProc == 0) {
+    int nodeID = 0;
+    double value = 0.0;
+    linsys->loadEssentialBCs(1, &nodeID, idType, fieldID, &offset, &value);
+  }
+  if (loadBCs && localProc == numProcs-1) {
+    double value = 1.0;
+    linsys->loadEssentialBCs(1, &lastNode, idType, fieldID, &offset, &value);
+  }
+
+  linsys->loadComplete();
+}
+
+//return true if the locally-owned rows of the matrices and rhs vectors of
+//linsys1 and linsys2 have the same structure, and coefficients that agree
+//to within tol.
+bool same_matrix_and_rhs(fei::LinearSystem& linsys1,
+                         fei::LinearSystem& linsys2,
+                         double tol)
+{
+  std::vector<fei::GlobalOrdinal> ownedEqns;
+  linsys1.getMatrix()->getMatrixGraph()->getRowSpace()->getIndices_Owned(ownedEqns);
+
+  fei::Matrix& A1 = *linsys1.getMatrix();
+  fei::Matrix& A2 = *linsys2.getMatrix();
+  for(size_t i=0; i<ownedEqns.size(); ++i) {
+    int len1 = -1, len2 = -1;
+    A1.getRowLength(ownedEqns[i], len1);
+    A2.getRowLength(ownedEqns[i], len2);
+    if (len1 != len2) return(false);
+    if (len1 < 1) continue;
+
+    std::vector<fei::GlobalOrdinal> cols1(len1), cols2(len1);
+    std::vector<double> coefs1(len1), coefs2(len1);
+    A1.copyOutRow(ownedEqns[i], len1, &coefs1[0], &cols1[0]);
+    A2.copyOutRow(ownedEqns[i], len1, &coefs2[0], &cols2[0]);
+    for(int j=0; j<len1; ++j) {
+      if (cols1[j] != cols2[j]) return(false);
+      if (std::abs(coefs1[j] - coefs2[j]) > tol) return(false);
+    }
+  }
+
+  int numOwned = ownedEqns.size();
+  if (numOwned < 1) return(true);
+
+  std::vector<double> b1(numOwned), b2(numOwned);
+  linsys1.getRHS()->copyOut(numOwned, &ownedEqns[0], &b1[0]);
+  linsys2.getRHS()->copyOut(numOwned, &ownedEqns[0], &b2[0]);
+  for(int i=0; i<numOwned; ++i) {
+    if (std::abs(b1[i] - b2[i]) > tol) return(false);
+  }
+
+  return(true);
+}
+
+}//namespace <anonymous>
+
+#endif // _fei_UBase_Laplace1D_hpp_
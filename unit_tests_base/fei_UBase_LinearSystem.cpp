@@ -0,0 +1,205 @@
+
+#include <Teuchos_ConfigDefs.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <fei_mpi.h>
+#include <fei_CommUtils.hpp>
+#include <fei_Factory_DistCSR.hpp>
+#include <fei_VectorSpace.hpp>
+#include <fei_MatrixGraph.hpp>
+#include <fei_Matrix.hpp>
+#include <fei_Vector.hpp>
+#include <fei_LinearSystem.hpp>
+
+#include "fei_UBase_Laplace1D.hpp"
+
+#include <vector>
+
+namespace {
+
+//create a matrix and rhs for linsys.
+void set_matrix_and_rhs(fei::Factory& factory,
+                        fei::SharedPtr<fei::MatrixGraph> mgraph,
+                        fei::LinearSystem& linsys)
+{
+  fei::SharedPtr<fei::Matrix> A = factory.createMatrix(mgraph);
+  fei::SharedPtr<fei::Vector> b = factory.createVector(mgraph);
+  linsys.setMatrix(A);
+  linsys.setRHS(b);
+}
+
+}//namespace <anonymous>
+
+TEUCHOS_UNIT_TEST(LinearSystem, loadLagrangeConstraints)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 4;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  init_Laplace1D(factory, numLocalElems, mgraph, false);
+
+  int crIDType = 1;
+  mgraph->getRowSpace()->defineIDTypes(1, &crIDType);
+
+  //three constraints per processor. The first one involves the node shared
+  //with the previous processor, so on all but the first processor it adds
+  //to remotely-owned rows.
+  const int numCRs = 3;
+  int firstElem = localProc*numLocalElems;
+  int crNodes[5] = {firstElem, firstElem+1, firstElem+1, firstElem+2,
+                    firstElem+2};
+  int weightOffsets[numCRs+1] = {0, 2, 4, 5};
+  int idTypes[2] = {0, 0};
+  int fieldIDs[2] = {0, 0};
+  int crIDs[numCRs];
+  for(int i=0; i<numCRs; ++i) {
+    crIDs[i] = numCRs*localProc + i;
+    mgraph->initLagrangeConstraint(crIDs[i], crIDType,
+                                   weightOffsets[i+1]-weightOffsets[i],
+                                   idTypes, &crNodes[weightOffsets[i]],
+                                   fieldIDs);
+  }
+
+  TEUCHOS_TEST_EQUALITY(mgraph->initComplete(), 0, out, success);
+
+  double weights[5] = {1.0, -1.0, 0.5, 2.0, 3.0};
+  double rhsValues[numCRs] = {0.1, 0.2, 0.3};
+
+  fei::SharedPtr<fei::LinearSystem> linsys = factory.createLinearSystem(mgraph);
+  fei::SharedPtr<fei::LinearSystem> blinsys = factory.createLinearSystem(mgraph);
+  set_matrix_and_rhs(factory, mgraph, *linsys);
+  set_matrix_and_rhs(factory, mgraph, *blinsys);
+
+  for(int i=0; i<numCRs; ++i) {
+    TEUCHOS_TEST_EQUALITY(linsys->loadLagrangeConstraint(crIDs[i],
+                                               &weights[weightOffsets[i]],
+                                               rhsValues[i]), 0, out, success);
+  }
+  TEUCHOS_TEST_EQUALITY(blinsys->loadLagrangeConstraints(numCRs, crIDs,
+                                               weightOffsets, weights,
+                                               rhsValues), 0, out, success);
+
+  TEUCHOS_TEST_EQUALITY(linsys->loadComplete(), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(blinsys->loadComplete(), 0, out, success);
+
+  TEUCHOS_TEST_EQUALITY(same_matrix_and_rhs(*linsys, *blinsys, 1.e-14),
+                        true, out, success);
+
+  //the weights do make it into the constraint's row.
+  fei::SharedPtr<fei::VectorSpace> vspace = mgraph->getRowSpace();
+  fei::GlobalOrdinal crEqn = -1, eqn0 = -1, eqn1 = -1;
+  vspace->getGlobalIndex(crIDType, crIDs[1], crEqn);
+  vspace->getGlobalIndex(0, crNodes[2], fieldIDs[0], eqn0);
+  vspace->getGlobalIndex(0, crNodes[3], fieldIDs[0], eqn1);
+  int len = 0;
+  blinsys->getMatrix()->getRowLength(crEqn, len);
+  std::vector<fei::GlobalOrdinal> cols(len);
+  std::vector<double> coefs(len);
+  if (len > 0) blinsys->getMatrix()->copyOutRow(crEqn, len, &coefs[0], &cols[0]);
+  int numFound = 0;
+  for(int j=0; j<len; ++j) {
+    if (cols[j] == eqn0) {
+      TEUCHOS_TEST_EQUALITY(coefs[j], weights[2], out, success);
+      ++numFound;
+    }
+    if (cols[j] == eqn1) {
+      TEUCHOS_TEST_EQUALITY(coefs[j], weights[3], out, success);
+      ++numFound;
+    }
+  }
+  TEUCHOS_TEST_EQUALITY(numFound, 2, out, success);
+}
+
+TEUCHOS_UNIT_TEST(LinearSystem, loadPenaltyConstraint_changedSinceMark)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 4;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  init_Laplace1D(factory, numLocalElems, mgraph, false);
+
+  int crIDType = 1;
+  mgraph->getRowSpace()->defineIDTypes(1, &crIDType);
+
+  //a penalty constraint on two nodes that are interior to this processor,
+  //so that its coefficients are summed directly into the matrix storage.
+  int firstElem = localProc*numLocalElems;
+  int crNodes[2] = {firstElem+1, firstElem+2};
+  int idTypes[2] = {0, 0};
+  int fieldIDs[2] = {0, 0};
+  int crID = localProc;
+  mgraph->initPenaltyConstraint(crID, crIDType, 2, idTypes, crNodes, fieldIDs);
+
+  TEUCHOS_TEST_EQUALITY(mgraph->initComplete(), 0, out, success);
+
+  fei::SharedPtr<fei::LinearSystem> linsys = factory.createLinearSystem(mgraph);
+  set_matrix_and_rhs(factory, mgraph, *linsys);
+  fei::SharedPtr<fei::Matrix> A = linsys->getMatrix();
+
+  fei::SharedPtr<fei::VectorSpace> vspace = mgraph->getRowSpace();
+  fei::GlobalOrdinal eqns[2] = {-1, -1};
+  vspace->getGlobalIndex(0, crNodes[0], fieldIDs[0], eqns[0]);
+  vspace->getGlobalIndex(0, crNodes[1], fieldIDs[0], eqns[1]);
+
+  double weights[2] = {1.0, -1.0};
+  double penaltyValue = 10.0;
+
+  for(int load=1; load<=2; ++load) {
+    A->markState();
+    TEUCHOS_TEST_EQUALITY(A->changedSinceMark(), false, out, success);
+
+    TEUCHOS_TEST_EQUALITY(linsys->loadPenaltyConstraint(crID, weights,
+                                                  penaltyValue, 0.0),
+                          0, out, success);
+    TEUCHOS_TEST_EQUALITY(A->changedSinceMark(), true, out, success);
+
+    //each load adds weights[i]*weights[j]*penaltyValue.
+    for(int i=0; i<2; ++i) {
+      int len = 0;
+      A->getRowLength(eqns[i], len);
+      std::vector<fei::GlobalOrdinal> cols(len);
+      std::vector<double> coefs(len);
+      if (len > 0) A->copyOutRow(eqns[i], len, &coefs[0], &cols[0]);
+      int numFound = 0;
+      for(int k=0; k<len; ++k) {
+        for(int j=0; j<2; ++j) {
+          if (cols[k] != eqns[j]) continue;
+          TEUCHOS_TEST_FLOATING_EQUALITY(coefs[k],
+                                         load*weights[i]*weights[j]*penaltyValue,
+                                         1.e-14, out, success);
+          ++numFound;
+        }
+      }
+      TEUCHOS_TEST_EQUALITY(numFound, 2, out, success);
+    }
+  }
+
+  //positions cached for A must not be used for a replacement matrix.
+  fei::SharedPtr<fei::Matrix> B = factory.createMatrix(mgraph);
+  linsys->setMatrix(B);
+  TEUCHOS_TEST_EQUALITY(linsys->loadPenaltyConstraint(crID, weights,
+                                                penaltyValue, 0.0),
+                        0, out, success);
+  for(int i=0; i<2; ++i) {
+    int len = 0;
+    B->getRowLength(eqns[i], len);
+    std::vector<fei::GlobalOrdinal> cols(len);
+    std::vector<double> coefs(len);
+    if (len > 0) B->copyOutRow(eqns[i], len, &coefs[0], &cols[0]);
+    for(int k=0; k<len; ++k) {
+      for(int j=0; j<2; ++j) {
+        if (cols[k] != eqns[j]) continue;
+        TEUCHOS_TEST_FLOATING_EQUALITY(coefs[k],
+                                       weights[i]*weights[j]*penaltyValue,
+                                       1.e-14, out, success);
+      }
+    }
+  }
+}
+
@@ -23,7 +23,7 @@ TEUCHOS_UNIT_TEST(MatrixTraits, FillableMat_1)
   fei::MatrixTraits<fei::FillableMat>::getNumLocalRows(&fm, numRows);
   TEUCHOS_TEST_EQUALITY(numRows, 3, out, success);
 
-  std::vector<int> indices1(2);
+  std::vector<fei::GlobalOrdinal> indices1(2);
   std::vector<double> coefs1(2);
 
   fei::MatrixTraits<fei::FillableMat>::copyOutRow(&fm, 1, 2, &coefs1[0], &indices1[0]);
@@ -0,0 +1,155 @@
+
+#include <Teuchos_ConfigDefs.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <fei_CommUtils.hpp>
+#include <fei_VectorSpace.hpp>
+#include <fei_MatrixGraph_Impl2.hpp>
+#include <fei_Matrix_Local.hpp>
+#include <fei_Matrix_LocalBlock.hpp>
+#include <fei_Vector_Local.hpp>
+
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+void sort_row(std::vector<fei::GlobalOrdinal>& indices,
+              std::vector<double>& coefs)
+{
+  std::vector<std::pair<fei::GlobalOrdinal,double> > entries(indices.size());
+  for(size_t i=0; i<indices.size(); ++i) {
+    entries[i] = std::make_pair(indices[i], coefs[i]);
+  }
+  std::sort(entries.begin(), entries.end());
+  for(size_t i=0; i<indices.size(); ++i) {
+    indices[i] = entries[i].first;
+    coefs[i] = entries[i].second;
+  }
+}
+
+}//namespace <anonymous>
+
+TEUCHOS_UNIT_TEST(Matrix_LocalBlock, compare_Matrix_Local)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  if (fei::numProcs(comm) > 1) return;
+
+  fei::SharedPtr<fei::VectorSpace> vspace(new fei::VectorSpace(comm));
+  fei::SharedPtr<fei::VectorSpace> nullvspace;
+  fei::SharedPtr<fei::MatrixGraph>
+    mgraph(new fei::MatrixGraph_Impl2(vspace, nullvspace));
+
+  //field 0 (size 2) lives on nodes 0..3 and field 1 (size 1) on nodes 3..5,
+  //so the block sizes are 2, 2, 2, 3, 1, 1.
+  int fieldIDs[2] = {0, 1};
+  int fieldSizes[2] = {2, 1};
+  int idType = 0;
+  vspace->defineFields(2, fieldIDs, fieldSizes);
+  vspace->defineIDTypes(1, &idType);
+
+  int pattern0 = mgraph->definePattern(2, idType, fieldIDs[0]);
+  int pattern1 = mgraph->definePattern(2, idType, fieldIDs[1]);
+  mgraph->initConnectivityBlock(0, 3, pattern0);
+  mgraph->initConnectivityBlock(1, 2, pattern1);
+
+  for(int e=0; e<3; ++e) {
+    int nodes[2] = {e, e+1};
+    mgraph->initConnectivity(0, e, nodes);
+  }
+  for(int e=0; e<2; ++e) {
+    int nodes[2] = {e+3, e+4};
+    mgraph->initConnectivity(1, e, nodes);
+  }
+
+  TEUCHOS_TEST_EQUALITY(mgraph->initComplete(), 0, out, success);
+
+  fei::SharedPtr<fei::Matrix> A =
+    fei::Matrix_Local::create_Matrix_Local(mgraph, false);
+  fei::SharedPtr<fei::Matrix> B =
+    fei::Matrix_LocalBlock::create_Matrix_LocalBlock(mgraph);
+
+  TEUCHOS_TEST_EQUALITY(B->usingBlockEntryStorage(), true, out, success);
+
+  fei::Matrix_LocalBlock* blkmat =
+    dynamic_cast<fei::Matrix_LocalBlock*>(B.get());
+  TEUCHOS_TEST_EQUALITY(blkmat->getBlkGraph().rowNumbers.size(), 6, out, success);
+  TEUCHOS_TEST_EQUALITY(blkmat->getRowSizes()[3], 3, out, success);
+
+  //unsymmetric element matrices, summed in with both formats.
+  std::vector<double> data(16);
+  std::vector<const double*> elemMat(4);
+  for(int i=0; i<4; ++i) elemMat[i] = &data[i*4];
+
+  for(int blk=0; blk<2; ++blk) {
+    int numElems = blk==0 ? 3 : 2;
+    int elemSize = blk==0 ? 4 : 2;
+    for(int i=0; i<elemSize; ++i) elemMat[i] = &data[i*elemSize];
+
+    for(int e=0; e<numElems; ++e) {
+      for(int i=0; i<elemSize*elemSize; ++i) data[i] = 100.0*blk + 10.0*e + i;
+
+      int format = e%2==0 ? FEI_DENSE_ROW : FEI_DENSE_COL;
+      TEUCHOS_TEST_EQUALITY(A->sumIn(blk, e, &elemMat[0], format), 0, out, success);
+      TEUCHOS_TEST_EQUALITY(B->sumIn(blk, e, &elemMat[0], format), 0, out, success);
+    }
+  }
+
+  //a point-entry contribution coupling node 3 to node 2.
+  fei::GlobalOrdinal eqn3 = -1, eqn2 = -1;
+  vspace->getGlobalIndex(idType, 3, fieldIDs[0], eqn3);
+  vspace->getGlobalIndex(idType, 2, fieldIDs[0], eqn2);
+  double value = 7.5;
+  const double* valptr = &value;
+  TEUCHOS_TEST_EQUALITY(A->sumIn(1, &eqn3, 1, &eqn2, &valptr), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(B->sumIn(1, &eqn3, 1, &eqn2, &valptr), 0, out, success);
+
+  std::vector<fei::GlobalOrdinal>& eqns = vspace->getEqnNumbers();
+  TEUCHOS_TEST_EQUALITY(B->getLocalNumRows(), (int)eqns.size(), out, success);
+
+  //block rows hold every point-column of each coupled node, so B may have
+  //extra (zero) entries that aren't in the point-entry structure.
+  for(size_t i=0; i<eqns.size(); ++i) {
+    int lenA = 0, lenB = 0;
+    A->getRowLength(eqns[i], lenA);
+    B->getRowLength(eqns[i], lenB);
+    TEUCHOS_TEST_EQUALITY(lenA <= lenB, true, out, success);
+
+    std::vector<fei::GlobalOrdinal> indA(lenA), indB(lenB);
+    std::vector<double> coefA(lenA), coefB(lenB);
+    A->copyOutRow(eqns[i], lenA, &coefA[0], &indA[0]);
+    B->copyOutRow(eqns[i], lenB, &coefB[0], &indB[0]);
+    sort_row(indA, coefA);
+
+    int numFound = 0;
+    for(int j=0; j<lenB; ++j) {
+      std::vector<fei::GlobalOrdinal>::iterator iter =
+        std::lower_bound(indA.begin(), indA.end(), indB[j]);
+      if (iter != indA.end() && *iter == indB[j]) {
+        ++numFound;
+        TEUCHOS_TEST_EQUALITY(coefA[iter-indA.begin()], coefB[j], out, success);
+      }
+      else {
+        TEUCHOS_TEST_EQUALITY(coefB[j], 0.0, out, success);
+      }
+    }
+    TEUCHOS_TEST_EQUALITY(numFound, lenA, out, success);
+  }
+
+  fei::Vector_Local x(vspace), yA(vspace), yB(vspace);
+  std::vector<double>& xcoefs = x.getCoefs();
+  for(size_t i=0; i<xcoefs.size(); ++i) xcoefs[i] = 1.0 + 0.5*i;
+
+  TEUCHOS_TEST_EQUALITY(A->multiply(&x, &yA), 0, out, success);
+  TEUCHOS_TEST_EQUALITY(B->multiply(&x, &yB), 0, out, success);
+
+  std::vector<double>& ycoefsA = yA.getCoefs();
+  std::vector<double>& ycoefsB = yB.getCoefs();
+  TEUCHOS_TEST_EQUALITY(ycoefsA.size(), ycoefsB.size(), out, success);
+  for(size_t i=0; i<ycoefsA.size(); ++i) {
+    TEUCHOS_TEST_EQUALITY(std::abs(ycoefsA[i] - ycoefsB[i]) < 1.e-12,
+                          true, out, success);
+  }
+}
+
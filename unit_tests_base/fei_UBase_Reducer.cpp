@@ -41,7 +41,7 @@ namespace {
 TEUCHOS_UNIT_TEST(Reducer, reducer_unit1)
 {
   //define equation-space to be 0 .. 4
-  std::vector<int> eqns(5);
+  std::vector<fei::GlobalOrdinal> eqns(5);
   for(unsigned i=0; i<5; ++i) {
     eqns[i] = i;
   }
@@ -76,6 +76,57 @@ TEUCHOS_UNIT_TEST(Reducer, reducer_unit1)
   TEUCHOS_TEST_EQUALITY(reducedEqn, 2, out, success);
 }
 
+TEUCHOS_UNIT_TEST(Reducer, reducer_translation_table)
+{
+  fei::SharedPtr<fei::FillableMat> D(new fei::FillableMat);
+
+  //slaves 3, 7, 8 and 20.
+  D->putCoef(3, 2, 1.0);
+  D->putCoef(7, 6, 1.0);
+  D->putCoef(8, 6, 1.0);
+  D->putCoef(20, 19, 1.0);
+
+  fei::SharedPtr<fei::CSVec> g;
+
+  //a reducer with no local eqns has no translation table, and uses a
+  //binary search of the slave list for every eqn.
+  fei::Reducer search_reducer(D, g, MPI_COMM_WORLD);
+
+  fei::Reducer reducer(D, g, MPI_COMM_WORLD);
+
+  std::vector<fei::GlobalOrdinal> localEqns;
+  for(int i=5; i<=12; ++i) localEqns.push_back(i);
+  reducer.setLocalUnreducedEqns(localEqns);
+
+  std::vector<fei::GlobalOrdinal> ghostEqns;
+  ghostEqns.push_back(14);
+  ghostEqns.push_back(1);
+  ghostEqns.push_back(15);
+  reducer.setGhostUnreducedEqns(ghostEqns);
+
+  for(int eqn=0; eqn<40; ++eqn) {
+    bool slave = search_reducer.isSlaveEqn(eqn);
+    TEUCHOS_TEST_EQUALITY(reducer.isSlaveEqn(eqn), slave, out, success);
+    TEUCHOS_TEST_EQUALITY(reducer.isSlaveCol(eqn), slave, out, success);
+    if (!slave) {
+      TEUCHOS_TEST_EQUALITY(reducer.translateToReducedEqn(eqn),
+                            search_reducer.translateToReducedEqn(eqn),
+                            out, success);
+    }
+  }
+
+  bool exception_caught = false;
+  try {
+    reducer.translateToReducedEqn(7);
+  }
+  catch(...) {
+    exception_caught = true;
+  }
+
+  TEUCHOS_TEST_EQUALITY(exception_caught, true, out, success);
+  TEUCHOS_TEST_EQUALITY(reducer.translateToReducedEqn(9), 6, out, success);
+}
+
 void fill_matrices(fei::FillableMat& Kii, fei::FillableMat& Kid,
                    fei::FillableMat& Kdi, fei::FillableMat& Kdd)
 {
@@ -117,12 +168,12 @@ void addFillableMatToReducer(fei::FillableMat& mat, fei::Reducer& reducer,
   fei::FillableMat::iterator
     iter = mat.begin(), iter_end = mat.end();
   for(; iter!=iter_end; ++iter) {
-    int row = iter->first;
+    fei::GlobalOrdinal row = iter->first;
     fei::CSVec* rowvec = iter->second;
-    const std::vector<int>& cols = rowvec->indices();
+    const std::vector<fei::GlobalOrdinal>& cols = rowvec->indices();
     const std::vector<double>& coefs = rowvec->coefs();
     for(size_t i=0; i<cols.size(); ++i) {
-      int col = cols[i];
+      fei::GlobalOrdinal col = cols[i];
       double coef = coefs[i];
       double* coefPtr = &coef;
       reducer.addMatrixValues(1, &row, 1, &col, &coefPtr, true, feimat, FEI_DENSE_ROW);
@@ -154,7 +205,7 @@ TEUCHOS_UNIT_TEST(Reducer, test_Reducer_test1)
   fei::Reducer reducer(D, g, comm);
 
   //define equation-space to be 0 .. 4
-  std::vector<int> eqns(5);
+  std::vector<fei::GlobalOrdinal> eqns(5);
   for(unsigned i=0; i<5; ++i) {
     eqns[i] = i;
   }
@@ -246,7 +297,7 @@ TEUCHOS_UNIT_TEST(Reducer, test_Reducer_test2)
   fei::Reducer reducer(D, g, comm);
 
   int num = 4;
-  std::vector<int> eqns1(num), eqns2(num);
+  std::vector<fei::GlobalOrdinal> eqns1(num), eqns2(num);
   for(int i=0; i<num; ++i) {
     eqns1[i] = i;
     eqns2[i] = i;
@@ -286,7 +337,7 @@ TEUCHOS_UNIT_TEST(Reducer, test_Reducer_test3)
   fei::Reducer reducer(D, g, comm);
 
   int num = 7;
-  std::vector<int> eqns1(num), eqns2(num);
+  std::vector<fei::GlobalOrdinal> eqns1(num), eqns2(num);
   for(int i=0; i<num; ++i) {
     eqns1[i] = i;
     eqns2[i] = i;
@@ -326,7 +377,7 @@ TEUCHOS_UNIT_TEST(Reducer, test_Reducer_test4)
   fei::Reducer reducer(D, g, comm);
 
   int num = 9;
-  std::vector<int> eqns1(num), eqns2(num);
+  std::vector<fei::GlobalOrdinal> eqns1(num), eqns2(num);
   for(int i=0; i<num; ++i) {
     eqns1[i] = i;
     eqns2[i] = i;
@@ -384,7 +435,7 @@ TEUCHOS_UNIT_TEST(Reducer, test_Reducer_test5)
   fei::Reducer reducer(D, g, comm);
 
   int num = 8;
-  std::vector<int> eqns1(num), eqns2(num);
+  std::vector<fei::GlobalOrdinal> eqns1(num), eqns2(num);
   for(int i=0; i<num; ++i) {
     eqns1[i] = i;
     eqns2[i] = i;
@@ -217,7 +217,7 @@ TEUCHOS_UNIT_TEST(SlaveConstraint, Carnes)
   vectorMatrix->putScalar(0.0);
   
   int len = Nnpe*Ndim;
-  std::vector<int> indices (len);
+  std::vector<fei::GlobalOrdinal> indices (len);
 
   const double h =1.0/(double)num_elems;
 
@@ -149,7 +149,7 @@ TEUCHOS_UNIT_TEST(SlaveReduce1, Rijk_de_Rooij )
 	double  elemMat[4] = {1., -1., -1., 1.};		// Element stiffness matrix
 	double* elemMat2d[2] = {elemMat, elemMat+2};
 	int matSize = 2;								// Size of element matrix
-	int indices[2]; 						// DOF indices for the element
+	fei::GlobalOrdinal indices[2];					// DOF indices for the element
 
 	// Loop through the 2 elements
 	for(size_t elemID=0; elemID<2; elemID++){
@@ -0,0 +1,261 @@
+
+#include <Teuchos_ConfigDefs.hpp>
+#include <Teuchos_UnitTestHarness.hpp>
+
+#include <fei_mpi.h>
+#include <fei_CommUtils.hpp>
+#include <fei_Factory_DistCSR.hpp>
+#include <fei_VectorSpace.hpp>
+#include <fei_MatrixGraph.hpp>
+#include <fei_Matrix.hpp>
+#include <fei_Vector.hpp>
+#include <fei_LinearSystem.hpp>
+#include <fei_ParameterSet.hpp>
+#include <fei_Solver.hpp>
+
+#include "fei_UBase_Laplace1D.hpp"
+
+#include <vector>
+#include <string>
+#include <cmath>
+
+TEUCHOS_UNIT_TEST(Solver_DistCSR, Laplace1D)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+  int numProcs = fei::numProcs(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 5;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  TEUCHOS_TEST_EQUALITY(init_Laplace1D(factory, numLocalElems, mgraph), 0,
+                        out, success);
+  int fieldID = 0, idType = 0;
+  int firstElem = localProc*numLocalElems;
+
+  //no load, u = 0 at the first node and u = 1 at the last, so the solution
+  //is u = nodeID/lastNode.
+  fei::SharedPtr<fei::LinearSystem> linsys =
+    factory.createLinearSystem(mgraph);
+  assemble_Laplace1D(factory, mgraph, linsys, std::vector<double>(1, 0.0),
+                     numLocalElems);
+  fei::SharedPtr<fei::Vector> x = linsys->getSolutionVector();
+  const int lastNode = numProcs*numLocalElems;
+
+  fei::SharedPtr<fei::Solver> solver = factory.createSolver();
+  TEUCHOS_TEST_EQUALITY(solver.get() != NULL, true, out, success);
+
+  const char* solvers[4] = {"cg", "cg", "gmres", "gmres"};
+  const char* preconds[4] = {"Jacobi", "ILU0", "ILU0", "none"};
+
+  int numLocalNodes = numLocalElems+1;
+  std::vector<int> nodeIDs(numLocalNodes);
+  for(int i=0; i<numLocalNodes; ++i) nodeIDs[i] = firstElem+i;
+
+  for(int s=0; s<4; ++s) {
+    fei::ParameterSet params;
+    params.add(fei::Param("solver", solvers[s]));
+    params.add(fei::Param("preconditioner", preconds[s]));
+    params.add(fei::Param("tolerance", 1.e-10));
+    params.add(fei::Param("maxIterations", 200));
+
+    x->putScalar(0.0);
+
+    int iterations = 0, status = -1;
+    TEUCHOS_TEST_EQUALITY(solver->solve(linsys.get(), NULL, params,
+                                        iterations, status), 0, out, success);
+    TEUCHOS_TEST_EQUALITY(status, 0, out, success);
+
+    x->scatterToOverlap();
+    std::vector<double> xvals(numLocalNodes, -99.0);
+    x->copyOutFieldData(fieldID, idType, numLocalNodes,
+                        &nodeIDs[0], &xvals[0]);
+
+    for(int i=0; i<numLocalNodes; ++i) {
+      double expected = (1.0*nodeIDs[i])/lastNode;
+      TEUCHOS_TEST_EQUALITY(std::abs(xvals[i] - expected) < 1.e-8,
+                            true, out, success);
+    }
+  }
+}
+
+
+TEUCHOS_UNIT_TEST(Solver_DistCSR, Laplace1D_multiple_rhs)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+  int numProcs = fei::numProcs(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 5;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  TEUCHOS_TEST_EQUALITY(init_Laplace1D(factory, numLocalElems, mgraph), 0,
+                        out, success);
+  int fieldID = 0, idType = 0;
+  int firstElem = localProc*numLocalElems;
+
+  //three load cases in one linear-system, and each on its own.
+  const int numVectors = 3;
+  std::vector<double> loads(numVectors);
+  for(int v=0; v<numVectors; ++v) loads[v] = 1.0*v;
+
+  fei::SharedPtr<fei::LinearSystem> linsys = factory.createLinearSystem(mgraph);
+  assemble_Laplace1D(factory, mgraph, linsys, loads, numLocalElems);
+  fei::SharedPtr<fei::Vector> x = linsys->getSolutionVector();
+  TEUCHOS_TEST_EQUALITY(x->getNumVectors(), numVectors, out, success);
+
+  std::vector<fei::SharedPtr<fei::LinearSystem> > singles(numVectors);
+  for(int v=0; v<numVectors; ++v) {
+    singles[v] = factory.createLinearSystem(mgraph);
+    assemble_Laplace1D(factory, mgraph, singles[v],
+                       std::vector<double>(1, loads[v]), numLocalElems);
+  }
+
+  fei::SharedPtr<fei::Solver> solver = factory.createSolver();
+
+  int numLocalNodes = numLocalElems+1;
+  std::vector<int> nodeIDs(numLocalNodes);
+  for(int i=0; i<numLocalNodes; ++i) nodeIDs[i] = firstElem+i;
+  const int lastNode = numProcs*numLocalElems;
+
+  const char* solvers[2] = {"cg", "gmres"};
+  for(int s=0; s<2; ++s) {
+    fei::ParameterSet params;
+    params.add(fei::Param("solver", solvers[s]));
+    params.add(fei::Param("tolerance", 1.e-12));
+    params.add(fei::Param("maxIterations", 200));
+
+    x->putScalar(0.0);
+    int iterations = 0, status = -1;
+    TEUCHOS_TEST_EQUALITY(solver->solve(linsys.get(), NULL, params,
+                                        iterations, status), 0, out, success);
+    TEUCHOS_TEST_EQUALITY(status, 0, out, success);
+    x->scatterToOverlap();
+
+    for(int v=0; v<numVectors; ++v) {
+      fei::SharedPtr<fei::Vector> x1 = singles[v]->getSolutionVector();
+      x1->putScalar(0.0);
+      TEUCHOS_TEST_EQUALITY(solver->solve(singles[v].get(), NULL, params,
+                                          iterations, status), 0, out, success);
+      TEUCHOS_TEST_EQUALITY(status, 0, out, success);
+      x1->scatterToOverlap();
+
+      std::vector<double> xvals(numLocalNodes, -99.0), x1vals(numLocalNodes, -99.0);
+      x->copyOutFieldData(fieldID, idType, numLocalNodes,
+                          &nodeIDs[0], &xvals[0], v);
+      x1->copyOutFieldData(fieldID, idType, numLocalNodes,
+                           &nodeIDs[0], &x1vals[0]);
+
+      for(int i=0; i<numLocalNodes; ++i) {
+        TEUCHOS_TEST_EQUALITY(std::abs(xvals[i] - x1vals[i]) < 1.e-8,
+                              true, out, success);
+        if (v == 0) {
+          double expected = (1.0*nodeIDs[i])/lastNode;
+          TEUCHOS_TEST_EQUALITY(std::abs(xvals[i] - expected) < 1.e-8,
+                                true, out, success);
+        }
+      }
+    }
+  }
+}
+
+TEUCHOS_UNIT_TEST(Solver_DistCSR, Laplace1D_float_preconditioner)
+{
+  MPI_Comm comm = MPI_COMM_WORLD;
+  int localProc = fei::localProc(comm);
+  int numProcs = fei::numProcs(comm);
+
+  fei::Factory_DistCSR factory(comm);
+
+  const int numLocalElems = 5;
+  fei::SharedPtr<fei::MatrixGraph> mgraph;
+  TEUCHOS_TEST_EQUALITY(init_Laplace1D(factory, numLocalElems, mgraph), 0,
+                        out, success);
+  int fieldID = 0, idType = 0;
+  int firstElem = localProc*numLocalElems;
+
+  //0.1 isn't exactly representable in single precision.
+  const double stiffness = 0.1;
+  std::vector<double> loads(1, 0.0);
+
+  fei::SharedPtr<fei::LinearSystem> linsys = factory.createLinearSystem(mgraph);
+  assemble_Laplace1D(factory, mgraph, linsys, loads, numLocalElems, stiffness);
+
+  fei::ParameterSet factoryParams;
+  factoryParams.add(fei::Param("MATRIX_SCALAR_TYPE", "float"));
+  factory.parameters(factoryParams);
+
+  fei::SharedPtr<fei::LinearSystem> plinsys = factory.createLinearSystem(mgraph);
+  assemble_Laplace1D(factory, mgraph, plinsys, loads, numLocalElems, stiffness);
+
+  fei::SharedPtr<fei::Matrix> A = linsys->getMatrix();
+  fei::SharedPtr<fei::Matrix> P = plinsys->getMatrix();
+  TEUCHOS_TEST_EQUALITY(std::string(A->typeName()),
+                        std::string("fei::DistCSRMat"), out, success);
+  TEUCHOS_TEST_EQUALITY(std::string(P->typeName()),
+                        std::string("fei::DistCSRMatrix<float>"), out, success);
+
+  //contributions are summed in double and rounded once, so each entry of P
+  //is the single-precision rounding of the corresponding entry of A.
+  std::vector<fei::GlobalOrdinal> ownedEqns;
+  mgraph->getRowSpace()->getIndices_Owned(ownedEqns);
+  for(size_t i=0; i<ownedEqns.size(); ++i) {
+    int lenA = -1, lenP = -1;
+    TEUCHOS_TEST_EQUALITY(A->getRowLength(ownedEqns[i], lenA), 0, out, success);
+    TEUCHOS_TEST_EQUALITY(P->getRowLength(ownedEqns[i], lenP), 0, out, success);
+    TEUCHOS_TEST_EQUALITY(lenA, lenP, out, success);
+    if (lenA < 1 || lenA != lenP) continue;
+
+    std::vector<fei::GlobalOrdinal> indA(lenA), indP(lenP);
+    std::vector<double> coefA(lenA), coefP(lenP);
+    A->copyOutRow(ownedEqns[i], lenA, &coefA[0], &indA[0]);
+    P->copyOutRow(ownedEqns[i], lenP, &coefP[0], &indP[0]);
+    for(int j=0; j<lenA; ++j) {
+      TEUCHOS_TEST_EQUALITY(indA[j], indP[j], out, success);
+      TEUCHOS_TEST_EQUALITY(coefP[j], (double)((float)coefA[j]), out, success);
+    }
+  }
+
+  fei::SharedPtr<fei::Solver> solver = factory.createSolver();
+  fei::SharedPtr<fei::Vector> x = linsys->getSolutionVector();
+
+  int numLocalNodes = numLocalElems+1;
+  std::vector<int> nodeIDs(numLocalNodes);
+  for(int i=0; i<numLocalNodes; ++i) nodeIDs[i] = firstElem+i;
+  const int lastNode = numProcs*numLocalElems;
+
+  const char* solvers[3] = {"cg", "cg", "gmres"};
+  const char* preconds[3] = {"Jacobi", "ILU0", "ILU0"};
+  for(int s=0; s<3; ++s) {
+    fei::ParameterSet params;
+    params.add(fei::Param("solver", solvers[s]));
+    params.add(fei::Param("preconditioner", preconds[s]));
+    params.add(fei::Param("tolerance", 1.e-10));
+    params.add(fei::Param("maxIterations", 200));
+
+    x->putScalar(0.0);
+    int iterations = 0, status = -1;
+    TEUCHOS_TEST_EQUALITY(solver->solve(linsys.get(), P.get(), params,
+                                        iterations, status), 0, out, success);
+    TEUCHOS_TEST_EQUALITY(status, 0, out, success);
+
+    x->scatterToOverlap();
+    std::vector<double> xvals(numLocalNodes, -99.0);
+    x->copyOutFieldData(fieldID, idType, numLocalNodes,
+                        &nodeIDs[0], &xvals[0]);
+
+    for(int i=0; i<numLocalNodes; ++i) {
+      double expected = (1.0*nodeIDs[i])/lastNode;
+      TEUCHOS_TEST_EQUALITY(std::abs(xvals[i] - expected) < 1.e-8,
+                            true, out, success);
+    }
+  }
+
+  //a single-precision matrix can't be the linear-system's matrix.
+  int iterations = 0, status = -1;
+  fei::ParameterSet params;
+  TEUCHOS_TEST_EQUALITY(solver->solve(plinsys.get(), NULL, params,
+                                      iterations, status), -1, out, success);
+}
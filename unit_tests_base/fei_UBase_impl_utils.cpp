@@ -5,16 +5,19 @@
 #include <fei_impl_utils.hpp>
 #include <fei_FillableMat.hpp>
 #include <fei_CSVec.hpp>
+#include <fei_CSRMat.hpp>
 #include <fei_CommUtils.hpp>
 
 #include <fei_iostream.hpp>
 
 #include <cmath>
 #include <limits>
+#include <vector>
 
 namespace {
 
-bool verify_offsets(const std::vector<int>& src, const std::vector<int>& tgt,
+bool verify_offsets(const std::vector<fei::GlobalOrdinal>& src,
+                    const std::vector<fei::GlobalOrdinal>& tgt,
                     const std::vector<int>& offsets)
 {
   if (offsets.size() != src.size()) return false;
@@ -30,7 +33,8 @@ bool verify_offsets(const std::vector<int>& src, const std::vector<int>& tgt,
 
 TEUCHOS_UNIT_TEST(impl_utils, find_offsets)
 {
-  std::vector<int> s1(5), t1(5), offs1;
+  std::vector<fei::GlobalOrdinal> s1(5), t1(5);
+  std::vector<int> offs1;
 
   for(size_t i=0; i<5; ++i) {
     s1[i] = i;
@@ -67,7 +71,7 @@ TEUCHOS_UNIT_TEST(impl_utils, find_offsets)
 
   t1 = s1;
   t1.resize(t1.size()*2);
-  int val = s1[s1.size()-1];
+  fei::GlobalOrdinal val = s1[s1.size()-1];
   for(size_t i=s1.size(); i<t1.size(); ++i) t1[i] = val+i;
 
   fei::impl_utils::find_offsets(s1, t1, offs1);
@@ -106,6 +110,124 @@ TEUCHOS_UNIT_TEST(impl_utils, pack_unpack_FillableMat)
   TEUCHOS_TEST_EQUALITY(result, true, out, success);
 }
 
+TEUCHOS_UNIT_TEST(impl_utils, pack_unpack_FillableMat_large_indices)
+{
+  //rows far apart and columns on both sides of their row, near the top of
+  //the int range.
+  fei::FillableMat fm, fm2;
+  const int big = std::numeric_limits<int>::max() - 10;
+  fm.putCoef(3, 0, 3.0);
+  fm.putCoef(3, 900, 3.9);
+  fm.putCoef(70000, 69990, 7.1);
+  fm.putCoef(70000, 70001, 7.2);
+  fm.putCoef(big, 1, 8.1);
+  fm.putCoef(big, big+5, 8.2);
+
+  std::vector<char> data(fei::impl_utils::num_bytes_FillableMat(fm));
+  TEUCHOS_TEST_EQUALITY(data.size() % sizeof(double), 0u, out, success);
+  fei::impl_utils::pack_FillableMat(fm, &data[0]);
+  fei::impl_utils::unpack_FillableMat(&data[0], &data[0]+data.size(), fm2);
+
+  TEUCHOS_TEST_EQUALITY(fm == fm2, true, out, success);
+
+  fei::CSRMat csrmat;
+  fei::impl_utils::unpack_CSRMat(&data[0], &data[0]+data.size(), csrmat);
+  TEUCHOS_TEST_EQUALITY(csrmat.getGraph().rowNumbers[2], big, out, success);
+  TEUCHOS_TEST_EQUALITY(csrmat.getGraph().packedColumnIndices[5], big+5, out, success);
+  TEUCHOS_TEST_EQUALITY(csrmat.getPackedCoefs()[5], 8.2, out, success);
+}
+
+TEUCHOS_UNIT_TEST(impl_utils, encode_decode_indices)
+{
+  //64-bit indices beyond the int range, unsorted.
+  std::vector<long long> indices;
+  const long long base = 5000000000LL;
+  indices.push_back(base);
+  indices.push_back(base+1);
+  indices.push_back(base+3);
+  indices.push_back(base-200);
+  indices.push_back(0);
+  indices.push_back(9000000000000000000LL);
+
+  size_t num_bytes =
+    fei::impl_utils::num_bytes_encoded_indices(indices.size(), &indices[0], base);
+  std::vector<char> buffer(num_bytes);
+  char* end = fei::impl_utils::encode_indices(indices.size(), &indices[0],
+                                              base, &buffer[0]);
+  TEUCHOS_TEST_EQUALITY((size_t)(end - &buffer[0]), num_bytes, out, success);
+
+  std::vector<long long> decoded(indices.size());
+  const char* dend =
+    fei::impl_utils::decode_indices(&buffer[0], &buffer[0]+buffer.size(),
+                                    indices.size(), base, &decoded[0]);
+  TEUCHOS_TEST_EQUALITY(dend == end, true, out, success);
+  for(size_t i=0; i<indices.size(); ++i) {
+    TEUCHOS_TEST_EQUALITY(decoded[i], indices[i], out, success);
+  }
+
+  //the clustered indices take a byte each, whatever the index width.
+  TEUCHOS_TEST_EQUALITY(fei::impl_utils::num_bytes_encoded_indices(3,
+                                                 &indices[0], base), 3u, out, success);
+
+  //int indices decode into 64-bit ones, but not the other way around when
+  //the values don't fit.
+  int ints[3] = {100, 102, 7};
+  std::vector<char> ibuffer(fei::impl_utils::num_bytes_encoded_indices(3, ints, 0));
+  fei::impl_utils::encode_indices(3, ints, 0, &ibuffer[0]);
+  long long wide[3];
+  fei::impl_utils::decode_indices(&ibuffer[0], &ibuffer[0]+ibuffer.size(),
+                                  3, 0LL, wide);
+  TEUCHOS_TEST_EQUALITY(wide[2], 7LL, out, success);
+
+  int narrow[6];
+  bool threw = false;
+  try {
+    fei::impl_utils::decode_indices(&buffer[0], &buffer[0]+buffer.size(),
+                                    indices.size(), 0, narrow);
+  }
+  catch(std::runtime_error& exc) {
+    threw = true;
+  }
+  TEUCHOS_TEST_EQUALITY(threw, true, out, success);
+
+  //truncated data is detected.
+  threw = false;
+  try {
+    fei::impl_utils::decode_indices(&buffer[0], &buffer[0]+buffer.size()-1,
+                                    indices.size(), base, &decoded[0]);
+  }
+  catch(std::runtime_error& exc) {
+    threw = true;
+  }
+  TEUCHOS_TEST_EQUALITY(threw, true, out, success);
+}
+
+TEUCHOS_UNIT_TEST(impl_utils, copy_int_indices)
+{
+  std::vector<long long> indices;
+  indices.push_back(-3);
+  indices.push_back(0);
+  indices.push_back(std::numeric_limits<int>::max());
+
+  std::vector<int> ints;
+  fei::impl_utils::copy_int_indices(indices, ints);
+  TEUCHOS_TEST_EQUALITY(ints.size(), indices.size(), out, success);
+  for(size_t i=0; i<indices.size(); ++i) {
+    TEUCHOS_TEST_EQUALITY((long long)ints[i], indices[i], out, success);
+  }
+
+  //an index that doesn't fit in an int must not be silently truncated.
+  indices.push_back(5000000000LL);
+  bool threw = false;
+  try {
+    fei::impl_utils::copy_int_indices(indices, ints);
+  }
+  catch(std::runtime_error& exc) {
+    threw = true;
+  }
+  TEUCHOS_TEST_EQUALITY(threw, true, out, success);
+}
+
 TEUCHOS_UNIT_TEST(impl_utils, separateBCEqns)
 {
   fei::FillableMat fm;
@@ -116,7 +238,7 @@ TEUCHOS_UNIT_TEST(impl_utils, separateBCEqns)
   fm.putCoef(4, 4, 4.0);
   fm.putCoef(5, 5, 5.0);
 
-  std::vector<int> bcEqns;
+  std::vector<fei::GlobalOrdinal> bcEqns;
   std::vector<double> bcVals;
 
   fei::impl_utils::separate_BC_eqns(fm, bcEqns, bcVals);
@@ -155,7 +277,7 @@ TEUCHOS_UNIT_TEST(impl_utils, create_col_to_row_map)
   fm.putCoef(1, 1, 1.1);
   fm.putCoef(2, 2, 2.2);
 
-  std::multimap<int,int> crmap;
+  std::multimap<fei::GlobalOrdinal,fei::GlobalOrdinal> crmap;
 
   fei::impl_utils::create_col_to_row_map(fm, crmap);
 
@@ -165,7 +287,8 @@ TEUCHOS_UNIT_TEST(impl_utils, create_col_to_row_map)
   }
 
   //next make sure that the col-to-row-map indicates that col 1 appears in 2 rows.
-  typedef std::multimap<int,int>::iterator MM_Iter;
+  typedef std::multimap<fei::GlobalOrdinal,fei::GlobalOrdinal>::iterator
+    MM_Iter;
   std::pair<MM_Iter,MM_Iter> mm = crmap.equal_range(1);
   int num = 0;
   for(; mm.first!=mm.second; ++mm.first) ++num;
@@ -200,7 +323,7 @@ TEUCHOS_UNIT_TEST(impl_utils, remove_couplings)
     throw std::runtime_error("matrow 8 has wrong length");
   }
 
-  const std::vector<int>& indices = matrow->indices();
+  const std::vector<fei::GlobalOrdinal>& indices = matrow->indices();
   const std::vector<double>& coefs = matrow->coefs();
   if (indices[0] != 0 || indices[1] != 10 ||
       std::abs(coefs[0] -0.25) > 1.e-49 || std::abs(coefs[1] -0.75) > 1.e-49) {
@@ -247,5 +370,220 @@ TEUCHOS_UNIT_TEST(impl_utils, global_union_mat)
   }
 }
 
+TEUCHOS_UNIT_TEST(impl_utils, apply_essential_bcs_csr)
+{
+  //tridiagonal 5x5 matrix with 2.0 on the diagonal and -1.0 off-diagonal,
+  //stored with global column-indices.
+  fei::GlobalOrdinal rowNumbers[] = {0, 1, 2, 3, 4};
+  int rowOffsets[] = {0, 2, 5, 8, 11, 13};
+  fei::GlobalOrdinal colIndices[] = {0,1, 0,1,2, 1,2,3, 2,3,4, 3,4};
+  double coefs[13];
+  for(int i=0; i<5; ++i) {
+    for(int j=rowOffsets[i]; j<rowOffsets[i+1]; ++j) {
+      coefs[j] = colIndices[j] == rowNumbers[i] ? 2.0 : -1.0;
+    }
+  }
+
+  fei::GlobalOrdinal bcEqns[] = {0, 3};
+  double bcValues[] = {1.0, 2.0};
+  double rhsContribs[5];
+
+  fei::impl_utils::apply_essential_bcs_csr(5, rowNumbers, rowOffsets,
+                                           colIndices, coefs,
+                                           2, bcEqns, bcValues,
+                                           true, rhsContribs);
+
+  //bc rows 0 and 3 should be unit rows
+  TEUCHOS_TEST_EQUALITY(coefs[0], 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[1], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[8], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[9], 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[10], 0.0, out, success);
+
+  //columns 0 and 3 should be zero in the other rows
+  TEUCHOS_TEST_EQUALITY(coefs[2], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[3], 2.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[7], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[11], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[12], 2.0, out, success);
+
+  //rhs -= A[i,bc]*bcValue
+  TEUCHOS_TEST_EQUALITY(rhsContribs[0], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[1], 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[2], 2.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[3], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[4], 2.0, out, success);
+
+  //now the same matrix (rows 1..2 only) in local-column form, where
+  //the column-map is not sorted.
+  fei::GlobalOrdinal rowNumbers2[] = {1, 2};
+  int rowOffsets2[] = {0, 3, 6};
+  fei::GlobalOrdinal colGIDs[] = {1, 2, 0, 3};
+  int colIndices2[] = {2,0,1, 0,1,3};
+  double coefs2[] = {-1.0, 2.0, -1.0, -1.0, 2.0, -1.0};
+
+  fei::impl_utils::apply_essential_bcs_csr(2, rowNumbers2, rowOffsets2,
+                                           colIndices2, 4, colGIDs, coefs2,
+                                           2, bcEqns, bcValues,
+                                           true, rhsContribs);
+
+  TEUCHOS_TEST_EQUALITY(coefs2[0], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs2[1], 2.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs2[5], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[0], 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[1], 2.0, out, success);
+}
+
+TEUCHOS_UNIT_TEST(impl_utils, apply_essential_bcs_FillableMat)
+{
+  fei::FillableMat mat;
+  for(int i=0; i<4; ++i) {
+    mat.putCoef(i, i, 2.0);
+    if (i > 0) mat.putCoef(i, i-1, -1.0);
+    if (i < 3) mat.putCoef(i, i+1, -1.0);
+  }
+
+  fei::GlobalOrdinal bcEqns[] = {2};
+  double bcValues[] = {3.0};
+  std::vector<fei::GlobalOrdinal> rhsRows;
+  std::vector<double> rhsCoefs;
+
+  fei::impl_utils::apply_essential_bcs(mat, 1, bcEqns, bcValues, true,
+                                       rhsRows, rhsCoefs);
+
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(2), 2), 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(2), 1), 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(1), 2), 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(3), 2), 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(3), 3), 2.0, out, success);
+
+  TEUCHOS_TEST_EQUALITY((int)rhsRows.size(), 2, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsRows[0], 1, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsRows[1], 3, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsCoefs[0], 3.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsCoefs[1], 3.0, out, success);
+}
+
+TEUCHOS_UNIT_TEST(impl_utils, apply_essential_bcs_sparse_columns)
+{
+  //global columns spanning most of the int range, with the columns of the
+  //csr rows not in ascending order.
+  const int big = std::numeric_limits<int>::max() - 10;
+  fei::GlobalOrdinal rowNumbers[] = {5, 70000};
+  int rowOffsets[] = {0, 4, 7};
+  fei::GlobalOrdinal colIndices[] = {big, 5, 0, 70000,  70000, 1, big+5};
+  double coefs[] = {1.0, 2.0, 3.0, 4.0,  5.0, 6.0, 7.0};
+
+  fei::GlobalOrdinal bcEqns[] = {0, 70000, big+5};
+  double bcValues[] = {10.0, 20.0, 30.0};
+  double rhsContribs[2];
+
+  fei::impl_utils::apply_essential_bcs_csr(2, rowNumbers, rowOffsets,
+                                           colIndices, coefs,
+                                           3, bcEqns, bcValues,
+                                           true, rhsContribs);
+
+  TEUCHOS_TEST_EQUALITY(coefs[0], 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[1], 2.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[2], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[3], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[0], -110.0, out, success);
+
+  //row 70000 is a bc row
+  TEUCHOS_TEST_EQUALITY(coefs[4], 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[5], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(coefs[6], 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsContribs[1], 0.0, out, success);
+
+  fei::FillableMat mat;
+  mat.putCoef(5, 0, 3.0);
+  mat.putCoef(5, 5, 2.0);
+  mat.putCoef(5, big, 1.0);
+  mat.putCoef(5, big+5, 4.0);
+  std::vector<fei::GlobalOrdinal> rhsRows;
+  std::vector<double> rhsCoefs;
+
+  fei::impl_utils::apply_essential_bcs(mat, 3, bcEqns, bcValues, true,
+                                       rhsRows, rhsCoefs);
+
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(5), 0), 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(5), big), 1.0, out, success);
+  TEUCHOS_TEST_EQUALITY(fei::get_entry(*mat.getRow(5), big+5), 0.0, out, success);
+  TEUCHOS_TEST_EQUALITY((int)rhsRows.size(), 1, out, success);
+  TEUCHOS_TEST_EQUALITY(rhsCoefs[0], -150.0, out, success);
+}
+
+TEUCHOS_UNIT_TEST(impl_utils, csr_matvec)
+{
+  //row i has i+1 entries, so every remainder of the unrolled inner loop
+  //is exercised.
+  const int numRows = 9;
+  const int numCols = 12;
+  std::vector<int> rowOffsets(1, 0), colIndices;
+  std::vector<double> coefs;
+  for(int i=0; i<numRows; ++i) {
+    for(int j=0; j<=i; ++j) {
+      colIndices.push_back((3*j+i) % numCols);
+      coefs.push_back(0.5*(i+1) - 0.25*j);
+    }
+    rowOffsets.push_back(colIndices.size());
+  }
+
+  std::vector<double> x(numCols);
+  for(int j=0; j<numCols; ++j) x[j] = 1.0 + 0.1*j;
+
+  std::vector<double> y(numRows, 0.0);
+  fei::impl_utils::csr_matvec(numRows, &rowOffsets[0], &rowOffsets[1],
+                              &colIndices[0], &coefs[0], &x[0], false, &y[0]);
+
+  std::vector<double> y2(numRows, 1.0);
+  fei::impl_utils::csr_matvec(numRows, &rowOffsets[0], &rowOffsets[1],
+                              &colIndices[0], &coefs[0], &x[0], true, &y2[0]);
+
+  for(int i=0; i<numRows; ++i) {
+    double expected = 0.0;
+    for(int k=rowOffsets[i]; k<rowOffsets[i+1]; ++k) {
+      expected += coefs[k]*x[colIndices[k]];
+    }
+    TEUCHOS_TEST_EQUALITY(std::abs(y[i] - expected) < 1.e-13, true, out, success);
+    TEUCHOS_TEST_EQUALITY(std::abs(y2[i] - expected - 1.0) < 1.e-13, true, out, success);
+  }
+
+  //single-precision coefficients (these are exact in float), with the
+  //products summed in double.
+  std::vector<float> fcoefs(coefs.begin(), coefs.end());
+  std::vector<double> y3(numRows, 0.0);
+  fei::impl_utils::csr_matvec(numRows, &rowOffsets[0], &rowOffsets[1],
+                              &colIndices[0], &fcoefs[0], &x[0], false, &y3[0]);
+  for(int i=0; i<numRows; ++i) {
+    TEUCHOS_TEST_EQUALITY(std::abs(y3[i] - y[i]) < 1.e-13, true, out, success);
+  }
+}
+
+TEUCHOS_UNIT_TEST(impl_utils, find_row_offsets)
+{
+  int rowCols[6] = {1, 3, 4, 7, 8, 12};
+
+  //unsorted, with a repeated column.
+  int cols[5] = {8, 1, 12, 4, 8};
+  int sortOrder[5] = {1, 3, 0, 4, 2};
+  int offsets[5] = {-1, -1, -1, -1, -1};
+
+  TEUCHOS_TEST_EQUALITY(fei::impl_utils::find_row_offsets(6, rowCols, 5, cols,
+                                                          sortOrder, offsets),
+                        0, out, success);
+
+  int expected[5] = {4, 0, 5, 2, 4};
+  for(int j=0; j<5; ++j) {
+    TEUCHOS_TEST_EQUALITY(offsets[j], expected[j], out, success);
+  }
+
+  int badCols[3] = {3, 5, 7};
+  int badOrder[3] = {0, 1, 2};
+  TEUCHOS_TEST_EQUALITY(fei::impl_utils::find_row_offsets(6, rowCols, 3, badCols,
+                                                          badOrder, offsets),
+                        -1, out, success);
+}
+
 }//namespace <anonymous>
 